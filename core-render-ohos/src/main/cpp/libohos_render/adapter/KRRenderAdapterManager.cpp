@@ -18,6 +18,7 @@
 #include <sys/stat.h>
 #include "libohos_render/manager/KRArkTSManager.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
+#include "libohos_render/utils/KRPropParseCache.h"
 
 KRRenderAdapterManager &KRRenderAdapterManager::GetInstance() {
     static KRRenderAdapterManager adapter_manager;
@@ -76,6 +77,8 @@ void KRRenderAdapterManager::LogError(const std::string &tag, const std::string
 
 void KRRenderAdapterManager::RegisterColorAdapter(std::shared_ptr<IKRColorParseAdapter> color_adapter) {
     color_adapter_ = color_adapter;
+    // 注册适配器后颜色不再缓存，同时丢弃已缓存的结果
+    kuikly::util::KRPropParseCache::GetInstance().SetColorAdapterRegistered(color_adapter != nullptr);
 }
 
 void KRRenderAdapterManager::RegisterLogAdapter(std::shared_ptr<IKRLogAdapter> log_adapter) {
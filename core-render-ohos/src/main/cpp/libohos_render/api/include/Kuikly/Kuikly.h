@@ -312,6 +312,13 @@ void KRDisableViewReuse();
  */
 void KREnableTextRenderV2();
 
+/**
+ * 启用Map/Array跨kotlin桥的二进制编码（替代json序列化），需kotlin侧core支持解码。
+ * 需在创建第一个页面实例前调用，kotlin侧在首次传递JSONObject/JSONArray时读取该开关。
+ * 这是一个临时API，后续会删除，未经沟通，请勿调用。
+ */
+void KREnableBinaryRenderValue();
+
 
 #ifdef __cplusplus
 }
@@ -81,6 +81,10 @@ const char *KRAnyDataGetString(KRAnyData data) {
     if (internal == nullptr || internal->anyValue == nullptr) {
         return nullptr;
     }
+    if (internal->anyValue->isMap() || internal->anyValue->isArray()) {
+        // 开启二进制编码后 toCValue 不再是 json 字符串
+        return internal->anyValue->toString().c_str();
+    }
     return internal->anyValue->toCValue().value.stringValue;
 }
 
@@ -140,6 +144,9 @@ int KRAnyDataGetBytes(KRAnyData data, const char** value, int *size) {
     if (internal == nullptr || internal->anyValue == nullptr) {
         return KRANYDATA_NULL_INPUT;
     }
+    if (internal->anyValue->isMap() || internal->anyValue->isArray()) {
+        return KRANYDATA_TYPE_MISMATCH;
+    }
     auto cValue = internal->anyValue->toCValue();
     *value = cValue.value.bytesValue;
     *size = cValue.size; 
@@ -154,6 +161,10 @@ int KRAnyDataGetStr(KRAnyData data, const char** value) {
     if (internal == nullptr || internal->anyValue == nullptr) {
         return KRANYDATA_NULL_INPUT;
     }
+    if (internal->anyValue->isMap() || internal->anyValue->isArray()) {
+        *value = internal->anyValue->toString().c_str();
+        return KRANYDATA_SUCCESS;
+    }
     auto cValue = internal->anyValue->toCValue();
     *value = cValue.value.stringValue;
     return KRANYDATA_SUCCESS;
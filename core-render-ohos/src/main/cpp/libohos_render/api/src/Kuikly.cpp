@@ -24,6 +24,7 @@
 #include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
+#include "libohos_render/foundation/type/KRRenderValueCodec.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -342,6 +343,10 @@ int g_kuikly_disable_view_reuse = 0;
 void KRDisableViewReuse(){
     g_kuikly_disable_view_reuse = 1;
 }
+
+void KREnableBinaryRenderValue(){
+    KRRenderValueCodec::SetEnabled(true);
+}
 #ifdef __cplusplus
 }
 #endif
@@ -16,6 +16,7 @@
 #include "libohos_render/context/KRRenderNativeContextHandlerManager.h"
 
 #include "libohos_render/context/DefaultRenderNativeContextHandler.h"
+#include "libohos_render/foundation/type/KRRenderValuePool.h"
 #include "libohos_render/manager/KRRenderManager.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
 
@@ -51,29 +52,31 @@ std::shared_ptr<IKRRenderNativeContextHandler> KRRenderNativeContextHandlerManag
 
 void KRRenderNativeContextHandlerManager::RegisterContextHandler(
     const std::string &instanceId, const std::shared_ptr<IKRRenderNativeContextHandler> &contextHandler) {
-    context_handler_map_[instanceId] = contextHandler;
+    auto &table = KRInstanceTable::GetInstance();
+    table.SetContextHandler(table.Acquire(instanceId), contextHandler);
 }
 
 void KRRenderNativeContextHandlerManager::UnregisterContextHandler(const std::string &instanceId) {
-    context_handler_map_.erase(instanceId);
+    auto &table = KRInstanceTable::GetInstance();
+    table.SetContextHandler(table.Find(instanceId), nullptr);
 }
 
 void KRRenderNativeContextHandlerManager::ScheduleDeallocRenderValues(
     std::shared_ptr<KRRenderValue> will_dealloc_render_value) {
     {
         KRScopedSpinLock lock(&pending_dealloc_render_values_lock_);
-        pending_dealloc_render_values_.push_back(will_dealloc_render_value);
+        pending_dealloc_render_values_.push_back(std::move(will_dealloc_render_value));
     }
     if (!scheduling_dealloc_render_values_) {
         scheduling_dealloc_render_values_ = true;
         KRContextScheduler::ScheduleTask(false, 16, [this]() {
             // `this` is safe to be captured in the closure, because it is an singleton.
-            decltype(pending_dealloc_render_values_) values;
+            // 与待释放列表交换后清空，两个列表的容量均保留，稳态下不再重新分配
             {
                 KRScopedSpinLock lock(&pending_dealloc_render_values_lock_);
-                values.swap(pending_dealloc_render_values_);
+                flushing_dealloc_render_values_.swap(pending_dealloc_render_values_);
             }
-            
+            flushing_dealloc_render_values_.clear();
             KRRenderNativeContextHandlerManager::GetInstance().scheduling_dealloc_render_values_ = false;
         });
     }
@@ -82,18 +85,27 @@ void KRRenderNativeContextHandlerManager::ScheduleDeallocRenderValues(
 KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
     const std::string &instanceId, int methodId, const KRRenderCValue &arg0, const KRRenderCValue &arg1,
     const KRRenderCValue &arg2, const KRRenderCValue &arg3, const KRRenderCValue &arg4, const KRRenderCValue &arg5) {
-    auto handler = context_handler_map_[instanceId];
-    if (!handler || nullptr == KRRenderManager::GetInstance().GetRenderView(instanceId)) {
+    return DispatchCallNative(KRInstanceTable::GetInstance().Find(instanceId), methodId, arg0, arg1, arg2, arg3, arg4,
+                              arg5);
+}
+
+KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
+    KRInstanceHandle handle, int methodId, const KRRenderCValue &arg0, const KRRenderCValue &arg1,
+    const KRRenderCValue &arg2, const KRRenderCValue &arg3, const KRRenderCValue &arg4, const KRRenderCValue &arg5) {
+    auto &table = KRInstanceTable::GetInstance();
+    auto handler = table.GetContextHandler(handle);
+    if (!handler || !table.HasRenderView(handle)) {
         auto cv = KRRenderCValue();
         cv.type = KRRenderCValue::NULL_VALUE;
         return cv;
     }
-    auto cv0 = std::make_shared<KRRenderValue>(arg0);
-    auto cv1 = std::make_shared<KRRenderValue>(arg1);
-    auto cv2 = std::make_shared<KRRenderValue>(arg2);
-    auto cv3 = std::make_shared<KRRenderValue>(arg3);
-    auto cv4 = std::make_shared<KRRenderValue>(arg4);
-    auto cv5 = std::make_shared<KRRenderValue>(arg5);
+    // 参数从线程内复用池获取，调用结束且未被业务持有时即可被下次调用复用
+    auto cv0 = KRRenderValuePool::Acquire(arg0);
+    auto cv1 = KRRenderValuePool::Acquire(arg1);
+    auto cv2 = KRRenderValuePool::Acquire(arg2);
+    auto cv3 = KRRenderValuePool::Acquire(arg3);
+    auto cv4 = KRRenderValuePool::Acquire(arg4);
+    auto cv5 = KRRenderValuePool::Acquire(arg5);
 
     auto return_value =
         handler->OnCallNative(static_cast<KuiklyRenderNativeMethod>(methodId), cv0, cv1, cv2, cv3, cv4, cv5);
@@ -102,6 +114,7 @@ KRRenderCValue KRRenderNativeContextHandlerManager::DispatchCallNative(
         null_return_value.type = KRRenderCValue::NULL_VALUE;
         return null_return_value;
     }
-    ScheduleDeallocRenderValues(return_value);
-    return return_value->toCValue();
+    auto c_value = return_value->toCValue();
+    ScheduleDeallocRenderValues(std::move(return_value));
+    return c_value;
 }
@@ -21,6 +21,7 @@
 #include "libohos_render/context/IKRRenderNativeContextHandler.h"
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/foundation/type/KRRenderValue.h"
+#include "libohos_render/manager/KRInstanceTable.h"
 #include "libohos_render/utils/KRScopedSpinLock.h"
 
 class KRRenderNativeContextHandlerManager {
@@ -40,6 +41,10 @@ class KRRenderNativeContextHandlerManager {
                                       const KRRenderCValue &arg1, const KRRenderCValue &arg2,
                                       const KRRenderCValue &arg3, const KRRenderCValue &arg4,
                                       const KRRenderCValue &arg5);
+    KRRenderCValue DispatchCallNative(KRInstanceHandle handle, int methodId, const KRRenderCValue &arg0,
+                                      const KRRenderCValue &arg1, const KRRenderCValue &arg2,
+                                      const KRRenderCValue &arg3, const KRRenderCValue &arg4,
+                                      const KRRenderCValue &arg5);
     static KRRenderNativeContextHandlerManager &GetInstance() {
         static KRRenderNativeContextHandlerManager m_instance;  // 局部静态变量
         return m_instance;
@@ -58,10 +63,10 @@ class KRRenderNativeContextHandlerManager {
     void ScheduleDeallocRenderValues(std::shared_ptr<KRRenderValue> will_dealloc_render_value);
 
  private:
-    std::unordered_map<std::string, std::shared_ptr<IKRRenderNativeContextHandler>> context_handler_map_;
     KRRenderContextHandlerCreator creator_;
     bool scheduling_dealloc_render_values_ = false;
     std::vector<std::shared_ptr<KRRenderValue>> pending_dealloc_render_values_;
+    std::vector<std::shared_ptr<KRRenderValue>> flushing_dealloc_render_values_;  // 仅在释放任务中访问
     KRSpinLock pending_dealloc_render_values_lock_;
 
     static KRRenderNativeContextHandlerManager *instance_;
@@ -17,9 +17,14 @@
 
 #include <functional>
 #include <memory>
+#include "libohos_render/foundation/KRPropKeys.h"
 #include "libohos_render/foundation/KRRect.h"
+#include "libohos_render/foundation/type/KRRenderValueCodec.h"
+#include "libohos_render/foundation/type/KRRenderValuePool.h"
 #include "libohos_render/layer/KRRenderLayerHandler.h"
+#include "libohos_render/context/KRRenderNativeContextHandlerManager.h"
 #include "libohos_render/manager/KRArkTSManager.h"
+#include "libohos_render/manager/KRInstanceTable.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/view/KRRenderView.h"
@@ -29,8 +34,10 @@ EXTERN_C_START
 const KRRenderCValue com_tencent_kuikly_CallNative(int methodId, KRRenderCValue arg0, KRRenderCValue arg1,
                                                    KRRenderCValue arg2, KRRenderCValue arg3, KRRenderCValue arg4,
                                                    KRRenderCValue arg5) {
-    return IKRRenderNativeContextHandler::DispatchCallNative(std::string(arg0.value.stringValue), methodId, arg0, arg1,
-                                                             arg2, arg3, arg4, arg5);
+    // 通过线程内缓存将实例 id 解析为句柄，避免每次调用构造 std::string 并查表
+    auto handle = KRInstanceTable::GetInstance().Resolve(arg0.value.stringValue);
+    return KRRenderNativeContextHandlerManager::GetInstance().DispatchCallNative(handle, methodId, arg0, arg1, arg2,
+                                                                                 arg3, arg4, arg5);
 }
 
 CallKotlin callKotlin_;
@@ -47,6 +54,11 @@ void com_tencent_kuikly_ScheduleContextTask(const char *pagerId, void (*onSchedu
 bool com_tencent_kuikly_IsCurrentOnContextThread(const char *pagerId) {
     return KRContextScheduler::IsCurrentOnContextThread();
 }
+
+// kotlin 侧通过 dlsym 查询，旧版本 render 没有该符号时 kotlin 侧按未开启处理
+int com_tencent_kuikly_BinaryRenderValueEnabled() {
+    return KRRenderValueCodec::IsEnabled() ? 1 : 0;
+}
 EXTERN_C_END
 
 /**
@@ -59,8 +71,8 @@ static constexpr int kSyncCallbackMask = 1;
 static constexpr int kCallbackKeepAliveMask = 2;
 
 /** 任务在context线程中执行 */
-static void PerformTaskOnContextQueue(bool isSync, int delayMs, const KRSchedulerTask &task) {
-    KRContextScheduler::ScheduleTask(isSync, delayMs, task);
+static KRTimerId PerformTaskOnContextQueue(bool isSync, int delayMs, const KRSchedulerTask &task) {
+    return KRContextScheduler::ScheduleTask(isSync, delayMs, task);
 }
 
 KRRenderCore::KRRenderCore(std::weak_ptr<IKRRenderView> renderView, std::shared_ptr<KRRenderContextParams> context)
@@ -151,6 +163,7 @@ std::shared_ptr<IKRRenderModuleExport> KRRenderCore::GetModuleOrCreate(const std
 }
 
 void KRRenderCore::WillDealloc(const std::string &instanceId) {
+    CancelPendingTimeouts();
     contextHandler_->WillDestroy();
     renderLayerHandler_->WillDestroy();
     auto self = shared_from_this();
@@ -171,6 +184,14 @@ void KRRenderCore::OnDestroy() {
     renderLayerHandler_->OnDestroy();
 }
 
+void KRRenderCore::CancelPendingTimeouts() {
+    std::lock_guard<std::mutex> lock(timeoutMutex_);
+    for (auto id : pendingTimeouts_) {
+        KRContextScheduler::CancelTask(id);
+    }
+    pendingTimeouts_.clear();
+}
+
 void KRRenderCore::AddTaskToMainQueueWithTask(const KRSchedulerTask &task) {
     uiScheduler_->AddTaskToMainQueueWithTask(task);
 }
@@ -200,6 +221,9 @@ KRRenderCore::OnCallNative(const KuiklyRenderNativeMethod &method, std::shared_p
         if (!uiScheduler_) {
             return defaultNullValue_;
         }
+        if (RecordNativeCommand(method, arg1, arg2, arg3, arg4, arg5)) {
+            return defaultNullValue_;
+        }
         std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
         uiScheduler_->AddTaskToMainQueueWithTask([weakSelf, method, arg1, arg2, arg3, arg4, arg5] {
             if (auto locked = weakSelf.lock()) {
@@ -210,6 +234,79 @@ KRRenderCore::OnCallNative(const KuiklyRenderNativeMethod &method, std::shared_p
     return defaultNullValue_;
 }
 
+bool KRRenderCore::RecordNativeCommand(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1,
+                                       const KRAnyValue &arg2, const KRAnyValue &arg3, const KRAnyValue &arg4,
+                                       const KRAnyValue &arg5) {
+    switch (method) {
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCreateRenderView: {
+        uiScheduler_->RecordCommands(
+            [&](KRRenderCommandBuffer &commands) { commands.CreateView(arg1->toInt(), arg2->toString()); });
+        return true;
+    }
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodRemoveRenderView: {
+        uiScheduler_->RecordCommands([&](KRRenderCommandBuffer &commands) { commands.RemoveView(arg1->toInt()); });
+        return true;
+    }
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodInsertSubRenderView: {
+        uiScheduler_->RecordCommands([&](KRRenderCommandBuffer &commands) {
+            commands.InsertSubView(arg1->toInt(), arg2->toInt(), arg3->toInt());
+        });
+        return true;
+    }
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetViewProp: {
+        if (arg4->toInt() == 1) {  // 事件需构造回调闭包
+            return false;
+        }
+        const auto &prop_key = arg2->toString();
+        auto prop_id = KRPropKeys::IdOf(prop_key);
+        uiScheduler_->RecordCommands(
+            [&](KRRenderCommandBuffer &commands) { commands.SetProp(arg1->toInt(), prop_id, prop_key, arg3); });
+        return true;
+    }
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetRenderViewFrame: {
+        auto rect = KRRect(arg2->toFloat(), arg3->toFloat(), arg4->toFloat(), arg5->toFloat());
+        uiScheduler_->RecordCommands([&](KRRenderCommandBuffer &commands) { commands.SetFrame(arg1->toInt(), rect); });
+        return true;
+    }
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallViewMethod: {
+        auto callback = MakeFireCallback(arg4);
+        uiScheduler_->RecordCommands([&](KRRenderCommandBuffer &commands) {
+            commands.CallViewMethod(arg1->toInt(), arg2->toString(), arg3, std::move(callback));
+        });
+        return true;
+    }
+    case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallModuleMethod: {
+        auto callback = MakeFireCallback(arg4);
+        auto callback_keep_alive = callback != nullptr && IsCallbackKeepAlive(arg5);
+        uiScheduler_->RecordCommands([&](KRRenderCommandBuffer &commands) {
+            commands.CallModuleMethod(arg1->toString(), arg2->toString(), arg3, std::move(callback),
+                                      callback_keep_alive);
+        });
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+KRRenderCallback KRRenderCore::MakeFireCallback(const KRAnyValue &callback_id) {
+    if (callback_id->toString().empty()) {
+        return nullptr;
+    }
+    std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
+    return [weakSelf, callback_id](KRAnyValue res) {
+        if (auto locked = weakSelf.lock()) {
+            PerformTaskOnContextQueue(false, 0, [weakSelf, callback_id, res] {
+                if (auto locked = weakSelf.lock()) {
+                    locked->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback,
+                                             callback_id, res, locked->defaultNullValue_, locked->defaultNullValue_,
+                                             locked->defaultNullValue_);
+                }
+            });
+        }
+    };
+}
+
 // 判断事件是否需要同步调用
 bool KRRenderCore::ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5) {
     if (method == KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallModuleMethod) {
@@ -264,9 +361,11 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
                     }
                 }
             };
-            renderLayerHandler_->SetEvent(arg1->toInt(), arg2->toString(), callback);
+            const auto &prop_key = arg2->toString();
+            renderLayerHandler_->SetEvent(arg1->toInt(), KRPropKeys::IdOf(prop_key), prop_key, callback);
         } else {
-            renderLayerHandler_->SetProp(arg1->toInt(), arg2->toString(), arg3);
+            const auto &prop_key = arg2->toString();
+            renderLayerHandler_->SetProp(arg1->toInt(), KRPropKeys::IdOf(prop_key), prop_key, arg3);
         }
         break;
     }
@@ -275,7 +374,7 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
         auto rect = KRRect(arg2->toFloat(), arg3->toFloat(), arg4->toFloat(), arg5->toFloat());
         std::string rectData((const char *)&rect, sizeof(KRRect));
         auto value = std::make_shared<KRRenderValue>(rectData);
-        renderLayerHandler_->SetProp(arg1->toInt(), "frame", value);
+        renderLayerHandler_->SetProp(arg1->toInt(), kPropKeyFrame, "frame", value);
         break;
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCalculateRenderViewSize: {
@@ -283,44 +382,12 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
         return std::make_shared<KRRenderValue>(sizeStr);
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallViewMethod: {
-        auto callbackId = arg4->toString();
-        KRRenderCallback callback = nullptr;
-        if (!callbackId.empty()) {
-            std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-            callback = [weakSelf, arg4](KRAnyValue res) {
-                if (auto locked = weakSelf.lock()) {
-                    PerformTaskOnContextQueue(false, 0, [weakSelf, arg4, res] {
-                        if (auto locked = weakSelf.lock()) {
-                            locked->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg4,
-                                                     res, locked->defaultNullValue_, locked->defaultNullValue_,
-                                                     locked->defaultNullValue_);
-                        }
-                    });
-                }
-            };
-        }
-        renderLayerHandler_->CallViewMethod(arg1->toInt(), arg2->toString(), arg3, callback);
+        renderLayerHandler_->CallViewMethod(arg1->toInt(), arg2->toString(), arg3, MakeFireCallback(arg4));
         break;
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodCallModuleMethod: {
-        auto callbackId = arg4->toString();
-        KRRenderCallback callback = nullptr;
-        auto callback_keep_alive = false;
-        if (!callbackId.empty()) {
-            callback_keep_alive = IsCallbackKeepAlive(arg5);
-            std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-            callback = [weakSelf, arg4](KRAnyValue res) {
-                if (auto locked = weakSelf.lock()) {
-                    PerformTaskOnContextQueue(false, 0, [weakSelf, arg4, res] {
-                        if (auto locked = weakSelf.lock()) {
-                            locked->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg4,
-                                                     res, locked->defaultNullValue_, locked->defaultNullValue_,
-                                                     locked->defaultNullValue_);
-                        }
-                    });
-                }
-            };
-        }
+        auto callback = MakeFireCallback(arg4);
+        auto callback_keep_alive = callback != nullptr && IsCallbackKeepAlive(arg5);
         return renderLayerHandler_->CallModuleMethod(sync, arg1->toString(), arg2->toString(), arg3, callback,
                                                      callback_keep_alive);
     }
@@ -358,13 +425,21 @@ KRAnyValue KRRenderCore::PerformNativeCallback(const KuiklyRenderNativeMethod &m
     }
     case KuiklyRenderNativeMethod::KuiklyRenderNativeMethodSetTimeout: {
         std::weak_ptr<KRRenderCore> weakSelf = shared_from_this();
-        PerformTaskOnContextQueue(false, arg1->toInt() > 0 ? arg1->toInt() : 1, [weakSelf, arg2] {
+        auto timerId = std::make_shared<KRTimerId>(0);
+        // 持锁到记录完 id，保证触发时能移除对应的 id
+        std::lock_guard<std::mutex> timeoutLock(timeoutMutex_);
+        *timerId = PerformTaskOnContextQueue(false, arg1->toInt() > 0 ? arg1->toInt() : 1, [weakSelf, arg2, timerId] {
             if (auto lock = weakSelf.lock()) {
+                {
+                    std::lock_guard<std::mutex> timeoutLock(lock->timeoutMutex_);
+                    lock->pendingTimeouts_.erase(*timerId);
+                }
                 auto nullValue = lock->defaultNullValue_;
                 lock->CallKotlinMethod(KuiklyRenderContextMethod::KuiklyRenderContextMethodFireCallback, arg2, nullValue,
                                        nullValue, nullValue, nullValue);
             }
         });
+        pendingTimeouts_.insert(*timerId);
         break;
     }
 
@@ -398,10 +473,32 @@ void KRRenderCore::WillPerformUITasksWithScheduler() {  // 运行在 context 线
                      defaultNullValue_, defaultNullValue_, defaultNullValue_);
 }
 
+std::shared_ptr<IKRRenderLayer> KRRenderCore::GetRenderLayer() {  // 运行在主线程
+    return renderLayerHandler_;
+}
+
+void KRRenderCore::WillRunMainQueueTasks() {  // 运行在主线程
+    if (auto rootview = renderView_.lock()) {
+        if (auto performance_manager = rootview->GetPerformanceManager()) {
+            performance_manager->OnUITasksWillPerform();
+        }
+    }
+}
+
+void KRRenderCore::DidRunMainQueueTasks() {  // 运行在主线程
+    if (auto rootview = renderView_.lock()) {
+        if (auto performance_manager = rootview->GetPerformanceManager()) {
+            performance_manager->OnUITasksDidPerform();
+        }
+    }
+}
+
 void KRRenderCore::CallKotlinMethod(const KuiklyRenderContextMethod &method, const KRAnyValue &arg1, const KRAnyValue &arg2,
                                     const KRAnyValue &arg3, const KRAnyValue &arg4, const KRAnyValue &arg5) {
-    auto arg0 = std::make_shared<KRRenderValue>(context_->InstanceId());
-    contextHandler_->Call(method, arg0, arg1, arg2, arg3, arg4, arg5);
+    // 主线程与 context 线程都会调用，实例 id 取自当前线程的复用池，各线程不共享同一对象的惰性缓存
+    const auto &instance_id = context_->InstanceId();
+    auto instance_id_value = KRRenderValuePool::AcquireString(instance_id.data(), instance_id.size());
+    contextHandler_->Call(method, instance_id_value, arg1, arg2, arg3, arg4, arg5);
 }
 
 void KRRenderCore::notifyInitState(KRInitState state) {
@@ -19,6 +19,8 @@
 /**
  * 负责渲染流程核心逻辑模块。
  */
+#include <mutex>
+#include <unordered_set>
 #include "libohos_render/context/IKRRenderNativeContextHandler.h"
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
@@ -65,6 +67,9 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
                  std::shared_ptr<KRRenderValue> &arg5) override;
     /** KRRenderUISchedulerDelegate interface override */
     void WillPerformUITasksWithScheduler() override;
+    void WillRunMainQueueTasks() override;
+    void DidRunMainQueueTasks() override;
+    std::shared_ptr<IKRRenderLayer> GetRenderLayer() override;
     /** core初始化之后必须调用该DidInit进行初始化 */
     void DidInit();
     /**
@@ -134,6 +139,9 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     std::shared_ptr<KRRenderValue> defaultNullValue_;
     /** 正在从主线程同步任务到context线程 */
     bool syncingPerformTaskMainThreadToContextThread = false;
+    /** 尚未触发的 setTimeout 定时器，页面销毁时取消 */
+    std::mutex timeoutMutex_;
+    std::unordered_set<KRTimerId> pendingTimeouts_;
 
     /** callback 是否为同步方法 */
     bool IsSyncCallback(const KRAnyValue &params);
@@ -146,8 +154,15 @@ class KRRenderCore : public std::enable_shared_from_this<KRRenderCore>,
     KRAnyValue PerformNativeCallback(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1, const KRAnyValue &arg2,
                                      const KRAnyValue &arg3, const KRAnyValue &arg4, const KRAnyValue &arg5, bool sync);
     bool ShouldSyncCallMethod(const KuiklyRenderNativeMethod &method, std::shared_ptr<KRRenderValue> &arg5);
+    /** 可编码的 UI 操作写入命令缓冲区，返回 false 表示需走闭包任务 */
+    bool RecordNativeCommand(const KuiklyRenderNativeMethod &method, const KRAnyValue &arg1, const KRAnyValue &arg2,
+                             const KRAnyValue &arg3, const KRAnyValue &arg4, const KRAnyValue &arg5);
+    /** 构造回调到 kotlin 侧 callbackId 的回调，callbackId 为空时返回 nullptr */
+    KRRenderCallback MakeFireCallback(const KRAnyValue &callback_id);
 
     void OnDestroy();
+    /** 取消所有尚未触发的 setTimeout */
+    void CancelPendingTimeouts();
 };
 
 #endif  // CORE_RENDER_OHOS_KRRenderCore_H
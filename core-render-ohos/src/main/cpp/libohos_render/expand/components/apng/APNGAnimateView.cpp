@@ -59,9 +59,11 @@ void APNGAnimateView::Destroy() {
 
 APNGAnimateView::~APNGAnimateView() {
     Destroy();
-    KRGCDQueue::GetInstance().DispatchAsync([apng = apng_] {
-        apng->width;  // sub thread gc
-    });
+    KRGCDQueue::GetInstance().DispatchAsync(
+        [apng = apng_, player = player_, drawable = current_drawable_] {
+            // sub thread gc
+        },
+        KRTaskPriority::kPrefetch);
 }
 
 void APNGAnimateView::SetAutoPlay(bool auto_play) {
@@ -89,6 +91,9 @@ void APNGAnimateView::Play() {
     auto_play_ = true;
     if (apng_) {
         if (play_timeout_flag_ == -1) {
+            if (player_) {
+                player_->Resume();
+            }
             PlayNextFrame();
         }
     }
@@ -99,6 +104,9 @@ void APNGAnimateView::Stop() {
     play_timeout_flag_ = -1;
     current_frame_index_ = -1;
     did_play_loop_count_ = 0;
+    if (player_) {
+        player_->Reset();
+    }
 }
 
 void APNGAnimateView::SetFrame(KRRect parent_frame) {
@@ -109,6 +117,7 @@ void APNGAnimateView::SetFrame(KRRect parent_frame) {
 void APNGAnimateView::LoadSuccess(std::shared_ptr<APNG> apng) {
     // 开始播放
     apng_ = apng;
+    player_ = std::make_shared<APNGPlayer>(apng);
     SyncAutoPlayIfNeed();
     if (animation_start_callback_) {
         animation_start_callback_();
@@ -123,28 +132,16 @@ void APNGAnimateView::LoadFailure() {
 }
 
 void APNGAnimateView::PlayNextFrame() {
-    if (apng_->frames.size() == 0) {
+    if (apng_->frames.size() == 0 || !player_) {
         return;
     }
     bool need_play_next_frame = true;
 
-    std::shared_ptr<APNGDrawable> apngDrawable = apng_->GetDrawable(current_frame_index_ + 1);
+    std::shared_ptr<APNGDrawable> apngDrawable = player_->TakeNextDrawable();
     if (apngDrawable == nullptr) {
-        if (!(apng_->IsParsing())) {  // 说明最后一个了
-            did_play_loop_count_ += 1;
-            if (did_play_loop_count_ < repeat_count_) {
-                current_frame_index_ = 0;
-                apngDrawable = apng_->GetDrawable(current_frame_index_);
-            } else {
-                need_play_next_frame = false;
-            }
-        } else {  // 还在解析 延迟等待
-            need_play_next_frame = true;
-        }
-    } else {
-        current_frame_index_ += 1;
-    }
-    if (apngDrawable && apngDrawable->isLast && did_play_loop_count_ + 1 >= repeat_count_) {
+        // 还在解码 延迟等待；没有任何可播放帧时结束
+        need_play_next_frame = !player_->IsFailed();
+    } else if (apngDrawable->isLast && did_play_loop_count_ + 1 >= repeat_count_) {
         need_play_next_frame = false;
     }
 
@@ -155,7 +152,13 @@ void APNGAnimateView::PlayNextFrame() {
         // 播放结束
         return;
     }
-    UpdateCurrentFrameToRender(apngDrawable);
+    if (apngDrawable) {
+        current_frame_index_ = apngDrawable->frameIndex;
+        if (apngDrawable->isLast) {
+            did_play_loop_count_ += 1;
+        }
+        UpdateCurrentFrameToRender(apngDrawable);
+    }
     int delay = 16;
     if (apngDrawable) {
         delay = apngDrawable->nextFrameDelay / speed_rate_;
@@ -177,6 +180,8 @@ void APNGAnimateView::PlayNextFrame() {
 void APNGAnimateView::UpdateCurrentFrameToRender(std::shared_ptr<APNGDrawable> apngDrawable) {
     if (apngDrawable && apngDrawable->drawable) {
         kuikly::util::SetArkUIImageSrc(image_node_, apngDrawable->drawable);
+        // 持有到被下一帧替换，避免正在显示的 drawable 被释放
+        current_drawable_ = apngDrawable;
     }
 }
 
@@ -0,0 +1,157 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGBlend.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define APNG_BLEND_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define APNG_BLEND_SSE2 1
+#endif
+
+// x / 255 四舍五入，x <= 255 * 255
+static inline uint32_t Div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+void APNGBlendRowSourceScalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i, src += 4, dst += 4) {
+        uint32_t a = src[3];
+        dst[0] = static_cast<uint8_t>(Div255(src[0] * a));
+        dst[1] = static_cast<uint8_t>(Div255(src[1] * a));
+        dst[2] = static_cast<uint8_t>(Div255(src[2] * a));
+        dst[3] = static_cast<uint8_t>(a);
+    }
+}
+
+void APNGBlendRowOverScalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; ++i, src += 4, dst += 4) {
+        uint32_t a = src[3];
+        if (a == 0) {
+            continue;
+        }
+        uint32_t inv = 255 - a;
+        dst[0] = static_cast<uint8_t>(Div255(src[0] * a) + Div255(dst[0] * inv));
+        dst[1] = static_cast<uint8_t>(Div255(src[1] * a) + Div255(dst[1] * inv));
+        dst[2] = static_cast<uint8_t>(Div255(src[2] * a) + Div255(dst[2] * inv));
+        dst[3] = static_cast<uint8_t>(a + Div255(dst[3] * inv));
+    }
+}
+
+#if defined(APNG_BLEND_NEON)
+
+// 与标量 Div255 相同的公式：t = x + 128，(t + (t >> 8)) >> 8
+static inline uint8x8_t Div255x8(uint16x8_t x) {
+    uint16x8_t t = vaddq_u16(x, vdupq_n_u16(128));
+    return vshrn_n_u16(vsraq_n_u16(t, t, 8), 8);
+}
+
+void APNGBlendRowSource(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint8x8x4_t s = vld4_u8(src + i * 4);
+        uint8x8x4_t out;
+        out.val[0] = Div255x8(vmull_u8(s.val[0], s.val[3]));
+        out.val[1] = Div255x8(vmull_u8(s.val[1], s.val[3]));
+        out.val[2] = Div255x8(vmull_u8(s.val[2], s.val[3]));
+        out.val[3] = s.val[3];
+        vst4_u8(dst + i * 4, out);
+    }
+    APNGBlendRowSourceScalar(dst + i * 4, src + i * 4, count - i);
+}
+
+void APNGBlendRowOver(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint8x8x4_t s = vld4_u8(src + i * 4);
+        uint8x8x4_t d = vld4_u8(dst + i * 4);
+        uint8x8_t a = s.val[3];
+        uint8x8_t inv = vmvn_u8(a);
+        uint8x8x4_t out;
+        out.val[0] = vadd_u8(Div255x8(vmull_u8(s.val[0], a)), Div255x8(vmull_u8(d.val[0], inv)));
+        out.val[1] = vadd_u8(Div255x8(vmull_u8(s.val[1], a)), Div255x8(vmull_u8(d.val[1], inv)));
+        out.val[2] = vadd_u8(Div255x8(vmull_u8(s.val[2], a)), Div255x8(vmull_u8(d.val[2], inv)));
+        out.val[3] = vadd_u8(a, Div255x8(vmull_u8(d.val[3], inv)));
+        vst4_u8(dst + i * 4, out);
+    }
+    APNGBlendRowOverScalar(dst + i * 4, src + i * 4, count - i);
+}
+
+#elif defined(APNG_BLEND_SSE2)
+
+// 与标量 Div255 相同的公式，x <= 255 * 255 时 16 位不会溢出
+static inline __m128i Div255x8(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// 每个像素的 alpha 广播到该像素的 4 个通道（16 位）
+static inline __m128i BroadcastAlpha(__m128i v) {
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_shufflehi_epi16(v, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// 两个像素（16 位）预乘，alpha 通道保持不变
+static inline __m128i Premultiply(__m128i s) {
+    const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    __m128i a = BroadcastAlpha(s);
+    a = _mm_or_si128(_mm_andnot_si128(alphaMask, a), _mm_and_si128(alphaMask, _mm_set1_epi16(255)));
+    return Div255x8(_mm_mullo_epi16(s, a));
+}
+
+static inline __m128i Over(__m128i s, __m128i d) {
+    __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), BroadcastAlpha(s));
+    return _mm_add_epi16(Premultiply(s), Div255x8(_mm_mullo_epi16(d, inv)));
+}
+
+void APNGBlendRowSource(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 4));
+        __m128i lo = Premultiply(_mm_unpacklo_epi8(s, zero));
+        __m128i hi = Premultiply(_mm_unpackhi_epi8(s, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), _mm_packus_epi16(lo, hi));
+    }
+    APNGBlendRowSourceScalar(dst + i * 4, src + i * 4, count - i);
+}
+
+void APNGBlendRowOver(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 4));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<__m128i *>(dst + i * 4));
+        __m128i lo = Over(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+        __m128i hi = Over(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 4), _mm_packus_epi16(lo, hi));
+    }
+    APNGBlendRowOverScalar(dst + i * 4, src + i * 4, count - i);
+}
+
+#else
+
+void APNGBlendRowSource(uint8_t *dst, const uint8_t *src, size_t count) {
+    APNGBlendRowSourceScalar(dst, src, count);
+}
+
+void APNGBlendRowOver(uint8_t *dst, const uint8_t *src, size_t count) {
+    APNGBlendRowOverScalar(dst, src, count);
+}
+
+#endif
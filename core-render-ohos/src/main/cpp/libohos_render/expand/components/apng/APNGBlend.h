@@ -0,0 +1,45 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_APNGBLEND_H
+#define CORE_RENDER_OHOS_APNGBLEND_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * APNG 帧合成的行处理函数，整数运算，NEON/SSE2 可用时向量化，否则走标量实现
+ * - src 为解码得到的 RGBA_8888 非预乘像素
+ * - dst 为 RGBA_8888 预乘画布，原地写入
+ * 各实现结果逐位一致
+ */
+
+/**
+ * APNG_BLEND_OP_SOURCE：dst = premultiply(src)
+ */
+void APNGBlendRowSource(uint8_t *dst, const uint8_t *src, size_t count);
+
+/**
+ * APNG_BLEND_OP_OVER：dst = premultiply(src) + dst * (1 - src.a)
+ */
+void APNGBlendRowOver(uint8_t *dst, const uint8_t *src, size_t count);
+
+/**
+ * 标量实现，供向量实现处理行尾以及校验使用
+ */
+void APNGBlendRowSourceScalar(uint8_t *dst, const uint8_t *src, size_t count);
+void APNGBlendRowOverScalar(uint8_t *dst, const uint8_t *src, size_t count);
+
+#endif  // CORE_RENDER_OHOS_APNGBLEND_H
@@ -31,31 +31,13 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
-#include "libohos_render/expand/components/apng/ApngParser.h"
+#include "libohos_render/expand/components/apng/APNGStructs.h"
 #include "libohos_render/expand/modules/log/KRLogModule.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/foundation/thread/KRGCDQueue.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRViewUtil.h"
 
-bool ReadFileToBuffer(const std::string &filePath, std::vector<uint8_t> &buffer) {
-    FILE *file = fopen(filePath.c_str(), "rb");
-    if (!file) {
-        return false;
-    }
-
-    fseek(file, 0, SEEK_END);
-    std::int32_t fileSize = ftell(file);
-    if (fileSize != -1) {
-        fseek(file, 0, SEEK_SET);
-        buffer.resize(fileSize);
-        fread(buffer.data(), 1, fileSize, file);
-    }
-    fclose(file);
-
-    return true;
-}
-
 /**
  * 异步获取 APNG（动画便携式网络图形）文件，并在完成时调用完成回调函数。
  *
@@ -98,46 +80,43 @@ void FetchAPNG(const std::string &filePath, std::function<void(std::shared_ptr<A
     }
     auto start = std::chrono::steady_clock::now();
     KRGCDQueue::GetInstance().DispatchAsync([filePath, start]() {
-        std::vector<uint8_t> buffer;
-        bool res = ReadFileToBuffer(filePath, buffer);
-        auto end0 = std::chrono::steady_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end0 - start);
+        // 只解析控制块，帧数据在播放时按需读取
+        auto apng = APNG::ParseFromFile(filePath);
+        auto end = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        bool isValidApng = apng && apng->isAPNG && apng->frames.size();
+        KR_LOG_INFO << "parse apng cost time:" << duration.count();
+        KRMainThread::RunOnMainThread([filePath, apng, isValidApng] {
+            auto it = pendingRequests.find(filePath);
+            if (it != pendingRequests.end()) {
+                std::vector<std::function<void(std::shared_ptr<APNG>)>> completions = std::move(it->second);
+                pendingRequests.erase(it);
 
-        parseAPNG(buffer, [end0, duration, filePath](std::shared_ptr<APNG> apng) {
-            auto end1 = std::chrono::steady_clock::now();
-            auto duration1 = std::chrono::duration_cast<std::chrono::milliseconds>(end1 - end0);
-            bool isValidApng = apng && apng->isAPNG && apng->frames.size();
-            KR_LOG_INFO << "ReadFileToBuffer cost time:" << (duration).count() << " parse apng c:" << duration1.count();
-            KRMainThread::RunOnMainThread([filePath, apng, isValidApng] {
-                auto it = pendingRequests.find(filePath);
-                if (it != pendingRequests.end()) {
-                    std::vector<std::function<void(std::shared_ptr<APNG>)>> completions = std::move(it->second);
-                    pendingRequests.erase(it);
-
-                    if (isValidApng) {
-                        apngCache[filePath] = apng;
-                        // 设置缓存过期时间为1分钟
-                        KRMainThread::RunOnMainThread(
-                            [filePath, apng] {
-                                KRGCDQueue::GetInstance().DispatchAsync([apng] {
+                if (isValidApng) {
+                    apngCache[filePath] = apng;
+                    // 设置缓存过期时间为1分钟
+                    KRMainThread::RunOnMainThread(
+                        [filePath, apng] {
+                            KRGCDQueue::GetInstance().DispatchAsync(
+                                [apng] {
                                     apng->width;  // sub thread release
-                                });
-                                apngCache.erase(filePath);
-                            },
-                            10 * 60000);
-                    }
+                                },
+                                KRTaskPriority::kPrefetch);
+                            apngCache.erase(filePath);
+                        },
+                        10 * 60000);
+                }
 
-                    for (const auto &completion : completions) {
-                        if (isValidApng) {
-                            // 加载成功
-                            completion(apng);
-                        } else {
-                            // 播放失败
-                            completion(nullptr);
-                        }
+                for (const auto &completion : completions) {
+                    if (isValidApng) {
+                        // 加载成功
+                        completion(apng);
+                    } else {
+                        // 播放失败
+                        completion(nullptr);
                     }
                 }
-            });
+            }
         });
     });
 }
@@ -0,0 +1,331 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGDecoder.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include "libohos_render/expand/components/apng/APNGBlend.h"
+#include "libohos_render/expand/components/apng/ApngParser.h"
+
+static const std::array<uint8_t, 8> kPNGSignature = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+// 防止损坏文件导致超大内存分配
+static constexpr uint32_t kMaxChunkLength = 0x7FFFFFFF;
+static constexpr uint32_t kFcTLLength = 26;
+
+static uint32_t ReadUint32(const uint8_t *bytes) {
+    return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+           (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+}
+
+static uint16_t ReadUint16(const uint8_t *bytes) {
+    return static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
+}
+
+static void WriteUint32(std::vector<uint8_t> &out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>((value >> 24) & 0xFF));
+    out.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
+    out.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+    out.push_back(static_cast<uint8_t>(value & 0xFF));
+}
+
+static bool ReadAt(FILE *file, uint64_t offset, uint8_t *buffer, size_t length) {
+    if (fseeko(file, static_cast<off_t>(offset), SEEK_SET) != 0) {
+        return false;
+    }
+    return fread(buffer, 1, length, file) == length;
+}
+
+/**
+ * 追加一个 chunk，data 为 nullptr 时从文件 offset 处读取
+ */
+static bool AppendChunk(std::vector<uint8_t> &out, const char *type, const uint8_t *data, FILE *file, uint64_t offset,
+                        uint32_t length) {
+    WriteUint32(out, length);
+    size_t crcStart = out.size();
+    out.insert(out.end(), type, type + 4);
+    size_t dataStart = out.size();
+    out.resize(dataStart + length);
+    if (data) {
+        std::memcpy(out.data() + dataStart, data, length);
+    } else if (!ReadAt(file, offset, out.data() + dataStart, length)) {
+        return false;
+    }
+    WriteUint32(out, crc32(out, crcStart, length + 4));
+    return true;
+}
+
+std::shared_ptr<APNG> APNG::ParseFromFile(const std::string &filePath) {
+    FILE *file = fopen(filePath.c_str(), "rb");
+    if (!file) {
+        return nullptr;
+    }
+    auto apng = std::make_shared<APNG>();
+    apng->filePath = filePath;
+
+    std::array<uint8_t, 8> signature;
+    if (fread(signature.data(), 1, signature.size(), file) != signature.size() || signature != kPNGSignature) {
+        fclose(file);
+        apng->isAPNG = false;
+        return apng;
+    }
+
+    bool isAnimated = false;
+    std::shared_ptr<Frame> frame = std::make_shared<Frame>();
+    std::vector<uint8_t> payload;
+    uint64_t off = signature.size();
+    uint8_t chunkHeader[8];
+    while (ReadAt(file, off, chunkHeader, sizeof(chunkHeader))) {
+        uint32_t length = ReadUint32(chunkHeader);
+        if (length > kMaxChunkLength) {
+            break;
+        }
+        std::string type(reinterpret_cast<const char *>(chunkHeader + 4), 4);
+        uint64_t dataOff = off + 8;
+        // 控制块需要读取内容，帧数据只记录位置
+        bool needPayload = type == "IHDR" || type == "acTL" || type == "fcTL";
+        if (needPayload) {
+            payload.resize(length);
+            if (!ReadAt(file, dataOff, payload.data(), length)) {
+                break;
+            }
+        }
+        if (type == "IHDR") {
+            if (length < 8) {
+                break;
+            }
+            apng->headerDataBytes = payload;
+            apng->width = ReadUint32(payload.data());
+            apng->height = ReadUint32(payload.data() + 4);
+        } else if (type == "acTL") {
+            isAnimated = true;
+            if (length >= 8) {
+                apng->numPlays = ReadUint32(payload.data() + 4);
+            }
+        } else if (type == "fcTL") {
+            if (length < kFcTLLength) {
+                break;
+            }
+            apng->frames.push_back(frame);
+
+            const uint8_t *fc = payload.data();
+            frame = std::make_shared<Frame>();
+            frame->width = ReadUint32(fc + 4);
+            frame->height = ReadUint32(fc + 8);
+            frame->left = ReadUint32(fc + 12);
+            frame->top = ReadUint32(fc + 16);
+            uint16_t delayN = ReadUint16(fc + 20);
+            uint16_t delayD = ReadUint16(fc + 22);
+            if (delayD == 0) {
+                delayD = 100;
+            }
+            frame->delay = 1000 * delayN / delayD;
+            if (frame->delay <= 10) {
+                frame->delay = 16;  // 等于最低30帧
+            }
+            apng->playTime += frame->delay;
+            frame->disposeOp = fc[24];
+            frame->blendOp = fc[25];
+        } else if (type == "fdAT") {
+            if (length > 4) {
+                frame->dataChunks.push_back(APNGChunkRef{dataOff + 4, length - 4});
+            }
+        } else if (type == "IDAT") {
+            frame->dataChunks.push_back(APNGChunkRef{dataOff, length});
+        } else {
+            auto &parts = type == "IEND" ? apng->postDataParts : apng->preDataParts;
+            size_t start = parts.size();
+            parts.resize(start + 12 + length);
+            if (!ReadAt(file, off, parts.data() + start, 12 + length)) {
+                parts.resize(start);
+                break;
+            }
+        }
+        if (type == "IEND") {
+            break;
+        }
+        off = dataOff + length + 4;
+    }
+    fclose(file);
+
+    apng->frames.push_back(frame);
+    if (!isAnimated || apng->headerDataBytes.empty()) {
+        apng->isAPNG = false;
+    }
+    return apng;
+}
+
+bool APNG::BuildFramePNG(FILE *file, const Frame &frame, std::vector<uint8_t> &out) const {
+    out.clear();
+    if (headerDataBytes.size() < 8 || frame.dataChunks.empty()) {
+        return false;
+    }
+    size_t totalSize = kPNGSignature.size() + 12 + headerDataBytes.size() + preDataParts.size() + postDataParts.size();
+    for (const auto &chunk : frame.dataChunks) {
+        totalSize += 12 + chunk.length;
+    }
+    out.reserve(totalSize);
+    out.insert(out.end(), kPNGSignature.begin(), kPNGSignature.end());
+
+    std::vector<uint8_t> header = headerDataBytes;
+    DataView hdv(header);
+    hdv.setUint32(0, frame.width);
+    hdv.setUint32(4, frame.height);
+    AppendChunk(out, "IHDR", header.data(), nullptr, 0, header.size());
+    out.insert(out.end(), preDataParts.begin(), preDataParts.end());
+    for (const auto &chunk : frame.dataChunks) {
+        if (!AppendChunk(out, "IDAT", nullptr, file, chunk.offset, chunk.length)) {
+            out.clear();
+            return false;
+        }
+    }
+    out.insert(out.end(), postDataParts.begin(), postDataParts.end());
+    return true;
+}
+
+void APNGCompositor::Reset(int width, int height) {
+    this->width = width;
+    this->height = height;
+    hasFirstFullFrame = false;
+    canvas.assign(static_cast<size_t>(width) * height * 4, 0);
+}
+
+bool APNGCompositor::Compose(const Frame &frame, const uint8_t *pixels) {
+    if (frame.width == 0 || frame.height == 0) {
+        return false;
+    }
+    // 首个完整帧
+    if (!hasFirstFullFrame) {
+        if (frame.width != width || frame.height != height || pixels == nullptr) {
+            return false;
+        }
+        hasFirstFullFrame = true;
+        APNGBlendRowSource(canvas.data(), pixels, static_cast<size_t>(width) * height);
+        return true;
+    }
+    // 非完整帧依赖合成，解码失败时不输出但仍执行 dispose
+    if (pixels == nullptr) {
+        return false;
+    }
+    BlendFrame(frame, pixels);
+    return true;
+}
+
+void APNGCompositor::BlendFrame(const Frame &frame, const uint8_t *pixels) {
+    // 超出画布的部分裁剪掉
+    int copyWidth = std::min(frame.width, width - frame.left);
+    int copyHeight = std::min(frame.height, height - frame.top);
+    if (frame.left < 0 || frame.top < 0 || copyWidth <= 0 || copyHeight <= 0) {
+        return;
+    }
+    for (int y = 0; y < copyHeight; ++y) {
+        const uint8_t *src = pixels + static_cast<size_t>(y) * frame.width * 4;
+        uint8_t *dst = canvas.data() + (static_cast<size_t>(y + frame.top) * width + frame.left) * 4;
+        if (frame.blendOp == APNG_BLEND_OP_SOURCE) {
+            APNGBlendRowSource(dst, src, copyWidth);
+        } else if (frame.blendOp == APNG_BLEND_OP_OVER) {
+            APNGBlendRowOver(dst, src, copyWidth);
+        }
+    }
+}
+
+void APNGCompositor::Dispose(const Frame &frame) {
+    if (!hasFirstFullFrame || frame.disposeOp != APNG_DISPOSE_OP_BACKGROUND) {
+        return;
+    }
+    // 清除当前帧区域
+    int clearWidth = std::min(frame.width, width - frame.left);
+    int clearHeight = std::min(frame.height, height - frame.top);
+    if (frame.left < 0 || frame.top < 0 || clearWidth <= 0 || clearHeight <= 0) {
+        return;
+    }
+    for (int y = 0; y < clearHeight; ++y) {
+        size_t dstIdx = (static_cast<size_t>(y + frame.top) * width + frame.left) * 4;
+        std::memset(canvas.data() + dstIdx, 0, static_cast<size_t>(clearWidth) * 4);
+    }
+}
+
+APNGFrameStream::APNGFrameStream(std::shared_ptr<APNG> apng, DecodeFunc decode)
+    : apng(std::move(apng)), decode(std::move(decode)) {
+    file = fopen(this->apng->filePath.c_str(), "rb");
+    compositor.Reset(this->apng->width, this->apng->height);
+}
+
+APNGFrameStream::~APNGFrameStream() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+}
+
+bool APNGFrameStream::ProcessFrame(const Frame &frame) {
+    const uint8_t *pixels = nullptr;
+    // 首个完整帧之前的非完整帧不会输出，无需解码
+    bool needDecode = frame.width > 0 && frame.height > 0 &&
+                      (compositor.HasFirstFullFrame() || (frame.width == apng->width && frame.height == apng->height));
+    if (needDecode && file && apng->BuildFramePNG(file, frame, pngBuffer) && decode(pngBuffer, frame, framePixels) &&
+        framePixels.size() >= static_cast<size_t>(frame.width) * frame.height * 4) {
+        pixels = framePixels.data();
+    }
+    return compositor.Compose(frame, pixels);
+}
+
+bool APNGFrameStream::Next(Output &output) {
+    auto &frames = apng->frames;
+    if (frames.empty()) {
+        return false;
+    }
+    if (pendingDispose) {
+        compositor.Dispose(*pendingDispose);
+        pendingDispose = nullptr;
+    }
+    // 最多遍历一整轮，防止没有可输出帧时死循环
+    for (size_t visited = 0; visited <= frames.size(); visited++) {
+        if (nextIndex >= frames.size()) {
+            Rewind();
+        }
+        size_t index = nextIndex++;
+        const Frame &frame = *frames[index];
+        bool didOutput = ProcessFrame(frame);
+        if (didOutput) {
+            output.canvas = &compositor.Canvas();
+            output.frameIndex = static_cast<int>(index);
+            output.isLast = index + 1 >= frames.size();
+            output.nextFrameDelay = output.isLast ? frames.back()->delay : frames[index + 1]->delay;
+            pendingDispose = &frame;
+            return true;
+        }
+        compositor.Dispose(frame);
+    }
+    return false;
+}
+
+void APNGFrameStream::Rewind() {
+    nextIndex = 0;
+    pendingDispose = nullptr;
+    compositor.Reset(apng->width, apng->height);
+}
+
+void APNGFrameStream::SeekTo(int frameIndex) {
+    Rewind();
+    auto &frames = apng->frames;
+    size_t target = std::min(static_cast<size_t>(std::max(frameIndex, 0)), frames.size());
+    while (nextIndex < target) {
+        const Frame &frame = *frames[nextIndex++];
+        ProcessFrame(frame);
+        compositor.Dispose(frame);
+    }
+}
@@ -0,0 +1,171 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_APNGDECODER_H
+#define CORE_RENDER_OHOS_APNGDECODER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * APNG 解码核心，不依赖平台 API：
+ * - APNG：容器解析结果，只记录各帧数据块在文件中的位置，可在多个播放实例间共享
+ * - APNGCompositor：按 dispose_op/blend_op 将帧合成到画布
+ * - APNGFrameStream：按需从文件读取并解码下一帧，帧解码（PNG -> RGBA）由平台注入
+ */
+
+enum APNGDisposeOp { APNG_DISPOSE_OP_NONE = 0, APNG_DISPOSE_OP_BACKGROUND = 1, APNG_DISPOSE_OP_PREVIOUS = 2 };
+enum APNGBlendOp { APNG_BLEND_OP_SOURCE = 0, APNG_BLEND_OP_OVER = 1 };
+
+/**
+ * 帧数据块（IDAT/fdAT 的压缩数据，不含 fdAT 序号）在文件中的位置
+ */
+struct APNGChunkRef {
+    uint64_t offset = 0;
+    uint32_t length = 0;
+};
+
+class Frame {
+ public:
+    int left = 0;
+    int top = 0;
+    int width = 0;
+    int height = 0;
+    int delay = 0;
+    int disposeOp = 0;
+    int blendOp = 0;
+    std::vector<APNGChunkRef> dataChunks;
+};
+
+class APNG {
+ public:
+    bool isAPNG = true;
+    int width = 0;
+    int height = 0;
+    int numPlays = 0;
+    int playTime = 0;
+    std::string filePath;
+    std::vector<std::shared_ptr<Frame>> frames;
+
+    /**
+     * 流式解析文件中的 chunk，只读取控制块，不加载帧数据
+     * @return 文件无法读取时返回 nullptr；非 APNG 时 isAPNG 为 false
+     */
+    static std::shared_ptr<APNG> ParseFromFile(const std::string &filePath);
+
+    /**
+     * 从已打开的文件中读取指定帧的数据块，拼装为独立的 PNG 数据
+     */
+    bool BuildFramePNG(FILE *file, const Frame &frame, std::vector<uint8_t> &out) const;
+
+ private:
+    std::vector<uint8_t> headerDataBytes;  // IHDR 数据
+    std::vector<uint8_t> preDataParts;     // IDAT 之前的辅助块（PLTE/tRNS 等），完整 chunk
+    std::vector<uint8_t> postDataParts;    // IEND
+};
+
+/**
+ * 帧合成画布（RGBA_8888，预乘 alpha），在同一块缓冲区上原地合成
+ * 注：首个与画布同尺寸的帧直接作为画布内容，之前的帧不输出；dispose_op PREVIOUS 按 NONE 处理
+ */
+class APNGCompositor {
+ public:
+    void Reset(int width, int height);
+
+    /**
+     * 合成一帧，pixels 为帧解码结果（frame.width * frame.height * 4，非预乘），解码失败时传 nullptr
+     * @return 是否产生输出帧，输出内容为 Canvas()
+     */
+    bool Compose(const Frame &frame, const uint8_t *pixels);
+
+    /**
+     * 输出后执行该帧的 dispose_op
+     */
+    void Dispose(const Frame &frame);
+
+    bool HasFirstFullFrame() const {
+        return hasFirstFullFrame;
+    }
+
+    const std::vector<uint8_t> &Canvas() const {
+        return canvas;
+    }
+
+ private:
+    int width = 0;
+    int height = 0;
+    bool hasFirstFullFrame = false;
+    std::vector<uint8_t> canvas;
+
+    void BlendFrame(const Frame &frame, const uint8_t *pixels);
+};
+
+/**
+ * 单个播放实例的解码流，非线程安全，同一时刻只能在一个线程中使用
+ */
+class APNGFrameStream {
+ public:
+    /**
+     * 将 PNG 数据解码为 RGBA_8888（非预乘）像素，尺寸为 frame.width * frame.height
+     */
+    using DecodeFunc = std::function<bool(const std::vector<uint8_t> &png, const Frame &frame,
+                                          std::vector<uint8_t> &rgba)>;
+
+    struct Output {
+        const std::vector<uint8_t> *canvas = nullptr;  // 预乘 RGBA，下一次调用 Next 前有效
+        int frameIndex = 0;
+        int nextFrameDelay = 0;
+        bool isLast = false;
+    };
+
+    APNGFrameStream(std::shared_ptr<APNG> apng, DecodeFunc decode);
+    ~APNGFrameStream();
+    APNGFrameStream(const APNGFrameStream &) = delete;
+    APNGFrameStream &operator=(const APNGFrameStream &) = delete;
+
+    /**
+     * 解码下一个输出帧，播放到末尾后自动从头开始
+     * @return 整个动画没有可输出的帧时返回 false
+     */
+    bool Next(Output &output);
+
+    /**
+     * 回到第一帧
+     */
+    void Rewind();
+
+    /**
+     * 定位到指定帧：从头合成但不输出，下一次 Next 从 frameIndex 开始
+     */
+    void SeekTo(int frameIndex);
+
+ private:
+    std::shared_ptr<APNG> apng;
+    DecodeFunc decode;
+    FILE *file = nullptr;
+    size_t nextIndex = 0;
+    const Frame *pendingDispose = nullptr;  // 上一个输出帧，其 dispose 延后到下一次 Next 执行
+    APNGCompositor compositor;
+    std::vector<uint8_t> pngBuffer;
+    std::vector<uint8_t> framePixels;
+
+    bool ProcessFrame(const Frame &frame);
+};
+
+#endif  // CORE_RENDER_OHOS_APNGDECODER_H
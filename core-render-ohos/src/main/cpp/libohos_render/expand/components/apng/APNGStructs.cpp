@@ -17,244 +17,235 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <unordered_set>
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
 
-void Frame::SetImageBuffer(std::vector<std::vector<uint8_t>> &image_buffer) {
-    if (width == 0) {
-        return;
-    }
-    // 预先计算所需的总内存大小
-    size_t totalSize = 0;
-    for (const auto &arr : image_buffer) {
-        totalSize += arr.size();
-    }
-    // 为 buffer 预分配内存
-    std::vector<uint8_t> &buffer = data;
-    buffer.reserve(totalSize);
-    // 合并 image_buffer 中的所有数组
-    for (const auto &arr : image_buffer) {
-        std::copy(arr.begin(), arr.end(), std::back_inserter(buffer));
-    }
-}
-
-static OH_PixelmapNative *CreatePixelMap(std::shared_ptr<Frame> frame) {
-    // 创建ImageSource实例
+/**
+ * 帧解码：PNG -> RGBA_8888
+ */
+static bool DecodeFramePixels(const std::vector<uint8_t> &png, const Frame &frame, std::vector<uint8_t> &rgba) {
     OH_ImageSourceNative *source = nullptr;
-
-    auto &buffer = frame->data;
-    Image_ErrorCode errCode = OH_ImageSourceNative_CreateFromData(buffer.data(), buffer.size(), &source);
+    Image_ErrorCode errCode =
+        OH_ImageSourceNative_CreateFromData(const_cast<uint8_t *>(png.data()), png.size(), &source);
     if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest OH_ImageSourceNative_CreateFromData failed, errCode: "
-                     << errCode;
-        return nullptr;
+        KR_LOG_ERROR << "APNG DecodeFramePixels OH_ImageSourceNative_CreateFromData failed, errCode: " << errCode;
+        return false;
     }
 
     OH_DecodingOptions *ops = nullptr;
     OH_DecodingOptions_Create(&ops);
-    // 设置为AUTO会根据图片资源格式解码，如果图片资源为HDR资源则会解码为HDR的pixelmap。
-    OH_DecodingOptions_SetDesiredDynamicRange(ops, IMAGE_DYNAMIC_RANGE_AUTO);
     OH_DecodingOptions_SetPixelFormat(ops, PIXEL_FORMAT_RGBA_8888);
-    OH_PixelmapNative *resPixMap = nullptr;
-    // ops参数支持传入nullptr, 当不需要设置解码参数时，不用创建
-    errCode = OH_ImageSourceNative_CreatePixelmap(source, ops, &resPixMap);
+    OH_PixelmapNative *pixelmap = nullptr;
+    errCode = OH_ImageSourceNative_CreatePixelmap(source, ops, &pixelmap);
     OH_DecodingOptions_Release(ops);
-
+    OH_ImageSourceNative_Release(source);
     if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest OH_ImageSourceNative_CreatePixelmap failed, errCode: "
-                     << errCode;
-        return nullptr;
+        KR_LOG_ERROR << "APNG DecodeFramePixels OH_ImageSourceNative_CreatePixelmap failed, errCode: " << errCode;
+        return false;
     }
-    return resPixMap;
-}
 
-static bool PixelmapToBitmapBuffer(OH_PixelmapNative *pixelmap, size_t bufferSize, std::vector<uint8_t> &buffer) {
-    buffer.clear();
-    buffer.reserve(bufferSize);
-    Image_ErrorCode errCode = OH_PixelmapNative_ReadPixels(pixelmap, buffer.data(), &bufferSize);
+    size_t bufferSize = static_cast<size_t>(frame.width) * frame.height * 4;
+    rgba.resize(bufferSize);
+    errCode = OH_PixelmapNative_ReadPixels(pixelmap, rgba.data(), &bufferSize);
+    OH_PixelmapNative_Release(pixelmap);
     if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "ImageSourceNativeCTest sourceTest PixelMapToBitmapBuffer failed, errCode: " << errCode;
-        buffer.clear();
+        KR_LOG_ERROR << "APNG DecodeFramePixels OH_PixelmapNative_ReadPixels failed, errCode: " << errCode;
         return false;
     }
     return true;
 }
 
-static OH_PixelmapNative *BitmapBufferToPixelmap(size_t bufferSize, int width, int height,
-                                                 std::vector<uint8_t> &buffer) {
+static OH_PixelmapNative *BitmapBufferToPixelmap(int width, int height, const std::vector<uint8_t> &buffer) {
     OH_PixelmapNative *resPixMap = nullptr;
-    OH_Pixelmap_InitializationOptions *createOpts;
+    OH_Pixelmap_InitializationOptions *createOpts = nullptr;
     OH_PixelmapInitializationOptions_Create(&createOpts);
     OH_PixelmapInitializationOptions_SetWidth(createOpts, width);
     OH_PixelmapInitializationOptions_SetHeight(createOpts, height);
     OH_PixelmapInitializationOptions_SetPixelFormat(createOpts, PIXEL_FORMAT_RGBA_8888);
-    // OH_PixelmapInitializationOptions_SetAlphaType(createOpts, PIXELMAP_ALPHA_TYPE_);
-
+    // 合成画布为预乘 alpha
+    OH_PixelmapInitializationOptions_SetAlphaType(createOpts, PIXELMAP_ALPHA_TYPE_PREMULTIPLIED);
     Image_ErrorCode errCode = OH_PixelmapNative_CreateEmptyPixelmap(createOpts, &resPixMap);
-
+    OH_PixelmapInitializationOptions_Release(createOpts);
     if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "BitmapBufferToPixelmap sourceTest OH_PixelmapNative_CreateEmptyPixelmap failed, errCode: "
-                     << errCode;
+        KR_LOG_ERROR << "BitmapBufferToPixelmap OH_PixelmapNative_CreateEmptyPixelmap failed, errCode: " << errCode;
         return nullptr;
     }
 
-    errCode = OH_PixelmapNative_WritePixels(resPixMap, buffer.data(), bufferSize);
+    errCode = OH_PixelmapNative_WritePixels(resPixMap, const_cast<uint8_t *>(buffer.data()), buffer.size());
     if (errCode != IMAGE_SUCCESS) {
-        KR_LOG_ERROR << "BitmapBufferToPixelmap BitmapBufferToPixelmap sourceTest OH_PixelmapNative_WritePixels "
-                        "failed, errCode: "
-                     << errCode;
+        KR_LOG_ERROR << "BitmapBufferToPixelmap OH_PixelmapNative_WritePixels failed, errCode: " << errCode;
+        OH_PixelmapNative_Release(resPixMap);
         return nullptr;
     }
-
     return resPixMap;
 }
 
-APNG::~APNG() {
-    std::unique_lock<std::mutex> lock(drawableMutex);
-    for (const auto &drawable : animateDrawables) {
-        if (drawable && drawable->pixelmap) {
-            OH_PixelmapNative_Release(drawable->pixelmap);
-        }
-        if (drawable && drawable->drawable) {
-            OH_ArkUI_DrawableDescriptor_Dispose(drawable->drawable);
-        }
-        drawable->drawable = nullptr;
-        drawable->pixelmap = nullptr;
+APNGDrawable::~APNGDrawable() {
+    if (drawable) {
+        OH_ArkUI_DrawableDescriptor_Dispose(drawable);
+        drawable = nullptr;
     }
-    animateDrawables.clear();
-}
-
-bool APNG::DidAddFrame(std::shared_ptr<Frame> frame, int index) {
-    if (frame->width == 0 || frame->height == 0) {
-        return false;
-    }
-    bool didHandled = false;
-    // 首个完整帧
-    if (frame->width == width && frame->height == height && !hasFirstFullFrame) {
-        auto drawable = std::make_shared<APNGDrawable>();
-        drawable->pixelmap = CreatePixelMap(frame);
-        if (drawable->pixelmap) {
-            hasFirstFullFrame = true;
-            drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
-            didHandled = true;
-            size_t bufferSize = width * height * 4;
-            AddDrawable(drawable, index);
-            lazyBeforeNextFrameTask = [needApplyPixelmap = drawable->pixelmap, frame, bufferSize, this]() {
-                PixelmapToBitmapBuffer(needApplyPixelmap, bufferSize, this->curBitmapBuffer);
-                HandlePostFrameDisposeOp(frame);
-            };
-        }
-    } else if (hasFirstFullFrame) {  // 非完整帧依赖合成
-        size_t bufferSize = width * height * 4;
-        if (this->lazyBeforeNextFrameTask) {
-            this->lazyBeforeNextFrameTask();
-            this->lazyBeforeNextFrameTask = nullptr;
-        }
-        if (frame->disposeOp == 2) {  // 保存上一帧到缓冲区
-            previousBuffer = curBitmapBuffer;
-        }
-        HandleFrameBlendOp(frame, index);
-        HandlePostFrameDisposeOp(frame);
-        didHandled = true;
+    if (pixelmap) {
+        OH_PixelmapNative_Release(pixelmap);
+        pixelmap = nullptr;
     }
-    return didHandled;
 }
 
-void APNG::HandleFrameBlendOp(std::shared_ptr<Frame> frame, int index) {
-    // 合成// 根据 blendOp 合成帧
-    auto &drawingBuffer = this->curBitmapBuffer;
-    auto framePixelmap = CreatePixelMap(frame);
-    auto frameBuffer = std::vector<uint8_t>();
-    int frameBufferSize = frame->width * frame->height * 4;
-    bool frameDecodeSuccess = PixelmapToBitmapBuffer(framePixelmap, frameBufferSize, frameBuffer);
-    if (!frameDecodeSuccess) {
-        return;
-    }
-    for (int y = 0; y < frame->height; ++y) {
-        for (int x = 0; x < frame->width; ++x) {
-            int srcIdx = (y * frame->width + x) * 4;
-            int dstIdx = ((y + frame->top) * width + (x + frame->left)) * 4;
+// 存活的播放器，用于内存告警时统一裁剪
+static std::mutex &PlayerRegistryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
 
-            if (frame->blendOp == 0) {  // 覆盖操作
-                drawingBuffer[dstIdx + 0] = frameBuffer[srcIdx + 0];
-                drawingBuffer[dstIdx + 1] = frameBuffer[srcIdx + 1];
-                drawingBuffer[dstIdx + 2] = frameBuffer[srcIdx + 2];
-                drawingBuffer[dstIdx + 3] = frameBuffer[srcIdx + 3];
-            } else if (frame->blendOp == 1) {
-                // 在这里执行混合操作，例如使用 alpha 通道作为权重计算新的颜色值
-                uint8_t srcR = frameBuffer[srcIdx + 0];
-                uint8_t srcG = frameBuffer[srcIdx + 1];
-                uint8_t srcB = frameBuffer[srcIdx + 2];
-                uint8_t srcA = frameBuffer[srcIdx + 3];
+static std::unordered_set<APNGPlayer *> &PlayerRegistry() {
+    static std::unordered_set<APNGPlayer *> players;
+    return players;
+}
 
-                uint8_t dstR = drawingBuffer[dstIdx + 0];
-                uint8_t dstG = drawingBuffer[dstIdx + 1];
-                uint8_t dstB = drawingBuffer[dstIdx + 2];
-                uint8_t dstA = drawingBuffer[dstIdx + 3];
+APNGPlayer::APNGPlayer(std::shared_ptr<APNG> apng) : apng_(std::move(apng)) {
+    std::lock_guard<std::mutex> lock(PlayerRegistryMutex());
+    PlayerRegistry().insert(this);
+}
 
-                float srcAlpha = srcA / 255.0f;
-                float dstAlpha = dstA / 255.0f;
-                float outAlpha = srcAlpha + dstAlpha * (1 - srcAlpha);
+APNGPlayer::~APNGPlayer() {
+    std::lock_guard<std::mutex> lock(PlayerRegistryMutex());
+    PlayerRegistry().erase(this);
+}
 
-                if (outAlpha == 0) {
-                    drawingBuffer[dstIdx + 0] = 0;
-                    drawingBuffer[dstIdx + 1] = 0;
-                    drawingBuffer[dstIdx + 2] = 0;
-                    drawingBuffer[dstIdx + 3] = 0;
-                } else {
-                    drawingBuffer[dstIdx + 0] =
-                        static_cast<uint8_t>((srcR * srcAlpha + dstR * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 1] =
-                        static_cast<uint8_t>((srcG * srcAlpha + dstG * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 2] =
-                        static_cast<uint8_t>((srcB * srcAlpha + dstB * dstAlpha * (1 - srcAlpha)) / outAlpha);
-                    drawingBuffer[dstIdx + 3] = static_cast<uint8_t>(outAlpha * 255);
-                }
-            }
+std::shared_ptr<APNGDrawable> APNGPlayer::TakeNextDrawable() {
+    std::shared_ptr<APNGDrawable> drawable;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!window_.empty()) {
+            drawable = window_.front();
+            window_.pop_front();
+            next_frame_index_ = drawable->isLast ? 0 : drawable->frameIndex + 1;
         }
     }
+    DecodeAheadIfNeeded();
+    return drawable;
+}
 
-    auto pixelmap = BitmapBufferToPixelmap(width * height * 4, width, height, this->curBitmapBuffer);
-    if (pixelmap) {
-        auto drawable = std::make_shared<APNGDrawable>();
-        drawable->pixelmap = pixelmap;
-        drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
-        AddDrawable(drawable, index);
+void APNGPlayer::Reset() {
+    std::deque<std::shared_ptr<APNGDrawable>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dropped.swap(window_);
+        seek_to_frame_ = 0;
+        next_frame_index_ = 0;
+        generation_++;
+        window_size_ = kDefaultWindowSize;
+        failed_.store(false);
     }
 }
 
-void APNG::HandlePostFrameDisposeOp(std::shared_ptr<Frame> frame) {
-    if (frame->disposeOp == 1) {  // 清理当前区域
-        auto &drawingBuffer = this->curBitmapBuffer;
-        // 清除当前帧区域
-        for (int y = 0; y < frame->height; ++y) {
-            for (int x = 0; x < frame->width; ++x) {
-                int dstIdx = ((y + frame->top) * width + (x + frame->left)) * 4;
-                drawingBuffer[dstIdx + 0] = 0;
-                drawingBuffer[dstIdx + 1] = 0;
-                drawingBuffer[dstIdx + 2] = 0;
-                drawingBuffer[dstIdx + 3] = 0;
+void APNGPlayer::Resume() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        window_size_ = kDefaultWindowSize;
+        if (failed_.load()) {
+            // 失败后不会有进行中的解码任务，从解码失败的那一帧重试
+            int retry_from = next_frame_index_;
+            if (!window_.empty()) {
+                retry_from = window_.back()->isLast ? 0 : window_.back()->frameIndex + 1;
             }
+            seek_to_frame_ = retry_from;
+            failed_.store(false);
         }
-    } else if (frame->disposeOp == 2) {
-        previousBuffer = this->curBitmapBuffer;
     }
+    DecodeAheadIfNeeded();
 }
 
-void APNG::AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex) {
-    std::unique_lock<std::mutex> lock(drawableMutex);
-    if (curFrameIndex + 1 < this->frames.size()) {
-        drawable->isLast = false;
-        drawable->nextFrameDelay = this->frames[curFrameIndex + 1]->delay;
-    } else {
-        drawable->nextFrameDelay = this->frames[this->frames.size() - 1]->delay;
-        drawable->isLast = true;
+void APNGPlayer::Trim() {
+    std::deque<std::shared_ptr<APNGDrawable>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        window_size_ = 1;
+        if (window_.size() <= 1) {
+            return;
+        }
+        // 被丢弃的帧之后需要重新解码，正在解码中的帧位于其后，一并丢弃
+        seek_to_frame_ = window_[1]->frameIndex;
+        generation_++;
+        dropped.assign(window_.begin() + 1, window_.end());
+        window_.resize(1);
     }
-    animateDrawables.push_back(drawable);
 }
 
-std::shared_ptr<APNGDrawable> APNG::GetDrawable(int index) {
-    std::unique_lock<std::mutex> lock(drawableMutex);
-    if (index < animateDrawables.size()) {
-        return animateDrawables[index];
+void APNGPlayer::TrimAllOnMemoryLevel(int level) {
+    if (level < 1) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(PlayerRegistryMutex());
+    for (auto player : PlayerRegistry()) {
+        player->Trim();
+    }
+}
+
+void APNGPlayer::DecodeAheadIfNeeded() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (decoding_ || failed_.load() || window_.size() >= window_size_) {
+            return;
+        }
+        decoding_ = true;
+    }
+    std::weak_ptr<APNGPlayer> weakSelf = shared_from_this();
+    KRGCDQueue::GetInstance().DispatchAsync([weakSelf] {
+        if (auto self = weakSelf.lock()) {
+            self->DecodeAhead();
+        }
+    });
+}
+
+void APNGPlayer::DecodeAhead() {
+    if (!stream_) {
+        stream_ = std::make_unique<APNGFrameStream>(apng_, DecodeFramePixels);
+    }
+    while (true) {
+        uint32_t generation = 0;
+        int seekToFrame = -1;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (window_.size() >= window_size_) {
+                decoding_ = false;
+                return;
+            }
+            generation = generation_;
+            seekToFrame = seek_to_frame_;
+            seek_to_frame_ = -1;
+        }
+        if (seekToFrame >= 0) {
+            stream_->SeekTo(seekToFrame);
+        }
+
+        std::shared_ptr<APNGDrawable> drawable;
+        APNGFrameStream::Output output;
+        if (stream_->Next(output)) {
+            drawable = std::make_shared<APNGDrawable>();
+            drawable->frameIndex = output.frameIndex;
+            drawable->nextFrameDelay = output.nextFrameDelay;
+            drawable->isLast = output.isLast;
+            drawable->pixelmap = BitmapBufferToPixelmap(apng_->width, apng_->height, *output.canvas);
+            if (drawable->pixelmap) {
+                drawable->drawable = OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(drawable->pixelmap);
+            }
+        }
+        if (!drawable || !drawable->drawable) {
+            KR_LOG_ERROR << "APNGPlayer decode frame failed: " << apng_->filePath;
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (generation == generation_) {
+                failed_.store(true);
+            }
+            decoding_ = false;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 解码期间发生了 Reset/Trim，结果作废（drawable 在锁外析构）
+        if (generation == generation_) {
+            window_.push_back(drawable);
+            drawable = nullptr;
+        }
     }
-    return nullptr;
 }
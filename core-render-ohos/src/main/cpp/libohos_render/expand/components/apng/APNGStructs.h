@@ -27,80 +27,95 @@
 #include <multimedia/image_framework/image_pixel_map_mdk.h>
 #include <native_drawing/drawing_canvas.h>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
-#include <execution>  // For std::execution::par
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <vector>
+#include "libohos_render/expand/components/apng/APNGDecoder.h"
 #include "libohos_render/expand/components/apng/APNGUtil.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 
-class Frame {
- public:
-    int left = 0;
-    int top = 0;
-    int width = 0;
-    int height = 0;
-    int delay = 0;
-    int disposeOp = 0;
-    int blendOp = 0;
-    std::vector<std::vector<uint8_t>> dataParts;
-    std::vector<uint8_t> data;
-    std::string base64Image;
-
-    void SetImageBuffer(std::vector<std::vector<uint8_t>> &image_buffer);
-};
-
+/**
+ * 一个可显示的合成帧，析构时释放 pixelmap 与 drawable
+ */
 class APNGDrawable {
  public:
-    int nextFrameDelay = 0;  // 如果为-1, 则没有下一个drawable
+    int frameIndex = 0;
+    int nextFrameDelay = 0;
     bool isLast = false;
     OH_PixelmapNative *pixelmap = nullptr;
     ArkUI_DrawableDescriptor *drawable = nullptr;
+
+    APNGDrawable() = default;
+    ~APNGDrawable();
+    APNGDrawable(const APNGDrawable &) = delete;
+    APNGDrawable &operator=(const APNGDrawable &) = delete;
 };
 
-class APNG {
+/**
+ * 单个 APNG 视图的播放器：在子线程按需解码，只保留有限个待显示帧（窗口），
+ * 内存占用与动画总帧数无关
+ */
+class APNGPlayer : public std::enable_shared_from_this<APNGPlayer> {
  public:
-    bool isAPNG = true;
-    int width = 0;
-    int height = 0;
-    int numPlays = 0;
-    int playTime = 0;
-    std::vector<std::shared_ptr<Frame>> frames;
-    std::vector<std::shared_ptr<APNGDrawable>> animateDrawables;  // 播放帧
-    ~APNG();
-
-    void WillParseFrame() {
-        isParsing.store(true);
-    }
-    bool DidAddFrame(std::shared_ptr<Frame> frame, int index);
-    void DidEndParserFrame() {
-        isParsing.store(false);
-        lazyBeforeNextFrameTask = nullptr;
-    }
+    static constexpr size_t kDefaultWindowSize = 3;
+
+    explicit APNGPlayer(std::shared_ptr<APNG> apng);
+    ~APNGPlayer();
+
+    /**
+     * 取出下一个待显示帧，尚未解码完成时返回 nullptr，同时触发预解码
+     * 注：需在主线程调用
+     */
+    std::shared_ptr<APNGDrawable> TakeNextDrawable();
 
-    bool IsParsing() {
-        return isParsing.load();
+    /**
+     * 是否没有任何可输出帧（全部解码失败）
+     */
+    bool IsFailed() const {
+        return failed_.load();
     }
 
-    std::shared_ptr<APNGDrawable> GetDrawable(int index);
+    /**
+     * 丢弃已解码的帧，下一次从第一帧开始；同时恢复窗口大小并清除失败状态
+     */
+    void Reset();
 
- private:
-    std::atomic_bool isParsing = true;
-    std::function<void()> lazyBeforeNextFrameTask = nullptr;
-    std::vector<uint8_t> curBitmapBuffer;
-    std::vector<uint8_t> previousBuffer;
-    std::mutex drawableMutex;
+    /**
+     * 开始播放时调用：恢复被 Trim 缩小的窗口，上次解码失败时从当前位置重试
+     */
+    void Resume();
+
+    /**
+     * 内存紧张时释放窗口中尚未显示的帧（保留最近的一帧），并缩小窗口直到下一次 Reset/Resume
+     */
+    void Trim();
 
-    bool hasFirstFullFrame = false;
+    /**
+     * 按系统内存等级裁剪所有播放器（level 同 KRMemoryCacheModule::TrimAllOnMemoryLevel）
+     */
+    static void TrimAllOnMemoryLevel(int level);
 
-    void HandleFrameBlendOp(std::shared_ptr<Frame> frame, int index);
+ private:
+    std::shared_ptr<APNG> apng_;
+    std::unique_ptr<APNGFrameStream> stream_;  // 只在解码任务中访问
+    std::mutex mutex_;
+    std::deque<std::shared_ptr<APNGDrawable>> window_;
+    size_t window_size_ = kDefaultWindowSize;
+    bool decoding_ = false;
+    int seek_to_frame_ = -1;  // >= 0 时解码任务先定位到该帧
+    int next_frame_index_ = 0;  // 下一个待显示帧的下标，解码失败重试时从这里开始
+    uint32_t generation_ = 0;  // Reset/Trim 后递增，丢弃旧任务的结果
+    std::atomic_bool failed_ = false;  // 在 mutex_ 内写入
 
-    void HandlePostFrameDisposeOp(std::shared_ptr<Frame> frame);
-    //
-    void AddDrawable(std::shared_ptr<APNGDrawable> drawable, int curFrameIndex);
+    void DecodeAheadIfNeeded();
+    void DecodeAhead();
 };
 
 enum APNGEvent { LOAD_FAILURE, ANIMATION_START, ANIMATION_END };
@@ -24,49 +24,11 @@
 #include <string>
 #include <vector>
 #include "libohos_render/expand/components/apng/APNGStructs.h"
+#include "libohos_render/utils/KRTextCodec.h"
 
 static void BufferToBase64(std::string &base64_str, const std::vector<uint8_t> &buffer) {
-    static std::string base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                      "abcdefghijklmnopqrstuvwxyz"
-                                      "0123456789+/";
-    int i = 0;
-    int j = 0;
-    uint8_t char_array_3[3];
-    uint8_t char_array_4[4];
-
-    for (auto buf_iter = buffer.begin(); buf_iter != buffer.end(); ++buf_iter) {
-        char_array_3[i++] = *(buf_iter);
-        if (i == 3) {
-            char_array_4[0] = (char_array_3[0] & 0xFC) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xF0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0F) << 2) + ((char_array_3[2] & 0xC0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3F;
-
-            for (i = 0; i < 4; ++i) {
-                base64_str += base64_chars[char_array_4[i]];
-            }
-            i = 0;
-        }
-    }
-
-    if (i) {
-        for (j = i; j < 3; ++j) {
-            char_array_3[j] = '\0';
-        }
-
-        char_array_4[0] = (char_array_3[0] & 0xFC) >> 2;
-        char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xF0) >> 4);
-        char_array_4[2] = ((char_array_3[1] & 0x0F) << 2) + ((char_array_3[2] & 0xC0) >> 6);
-        char_array_4[3] = char_array_3[2] & 0x3F;
-
-        for (j = 0; j < i + 1; ++j) {
-            base64_str += base64_chars[char_array_4[j]];
-        }
-
-        while (i++ < 3) {
-            base64_str += '=';
-        }
-    }
+    KRTextCodec::Base64Encode(std::string_view(reinterpret_cast<const char *>(buffer.data()), buffer.size()),
+                              base64_str);
 }
 
 #endif  // CORE_RENDER_OHOS_APNGUTIL_H
@@ -23,7 +23,6 @@
 #include <stdexcept>
 #include <string>
 #include <vector>
-#include "libohos_render/expand/components/apng/APNGStructs.h"
 
 class DataView {
  public:
@@ -120,10 +119,6 @@ static std::vector<uint8_t> makeStringArray(const std::string &str) {
     return result;
 }
 
-static std::vector<uint8_t> subBuffer(const std::vector<uint8_t> &bytes, size_t start, size_t length) {
-    std::vector<uint8_t> result(bytes.begin() + start, bytes.begin() + start + length);
-    return result;
-}
 static std::vector<uint8_t> makeChunkBytes(const std::string &type, const std::vector<uint8_t> &dataBytes) {
     std::size_t crcLen = type.length() + dataBytes.size();
     std::vector<uint8_t> bytes(crcLen + 8);
@@ -148,144 +143,4 @@ static std::vector<uint8_t> makeDWordArray(uint32_t x) {
                                 static_cast<uint8_t>((x >> 8) & 0xFF), static_cast<uint8_t>(x & 0xFF)};
 }
 
-static void eachChunk(std::vector<uint8_t> &bytes,
-                      std::function<bool(const std::string &, std::vector<uint8_t> &, size_t, size_t)> callback) {
-    size_t off = 8;
-    std::string type;
-    size_t length = 0;
-    bool res = false;
-    auto dv = DataView(bytes);
-    do {
-        length = dv.getUint32(off);
-        type = readString(bytes, off + 4, 4);
-        res = callback(type, bytes, off, length);
-        off += (12 + length);
-    } while (res != false && type != "IEND" && off < bytes.size());
-}
-
-static void parseAPNG(std::vector<uint8_t> &buffer, std::function<void(std::shared_ptr<APNG>)> completion) {
-    if (!completion) {
-        return;
-    }
-    static std::array<uint8_t, 8> PNGSignature = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
-    std::vector<uint8_t> &bytes = buffer;
-    std::shared_ptr<APNG> apng = std::make_shared<APNG>();
-
-    if (bytes.size() < 8 || !std::equal(bytes.begin(), bytes.begin() + 8, PNGSignature.begin())) {
-        apng->isAPNG = false;
-        completion(apng);
-        return;
-    }
-
-    bool isAnimated = false;
-    eachChunk(bytes, [&isAnimated](const std::string &type, const std::vector<uint8_t> &, size_t, size_t) -> bool {
-        return !(isAnimated = (type == "acTL"));
-    });
-
-    if (!isAnimated) {
-        apng->isAPNG = false;
-        completion(apng);
-        return;
-    }
-
-    std::vector<std::vector<uint8_t>> preDataParts;
-    std::vector<std::vector<uint8_t>> postDataParts;
-    std::vector<uint8_t> headerDataBytes;
-    std::shared_ptr<Frame> frame = std::make_shared<Frame>();
-    int frameNumber = 0;
-
-    eachChunk(bytes, [&](const std::string &type, std::vector<uint8_t> &bytes, size_t off, size_t length) -> bool {
-        auto dv = DataView(bytes);
-        if (type == "IHDR") {
-            headerDataBytes = subBuffer(bytes, off + 8, length);
-            apng->width = dv.getUint32(off + 8);
-            apng->height = dv.getUint32(off + 12);
-        } else if (type == "acTL") {
-            apng->numPlays = dv.getUint32(off + 8 + 4);
-        } else if (type == "fcTL") {
-            {
-                apng->frames.push_back(frame);
-                frameNumber++;
-            }
-
-            frame = std::make_shared<Frame>();
-            frame->width = dv.getUint32(off + 8 + 4);
-            frame->height = dv.getUint32(off + 8 + 8);
-            frame->left = dv.getUint32(off + 8 + 12);
-            frame->top = dv.getUint32(off + 8 + 16);
-            uint16_t delayN = dv.getUint16(off + 8 + 20);
-            uint16_t delayD = dv.getUint16(off + 8 + 22);
-            if (delayD == 0) {
-                delayD = 100;
-            }
-            frame->delay = 1000 * delayN / delayD;
-            if (frame->delay <= 10) {
-                frame->delay = 16;  // 等于最低30帧
-            }
-            apng->playTime += frame->delay;
-            frame->disposeOp = dv.getUint8(off + 8 + 24);
-            frame->blendOp = dv.getUint8(off + 8 + 25);
-            frame->dataParts.clear();
-            if (frameNumber == 0 && frame->disposeOp == 2) {
-                frame->disposeOp = 1;
-            }
-        } else if (type == "fdAT") {
-            frame->dataParts.push_back(subBuffer(bytes, off + 8 + 4, static_cast<size_t>(length - 4)));
-        } else if (type == "IDAT") {
-            frame->dataParts.push_back(subBuffer(bytes, off + 8, length));
-        } else if (type == "IEND") {
-            postDataParts.push_back(subBuffer(bytes, off, 12 + length));
-        } else {
-            preDataParts.push_back(subBuffer(bytes, off, 12 + length));
-        }
-        return true;
-    });
-
-    apng->frames.push_back(frame);
-
-    if (apng->frames.empty()) {
-        apng->isAPNG = false;
-        completion(apng);
-        return;
-    }
-    apng->WillParseFrame();
-    int index = 0;
-    bool didAddFrameSuccess = false;
-    for (auto frame : apng->frames) {
-        std::vector<std::vector<uint8_t>> bb;
-        // 预先分配内存
-        size_t totalSize = preDataParts.size() + frame->dataParts.size() + postDataParts.size() + 2;
-        bb.reserve(totalSize);
-
-        bb.emplace_back(PNGSignature.begin(), PNGSignature.end());
-
-        auto hdv = DataView(headerDataBytes);
-        hdv.setUint32(0, frame->width);
-        hdv.setUint32(4, frame->height);
-
-        bb.emplace_back(makeChunkBytes("IHDR", headerDataBytes));
-        bb.insert(bb.end(), preDataParts.begin(), preDataParts.end());
-        for (const auto &p : frame->dataParts) {
-            bb.emplace_back(makeChunkBytes("IDAT", p));
-        }
-        bb.insert(bb.end(), postDataParts.begin(), postDataParts.end());
-        frame->SetImageBuffer(bb);
-        if (apng->DidAddFrame(frame, index) && !didAddFrameSuccess) {
-            didAddFrameSuccess = true;
-            completion(apng);
-        }
-        frame->dataParts.clear();
-        bb.clear();
-        index++;
-    }
-    apng->DidEndParserFrame();
-
-    if (apng->frames.empty()) {
-        apng->isAPNG = false;
-    }
-    if (!didAddFrameSuccess) {
-        completion(apng);
-    }
-}
-
 #endif  // CORE_RENDER_OHOS_APNGPARSER_H
@@ -35,8 +35,10 @@ class KRBasePropsHandler : public std::enable_shared_from_this<KRBasePropsHandle
     }
     virtual ~KRBasePropsHandler() = default;
 
-    virtual bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value, const KRRenderCallback event_call_back);
-    virtual bool SetPropWithoutAnimation(const std::string &prop_key, const KRAnyValue &prop_value,
+    // prop_id 为 KRPropKeys::IdOf(prop_key)
+    virtual bool SetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
+                         const KRRenderCallback event_call_back);
+    virtual bool SetPropWithoutAnimation(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                                  const KRRenderCallback event_call_back);
 
     virtual bool ResetProp(const std::string &prop_key);
@@ -109,10 +111,11 @@ class KRArkTSViewBasePropsHandler : public KRBasePropsHandler{
     }
     virtual ~KRArkTSViewBasePropsHandler() = default;
 
-    bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value, const KRRenderCallback event_call_back) override {
+    bool SetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
+                 const KRRenderCallback event_call_back) override {
         return false;
     }
-    bool SetPropWithoutAnimation(const std::string &prop_key, const KRAnyValue &prop_value,
+    bool SetPropWithoutAnimation(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                                  const KRRenderCallback event_call_back) override {
         return false;
     }
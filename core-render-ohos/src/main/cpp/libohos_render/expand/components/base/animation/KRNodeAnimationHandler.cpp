@@ -33,17 +33,18 @@ void KRNodeAnimationHandler::start(std::weak_ptr<KRBasePropsHandler> target,
     }
     auto context = propsHandler->GetUIContext();
     auto propKey = this->propKey;
+    auto propId = KRPropKeys::IdOf(propKey);
     auto propVal = this->finalValue;
 
     currentAnimateOption = buildAnimateOption();
 
-    animation_ = std::make_shared<KRAnimation>(context, currentAnimateOption, [view, propKey, propVal]() {
+    animation_ = std::make_shared<KRAnimation>(context, currentAnimateOption, [view, propId, propKey, propVal]() {
         auto selfView = view.lock();
         if (selfView == nullptr) {
             return;
         }
         if (auto handler = selfView->GetBasePropsHandler()) {
-            handler->SetPropWithoutAnimation(propKey, propVal, nullptr);
+            handler->SetPropWithoutAnimation(propId, propKey, propVal, nullptr);
         }
     });
     std::weak_ptr<KRNodeAnimationHandler> weakSelf = shared_from_this();
@@ -21,6 +21,7 @@
 #include <arkui/native_node.h>
 #include <arkui/native_node_napi.h>
 #include "libohos_render/expand/components/base/KRBasePropsHandler.h"
+#include "libohos_render/foundation/KRPropKeys.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/animate/KRAnimateOption.h"
@@ -87,13 +88,14 @@ class KRNodeAnimationHandler : public std::enable_shared_from_this<KRNodeAnimati
         auto view = weakView;
         auto context = weakView.lock()->GetUIContext();
         auto propKey = this->propKey;
+        auto propId = KRPropKeys::IdOf(propKey);
         auto propVal = this->finalValue;
 
         currentAnimateOption = buildAnimateOption();
 
-        animation_ = std::make_shared<KRAnimation>(context, currentAnimateOption, [view, propKey, propVal]() {
+        animation_ = std::make_shared<KRAnimation>(context, currentAnimateOption, [view, propId, propKey, propVal]() {
             if (auto selfView = view.lock()) {
-                selfView->SetPropWithoutAnimation(propKey, propVal, nullptr);
+                selfView->SetPropWithoutAnimation(propId, propKey, propVal, nullptr);
             }
         });
         std::weak_ptr<KRNodeAnimationHandler> weakSelf = shared_from_this();
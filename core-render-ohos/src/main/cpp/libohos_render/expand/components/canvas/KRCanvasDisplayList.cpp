@@ -0,0 +1,439 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/canvas/KRCanvasDisplayList.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+
+#include "libohos_render/utils/KRColor.h"
+#include "libohos_render/utils/KRJSONObject.h"
+
+static constexpr std::string_view LINEAR_GRADIENT = "linear-gradient";
+
+static const std::unordered_map<std::string_view, KRCanvasOpCode> &MethodOpCodeMap() {
+    static const std::unordered_map<std::string_view, KRCanvasOpCode> map = {
+        {"lineCap", KRCanvasOpCode::kLineCap},
+        {"lineWidth", KRCanvasOpCode::kLineWidth},
+        {"lineDash", KRCanvasOpCode::kLineDash},
+        {"strokeStyle", KRCanvasOpCode::kStrokeStyle},
+        {"fillStyle", KRCanvasOpCode::kFillStyle},
+        {"beginPath", KRCanvasOpCode::kBeginPath},
+        {"moveTo", KRCanvasOpCode::kMoveTo},
+        {"lineTo", KRCanvasOpCode::kLineTo},
+        {"arc", KRCanvasOpCode::kArc},
+        {"closePath", KRCanvasOpCode::kClosePath},
+        {"stroke", KRCanvasOpCode::kStroke},
+        {"fill", KRCanvasOpCode::kFill},
+        {"createLinearGradient", KRCanvasOpCode::kCreateLinearGradient},
+        {"quadraticCurveTo", KRCanvasOpCode::kQuadraticCurveTo},
+        {"textAlign", KRCanvasOpCode::kTextAlign},
+        {"font", KRCanvasOpCode::kFont},
+        {"fillText", KRCanvasOpCode::kFillText},
+        {"strokeText", KRCanvasOpCode::kStrokeText},
+        {"bezierCurveTo", KRCanvasOpCode::kBezierCurveTo},
+        {"save", KRCanvasOpCode::kSave},
+        {"saveLayer", KRCanvasOpCode::kSaveLayer},
+        {"restore", KRCanvasOpCode::kRestore},
+        {"clip", KRCanvasOpCode::kClip},
+        {"translate", KRCanvasOpCode::kTranslate},
+        {"scale", KRCanvasOpCode::kScale},
+        {"rotate", KRCanvasOpCode::kRotate},
+        {"skew", KRCanvasOpCode::kSkew},
+        {"transform", KRCanvasOpCode::kTransform},
+        {"drawImage", KRCanvasOpCode::kDrawImage},
+    };
+    return map;
+}
+
+static std::vector<std::string> Split(const std::string &str, char delimiter) {
+    std::vector<std::string> result;
+    std::size_t start = 0;
+    std::size_t end = str.find(delimiter);
+    while (end != std::string::npos) {
+        result.push_back(str.substr(start, end - start));
+        start = end + 1;
+        end = str.find(delimiter, start);
+    }
+    result.push_back(str.substr(start));
+    return result;
+}
+
+static inline float ToDegrees(double radians) {
+    return radians * 180 / M_PI;
+}
+
+KRCanvasDisplayList::KRCanvasDisplayList(KRCanvasColorParser color_parser) : color_parser_(color_parser) {}
+
+bool KRCanvasDisplayList::OpCodeOf(const std::string &method, KRCanvasOpCode &code) {
+    auto &map = MethodOpCodeMap();
+    auto it = map.find(method);
+    if (it == map.end()) {
+        return false;
+    }
+    code = it->second;
+    return true;
+}
+
+void KRCanvasDisplayList::Append(KRCanvasOpCode code, const std::string &params) {
+    KRCanvasOp op;
+    op.code = code;
+    if (Compile(op, params)) {
+        ops_.push_back(op);
+    }
+}
+
+void KRCanvasDisplayList::Clear() {
+    ops_.clear();
+    strings_.clear();
+    float_arrays_.clear();
+    gradients_.clear();
+}
+
+uint32_t KRCanvasDisplayList::ParseColor(const std::string &color) const {
+    if (color_parser_) {
+        return color_parser_(color);
+    }
+    return kuikly::graphics::Color::FromString(color).value;
+}
+
+uint32_t KRCanvasDisplayList::AddString(std::string str) {
+    strings_.push_back(std::move(str));
+    return strings_.size() - 1;
+}
+
+uint32_t KRCanvasDisplayList::AddFloats(std::vector<float> floats) {
+    float_arrays_.push_back(std::move(floats));
+    return float_arrays_.size() - 1;
+}
+
+bool KRCanvasDisplayList::Compile(KRCanvasOp &op, const std::string &params) {
+    switch (op.code) {
+    case KRCanvasOpCode::kBeginPath:
+    case KRCanvasOpCode::kClosePath:
+    case KRCanvasOpCode::kStroke:
+    case KRCanvasOpCode::kFill:
+    case KRCanvasOpCode::kSave:
+    case KRCanvasOpCode::kRestore:
+        return true;
+    case KRCanvasOpCode::kCreateLinearGradient:
+        // 渐变通过 style 字符串传递，该指令无需回放
+        return false;
+    case KRCanvasOpCode::kTextAlign:
+        // textAlign 的参数为原始字符串
+        if (params == "left") {
+            op.index = static_cast<uint32_t>(KRCanvasTextAlign::kLeft);
+        } else if (params == "center") {
+            op.index = static_cast<uint32_t>(KRCanvasTextAlign::kCenter);
+        } else if (params == "right") {
+            op.index = static_cast<uint32_t>(KRCanvasTextAlign::kRight);
+        } else {
+            return false;
+        }
+        return true;
+    case KRCanvasOpCode::kStrokeStyle:
+    case KRCanvasOpCode::kFillStyle:
+        return CompileStyle(op, params);
+    case KRCanvasOpCode::kArc:
+        return CompileArc(op, params);
+    default:
+        break;
+    }
+
+    auto obj = kuikly::util::JSONObject::Parse(params);
+    if (obj == nullptr) {
+        return false;
+    }
+    switch (op.code) {
+    case KRCanvasOpCode::kLineCap: {
+        std::string str = obj->GetString("style");
+        auto cap = KRCanvasLineCap::kButt;
+        if (str == "round") {
+            cap = KRCanvasLineCap::kRound;
+        } else if (str == "square") {
+            cap = KRCanvasLineCap::kSquare;
+        }
+        op.index = static_cast<uint32_t>(cap);
+        return true;
+    }
+    case KRCanvasOpCode::kLineWidth:
+        op.args[0] = obj->GetNumber("width");
+        return true;
+    case KRCanvasOpCode::kLineDash: {
+        auto intervals = obj->GetNumberArray("intervals");
+        op.index = AddFloats(std::vector<float>(intervals.begin(), intervals.end()));
+        return true;
+    }
+    case KRCanvasOpCode::kMoveTo:
+    case KRCanvasOpCode::kLineTo:
+    case KRCanvasOpCode::kTranslate:
+    case KRCanvasOpCode::kScale:
+    case KRCanvasOpCode::kSkew:
+        op.args[0] = obj->GetNumber("x");
+        op.args[1] = obj->GetNumber("y");
+        return true;
+    case KRCanvasOpCode::kQuadraticCurveTo:
+        op.args[0] = obj->GetNumber("cpx");
+        op.args[1] = obj->GetNumber("cpy");
+        op.args[2] = obj->GetNumber("x");
+        op.args[3] = obj->GetNumber("y");
+        return true;
+    case KRCanvasOpCode::kBezierCurveTo:
+        op.args[0] = obj->GetNumber("cp1x");
+        op.args[1] = obj->GetNumber("cp1y");
+        op.args[2] = obj->GetNumber("cp2x");
+        op.args[3] = obj->GetNumber("cp2y");
+        op.args[4] = obj->GetNumber("x");
+        op.args[5] = obj->GetNumber("y");
+        return true;
+    case KRCanvasOpCode::kFont: {
+        // 字重缩放依赖回放时的 context 配置，这里只保存原始字重
+        op.index = AddString(obj->GetString("family"));
+        op.args[0] = obj->GetNumber("size");
+        op.args[1] = std::strtol(obj->GetString("weight").c_str(), nullptr, 10);
+        auto style = obj->GetString("style") == "italic" ? KRCanvasFontStyle::kItalic : KRCanvasFontStyle::kNormal;
+        op.args[2] = static_cast<float>(style);
+        return true;
+    }
+    case KRCanvasOpCode::kFillText:
+    case KRCanvasOpCode::kStrokeText:
+        op.index = AddString(obj->GetString("text"));
+        op.args[0] = obj->GetNumber("x");
+        op.args[1] = obj->GetNumber("y");
+        return true;
+    case KRCanvasOpCode::kSaveLayer: {
+        float x = obj->GetNumber("x");
+        float y = obj->GetNumber("y");
+        op.args[0] = x;
+        op.args[1] = y;
+        op.args[2] = x + obj->GetNumber("width");
+        op.args[3] = y + obj->GetNumber("height");
+        return true;
+    }
+    case KRCanvasOpCode::kClip:
+        op.index = obj->GetNumber("intersect") ? 1 : 0;
+        return true;
+    case KRCanvasOpCode::kRotate:
+        op.args[0] = ToDegrees(obj->GetNumber("angle"));
+        return true;
+    case KRCanvasOpCode::kTransform: {
+        auto values = obj->GetNumberArray("values");
+        if (values.size() < 9) {
+            return false;
+        }
+        op.index = AddFloats(std::vector<float>(values.begin(), values.begin() + 9));
+        return true;
+    }
+    case KRCanvasOpCode::kDrawImage: {
+        // sWidth/sHeight 小于 0 时回放时取图片尺寸，dWidth/dHeight 为 NaN 时取 sWidth/sHeight
+        const double unspecified = std::numeric_limits<double>::quiet_NaN();
+        op.index = AddString(obj->GetString("cacheKey"));
+        op.args[0] = obj->GetNumber("sx");
+        op.args[1] = obj->GetNumber("sy");
+        op.args[2] = obj->GetNumber("sWidth", -1);
+        op.args[3] = obj->GetNumber("sHeight", -1);
+        op.args[4] = obj->GetNumber("dx");
+        op.args[5] = obj->GetNumber("dy");
+        op.args[6] = obj->GetNumber("dWidth", unspecified);
+        op.args[7] = obj->GetNumber("dHeight", unspecified);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+bool KRCanvasDisplayList::CompileStyle(KRCanvasOp &op, const std::string &params) {
+    auto paramObj = kuikly::util::JSONObject::Parse(params);
+    if (paramObj == nullptr) {
+        return false;
+    }
+    bool is_fill = op.code == KRCanvasOpCode::kFillStyle;
+    const std::string style = paramObj->GetString("style");
+    if (style.compare(0, LINEAR_GRADIENT.size(), LINEAR_GRADIENT) == 0) {
+        // 解析失败时回放为清除着色器
+        KRCanvasGradient gradient;
+        if (auto gradientObj = kuikly::util::JSONObject::Parse(style.substr(LINEAR_GRADIENT.size()))) {
+            gradient.x0 = gradientObj->GetNumber("x0");
+            gradient.y0 = gradientObj->GetNumber("y0");
+            gradient.x1 = gradientObj->GetNumber("x1");
+            gradient.y1 = gradientObj->GetNumber("y1");
+            for (const auto &colorStop : Split(gradientObj->GetString("colorStops"), ',')) {
+                if (colorStop.empty()) {
+                    continue;
+                }
+                auto colorAndStop = Split(colorStop, ' ');
+                if (colorAndStop.size() < 2) {
+                    continue;
+                }
+                gradient.colors.push_back(ParseColor(colorAndStop[0]));
+                gradient.locations.push_back(std::strtof(colorAndStop[1].c_str(), nullptr));
+            }
+        }
+        gradients_.push_back(std::move(gradient));
+        op.code = is_fill ? KRCanvasOpCode::kFillGradient : KRCanvasOpCode::kStrokeGradient;
+        op.index = gradients_.size() - 1;
+    } else if (is_fill) {
+        op.index = kuikly::graphics::Color::FromString(style).value;
+    } else {
+        op.index = ParseColor(style);
+    }
+    return true;
+}
+
+bool KRCanvasDisplayList::CompileArc(KRCanvasOp &op, const std::string &params) {
+    auto paramObj = kuikly::util::JSONObject::Parse(params);
+    if (paramObj == nullptr) {
+        return false;
+    }
+    float x = paramObj->GetNumber("x");
+    float y = paramObj->GetNumber("y");
+    float r = paramObj->GetNumber("r");
+    float startAngle = ToDegrees(paramObj->GetNumber("sAngle"));
+    float endAngle = ToDegrees(paramObj->GetNumber("eAngle"));
+    bool ccw = paramObj->GetNumber("counterclockwise");
+    float sweepAngle = endAngle - startAngle;
+    if (ccw) {
+        // Preprocessing for counter-clockwise drawing:
+        // 0. Angles in (-720, 0] require no processing
+        // 1. sweepAngle > 0, startAngle and endAngle represent absolute angles, convert to [-360, 0)
+        // 2. sweepAngle <= -720, drawing exceeds 2 turns, convert to (-720, -360]
+        // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in (-720, 0]
+        if (sweepAngle > 0 || sweepAngle <= -720) {
+            sweepAngle = std::fmod(sweepAngle, 360) - 360;
+        }
+    } else {
+        // Preprocessing for clockwise drawing:
+        // 0. Angles in [0, 720) require no processing
+        // 1. sweepAngle < 0, startAngle and endAngle represent absolute angles, convert to (0, 360]
+        // 2. sweepAngle >= 720, drawing exceeds 2 turns, convert to [360, 720)
+        // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in [0, 720)
+        if (sweepAngle < 0 || sweepAngle >= 720) {
+            sweepAngle = std::fmod(sweepAngle, 360) + 360;
+        }
+    }
+    op.args[0] = x - r;
+    op.args[1] = y - r;
+    op.args[2] = x + r;
+    op.args[3] = y + r;
+    op.args[4] = startAngle;
+    op.args[5] = sweepAngle;
+    return true;
+}
+
+void KRCanvasDisplayList::Replay(IKRCanvasReplayer &replayer) const {
+    for (const auto &op : ops_) {
+        ReplayOp(op, replayer);
+    }
+}
+
+void KRCanvasDisplayList::ReplayOp(const KRCanvasOp &op, IKRCanvasReplayer &replayer) const {
+    auto &a = op.args;
+    switch (op.code) {
+    case KRCanvasOpCode::kLineCap:
+        replayer.SetLineCap(static_cast<KRCanvasLineCap>(op.index));
+        break;
+    case KRCanvasOpCode::kLineWidth:
+        replayer.SetLineWidth(a[0]);
+        break;
+    case KRCanvasOpCode::kLineDash:
+        replayer.SetLineDash(FloatsAt(op.index));
+        break;
+    case KRCanvasOpCode::kStrokeStyle:
+        replayer.SetStrokeColor(op.index);
+        break;
+    case KRCanvasOpCode::kFillStyle:
+        replayer.SetFillColor(op.index);
+        break;
+    case KRCanvasOpCode::kStrokeGradient:
+        replayer.SetStrokeGradient(GradientAt(op.index));
+        break;
+    case KRCanvasOpCode::kFillGradient:
+        replayer.SetFillGradient(GradientAt(op.index));
+        break;
+    case KRCanvasOpCode::kBeginPath:
+        replayer.BeginPath();
+        break;
+    case KRCanvasOpCode::kMoveTo:
+        replayer.MoveTo(a[0], a[1]);
+        break;
+    case KRCanvasOpCode::kLineTo:
+        replayer.LineTo(a[0], a[1]);
+        break;
+    case KRCanvasOpCode::kArc:
+        replayer.ArcTo(a[0], a[1], a[2], a[3], a[4], a[5]);
+        break;
+    case KRCanvasOpCode::kClosePath:
+        replayer.ClosePath();
+        break;
+    case KRCanvasOpCode::kStroke:
+        replayer.Stroke();
+        break;
+    case KRCanvasOpCode::kFill:
+        replayer.Fill();
+        break;
+    case KRCanvasOpCode::kQuadraticCurveTo:
+        replayer.QuadTo(a[0], a[1], a[2], a[3]);
+        break;
+    case KRCanvasOpCode::kBezierCurveTo:
+        replayer.CubicTo(a[0], a[1], a[2], a[3], a[4], a[5]);
+        break;
+    case KRCanvasOpCode::kTextAlign:
+        replayer.SetTextAlign(static_cast<KRCanvasTextAlign>(op.index));
+        break;
+    case KRCanvasOpCode::kFont:
+        replayer.SetFont(StringAt(op.index), a[0], static_cast<int>(a[1]), static_cast<KRCanvasFontStyle>(a[2]));
+        break;
+    case KRCanvasOpCode::kFillText:
+    case KRCanvasOpCode::kStrokeText:
+        replayer.DrawText(StringAt(op.index), a[0], a[1], op.code == KRCanvasOpCode::kFillText);
+        break;
+    case KRCanvasOpCode::kSave:
+        replayer.Save();
+        break;
+    case KRCanvasOpCode::kSaveLayer:
+        replayer.SaveLayer(a[0], a[1], a[2], a[3]);
+        break;
+    case KRCanvasOpCode::kRestore:
+        replayer.Restore();
+        break;
+    case KRCanvasOpCode::kClip:
+        replayer.Clip(op.index != 0);
+        break;
+    case KRCanvasOpCode::kTranslate:
+        replayer.Translate(a[0], a[1]);
+        break;
+    case KRCanvasOpCode::kScale:
+        replayer.Scale(a[0], a[1]);
+        break;
+    case KRCanvasOpCode::kRotate:
+        replayer.Rotate(a[0]);
+        break;
+    case KRCanvasOpCode::kSkew:
+        replayer.Skew(a[0], a[1]);
+        break;
+    case KRCanvasOpCode::kTransform:
+        replayer.Concat(FloatsAt(op.index));
+        break;
+    case KRCanvasOpCode::kDrawImage:
+        replayer.DrawImage(StringAt(op.index), a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+        break;
+    default:
+        break;
+    }
+}
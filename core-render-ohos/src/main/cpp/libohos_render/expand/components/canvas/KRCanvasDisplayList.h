@@ -0,0 +1,212 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
+#define CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class KRCanvasOpCode : uint8_t {
+    kLineCap,
+    kLineWidth,
+    kLineDash,
+    kStrokeStyle,
+    kFillStyle,
+    kBeginPath,
+    kMoveTo,
+    kLineTo,
+    kArc,
+    kClosePath,
+    kStroke,
+    kFill,
+    kCreateLinearGradient,
+    kQuadraticCurveTo,
+    kTextAlign,
+    kFont,
+    kFillText,
+    kStrokeText,
+    kBezierCurveTo,
+    kSave,
+    kSaveLayer,
+    kRestore,
+    kClip,
+    kTranslate,
+    kScale,
+    kRotate,
+    kSkew,
+    kTransform,
+    kDrawImage,
+    // 以下为编译期改写的指令，不对应 method
+    kStrokeGradient,
+    kFillGradient,
+};
+
+enum class KRCanvasLineCap : uint32_t {
+    kButt,
+    kRound,
+    kSquare,
+};
+
+enum class KRCanvasTextAlign : uint32_t {
+    kLeft,
+    kCenter,
+    kRight,
+};
+
+enum class KRCanvasFontStyle : uint32_t {
+    kNormal,
+    kItalic,
+};
+
+/**
+ * 编译后的绘制指令，数值参数已在 append 时解析完成
+ * 变长参数（字符串、数组、渐变）存放在 KRCanvasDisplayList 的侧表中，通过 index 引用
+ */
+struct KRCanvasOp {
+    static constexpr int kMaxArgs = 8;
+
+    KRCanvasOpCode code;
+    uint32_t index = 0;  // 枚举值/标志位，或侧表下标
+    float args[kMaxArgs] = {0};
+};
+
+/**
+ * 线性渐变样式，着色器在回放时按需创建
+ */
+struct KRCanvasGradient {
+    float x0 = 0;
+    float y0 = 0;
+    float x1 = 0;
+    float y1 = 0;
+    std::vector<uint32_t> colors;
+    std::vector<float> locations;
+};
+
+/**
+ * 绘制指令的回放目标，参数均为编译后的值
+ * 真机上由 KRCanvasView 转为 OH_Drawing 调用，测试中可替换为记录调用的实现
+ */
+class IKRCanvasReplayer {
+ public:
+    virtual ~IKRCanvasReplayer() = default;
+
+    virtual void SetLineCap(KRCanvasLineCap cap) = 0;
+    virtual void SetLineWidth(float width) = 0;
+    // intervals 为空时清除虚线
+    virtual void SetLineDash(const std::vector<float> &intervals) = 0;
+    virtual void SetStrokeColor(uint32_t color) = 0;
+    virtual void SetFillColor(uint32_t color) = 0;
+    // gradient.colors 为空时清除着色器
+    virtual void SetStrokeGradient(const KRCanvasGradient &gradient) = 0;
+    virtual void SetFillGradient(const KRCanvasGradient &gradient) = 0;
+
+    virtual void BeginPath() = 0;
+    virtual void MoveTo(float x, float y) = 0;
+    virtual void LineTo(float x, float y) = 0;
+    // 角度单位为度，sweep_angle 已归一化到 (-720, 720)
+    virtual void ArcTo(float left, float top, float right, float bottom, float start_angle, float sweep_angle) = 0;
+    virtual void QuadTo(float cpx, float cpy, float x, float y) = 0;
+    virtual void CubicTo(float cp1x, float cp1y, float cp2x, float cp2y, float x, float y) = 0;
+    virtual void ClosePath() = 0;
+    virtual void Stroke() = 0;
+    virtual void Fill() = 0;
+
+    virtual void SetTextAlign(KRCanvasTextAlign align) = 0;
+    // weight 为未经缩放的原始字重
+    virtual void SetFont(const std::string &family, float size, int weight, KRCanvasFontStyle style) = 0;
+    virtual void DrawText(const std::string &text, float x, float y, bool fill) = 0;
+
+    virtual void Save() = 0;
+    virtual void SaveLayer(float left, float top, float right, float bottom) = 0;
+    virtual void Restore() = 0;
+    // 以当前路径裁剪，intersect 为 false 时取差集
+    virtual void Clip(bool intersect) = 0;
+    virtual void Translate(float x, float y) = 0;
+    virtual void Scale(float x, float y) = 0;
+    virtual void Rotate(float degrees) = 0;
+    virtual void Skew(float x, float y) = 0;
+    // matrix 为 9 个元素的 3x3 行主序矩阵
+    virtual void Concat(const std::vector<float> &matrix) = 0;
+    // s_width/s_height 小于 0 时取图片尺寸，d_width/d_height 为 NaN 时取 s_width/s_height
+    virtual void DrawImage(const std::string &cache_key, float sx, float sy, float s_width, float s_height, float dx,
+                           float dy, float d_width, float d_height) = 0;
+};
+
+/**
+ * 颜色字符串解析函数
+ */
+using KRCanvasColorParser = uint32_t (*)(const std::string &color);
+
+/**
+ * canvas 绘制指令列表：CallMethod 时编译一次，OnDraw 时直接按 opcode 回放，避免每帧的字符串比较和 json 解析
+ * 注：本类只负责编译与存储，不依赖 OH_Drawing，绘制由 IKRCanvasReplayer 实现
+ */
+class KRCanvasDisplayList {
+ public:
+    /**
+     * @param color_parser 解析 strokeStyle 与渐变色标的颜色，为空时与 fillStyle 一样按 rgba()/#/十进制解析
+     */
+    explicit KRCanvasDisplayList(KRCanvasColorParser color_parser = nullptr);
+
+    /**
+     * 查找 method 对应的 opcode，非绘制指令返回 false
+     */
+    static bool OpCodeOf(const std::string &method, KRCanvasOpCode &code);
+
+    /**
+     * 编译并追加一条指令，参数非法或回放时无效果的指令会被丢弃
+     */
+    void Append(KRCanvasOpCode code, const std::string &params);
+
+    void Clear();
+
+    /**
+     * 按顺序回放全部指令
+     */
+    void Replay(IKRCanvasReplayer &replayer) const;
+
+    const std::vector<KRCanvasOp> &Ops() const {
+        return ops_;
+    }
+    const std::string &StringAt(uint32_t index) const {
+        return strings_[index];
+    }
+    const std::vector<float> &FloatsAt(uint32_t index) const {
+        return float_arrays_[index];
+    }
+    const KRCanvasGradient &GradientAt(uint32_t index) const {
+        return gradients_[index];
+    }
+
+ private:
+    bool Compile(KRCanvasOp &op, const std::string &params);
+    bool CompileStyle(KRCanvasOp &op, const std::string &params);
+    bool CompileArc(KRCanvasOp &op, const std::string &params);
+    void ReplayOp(const KRCanvasOp &op, IKRCanvasReplayer &replayer) const;
+    uint32_t ParseColor(const std::string &color) const;
+
+    uint32_t AddString(std::string str);
+    uint32_t AddFloats(std::vector<float> floats);
+
+    KRCanvasColorParser color_parser_;
+    std::vector<KRCanvasOp> ops_;
+    std::vector<std::string> strings_;
+    std::vector<std::vector<float>> float_arrays_;
+    std::vector<KRCanvasGradient> gradients_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRCANVASDISPLAYLIST_H
@@ -12,7 +12,6 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-
 #include "KRCanvasView.h"
 
 #include <multimedia/image_framework/image/pixelmap_native.h>
@@ -27,48 +26,15 @@
 #include <native_drawing/drawing_shader_effect.h>
 #include <native_drawing/drawing_types.h>
 #include <native_drawing/drawing_matrix.h>
+#include <cmath>
 
 #include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
-#include "libohos_render/utils/KRColor.h"
-#include "libohos_render/utils/KRJSONObject.h"
-
-static constexpr std::string_view LINE_CAP = "lineCap";
-static constexpr std::string_view LINE_WIDTH = "lineWidth";
-static constexpr std::string_view LINE_DASH = "lineDash";
-static constexpr std::string_view STROKE_STYLE = "strokeStyle";
-static constexpr std::string_view FILL_STYLE = "fillStyle";
-static constexpr std::string_view BEGIN_PATH = "beginPath";
-static constexpr std::string_view MOVE_TO = "moveTo";
-static constexpr std::string_view LINE_TO = "lineTo";
-static constexpr std::string_view ARC = "arc";
-static constexpr std::string_view CLOSE_PATH = "closePath";
+
 static constexpr std::string_view STROKE = "stroke";
 static constexpr std::string_view FILL = "fill";
-static constexpr std::string_view CREATE_LINEAR_GRADIENT = "createLinearGradient";
-static constexpr std::string_view QUADRATIC_CURVE_TO = "quadraticCurveTo";
-static constexpr std::string_view TEXT_ALIGN = "textAlign";
-static constexpr std::string_view FONT = "font";
-static constexpr std::string_view FILL_TEXT = "fillText";
-static constexpr std::string_view STROKE_TEXT = "strokeText";
-static constexpr std::string_view BEZIER_CURVE_TO = "bezierCurveTo";
 static constexpr std::string_view RESET = "reset";
-static constexpr std::string_view LINEAR_GRADIENT = "linear-gradient";
-static constexpr std::string_view SAVE = "save";
-static constexpr std::string_view SAVE_LAYER = "saveLayer";
-static constexpr std::string_view RESTORE = "restore";
-static constexpr std::string_view CLIP = "clip";
-static constexpr std::string_view TRANSLATE = "translate";
-static constexpr std::string_view SCALE = "scale";
-static constexpr std::string_view ROTATE = "rotate";
-static constexpr std::string_view SKEW = "skew";
-static constexpr std::string_view TRANSFORM = "transform";
-static constexpr std::string_view DRAW_IMAGE = "drawImage";
-
-KRCanvasView::KRCanvasView()
-    : KRView(), cachable_methods_({LINE_CAP, LINE_WIDTH, LINE_DASH, STROKE_STYLE, FILL_STYLE, BEGIN_PATH, MOVE_TO,
-                                   LINE_TO, ARC, CLOSE_PATH, STROKE, FILL, CREATE_LINEAR_GRADIENT, QUADRATIC_CURVE_TO,
-                                   TEXT_ALIGN, FONT, FILL_TEXT, STROKE_TEXT, BEZIER_CURVE_TO, SAVE, SAVE_LAYER,
-                                   RESTORE, CLIP, TRANSLATE, SCALE, ROTATE, SKEW, TRANSFORM, DRAW_IMAGE}) {
+
+KRCanvasView::KRCanvasView() : KRView(), display_list_(kuikly::util::ConvertToHexColor) {
     // ctor body left blank
 }
 void KRCanvasView::DidMoveToParentView() {
@@ -79,9 +45,14 @@ void KRCanvasView::DidMoveToParentView() {
 void KRCanvasView::DidInit() {
     IKRRenderViewExport::DidInit();
 }
+void KRCanvasView::OnDestroy() {
+    KRView::OnDestroy();
+    UnpinUnusedImages(true);
+}
 
 bool KRCanvasView::ShouldCacheOp(const std::string &method) {
-    return cachable_methods_.find(method) != cachable_methods_.end();
+    KRCanvasOpCode code;
+    return KRCanvasDisplayList::OpCodeOf(method, code);
 }
 
 bool KRCanvasView::MarkDirtyIfNeeded(const std::string &method) {
@@ -113,128 +84,89 @@ void KRCanvasView::OnCustomEvent(ArkUI_NodeCustomEvent *event, const ArkUI_NodeC
     }
 }
 
-void KRCanvasView::SetLineCap(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    std::string str = obj->GetString("style");
-    OH_Drawing_PenLineCapStyle style = LINE_FLAT_CAP;
-    if (str == "round") {
-        style = LINE_ROUND_CAP;
-    } else if (str == "square") {
-        style = LINE_SQUARE_CAP;
-    }
+OH_Drawing_Pen *KRCanvasView::GetOrCreatePen() {
     if (pen_ == nullptr) {
         pen_ = OH_Drawing_PenCreate();
     }
-    OH_Drawing_PenSetCap(pen_, style);
+    return pen_;
 }
 
-void KRCanvasView::SetLineWidth(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float width = obj->GetNumber("width");
-
-    if (pen_ == nullptr) {
-        pen_ = OH_Drawing_PenCreate();
+OH_Drawing_Brush *KRCanvasView::GetOrCreateBrush() {
+    if (brush_ == nullptr) {
+        brush_ = OH_Drawing_BrushCreate();
     }
-    OH_Drawing_PenSetWidth(pen_, width);
+    return brush_;
 }
 
-void KRCanvasView::SetLineDash(const std::string &params) {
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    auto intervalsVector = obj->GetNumberArray("intervals");
-    int count = intervalsVector.size();
-    if (pen_ == nullptr) {
-        pen_ = OH_Drawing_PenCreate();
+void KRCanvasView::SetLineCap(KRCanvasLineCap cap) {
+    auto style = LINE_FLAT_CAP;
+    if (cap == KRCanvasLineCap::kRound) {
+        style = LINE_ROUND_CAP;
+    } else if (cap == KRCanvasLineCap::kSquare) {
+        style = LINE_SQUARE_CAP;
     }
-    if (count == 0) {
-        OH_Drawing_PenSetPathEffect(pen_, nullptr);
+    OH_Drawing_PenSetCap(GetOrCreatePen(), style);
+}
+
+void KRCanvasView::SetLineWidth(float width) {
+    OH_Drawing_PenSetWidth(GetOrCreatePen(), width);
+}
+
+void KRCanvasView::SetLineDash(const std::vector<float> &intervals) {
+    auto pen = GetOrCreatePen();
+    if (intervals.empty()) {
+        OH_Drawing_PenSetPathEffect(pen, nullptr);
         return;
     }
-    std::vector<float> intervals(intervalsVector.begin(), intervalsVector.end());
-    auto pathEffect = OH_Drawing_CreateDashPathEffect(intervals.data(), count, 0);
-    OH_Drawing_PenSetPathEffect(pen_, pathEffect);
+    auto pathEffect = OH_Drawing_CreateDashPathEffect(const_cast<float *>(intervals.data()), intervals.size(), 0);
+    OH_Drawing_PenSetPathEffect(pen, pathEffect);
     OH_Drawing_PathEffectDestroy(pathEffect);
 }
 
-void processColorStops(const std::string &colorStopsStr, std::vector<uint32_t> &colors, std::vector<float> &locations) {
-    std::vector<std::string> splits = kuikly::util::ConvertSplit(colorStopsStr, ",");
+void KRCanvasView::SetStrokeColor(uint32_t color) {
+    auto pen = GetOrCreatePen();
+    OH_Drawing_PenSetShaderEffect(pen, nullptr);
+    OH_Drawing_PenSetColor(pen, color);
+}
+
+void KRCanvasView::SetFillColor(uint32_t color) {
+    auto brush = GetOrCreateBrush();
+    OH_Drawing_BrushSetShaderEffect(brush, nullptr);
+    OH_Drawing_BrushSetColor(brush, color);
+}
 
-    for (const auto &colorStopStr : splits) {
-        if (colorStopStr.empty()) {
-            continue;
-        }
-        std::vector<std::string> colorAndStop = kuikly::util::ConvertSplit(colorStopStr, " ");
-        if (colorAndStop.size() < 2) {
-            continue;
-        }
-        colors.push_back(kuikly::util::ConvertToHexColor(colorAndStop[0]));
-        locations.push_back(std::stof(colorAndStop[1]));
-    }
-}
-
-OH_Drawing_ShaderEffect *parseGradientStyle(const std::string &style) {
-    auto paramObj = kuikly::util::JSONObject::Parse(style.substr(LINEAR_GRADIENT.size()));
-    OH_Drawing_ShaderEffect *colorShaderEffect = nullptr;
-    if (paramObj) {
-        float x0 = paramObj->GetNumber("x0");
-        float y0 = paramObj->GetNumber("y0");
-        float x1 = paramObj->GetNumber("x1");
-        float y1 = paramObj->GetNumber("y1");
-        const std::string colorStopsStr = paramObj->GetString("colorStops");
-
-        std::vector<uint32_t> colors;
-        std::vector<float> locations;
-        processColorStops(colorStopsStr, colors, locations);
-
-        // 开始点
-        OH_Drawing_Point *startPt = OH_Drawing_PointCreate(x0, y0);
-        // 结束点
-        OH_Drawing_Point *endPt = OH_Drawing_PointCreate(x1, y1);
-        // 创建线性渐变着色器效果
-        colorShaderEffect = OH_Drawing_ShaderEffectCreateLinearGradient(startPt, endPt, colors.data(), locations.data(),
-                                                                        colors.size(), OH_Drawing_TileMode::CLAMP);
-        OH_Drawing_PointDestroy(startPt);
-        OH_Drawing_PointDestroy(endPt);
+static OH_Drawing_ShaderEffect *CreateGradientShader(const KRCanvasGradient &gradient) {
+    if (gradient.colors.empty()) {
+        return nullptr;
     }
+    // 开始点
+    OH_Drawing_Point *startPt = OH_Drawing_PointCreate(gradient.x0, gradient.y0);
+    // 结束点
+    OH_Drawing_Point *endPt = OH_Drawing_PointCreate(gradient.x1, gradient.y1);
+    // 创建线性渐变着色器效果
+    OH_Drawing_ShaderEffect *colorShaderEffect =
+        OH_Drawing_ShaderEffectCreateLinearGradient(startPt, endPt, gradient.colors.data(), gradient.locations.data(),
+                                                    gradient.colors.size(), OH_Drawing_TileMode::CLAMP);
+    OH_Drawing_PointDestroy(startPt);
+    OH_Drawing_PointDestroy(endPt);
     return colorShaderEffect;
 }
 
-void KRCanvasView::SetStrokeStyle(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        const std::string style = paramObj->GetString("style");
-        if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
-            OH_Drawing_ShaderEffect *colorShaderEffect = parseGradientStyle(style);
-            if (pen_ == nullptr) {
-                pen_ = OH_Drawing_PenCreate();
-            }
-            OH_Drawing_PenSetShaderEffect(pen_, colorShaderEffect);
-        } else {
-            if (pen_ == nullptr) {
-                pen_ = OH_Drawing_PenCreate();
-            }
-            OH_Drawing_PenSetShaderEffect(pen_, nullptr);
-            OH_Drawing_PenSetColor(pen_, kuikly::util::ConvertToHexColor(style));
-        }
+void KRCanvasView::SetStrokeGradient(const KRCanvasGradient &gradient) {
+    OH_Drawing_ShaderEffect *colorShaderEffect = CreateGradientShader(gradient);
+    OH_Drawing_PenSetShaderEffect(GetOrCreatePen(), colorShaderEffect);
+    if (colorShaderEffect) {
+        // pen 内部持有着色器引用
+        OH_Drawing_ShaderEffectDestroy(colorShaderEffect);
     }
 }
-void KRCanvasView::SetFillStyle(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        const std::string style = paramObj->GetString("style");
-        if (style.substr(0, LINEAR_GRADIENT.size()) == LINEAR_GRADIENT) {
-            OH_Drawing_ShaderEffect *colorShaderEffect = parseGradientStyle(style);
-            if (brush_ == nullptr) {
-                brush_ = OH_Drawing_BrushCreate();
-            }
-            OH_Drawing_BrushSetShaderEffect(brush_, colorShaderEffect);
-        } else {
-            if (brush_ == nullptr) {
-                brush_ = OH_Drawing_BrushCreate();
-            }
-            OH_Drawing_BrushSetShaderEffect(brush_, nullptr);
-            kuikly::graphics::Color color = kuikly::graphics::Color::FromString(style);
-            OH_Drawing_BrushSetColor(brush_, color.value);
-        }
+
+void KRCanvasView::SetFillGradient(const KRCanvasGradient &gradient) {
+    OH_Drawing_ShaderEffect *colorShaderEffect = CreateGradientShader(gradient);
+    OH_Drawing_BrushSetShaderEffect(GetOrCreateBrush(), colorShaderEffect);
+    if (colorShaderEffect) {
+        // brush 内部持有着色器引用
+        OH_Drawing_ShaderEffectDestroy(colorShaderEffect);
     }
 }
 
@@ -245,68 +177,42 @@ void KRCanvasView::BeginPath() {
     drawingPath_ = OH_Drawing_PathCreate();
 }
 
-void KRCanvasView::MoveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
+void KRCanvasView::MoveTo(float x, float y) {
+    if (drawingPath_) {
+        OH_Drawing_PathMoveTo(drawingPath_, x, y);
     }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
+}
 
-    OH_Drawing_PathMoveTo(drawingPath_, x, y);
+void KRCanvasView::LineTo(float x, float y) {
+    if (drawingPath_) {
+        OH_Drawing_PathLineTo(drawingPath_, x, y);
+    }
 }
 
-void KRCanvasView::LineTo(const std::string &params) {
+void KRCanvasView::ArcTo(float left, float top, float right, float bottom, float start_angle, float sweep_angle) {
     if (drawingPath_ == nullptr) {
         return;
     }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathLineTo(drawingPath_, x, y);
+    if (std::fabs(sweep_angle) < 360) {
+        // Deal with arc less than 2π
+        OH_Drawing_PathArcTo(drawingPath_, left, top, right, bottom, start_angle, sweep_angle);
+    } else {
+        // Deal with arc greater than or equal to 2π
+        float halfSweepAngle = sweep_angle * 0.5;
+        OH_Drawing_PathArcTo(drawingPath_, left, top, right, bottom, start_angle, halfSweepAngle);
+        OH_Drawing_PathArcTo(drawingPath_, left, top, right, bottom, start_angle + halfSweepAngle, halfSweepAngle);
+    }
 }
 
-void KRCanvasView::Arc(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
+void KRCanvasView::QuadTo(float cpx, float cpy, float x, float y) {
+    if (drawingPath_) {
+        OH_Drawing_PathQuadTo(drawingPath_, cpx, cpy, x, y);
     }
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    if (paramObj) {
-        float x = paramObj->GetNumber("x");
-        float y = paramObj->GetNumber("y");
-        float r = paramObj->GetNumber("r");
-        float startAngle = paramObj->GetNumber("sAngle") * 180 / M_PI;
-        float endAngle = paramObj->GetNumber("eAngle") * 180 / M_PI;
-        bool ccw = paramObj->GetNumber("counterclockwise");
-        float sweepAngle = endAngle - startAngle;
-        if (ccw) {
-            // Preprocessing for counter-clockwise drawing:
-            // 0. Angles in (-720, 0] require no processing
-            // 1. sweepAngle > 0, startAngle and endAngle represent absolute angles, convert to [-360, 0)
-            // 2. sweepAngle <= -720, drawing exceeds 2 turns, convert to (-720, -360]
-            // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in (-720, 0]
-            if (sweepAngle > 0 || sweepAngle <= -720) {
-                sweepAngle = std::fmod(sweepAngle, 360) - 360;
-            }
-        } else {
-            // Preprocessing for clockwise drawing:
-            // 0. Angles in [0, 720) require no processing
-            // 1. sweepAngle < 0, startAngle and endAngle represent absolute angles, convert to (0, 360]
-            // 2. sweepAngle >= 720, drawing exceeds 2 turns, convert to [360, 720)
-            // Rules 2 and 3 share the same formula; In summary, final sweepAngle is in [0, 720)
-            if (sweepAngle < 0 || sweepAngle >= 720) {
-                sweepAngle = std::fmod(sweepAngle, 360) + 360;
-            }
-        }
-        if (std::fabs(sweepAngle) < 360) {
-            // Deal with arc less than 2π
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle, sweepAngle);
-        } else {
-            // Deal with arc greater than or equal to 2π
-            float halfSweepAngle = sweepAngle * 0.5;
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle, halfSweepAngle);
-            OH_Drawing_PathArcTo(drawingPath_, x - r, y - r, x + r, y + r, startAngle + halfSweepAngle, halfSweepAngle);
-        }
+}
+
+void KRCanvasView::CubicTo(float cp1x, float cp1y, float cp2x, float cp2y, float x, float y) {
+    if (drawingPath_) {
+        OH_Drawing_PathCubicTo(drawingPath_, cp1x, cp1y, cp2x, cp2y, x, y);
     }
 }
 
@@ -340,57 +246,38 @@ void KRCanvasView::Fill() {
     }
 }
 
-void KRCanvasView::SetTextAlign(const std::string &params) {
-    if (params == "left") {
-        text_feature_.textAlign = TEXT_ALIGN_LEFT;
-    } else if (params == "center") {
+void KRCanvasView::SetTextAlign(KRCanvasTextAlign align) {
+    text_feature_.textAlign = TEXT_ALIGN_LEFT;
+    if (align == KRCanvasTextAlign::kCenter) {
         text_feature_.textAlign = TEXT_ALIGN_CENTER;
-    } else if (params == "right") {
+    } else if (align == KRCanvasTextAlign::kRight) {
         text_feature_.textAlign = TEXT_ALIGN_RIGHT;
     }
 }
 
-void KRCanvasView::SetFont(const std::string &params) {
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    auto size = paramObj->GetNumber("size");
-    auto style = paramObj->GetString("style");
-    auto weight = std::stoi(paramObj->GetString("weight"));
-    auto family = paramObj->GetString("family");
-    
+void KRCanvasView::SetFont(const std::string &family, float size, int weight, KRCanvasFontStyle style) {
     float scale = 1.0;
     if (auto root = GetRootView().lock()) {
         scale = root->GetContext()->Config()->GetFontWeightScale();
     }
 
     text_feature_.fontSize = size;
-    text_feature_.fontStyle = kuikly::util::ConvertToFontStyle(style);
     text_feature_.fontWeight = kuikly::util::ConvertFontWeight(weight, scale);
+    text_feature_.fontStyle = style == KRCanvasFontStyle::kItalic ? FONT_STYLE_ITALIC : FONT_STYLE_NORMAL;
     text_feature_.fontFamily = family;
 }
 
-void KRCanvasView::FillText(const std::string &params) {
-    if (canvas_) {
-        std::shared_ptr<struct KRFontCollectionWrapper> font_collection_wrapper =
-            std::make_shared<KRFontCollectionWrapper>();
-        DrawText(params, font_collection_wrapper, FILL_TEXT);
-    }
-}
-
-void KRCanvasView::StrokeText(const std::string &params) {
-    if (canvas_) {
-        std::shared_ptr<struct KRFontCollectionWrapper> font_collection_wrapper =
-            std::make_shared<KRFontCollectionWrapper>();
-        DrawText(params, font_collection_wrapper, STROKE_TEXT);
+void KRCanvasView::DrawText(const std::string &text, float x, float y, bool fill) {
+    if (canvas_ == nullptr) {
+        return;
     }
-}
-
-void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCollectionWrapper> wrapper,
-                            std::string_view type) {
+    auto wrapper = std::make_shared<KRFontCollectionWrapper>();
     OH_Drawing_TextStyle *txtStyle = OH_Drawing_CreateTextStyle();
     // 设置文字大小、字重等属性
     float fontSizeScale = 1;
     auto rootView = GetRootView().lock();
     if (rootView == nullptr) {
+        OH_Drawing_DestroyTextStyle(txtStyle);
         return;
     }
     if (auto context = rootView->GetContext()) {
@@ -420,23 +307,12 @@ void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCol
     // 使用左对齐
     OH_Drawing_SetTypographyTextAlign(typoStyle, TEXT_ALIGN_LEFT);
 
-    if (type == FILL_TEXT) {
-        if (brush_ == nullptr) {
-            brush_ = OH_Drawing_BrushCreate();
-        }
-        OH_Drawing_SetTextStyleForegroundBrush(txtStyle, brush_);
-    } else if (type == STROKE_TEXT) {
-        if (pen_ == nullptr) {
-            pen_ = OH_Drawing_PenCreate();
-        }
-        OH_Drawing_SetTextStyleForegroundPen(txtStyle, pen_);
+    if (fill) {
+        OH_Drawing_SetTextStyleForegroundBrush(txtStyle, GetOrCreateBrush());
+    } else {
+        OH_Drawing_SetTextStyleForegroundPen(txtStyle, GetOrCreatePen());
     }
 
-    auto paramObj = kuikly::util::JSONObject::Parse(params);
-    auto text = paramObj->GetString("text");
-    auto x = paramObj->GetNumber("x");
-    auto y = paramObj->GetNumber("y");
-
     OH_Drawing_TypographyCreate *handler = OH_Drawing_CreateTypographyHandler(typoStyle, wrapper->fontCollection);
     OH_Drawing_TypographyHandlerPushTextStyle(handler, txtStyle);
     // 设置文字内容
@@ -460,11 +336,7 @@ void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCol
         left = 0;
     }
 
-    x -= left;
-    // 修改y为baseLine在屏幕上的位置
-    y -= baseLineHeight;
-
-    double position[2] = {x, y};
+    double position[2] = {x - left, y - baseLineHeight};  // y 为 baseLine 在屏幕上的位置
     OH_Drawing_TypographyPaint(typography, canvas_, position[0], position[1]);
     // 释放变量
     OH_Drawing_DestroyTypography(typography);
@@ -473,46 +345,15 @@ void KRCanvasView::DrawText(std::string params, std::shared_ptr<struct KRFontCol
     OH_Drawing_DestroyTextStyle(txtStyle);
 }
 
-void KRCanvasView::QuadraticCurveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
-    }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float cpx = obj->GetNumber("cpx");
-    float cpy = obj->GetNumber("cpy");
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathQuadTo(drawingPath_, cpx, cpy, x, y);
-}
-
-void KRCanvasView::BezierCurveTo(const std::string &params) {
-    if (drawingPath_ == nullptr) {
-        return;
-    }
-    auto obj = kuikly::util::JSONObject::Parse(params);
-    float cp1x = obj->GetNumber("cp1x");
-    float cp1y = obj->GetNumber("cp1y");
-    float cp2x = obj->GetNumber("cp2x");
-    float cp2y = obj->GetNumber("cp2y");
-    float x = obj->GetNumber("x");
-    float y = obj->GetNumber("y");
-    OH_Drawing_PathCubicTo(drawingPath_, cp1x, cp1y, cp2x, cp2y, x, y);
-}
-
 void KRCanvasView::Save() {
     if (canvas_) {
         OH_Drawing_CanvasSave(canvas_);
     }
 }
 
-void KRCanvasView::SaveLayer(const std::string &params) {
+void KRCanvasView::SaveLayer(float left, float top, float right, float bottom) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
-        float width = obj->GetNumber("width");
-        float height = obj->GetNumber("height");
-        OH_Drawing_Rect *rect = OH_Drawing_RectCreate(x, y, x + width, y + height);
+        OH_Drawing_Rect *rect = OH_Drawing_RectCreate(left, top, right, bottom);
         OH_Drawing_CanvasSaveLayer(canvas_, rect, brush_);
         OH_Drawing_RectDestroy(rect);
     }
@@ -524,57 +365,39 @@ void KRCanvasView::Restore() {
     }
 }
 
-void KRCanvasView::clip(const std::string &params) {
+void KRCanvasView::Clip(bool intersect) {
     if (canvas_ && drawingPath_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        auto op = obj->GetNumber("intersect") ? OH_Drawing_CanvasClipOp::INTERSECT
-                                              : OH_Drawing_CanvasClipOp::DIFFERENCE;
-        OH_Drawing_CanvasClipPath(canvas_, drawingPath_, op, true);
+        auto clipOp = intersect ? OH_Drawing_CanvasClipOp::INTERSECT : OH_Drawing_CanvasClipOp::DIFFERENCE;
+        OH_Drawing_CanvasClipPath(canvas_, drawingPath_, clipOp, true);
     }
 }
 
-void KRCanvasView::Translate(const std::string &params) {
+void KRCanvasView::Translate(float x, float y) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
         OH_Drawing_CanvasTranslate(canvas_, x, y);
     }
 }
 
-void KRCanvasView::Scale(const std::string &params) {
+void KRCanvasView::Scale(float x, float y) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
         OH_Drawing_CanvasScale(canvas_, x, y);
     }
 }
 
-void KRCanvasView::Rotate(const std::string &params) {
+void KRCanvasView::Rotate(float degrees) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float degrees = obj->GetNumber("angle") * 180 / M_PI;
         OH_Drawing_CanvasRotate(canvas_, degrees, 0, 0);
     }
 }
 
-void KRCanvasView::Skew(const std::string &params) {
+void KRCanvasView::Skew(float x, float y) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        float x = obj->GetNumber("x");
-        float y = obj->GetNumber("y");
         OH_Drawing_CanvasSkew(canvas_, x, y);
     }
 }
 
-void KRCanvasView::Transform(const std::string &params) {
+void KRCanvasView::Concat(const std::vector<float> &values) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        auto values = obj->GetNumberArray("values");
-        if (values.size() < 9) {
-            return;
-        }
         auto matrix = OH_Drawing_MatrixCreate();
         OH_Drawing_MatrixSetMatrix(matrix,
                                    values[0], values[1], values[2],
@@ -585,19 +408,18 @@ void KRCanvasView::Transform(const std::string &params) {
     }
 }
 
-void KRCanvasView::DrawImage(const std::string &params) {
+void KRCanvasView::DrawImage(const std::string &cache_key, float sx, float sy, float sWidth, float sHeight, float dx,
+                             float dy, float dWidth, float dHeight) {
     if (canvas_) {
-        auto obj = kuikly::util::JSONObject::Parse(params);
-        std::string cacheKey = obj->GetString("cacheKey");
         auto module = std::dynamic_pointer_cast<KRMemoryCacheModule>(GetModule(kMemoryCacheModuleName));
-        auto pixelmap = module->GetImage(cacheKey);
-        if (!pixelmap) {
+        if (!module) {
             return;
         }
-        float sx = obj->GetNumber("sx");
-        float sy = obj->GetNumber("sy");
-        float sWidth = obj->GetNumber("sWidth", -1);
-        float sHeight = obj->GetNumber("sHeight", -1);
+        auto cached_pixelmap = module->GetImage(cache_key);
+        if (!cached_pixelmap) {
+            return;
+        }
+        OH_PixelmapNative *pixelmap = cached_pixelmap.get();
         if (sWidth < 0 || sHeight < 0) {
             OH_Pixelmap_ImageInfo *info;
             OH_PixelmapImageInfo_Create(&info);
@@ -610,10 +432,12 @@ void KRCanvasView::DrawImage(const std::string &params) {
             sWidth = width;
             sHeight = height;
         }
-        float dx = obj->GetNumber("dx");
-        float dy = obj->GetNumber("dy");
-        float dWidth = obj->GetNumber("dWidth", sWidth);
-        float dHeight = obj->GetNumber("dHeight", sHeight);
+        if (std::isnan(dWidth)) {
+            dWidth = sWidth;
+        }
+        if (std::isnan(dHeight)) {
+            dHeight = sHeight;
+        }
 
         OH_Drawing_PixelMap *drawingPixelMap = OH_Drawing_PixelMapGetFromOhPixelMapNative(pixelmap);
         OH_Drawing_Rect *srcRect = OH_Drawing_RectCreate(sx, sy, sx + sWidth, sy + sHeight);
@@ -625,7 +449,7 @@ void KRCanvasView::DrawImage(const std::string &params) {
 }
 
 void KRCanvasView::Reset() {
-    ops_.clear();
+    display_list_.Clear();
 
     if (drawingPath_) {
         OH_Drawing_PathDestroy(drawingPath_);
@@ -642,7 +466,50 @@ void KRCanvasView::Reset() {
 }
 
 void KRCanvasView::AddOp(const std::string &method, const KRAnyValue &params) {
-    ops_.push_back(std::pair{method, params->toString()});
+    KRCanvasOpCode code;
+    if (!KRCanvasDisplayList::OpCodeOf(method, code)) {
+        return;
+    }
+    auto op_count = display_list_.Ops().size();
+    display_list_.Append(code, params->toString());
+    if (code == KRCanvasOpCode::kDrawImage && display_list_.Ops().size() > op_count) {
+        PinImage(display_list_.StringAt(display_list_.Ops().back().index));
+    }
+}
+
+void KRCanvasView::PinImage(const std::string &cache_key) {
+    if (pinned_image_keys_.count(cache_key)) {
+        return;
+    }
+    auto module = std::dynamic_pointer_cast<KRMemoryCacheModule>(GetModule(kMemoryCacheModuleName));
+    if (module && module->PinImage(cache_key)) {
+        pinned_image_keys_.insert(cache_key);
+    }
+}
+
+void KRCanvasView::UnpinUnusedImages(bool unpin_all) {
+    if (pinned_image_keys_.empty()) {
+        return;
+    }
+    std::unordered_set<std::string> used_keys;
+    if (!unpin_all) {
+        for (const auto &op : display_list_.Ops()) {
+            if (op.code == KRCanvasOpCode::kDrawImage) {
+                used_keys.insert(display_list_.StringAt(op.index));
+            }
+        }
+    }
+    auto module = std::dynamic_pointer_cast<KRMemoryCacheModule>(GetModule(kMemoryCacheModuleName));
+    for (auto it = pinned_image_keys_.begin(); it != pinned_image_keys_.end();) {
+        if (used_keys.count(*it)) {
+            ++it;
+            continue;
+        }
+        if (module) {
+            module->UnpinImage(*it);
+        }
+        it = pinned_image_keys_.erase(it);
+    }
 }
 
 void KRCanvasView::OnDraw(ArkUI_NodeCustomEvent *event) {
@@ -663,69 +530,7 @@ void KRCanvasView::OnDraw(ArkUI_NodeCustomEvent *event) {
     OH_Drawing_CanvasClipRect(canvas_, rect, OH_Drawing_CanvasClipOp::INTERSECT, false);
     OH_Drawing_RectDestroy(rect);
 
-    std::for_each(ops_.begin(), ops_.end(), [this](auto item) {
-        const std::string &method = item.first;
-        const std::string &params = item.second;
-        if (method == LINE_CAP) {
-            SetLineCap(params);
-        } else if (method == LINE_WIDTH) {
-            SetLineWidth(params);
-        } else if (method == LINE_DASH) {
-            SetLineDash(params);
-        } else if (method == STROKE_STYLE) {
-            SetStrokeStyle(params);
-        } else if (method == FILL_STYLE) {
-            SetFillStyle(params);
-        } else if (method == BEGIN_PATH) {
-            BeginPath();
-        } else if (method == MOVE_TO) {
-            MoveTo(params);
-        } else if (method == LINE_TO) {
-            LineTo(params);
-        } else if (method == ARC) {
-            Arc(params);
-        } else if (method == CLOSE_PATH) {
-            ClosePath();
-        } else if (method == STROKE) {
-            Stroke();
-        } else if (method == FILL) {
-            Fill();
-        } else if (method == CREATE_LINEAR_GRADIENT) {
-            //
-        } else if (method == QUADRATIC_CURVE_TO) {
-            QuadraticCurveTo(params);
-        } else if (method == TEXT_ALIGN) {
-            SetTextAlign(params);
-        } else if (method == FONT) {
-            SetFont(params);
-        } else if (method == FILL_TEXT) {
-            FillText(params);
-        } else if (method == STROKE_TEXT) {
-            StrokeText(params);
-        } else if (method == BEZIER_CURVE_TO) {
-            BezierCurveTo(params);
-        } else if (method == RESET) {
-            Reset();
-        } else if (method == SAVE) {
-            Save();
-        } else if (method == SAVE_LAYER) {
-            SaveLayer(params);
-        } else if (method == RESTORE) {
-            Restore();
-        } else if (method == CLIP) {
-            clip(params);
-        } else if (method == TRANSLATE) {
-            Translate(params);
-        } else if (method == SCALE) {
-            Scale(params);
-        } else if (method == ROTATE) {
-            Rotate(params);
-        } else if (method == SKEW) {
-            Skew(params);
-        } else if (method == TRANSFORM) {
-            Transform(params);
-        } else if (method == DRAW_IMAGE) {
-            DrawImage(params);
-        }
-    });
+    // reset 后不再引用的图片延后到绘制时解除 pin，避免 reset 与重新添加指令之间图片被淘汰
+    UnpinUnusedImages(false);
+    display_list_.Replay(*this);
 }
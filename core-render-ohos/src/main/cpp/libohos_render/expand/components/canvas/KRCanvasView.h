@@ -18,6 +18,7 @@
 
 #include <unordered_set>
 
+#include "libohos_render/expand/components/canvas/KRCanvasDisplayList.h"
 #include "libohos_render/expand/components/richtext/KRRichTextShadow.h"
 #include "libohos_render/expand/components/view/KRView.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
@@ -31,7 +32,7 @@ class TextFeature {
     OH_Drawing_FontWeight fontWeight = FONT_WEIGHT_400;
 };
 
-class KRCanvasView : public KRView {
+class KRCanvasView : public KRView, private IKRCanvasReplayer {
  public:
     static constexpr std::string_view Name = "KRCanvasView";
     KRCanvasView();
@@ -46,41 +47,49 @@ class KRCanvasView : public KRView {
 
     void DidInit() override;
     void DidMoveToParentView() override;
+    void OnDestroy() override;
 
  private:
-    void SetLineCap(const std::string &params);
-    void SetLineWidth(const std::string &params);
-    void SetLineDash(const std::string &params);
-    void SetStrokeStyle(const std::string &params);
-    void SetFillStyle(const std::string &params);
-    void BeginPath();
-    void MoveTo(const std::string &params);
-    void LineTo(const std::string &params);
-    void Arc(const std::string &params);
-    void ClosePath();
-    void Stroke();
-    void Fill();
-    void FillText(const std::string &params);
-    void StrokeText(const std::string &params);
-    void SetTextAlign(const std::string &params);
-    void SetFont(const std::string &params);
-    void QuadraticCurveTo(const std::string &params);
-    void BezierCurveTo(const std::string &params);
-    void Save();
-    void SaveLayer(const std::string &params);
-    void Restore();
-    void clip(const std::string &params);
-    void Translate(const std::string &params);
-    void Scale(const std::string &params);
-    void Rotate(const std::string &params);
-    void Skew(const std::string &params);
-    void Transform(const std::string &params);
-    void DrawImage(const std::string &params);
+    // IKRCanvasReplayer，转为 OH_Drawing 调用
+    void SetLineCap(KRCanvasLineCap cap) override;
+    void SetLineWidth(float width) override;
+    void SetLineDash(const std::vector<float> &intervals) override;
+    void SetStrokeColor(uint32_t color) override;
+    void SetFillColor(uint32_t color) override;
+    void SetStrokeGradient(const KRCanvasGradient &gradient) override;
+    void SetFillGradient(const KRCanvasGradient &gradient) override;
+    void BeginPath() override;
+    void MoveTo(float x, float y) override;
+    void LineTo(float x, float y) override;
+    void ArcTo(float left, float top, float right, float bottom, float start_angle, float sweep_angle) override;
+    void QuadTo(float cpx, float cpy, float x, float y) override;
+    void CubicTo(float cp1x, float cp1y, float cp2x, float cp2y, float x, float y) override;
+    void ClosePath() override;
+    void Stroke() override;
+    void Fill() override;
+    void SetTextAlign(KRCanvasTextAlign align) override;
+    void SetFont(const std::string &family, float size, int weight, KRCanvasFontStyle style) override;
+    void DrawText(const std::string &text, float x, float y, bool fill) override;
+    void Save() override;
+    void SaveLayer(float left, float top, float right, float bottom) override;
+    void Restore() override;
+    void Clip(bool intersect) override;
+    void Translate(float x, float y) override;
+    void Scale(float x, float y) override;
+    void Rotate(float degrees) override;
+    void Skew(float x, float y) override;
+    void Concat(const std::vector<float> &matrix) override;
+    void DrawImage(const std::string &cache_key, float sx, float sy, float s_width, float s_height, float dx,
+                   float dy, float d_width, float d_height) override;
+
+    OH_Drawing_Pen *GetOrCreatePen();
+    OH_Drawing_Brush *GetOrCreateBrush();
     void Reset();
-    void DrawText(std::string params, std::shared_ptr<struct KRFontCollectionWrapper> wrapper, std::string_view type);
 
     void AddOp(const std::string &method, const KRAnyValue &params);
     void OnDraw(ArkUI_NodeCustomEvent *event);
+    void PinImage(const std::string &cache_key);
+    void UnpinUnusedImages(bool unpin_all);
 
     bool ShouldCacheOp(const std::string &method);
     bool MarkDirtyIfNeeded(const std::string &method);
@@ -90,8 +99,8 @@ class KRCanvasView : public KRView {
     OH_Drawing_Path *drawingPath_ = nullptr;
     OH_Drawing_Brush *brush_ = nullptr;
     OH_Drawing_Pen *pen_ = nullptr;
-    std::vector<std::pair<std::string, std::string>> ops_;
-    std::unordered_set<std::string_view> cachable_methods_;
+    KRCanvasDisplayList display_list_;
+    std::unordered_set<std::string> pinned_image_keys_;  // 当前绘制指令引用的图片，避免被内存缓存淘汰
     TextFeature text_feature_;
 };
 
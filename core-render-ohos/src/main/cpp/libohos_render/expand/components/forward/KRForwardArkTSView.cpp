@@ -34,11 +34,11 @@ void KRForwardArkTSView::OnDestroy() {
     ark_node_ = nullptr;
 }
 
-bool KRForwardArkTSView::ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
+bool KRForwardArkTSView::ToSetBaseProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                                        const KRRenderCallback event_call_back) {
-    bool handled = IKRRenderViewExport::ToSetBaseProp(prop_key, prop_value, event_call_back);
+    bool handled = IKRRenderViewExport::ToSetBaseProp(prop_id, prop_key, prop_value, event_call_back);
     if (handled) {
-        if (prop_key == kBackgroundColor || prop_key == kBackgroundImage) {
+        if (prop_id == kPropKeyBackgroundColor || prop_id == kPropKeyBackgroundImage) {
             KRArkTSManager::GetInstance().CallArkTSMethod(GetInstanceId(), KRNativeCallArkTSMethod::SetViewProp,
                                                           std::make_shared<KRRenderValue>(GetViewTag()),
                                                           std::make_shared<KRRenderValue>(prop_key), prop_value,
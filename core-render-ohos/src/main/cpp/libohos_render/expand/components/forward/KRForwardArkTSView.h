@@ -37,7 +37,7 @@ class KRForwardArkTSView : public IKRRenderViewExport {
      */
     void DidMoveToParentView() override;
 
-    bool ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
+    bool ToSetBaseProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                        const KRRenderCallback event_call_back) override;
 
     bool ReuseEnable() override {
@@ -46,16 +46,16 @@ void KRForwardArkTSViewV2::DestroyNode(){
     ark_node_ = nullptr;
     node_ = nullptr;
 }
-void KRForwardArkTSViewV2::ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+void KRForwardArkTSViewV2::ToSetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                            const KRRenderCallback event_call_back){
     SetProp(prop_key, prop_value, event_call_back);
 }
 
-bool KRForwardArkTSViewV2::ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
+bool KRForwardArkTSViewV2::ToSetBaseProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                                        const KRRenderCallback event_call_back) {
-    bool handled = IKRRenderViewExport::ToSetBaseProp(prop_key, prop_value, event_call_back);
+    bool handled = IKRRenderViewExport::ToSetBaseProp(prop_id, prop_key, prop_value, event_call_back);
     if (handled) {
-        if (prop_key == kBackgroundColor || prop_key == kBackgroundImage) {
+        if (prop_id == kPropKeyBackgroundColor || prop_id == kPropKeyBackgroundImage) {
             KRArkTSManager::GetInstance().CallArkTSMethod(this->GetInstanceId(), KRNativeCallArkTSMethod::SetViewProp,
                                                           std::make_shared<KRRenderValue>(this->GetViewTag()),
                                                           std::make_shared<KRRenderValue>(prop_key), prop_value,
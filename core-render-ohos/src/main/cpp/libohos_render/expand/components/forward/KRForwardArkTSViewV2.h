@@ -30,8 +30,8 @@ class KRForwardArkTSViewV2 : public IKRRenderViewExport {
 
     void OnDestroy() override;
     void DestroyNode() override;
-    void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
-                           const KRRenderCallback event_call_back = nullptr) override;
+    void ToSetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
+                   const KRRenderCallback event_call_back = nullptr) override;
     bool SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                  const KRRenderCallback event_call_back = nullptr) override;
     void FireViewEventFromArkTS(std::string eventKey, KRAnyValue data) override;
@@ -55,7 +55,7 @@ class KRForwardArkTSViewV2 : public IKRRenderViewExport {
      */
     void DidMoveToParentView() override;
 
-    bool ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
+    bool ToSetBaseProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                        const KRRenderCallback event_call_back) override;
 
     bool ReuseEnable() override {
@@ -0,0 +1,152 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/image/KRImageDecoder.h"
+
+#include <multimedia/image_framework/image/image_source_native.h>
+#include <algorithm>
+#include "libohos_render/utils/KRRenderLoger.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Remove this declaration if compatable api is raised to 18 and above
+extern Image_ErrorCode OH_PixelmapNative_Destroy(OH_PixelmapNative **pixelmap) __attribute__((weak));
+#ifdef __cplusplus
+};
+#endif
+
+// 解码缓存按像素字节数淘汰
+constexpr size_t kDecodeCacheMaxBytes = 32 * 1024 * 1024;
+constexpr int32_t kMemoryLevelModerate = 0;
+
+static void ReleasePixelmap(OH_PixelmapNative *pixelmap) {
+    if (OH_PixelmapNative_Destroy) {
+        OH_PixelmapNative_Destroy(&pixelmap);
+    } else {
+        OH_PixelmapNative_Release(pixelmap);
+    }
+}
+
+const std::shared_ptr<KRImageDecodePipeline> &KRImageDecoder::SharedPipeline() {
+    static const auto pipeline = std::make_shared<KRImageDecodePipeline>(
+        [](const KRImageDecodePipeline::Request &request, const KRCancelToken &token) {
+            return KRImageDecoder::Decode(request, token);
+        },
+        [](const OH_PixelmapNative &pixelmap) {
+            return KRImageDecoder::GetByteCount(const_cast<OH_PixelmapNative *>(&pixelmap));
+        },
+        kDecodeCacheMaxBytes);
+    return pipeline;
+}
+
+void KRImageDecoder::TrimOnMemoryLevel(int32_t level) {
+    // 中等压力时减半，更高等级时清空；正在显示的图片由 view 持有，不受影响
+    if (level > kMemoryLevelModerate) {
+        SharedPipeline()->ClearCache();
+    } else {
+        SharedPipeline()->TrimCache(kDecodeCacheMaxBytes / 2);
+    }
+}
+
+// 在 max_width x max_height 以内保持宽高比的最大尺寸，不放大；某一维为 0 时只按另一维约束
+static bool FitSize(uint32_t width, uint32_t height, uint32_t max_width, uint32_t max_height, Image_Size &out) {
+    if (width == 0 || height == 0 || (max_width == 0 && max_height == 0)) {
+        return false;
+    }
+    double scale = 1.0;
+    if (max_width > 0) {
+        scale = std::min(scale, static_cast<double>(max_width) / width);
+    }
+    if (max_height > 0) {
+        scale = std::min(scale, static_cast<double>(max_height) / height);
+    }
+    if (scale >= 1.0) {
+        return false;
+    }
+    out.width = std::max<uint32_t>(1, static_cast<uint32_t>(width * scale + 0.5));
+    out.height = std::max<uint32_t>(1, static_cast<uint32_t>(height * scale + 0.5));
+    return true;
+}
+
+std::shared_ptr<OH_PixelmapNative> KRImageDecoder::Decode(const KRImageDecodePipeline::Request &request,
+                                                          const KRCancelToken &token) {
+    auto &uri = request.src;
+    OH_ImageSourceNative *source = nullptr;
+    auto code = OH_ImageSourceNative_CreateFromUri(const_cast<char *>(uri.data()), uri.length(), &source);
+    if (code != IMAGE_SUCCESS) {
+        KR_LOG_ERROR << "failed to create image source from uri: " << uri << ", error code: " << code;
+        return nullptr;
+    }
+    if (request.options & kOptionStillOnly) {
+        uint32_t frame_count = 1;
+        if (OH_ImageSourceNative_GetFrameCount(source, &frame_count) == IMAGE_SUCCESS && frame_count > 1) {
+            OH_ImageSourceNative_Release(source);
+            return nullptr;
+        }
+    }
+    uint32_t width = 0;
+    uint32_t height = 0;
+    OH_ImageSource_Info *info = nullptr;
+    if (OH_ImageSourceInfo_Create(&info) == IMAGE_SUCCESS) {
+        if (OH_ImageSourceNative_GetImageInfo(source, 0, info) == IMAGE_SUCCESS) {
+            OH_ImageSourceInfo_GetWidth(info, &width);
+            OH_ImageSourceInfo_GetHeight(info, &height);
+        }
+        OH_ImageSourceInfo_Release(info);
+    }
+
+    OH_PixelmapNative *pixelmap = nullptr;
+    OH_DecodingOptions *ops = nullptr;
+    // 读取图片信息后再检查一次，已取消时不再进行耗时的解码
+    if (!token.IsCancelled() && OH_DecodingOptions_Create(&ops) == IMAGE_SUCCESS) {
+        // 设置为AUTO会根据图片资源格式解码，如果图片资源为HDR资源则会解码为HDR的pixelmap。
+        OH_DecodingOptions_SetDesiredDynamicRange(ops, IMAGE_DYNAMIC_RANGE_AUTO);
+        Image_Size desired_size;
+        if (FitSize(width, height, request.width, request.height, desired_size)) {
+            OH_DecodingOptions_SetDesiredSize(ops, &desired_size);
+        }
+        OH_ImageSourceNative_CreatePixelmap(source, ops, &pixelmap);
+        OH_DecodingOptions_Release(ops);
+    }
+    OH_ImageSourceNative_Release(source);
+    return WrapPixelmap(pixelmap);
+}
+
+std::shared_ptr<OH_PixelmapNative> KRImageDecoder::WrapPixelmap(OH_PixelmapNative *pixelmap) {
+    if (!pixelmap) {
+        return nullptr;
+    }
+    return std::shared_ptr<OH_PixelmapNative>(pixelmap, ReleasePixelmap);
+}
+
+size_t KRImageDecoder::GetByteCount(OH_PixelmapNative *pixelmap) {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t row_stride = 0;
+    OH_Pixelmap_ImageInfo *info;
+    if (OH_PixelmapImageInfo_Create(&info) == IMAGE_SUCCESS) {
+        if (OH_PixelmapNative_GetImageInfo(pixelmap, info) == IMAGE_SUCCESS) {
+            OH_PixelmapImageInfo_GetWidth(info, &width);
+            OH_PixelmapImageInfo_GetHeight(info, &height);
+            OH_PixelmapImageInfo_GetRowStride(info, &row_stride);
+        }
+        OH_PixelmapImageInfo_Release(info);
+    }
+    if (row_stride == 0) {
+        row_stride = width * 4;  // 按 RGBA_8888 估算
+    }
+    return static_cast<size_t>(row_stride) * height;
+}
@@ -0,0 +1,55 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRIMAGEDECODER_H
+#define CORE_RENDER_OHOS_KRIMAGEDECODER_H
+
+#include <multimedia/image_framework/image/pixelmap_native.h>
+#include <memory>
+#include <string>
+#include "libohos_render/foundation/KRDecodePipeline.h"
+
+using KRImageDecodePipeline = KRDecodePipeline<OH_PixelmapNative>;
+
+/**
+ * 基于 OH_ImageSourceNative 的图片解码，供 KRImageDecodePipeline 在工作线程调用
+ */
+class KRImageDecoder {
+ public:
+    // 只解码静态图，多帧图片（gif、webp 动图等）返回失败，由调用方交给 ArkUI 处理
+    static constexpr int32_t kOptionStillOnly = 1;
+
+    /**
+     * 全局共享的解码管线
+     */
+    static const std::shared_ptr<KRImageDecodePipeline> &SharedPipeline();
+
+    /**
+     * 按系统内存等级裁剪解码缓存（level 同 KRMemoryCacheModule::TrimAllOnMemoryLevel）
+     */
+    static void TrimOnMemoryLevel(int32_t level);
+
+    /**
+     * 解码 uri 指向的图片，目标尺寸非 0 时保持宽高比缩小到目标尺寸以内，不放大
+     */
+    static std::shared_ptr<OH_PixelmapNative> Decode(const KRImageDecodePipeline::Request &request,
+                                                     const KRCancelToken &token = KRCancelToken());
+
+    static std::shared_ptr<OH_PixelmapNative> WrapPixelmap(OH_PixelmapNative *pixelmap);
+
+    static size_t GetByteCount(OH_PixelmapNative *pixelmap);
+};
+
+#endif  // CORE_RENDER_OHOS_KRIMAGEDECODER_H
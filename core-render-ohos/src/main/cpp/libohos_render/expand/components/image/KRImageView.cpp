@@ -17,9 +17,11 @@
 
 #include <deviceinfo.h>
 #include <resourcemanager/ohresmgr.h>
+#include <algorithm>
 #include <string_view>
 #include "libohos_render/expand/components/image/KRImageAdapterManager.h"
 #include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRRenderManager.h"
 #include "libohos_render/manager/KRSnapshotManager.h"
 #include "libohos_render/utils/KRThreadChecker.h"
@@ -94,6 +96,7 @@ bool KRImageView::ReuseEnable() {
 
 void KRImageView::OnDestroy() {
     ResetMaskLinearGradientNode();
+    ResetDecodedImage();
 }
 
 bool KRImageView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
@@ -130,6 +133,7 @@ bool KRImageView::ResetProp(const std::string &prop_key) {
     if (kuikly::util::isEqual(prop_key, kPropNameSrc)) {
         image_src_ = "";
         kuikly::util::ResetArkUIImageSrc(GetNode());
+        ResetDecodedImage();
         didHanded = true;
     } else if (kuikly::util::isEqual(prop_key, kPropNameResize)) {
         SetResizeMode(NewKRRenderValue(kResizeModeCover));
@@ -208,6 +212,7 @@ bool KRImageView::SetImageSrc(const KRAnyValue &value) {
     }
 
     kuikly::util::ResetArkUIImageSrc(GetNode());
+    ResetDecodedImage();
     image_src_ = src;
     if (auto imageAdapterV2 = KRImageAdapterManager::GetInstance()->GetAdapterV2()) {
         KRViewContext ctx(GetInstanceId(), GetViewTag());
@@ -463,7 +468,14 @@ void KRImageView::LoadFromBase64(const std::shared_ptr<KRImageLoadOption> image_
     } else {
         auto module_name = std::string(kMemoryCacheModuleName);
         auto memory_cache_module = std::dynamic_pointer_cast<KRMemoryCacheModule>(GetModule(module_name));
-        if (memory_cache_module) {
+        if (!memory_cache_module) {
+            return;
+        }
+        // cacheImage 解码缓存的图片直接上屏
+        if (auto pixelmap = memory_cache_module->GetImage(image_option->src_)) {
+            ResetDecodedImage();
+            ApplyDecodedImage(decode_generation_, image_option->src_, pixelmap);
+        } else {
             auto base64Str = memory_cache_module->Get(image_option->src_)->toString();
             if (!base64Str.empty()) {
                 kuikly::util::SetArkUIImageSrc(GetNode(), base64Str);
@@ -473,7 +485,7 @@ void KRImageView::LoadFromBase64(const std::shared_ptr<KRImageLoadOption> image_
 }
 
 void KRImageView::LoadFromFile(const std::shared_ptr<KRImageLoadOption> image_option) {
-    kuikly::util::SetArkUIImageSrc(GetNode(), image_option->src_);
+    DecodeInBackground(image_option->src_);
 }
 
 void KRImageView::LoadFromNetwork(const std::shared_ptr<KRImageLoadOption> image_option) {
@@ -516,3 +528,67 @@ void KRImageView::LoadFromAssets(const std::shared_ptr<KRImageLoadOption> image_
         }
     }
 }
+
+void KRImageView::DecodeInBackground(const std::string &src) {
+    ResetDecodedImage();
+    auto generation = decode_generation_;
+    std::weak_ptr<IKRRenderViewExport> weak_self = shared_from_this();
+    // 同一批次的 frame 设置完成后再按视图尺寸解码
+    KRMainThread::RunOnMainThreadForNextLoop([weak_self, generation, src] {
+        auto self = std::dynamic_pointer_cast<KRImageView>(weak_self.lock());
+        if (!self || self->decode_generation_ != generation) {
+            return;
+        }
+        auto dpi = KRConfig::GetDpi();
+        KRImageDecodePipeline::Request request;
+        request.src = src;
+        request.width = static_cast<uint32_t>(std::max(0.0, self->GetFrame().width * dpi));
+        request.height = static_cast<uint32_t>(std::max(0.0, self->GetFrame().height * dpi));
+        request.options = KRImageDecoder::kOptionStillOnly;
+        auto &pipeline = KRImageDecoder::SharedPipeline();
+        if (auto pixelmap = pipeline->GetCached(request)) {
+            self->ApplyDecodedImage(generation, src, pixelmap);
+            return;
+        }
+        self->decode_request_id_ =
+            pipeline->Load(request, [weak_self, generation, src](const std::shared_ptr<OH_PixelmapNative> &pixelmap) {
+                KRMainThread::RunOnMainThread([weak_self, generation, src, pixelmap] {
+                    if (auto self = std::dynamic_pointer_cast<KRImageView>(weak_self.lock())) {
+                        self->ApplyDecodedImage(generation, src, pixelmap);
+                    }
+                });
+            });
+    });
+}
+
+void KRImageView::ApplyDecodedImage(uint32_t generation, const std::string &src,
+                                    const std::shared_ptr<OH_PixelmapNative> &pixelmap) {
+    if (generation != decode_generation_) {
+        return;
+    }
+    decode_request_id_ = 0;
+    ArkUI_DrawableDescriptor *drawable =
+        pixelmap ? OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(pixelmap.get()) : nullptr;
+    if (!drawable) {
+        // 由 ArkUI 加载，加载结果照常通过 onComplete/onError 回调
+        kuikly::util::SetArkUIImageSrc(GetNode(), src);
+        return;
+    }
+    kuikly::util::SetArkUIImageSrc(GetNode(), drawable);
+    decoded_drawable_ = drawable;
+    decoded_pixelmap_ = pixelmap;
+}
+
+void KRImageView::ResetDecodedImage() {
+    decode_generation_++;
+    if (decode_request_id_ != 0) {
+        KRImageDecoder::SharedPipeline()->Cancel(decode_request_id_);
+        decode_request_id_ = 0;
+    }
+    if (decoded_drawable_) {
+        kuikly::util::ResetArkUIImageSrc(GetNode());
+        OH_ArkUI_DrawableDescriptor_Dispose(decoded_drawable_);
+        decoded_drawable_ = nullptr;
+    }
+    decoded_pixelmap_ = nullptr;
+}
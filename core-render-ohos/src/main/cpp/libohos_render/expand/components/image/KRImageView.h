@@ -16,6 +16,7 @@
 #ifndef CORE_RENDER_OHOS_KRIMAGEVIEW_H
 #define CORE_RENDER_OHOS_KRIMAGEVIEW_H
 
+#include "libohos_render/expand/components/image/KRImageDecoder.h"
 #include "libohos_render/expand/components/image/KRImageLoadOption.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 
@@ -61,6 +62,16 @@ class KRImageView : public IKRRenderViewExport {
     void LoadFromFile(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromResourceMedia(const std::shared_ptr<KRImageLoadOption> image_option);
     void LoadFromAssets(const std::shared_ptr<KRImageLoadOption> image_option);
+    /**
+     * 在后台按视图尺寸解码本地图片，动图或解码失败时交给 ArkUI 加载
+     */
+    void DecodeInBackground(const std::string &src);
+    void ApplyDecodedImage(uint32_t generation, const std::string &src,
+                           const std::shared_ptr<OH_PixelmapNative> &pixelmap);
+    /**
+     * 取消进行中的解码并释放已上屏的解码结果，src 变化、复用、销毁时调用
+     */
+    void ResetDecodedImage();
 
  private:
     std::string image_src_;
@@ -72,6 +83,10 @@ class KRImageView : public IKRRenderViewExport {
     bool had_register_on_error_event_ = false;
     bool is_dot_nine_image_ = false;
     ArkUI_NodeHandle mask_linear_gradient_node_ = nullptr;
+    uint32_t decode_generation_ = 0;
+    uint64_t decode_request_id_ = 0;
+    std::shared_ptr<OH_PixelmapNative> decoded_pixelmap_;
+    ArkUI_DrawableDescriptor *decoded_drawable_ = nullptr;
     
     static void AdapterSetImageCallback(const void* context,
                                    const char *src,
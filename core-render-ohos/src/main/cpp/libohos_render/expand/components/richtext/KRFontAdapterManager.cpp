@@ -14,6 +14,7 @@
  */
 
 #include "KRFontAdapterManager.h"
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
 KRFontAdapterManager *KRFontAdapterManager::GetInstance() {
     static KRFontAdapterManager *instance_ = nullptr;
     static std::once_flag flag;
@@ -26,6 +27,8 @@ void KRFontAdapterManager::RegisterFontAdapter(KRFontAdapter adapter, const char
         std::lock_guard<std::mutex> lock(mutex_);
         adapterMap_[fontFamily] = adapter;
     }
+    // 字体变化后已缓存的测量结果不再可信
+    KRTextMeasureCache::GetInstance().Clear();
 }
 
 std::unordered_map<std::string, KRFontAdapter> KRFontAdapterManager::AllAdapters() {
@@ -22,6 +22,7 @@
 #include <native_drawing/drawing_text_declaration.h>
 #include <native_drawing/drawing_text_typography.h>
 
+#include <algorithm>
 #include <cassert>
 #include <codecvt>
 #include <unordered_set>
@@ -60,9 +61,6 @@ static bool isRawFilePath(const std::string &src) {
 }
 
 KRRichTextShadow::~KRRichTextShadow() {
-    if (context_thread_typography_ != nullptr) {
-        OH_Drawing_DestroyTypography(context_thread_typography_);
-    }
     context_thread_typography_ = nullptr;
 }
 
@@ -105,11 +103,120 @@ KRSize KRRichTextShadow::CalculateRenderViewSize(double constraint_width, double
     }else{
         SetParagraph(nullptr);
     }
+    auto cache_key = MeasureCacheKey(constraint_width, constraint_height);
+    if (!cache_key.empty()) {
+        auto &cache = KRTextMeasureCache::GetInstance();
+        if (auto result = cache.Get(cache_key)) {
+            if (context_thread_typography_ == nullptr || context_thread_typography_ != result->typography) {
+                ReleaseLastTypography();
+            }
+            ApplyMeasureResult(result, constraint_width, constraint_height);
+            return context_measure_size_;
+        }
+        ReleaseLastTypography();
+        BuildTextTypography(constraint_width, constraint_height);
+        if (auto typography = cache.Put(cache_key, MakeMeasureResult())) {
+            // 改为持有缓存租出的排版对象，所有副本释放后才能被其他 shadow 复用
+            context_thread_typography_ = typography;
+        }
+        return context_measure_size_;
+    }
     ReleaseLastTypography();
     BuildTextTypography(constraint_width, constraint_height);
     return context_measure_size_;
 }
 
+std::string KRRichTextShadow::MeasureCacheKey(double constraint_width, double constraint_height) {
+    if (!MeasureCacheEnabled()) {
+        return "";
+    }
+    auto rootView = GetRootView().lock();
+    if (rootView == nullptr) {
+        return "";
+    }
+    auto config = rootView->GetContext()->Config();
+    char buffer[128] = {0};
+    std::snprintf(buffer, sizeof(buffer), "%.3f|%.3f|%.3f|%.3f|%.3f|", constraint_width, constraint_height,
+                  config->GetFontSizeScale(), config->GetFontWeightScale(), KRConfig::GetDpi());
+    std::string key(buffer);
+    static const std::string kEmptyString;
+
+    // 按 key 排序，保证相同属性得到稳定一致的序列化结果
+    auto append_map = [&key](const KRRenderValue::Map &map) -> bool {
+        std::vector<const KRRenderValue::Map::value_type *> entries;
+        entries.reserve(map.size());
+        for (auto &entry : map) {
+            entries.push_back(&entry);
+        }
+        std::sort(entries.begin(), entries.end(), [](auto *lhs, auto *rhs) { return lhs->first < rhs->first; });
+        for (auto *entry : entries) {
+            const std::string &value = entry->second ? entry->second->toString() : kEmptyString;
+            // 渐变色构建时会额外走 StyledString 测量并设置 paragraph，不参与缓存
+            if (entry->first == "backgroundImage" && !value.empty()) {
+                return false;
+            }
+            key.append(entry->first).append("=").append(std::to_string(value.size())).append(":").append(value);
+        }
+        key.append(";");
+        return true;
+    };
+    if (!append_map(props_)) {
+        return "";
+    }
+    for (auto &span : values_) {
+        if (!append_map(span->toMap())) {
+            return "";
+        }
+    }
+    return key;
+}
+
+std::shared_ptr<KRTextMeasureResult> KRRichTextShadow::MakeMeasureResult() const {
+    auto result = std::make_shared<KRTextMeasureResult>();
+    result->size = context_measure_size_;
+    result->draw_offset_x = context_thread_drawOffsetX_;
+    result->draw_offset_y = context_thread_drawOffsetY_;
+    result->text_align = context_thread_text_align_;
+    result->placeholder_index_map = placeholder_index_map_;
+    result->span_offsets = span_offsets_;
+    result->typography = context_thread_typography_;
+    result->font_collection = font_collection_wrapper_;
+    return result;
+}
+
+void KRRichTextShadow::ApplyMeasureResult(const std::shared_ptr<KRTextMeasureResult> &result, double constraint_width,
+                                          double constraint_height) {
+    context_measure_size_ = result->size;
+    context_thread_drawOffsetX_ = result->draw_offset_x;
+    context_thread_drawOffsetY_ = result->draw_offset_y;
+    context_thread_text_align_ = result->text_align;
+    placeholder_index_map_ = result->placeholder_index_map;
+    span_offsets_ = result->span_offsets;
+    if (context_thread_typography_ != nullptr && context_thread_typography_ == result->typography) {
+        return;  // 自身持有的排版结果仍然有效
+    }
+    if (auto typography = KRTextMeasureCache::GetInstance().AcquireTypography(result)) {
+        // 主线程绘制时可能按 view 宽度重排过，复用前按约束宽度重新排版（无需重新 shaping）
+        double max_width = (constraint_width == 0 ? 10000000 : constraint_width) * KRConfig::GetDpi();
+        OH_Drawing_TypographyLayout(typography.get(), max_width);
+        context_thread_typography_ = typography;
+        font_collection_wrapper_ = result->font_collection;
+        context_thread_typography_pending_ = false;
+        return;
+    }
+    context_thread_typography_pending_ = true;
+    pending_constraint_width_ = constraint_width;
+    pending_constraint_height_ = constraint_height;
+}
+
+void KRRichTextShadow::EnsureContextThreadTypography() {
+    if (!context_thread_typography_pending_) {
+        return;
+    }
+    context_thread_typography_pending_ = false;
+    BuildTextTypography(pending_constraint_width_, pending_constraint_height_);
+}
+
 KRSize KRRichTextShadow::CalculateRenderViewSizeWithStyledString(double constraint_width, double constraint_height) {
     auto rootView = GetRootView().lock();
     if (rootView == nullptr) {
@@ -162,6 +269,7 @@ bool KRRichTextShadow::StyledStringEnabled(){
  * @return
  */
 KRSchedulerTask KRRichTextShadow::TaskToMainQueueWhenWillSetShadowToView() {
+    EnsureContextThreadTypography();
     auto self = shared_from_this();
     auto typography = context_thread_typography_;
     auto offsetY = context_thread_drawOffsetY_;
@@ -510,17 +618,18 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
         spanIndex++;
     }
     // 根据handler对象生成文本排版布局typography
-    context_thread_typography_ = OH_Drawing_CreateTypography(handler);
+    auto typography = OH_Drawing_CreateTypography(handler);
+    context_thread_typography_ = std::shared_ptr<OH_Drawing_Typography>(typography, OH_Drawing_DestroyTypography);
     if (constraint_width == 0) {
         constraint_width = 10000000;  // 无限宽
     }
     double maxWidth = constraint_width * dpi;
-    OH_Drawing_TypographyLayout(context_thread_typography_, maxWidth);
+    OH_Drawing_TypographyLayout(typography, maxWidth);
     // 获取文本布局结果的宽高
-    auto height = OH_Drawing_TypographyGetHeight(context_thread_typography_);
+    auto height = OH_Drawing_TypographyGetHeight(typography);
     auto ouput_measure_height_ = height / dpi;
     auto longestLineWidth =
-        std::fmax(0, std::fmin(std::ceil(OH_Drawing_TypographyGetLongestLine(context_thread_typography_)), maxWidth));
+        std::fmax(0, std::fmin(std::ceil(OH_Drawing_TypographyGetLongestLine(typography)), maxWidth));
     context_thread_text_align_ = text_align;
     auto ouput_measure_width_ = (longestLineWidth / dpi);
     if (ouput_measure_width_ < 0.01) {
@@ -535,14 +644,15 @@ OH_Drawing_Typography *KRRichTextShadow::BuildTextTypography(double constraint_w
     if (typoStyle != nullptr) {
         OH_Drawing_DestroyTypographyStyle(typoStyle);
     }
-    return context_thread_typography_;
+    return typography;
 }
 
 void KRRichTextShadow::ReleaseLastTypography() {
-    OH_Drawing_Typography *typography = context_thread_typography_;
+    std::shared_ptr<OH_Drawing_Typography> typography = std::move(context_thread_typography_);
     float drawOffsetY = context_thread_drawOffsetY_;
     float drawOffsetX = context_thread_drawOffsetX_;
     context_thread_typography_ = nullptr;
+    context_thread_typography_pending_ = false;
     context_thread_drawOffsetY_ = 0;
     context_thread_drawOffsetX_ = 0;
     context_thread_text_align_ = TEXT_ALIGN_LEFT;
@@ -553,10 +663,9 @@ void KRRichTextShadow::ReleaseLastTypography() {
             std::shared_ptr<IKRRenderShadowExport> self = shared_from_this();
             lock->AddTaskToMainQueueWithTask([self, typography, drawOffsetY, drawOffsetX, collection] {
                 KRRichTextShadow *shadow = static_cast<KRRichTextShadow *>(self.get());
-                if (shadow && shadow->MainThreadTypography() == typography) {
+                if (shadow && shadow->MainThreadTypography() == typography.get()) {
                     shadow->SetMainThreadTypography(nullptr);
                 }
-                OH_Drawing_DestroyTypography(typography);
             });
         }
     }
@@ -574,9 +683,10 @@ KRAnyValue KRRichTextShadow::SpanRect(int spanIndex) {
         return NewKRRenderValue(buffer);
     }
 
-    if (placeholder_index_map_.find(spanIndex) != placeholder_index_map_.end()) {
+    EnsureContextThreadTypography();
+    if (context_thread_typography_ != nullptr && placeholder_index_map_.find(spanIndex) != placeholder_index_map_.end()) {
         auto placeholderIndex = placeholder_index_map_[spanIndex];
-        auto placeholderRects = OH_Drawing_TypographyGetRectsForPlaceholders(context_thread_typography_);
+        auto placeholderRects = OH_Drawing_TypographyGetRectsForPlaceholders(context_thread_typography_.get());
         auto x = OH_Drawing_GetLeftFromTextBox(placeholderRects, placeholderIndex);
         auto y = OH_Drawing_GetTopFromTextBox(placeholderRects, placeholderIndex);
         auto width = OH_Drawing_GetRightFromTextBox(placeholderRects, placeholderIndex) -
@@ -604,7 +714,7 @@ int KRRichTextShadow::SpanIndexAt(float spanX, float spanY) {
         int lastSpanBegin = std::get<1>(span_offsets_[index]);
         int lastSpanEnd = std::get<2>(span_offsets_[index]);
         OH_Drawing_TextBox *box = OH_Drawing_TypographyGetRectsForRange(
-            main_thread_typography_, lastSpanBegin, lastSpanEnd, RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
+            main_thread_typography_.get(), lastSpanBegin, lastSpanEnd, RECT_HEIGHT_STYLE_MAX, RECT_WIDTH_STYLE_MAX);
         int n = OH_Drawing_GetSizeOfTextBox(box);
         auto dpi = KRConfig::GetDpi();
         for (int boxIndex = 0; boxIndex < n; ++boxIndex) {
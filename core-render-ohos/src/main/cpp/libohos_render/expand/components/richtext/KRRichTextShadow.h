@@ -23,6 +23,7 @@
 #include <unordered_set>
 #include "libohos_render/expand/components/richtext/KRFontAdapterManager.h"
 #include "libohos_render/expand/components/richtext/KRParagraph.h"
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
 #include "libohos_render/utils/KRScopedSpinLock.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
 
@@ -74,7 +75,7 @@ class KRRichTextShadow : public IKRRenderShadowExport {
     KRSchedulerTask TaskToMainQueueWhenWillSetShadowToView() override;
 
     OH_Drawing_Typography *MainThreadTypography() const {
-        return main_thread_typography_;
+        return main_thread_typography_.get();
     }
     const float DrawOffsetY() const {
         return main_thread_drawOffsetY_;
@@ -93,7 +94,7 @@ class KRRichTextShadow : public IKRRenderShadowExport {
         return main_measure_size_;
     }
 
-    void SetMainThreadTypography(OH_Drawing_Typography *typography) {
+    void SetMainThreadTypography(const std::shared_ptr<OH_Drawing_Typography> &typography) {
         main_thread_typography_ = typography;
     }
 
@@ -103,6 +104,13 @@ class KRRichTextShadow : public IKRRenderShadowExport {
     }
     
     virtual bool StyledStringEnabled();
+
+    /**
+     * 是否允许使用进程级文本测量缓存（排版结果依赖额外状态的子类应关闭）
+     */
+    virtual bool MeasureCacheEnabled() {
+        return true;
+    }
  private:
     std::string GetTextContent();
     KRSize CalculateRenderViewSizeWithStyledString(double constraint_width, double constraint_height);
@@ -110,8 +118,12 @@ class KRRichTextShadow : public IKRRenderShadowExport {
  private:
     KRRenderValue::Map props_;
     KRRenderValue::Array values_;
-    OH_Drawing_Typography *main_thread_typography_ = nullptr;
-    OH_Drawing_Typography *context_thread_typography_ = nullptr;
+    std::shared_ptr<OH_Drawing_Typography> main_thread_typography_;
+    std::shared_ptr<OH_Drawing_Typography> context_thread_typography_;
+    // 命中测量缓存但排版对象无法复用时，延迟到真正需要绘制时再构建
+    bool context_thread_typography_pending_ = false;
+    double pending_constraint_width_ = 0;
+    double pending_constraint_height_ = 0;
     float context_thread_drawOffsetX_ = 0;
     float context_thread_drawOffsetY_ = 0;
     float main_thread_drawOffsetX_ = 0;
@@ -135,6 +147,14 @@ class KRRichTextShadow : public IKRRenderShadowExport {
     OH_Drawing_Typography *BuildTextTypography(double constraint_width, double constraint_height);
 
     void ReleaseLastTypography();
+    /**
+     * 生成测量缓存 key，不可缓存时返回空字符串
+     */
+    std::string MeasureCacheKey(double constraint_width, double constraint_height);
+    std::shared_ptr<KRTextMeasureResult> MakeMeasureResult() const;
+    void ApplyMeasureResult(const std::shared_ptr<KRTextMeasureResult> &result, double constraint_width,
+                            double constraint_height);
+    void EnsureContextThreadTypography();
     /**
      * 调用获取Span位置方法
      */
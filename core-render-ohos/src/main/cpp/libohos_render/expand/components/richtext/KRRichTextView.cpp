@@ -148,9 +148,9 @@ void KRRichTextView::OnForegroundDraw(ArkUI_NodeCustomEvent *event) {
     OH_Drawing_TypographyPaint(textTypo, drawingHandle, 0, -drawOffsetY);
 }
 
-void KRRichTextView::ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+void KRRichTextView::ToSetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                                const KRRenderCallback event_callback) {
-    if (kuikly::util::isEqual(prop_key, "click")) {
+    if (prop_id == kPropKeyClick) {
         std::weak_ptr<KRRichTextView> weakSelf = std::dynamic_pointer_cast<KRRichTextView>(shared_from_this());
         KRRenderCallback middleManCallback = [weakSelf, event_callback](KRAnyValue res) {
             auto strongSelf = weakSelf.lock();
@@ -192,8 +192,8 @@ void KRRichTextView::ToSetProp(const std::string &prop_key, const KRAnyValue &pr
                 event_callback(res);
             }
         };
-        IKRRenderViewExport::ToSetProp(prop_key, prop_value, middleManCallback);
+        IKRRenderViewExport::ToSetProp(prop_id, prop_key, prop_value, middleManCallback);
     } else {
-        IKRRenderViewExport::ToSetProp(prop_key, prop_value, event_callback);
+        IKRRenderViewExport::ToSetProp(prop_id, prop_key, prop_value, event_callback);
     }
 }
@@ -41,7 +41,7 @@ class KRRichTextView : public IKRRenderViewExport {
 
     void SetRenderViewFrame(const KRRect &frame) override;
 
-    void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+    void ToSetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                    const KRRenderCallback event_call_back = nullptr) override;
 
  private:
@@ -0,0 +1,113 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+
+// 列表中常见的重复文本数量级，超过后按 LRU 淘汰
+static constexpr size_t kDefaultTextMeasureCacheCapacity = 256;
+
+KRTextMeasureCache &KRTextMeasureCache::GetInstance() {
+    static KRTextMeasureCache *instance = new KRTextMeasureCache(kDefaultTextMeasureCacheCapacity);
+    return *instance;
+}
+
+std::shared_ptr<KRTextMeasureResult> KRTextMeasureCache::Get(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        stats_.miss_count++;
+        return nullptr;
+    }
+    lru_list_.splice(lru_list_.begin(), lru_list_, it->second);
+    stats_.hit_count++;
+    return it->second->result;
+}
+
+std::shared_ptr<OH_Drawing_Typography> KRTextMeasureCache::Put(const std::string &key,
+                                                               const std::shared_ptr<KRTextMeasureResult> &result) {
+    if (result == nullptr) {
+        return nullptr;
+    }
+    if (capacity_ == 0) {
+        return result->typography;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        it->second->result = result;
+        lru_list_.splice(lru_list_.begin(), lru_list_, it->second);
+    } else {
+        lru_list_.push_front(Entry{key, result});
+        index_.emplace(lru_list_.front().key, lru_list_.begin());
+        while (lru_list_.size() > capacity_) {
+            index_.erase(lru_list_.back().key);
+            lru_list_.pop_back();
+            stats_.eviction_count++;
+        }
+    }
+    return LeaseLocked(result);
+}
+
+std::shared_ptr<OH_Drawing_Typography>
+KRTextMeasureCache::AcquireTypography(const std::shared_ptr<KRTextMeasureResult> &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 同一时刻只租给一个 shadow，避免多个 view 在主线程对同一排版对象按不同宽度重排
+    auto typography = LeaseLocked(result);
+    if (typography != nullptr) {
+        stats_.typography_reuse_count++;
+    }
+    return typography;
+}
+
+std::shared_ptr<OH_Drawing_Typography>
+KRTextMeasureCache::LeaseLocked(const std::shared_ptr<KRTextMeasureResult> &result) {
+    if (result == nullptr || result->typography == nullptr || result->typography_leased) {
+        return nullptr;
+    }
+    result->typography_leased = true;
+    // 租约副本全部释放时归还，归还与租出都在 mutex_ 内完成，前一租约持有者的读写对下一持有者可见
+    struct Lease {
+        Lease(KRTextMeasureCache *cache, const std::shared_ptr<KRTextMeasureResult> &result)
+            : cache(cache), result(result), typography(result->typography) {}
+        ~Lease() {
+            cache->ReturnTypography(result);
+        }
+        KRTextMeasureCache *cache;
+        std::weak_ptr<KRTextMeasureResult> result;
+        std::shared_ptr<OH_Drawing_Typography> typography;
+    };
+    auto lease = std::make_shared<Lease>(this, result);
+    return std::shared_ptr<OH_Drawing_Typography>(lease, lease->typography.get());
+}
+
+void KRTextMeasureCache::ReturnTypography(const std::weak_ptr<KRTextMeasureResult> &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto strong_result = result.lock()) {
+        strong_result->typography_leased = false;
+    }
+}
+
+void KRTextMeasureCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    lru_list_.clear();
+}
+
+KRTextMeasureCache::Stats KRTextMeasureCache::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats = stats_;
+    stats.size = lru_list_.size();
+    return stats;
+}
@@ -0,0 +1,113 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
+#define CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
+
+#include <native_drawing/drawing_text_declaration.h>
+#include <native_drawing/drawing_text_typography.h>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "libohos_render/foundation/KRSize.h"
+
+struct KRFontCollectionWrapper;
+
+/**
+ * 一次文本测量的结果，可被相同输入（span 属性、字体缩放、约束尺寸）的 shadow 复用
+ */
+struct KRTextMeasureResult {
+    KRSize size;
+    float draw_offset_x = 0;
+    float draw_offset_y = 0;
+    OH_Drawing_TextAlign text_align = TEXT_ALIGN_LEFT;
+    std::unordered_map<int, int> placeholder_index_map;
+    std::vector<std::tuple<int, int, int>> span_offsets;  // span, begin, end
+    /** 排版结果，通过 KRTextMeasureCache 租借给 shadow，同一时刻只有一个租约 */
+    std::shared_ptr<OH_Drawing_Typography> typography;
+    std::shared_ptr<KRFontCollectionWrapper> font_collection;
+    /** typography 是否已被租出，由 KRTextMeasureCache 加锁读写 */
+    bool typography_leased = false;
+};
+
+/**
+ * 进程级文本测量缓存，以 LRU 方式淘汰，key 为 span 属性等输入的规范化字符串
+ * 排版对象以租约的形式交给 shadow：租约的所有副本（包括主线程持有的）释放后才归还缓存，之后才能再租给其他 shadow
+ */
+class KRTextMeasureCache {
+ public:
+    struct Stats {
+        uint64_t hit_count = 0;
+        uint64_t miss_count = 0;
+        uint64_t eviction_count = 0;
+        uint64_t typography_reuse_count = 0;
+        size_t size = 0;
+    };
+
+    static KRTextMeasureCache &GetInstance();
+
+    explicit KRTextMeasureCache(size_t capacity) : capacity_(capacity) {}
+    KRTextMeasureCache(const KRTextMeasureCache &) = delete;
+    KRTextMeasureCache &operator=(const KRTextMeasureCache &) = delete;
+
+    /**
+     * 查找测量结果，未命中返回 nullptr
+     */
+    std::shared_ptr<KRTextMeasureResult> Get(const std::string &key);
+
+    /**
+     * 写入测量结果，超出容量时淘汰最久未使用的项
+     * @return result 中排版对象的租约，写入方应改为持有租约，而不是 result->typography 本身
+     */
+    std::shared_ptr<OH_Drawing_Typography> Put(const std::string &key,
+                                               const std::shared_ptr<KRTextMeasureResult> &result);
+
+    /**
+     * 尝试独占复用结果中的排版对象，已被租出时返回 nullptr
+     */
+    std::shared_ptr<OH_Drawing_Typography> AcquireTypography(const std::shared_ptr<KRTextMeasureResult> &result);
+
+    void Clear();
+
+    Stats GetStats();
+
+ private:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<KRTextMeasureResult> result;
+    };
+    using EntryList = std::list<Entry>;
+
+    /**
+     * 调用方需持有 mutex_
+     */
+    std::shared_ptr<OH_Drawing_Typography> LeaseLocked(const std::shared_ptr<KRTextMeasureResult> &result);
+    void ReturnTypography(const std::weak_ptr<KRTextMeasureResult> &result);
+
+    size_t capacity_;
+    EntryList lru_list_;  // 头部为最近使用
+    std::unordered_map<std::string_view, EntryList::iterator> index_;  // key 指向 lru_list_ 中节点的 key
+    std::mutex mutex_;
+    Stats stats_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTEXTMEASURECACHE_H
@@ -39,6 +39,13 @@ class KRGradientRichTextShadow : public KRRichTextShadow {
      */
     void DidBuildTextStyle(OH_Drawing_TextStyle *textStyle, double dpi) override;
 
+    /**
+     * 渐变色依赖上一次测量的尺寸，不参与测量缓存
+     */
+    bool MeasureCacheEnabled() override {
+        return false;
+    }
+
  private:
     double calculate_width_ = 0.0;
     double calculate_height_ = 0.0;
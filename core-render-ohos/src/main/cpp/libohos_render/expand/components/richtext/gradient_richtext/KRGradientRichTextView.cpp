@@ -15,11 +15,10 @@
 
 #include "libohos_render/expand/components/richtext/gradient_richtext/KRGradientRichTextView.h"
 
-const char *tBackgroundImage = "backgroundImage";
-void KRGradientRichTextView::ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+void KRGradientRichTextView::ToSetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                                        const KRRenderCallback event_call_back) {
-    if (strcmp(prop_key.c_str(), tBackgroundImage) == 0) {
+    if (prop_id == kPropKeyBackgroundImage) {
         return;
     }
-    KRRichTextView::ToSetProp(prop_key, prop_value, event_call_back);
+    KRRichTextView::ToSetProp(prop_id, prop_key, prop_value, event_call_back);
 }
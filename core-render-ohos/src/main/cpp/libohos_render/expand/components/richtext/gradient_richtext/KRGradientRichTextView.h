@@ -17,7 +17,7 @@
 #define CORE_RENDER_OHOS_KRGRADIENTRICHTEXTVIEW_H
 #include "libohos_render/expand/components/richtext/KRRichTextView.h"
 class KRGradientRichTextView : public KRRichTextView {
-    void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+    void ToSetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                    const KRRenderCallback event_call_back) override;
 };
 
@@ -155,6 +155,9 @@ void KRScrollerView::DidInit() {
     last_scroll_y_ = 0;
     velocity_x_ = 0;
     velocity_y_ = 0;
+    if (!scroll_coalescer_) {
+        scroll_coalescer_ = KREventCoalescer::Create();
+    }
     SetBouncesEnable(NewKRRenderValue(bounces_enabled_));
     RegisterEvent(NODE_SCROLL_EVENT_ON_SCROLL_FRAME_BEGIN);
     RegisterEvent(NODE_SCROLL_EVENT_ON_SCROLL_START);
@@ -254,37 +257,50 @@ void KRScrollerView::FireOnScrollEvent(ArkUI_NodeEvent *event) {
     if (!on_scroll_callback_) {
         return;
     }
-    on_scroll_callback_(GetCommonScrollParams());
+    // 同一帧内的滚动回调合并为一次，派发时取最新的滚动参数
+    std::weak_ptr<KRScrollerView> weak_self = std::dynamic_pointer_cast<KRScrollerView>(shared_from_this());
+    scroll_coalescer_->PostMotion(MakeScrollSample(point), [weak_self](const KRCoalescedMotion &motion) {
+        auto self = weak_self.lock();
+        if (self && self->on_scroll_callback_) {
+            self->on_scroll_callback_(self->GetCommonScrollParams());
+        }
+    });
 }
 
-void KRScrollerView::FireBeginDragEvent(ArkUI_NodeEvent *event) {
-    if (!on_drag_begin_callback_) {
+void KRScrollerView::FireDiscreteScrollEvent(const KRRenderCallback &callback) {
+    if (!callback) {
         return;
     }
-    on_drag_begin_callback_(GetCommonScrollParams());
+    auto point = kuikly::util::GetArkUIScrollContentOffset(GetNode());
+    scroll_coalescer_->PostDiscrete(MakeScrollSample(point), [this, callback] { callback(GetCommonScrollParams()); });
+}
+
+KRMotionSample KRScrollerView::MakeScrollSample(const KRPoint &point) {
+    KRMotionSample sample;
+    sample.point = point;
+    sample.window_point = point;
+    sample.timestamp_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    return sample;
+}
+
+void KRScrollerView::FireBeginDragEvent(ArkUI_NodeEvent *event) {
+    FireDiscreteScrollEvent(on_drag_begin_callback_);
 }
 
 void KRScrollerView::FireWillDragEndEvent(ArkUI_NodeEvent *event) {
     KR_LOG_INFO << "fire will drag end";
-    if (!on_will_drag_end_callback_) {
-        return;
-    }
     // TODO(userName): 补充加速度参数
-    on_will_drag_end_callback_(GetCommonScrollParams());
+    FireDiscreteScrollEvent(on_will_drag_end_callback_);
 }
 
 void KRScrollerView::FireEndDragEvent(ArkUI_NodeEvent *event) {
-    if (!on_drag_end_callback_) {
-        return;
-    }
-    on_drag_end_callback_(GetCommonScrollParams());
+    FireDiscreteScrollEvent(on_drag_end_callback_);
 }
 
 void KRScrollerView::FireEndScrollEvent(ArkUI_NodeEvent *event) {
-    if (!on_scroll_end_callback_) {
-        return;
-    }
-    on_scroll_end_callback_(GetCommonScrollParams());
+    FireDiscreteScrollEvent(on_scroll_end_callback_);
 }
 
 void KRScrollerView::DidInsertSubRenderView(const std::shared_ptr<IKRRenderViewExport> &sub_render_view, int index) {
@@ -296,6 +312,9 @@ void KRScrollerView::DidInsertSubRenderView(const std::shared_ptr<IKRRenderViewE
 }
 
 void KRScrollerView::OnDestroy() {
+    if (scroll_coalescer_) {
+        scroll_coalescer_->Reset();
+    }
     if (!content_view_) {
         return;
     }
@@ -17,6 +17,7 @@
 #define CORE_RENDER_OHOS_KRSCROLLERVIEW_H
 
 #include "KRScrollerContentInset.h"
+#include "libohos_render/expand/events/KREventCoalescer.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
 #include "libohos_render/foundation/KRPoint.h"
 #include "libohos_render/foundation/KRRect.h"
@@ -124,6 +125,9 @@ class KRScrollerView : public IKRRenderViewExport {
     bool IsDraggingStateToFlingState(ArkUI_ScrollState new_scroll_state);
     bool IsDraggingStateToIdeaState(ArkUI_ScrollState new_scroll_state);
     std::shared_ptr<KRRenderValue> GetCommonScrollParams();
+    // 派发 begin/end 类事件，先派发已合并的滚动事件
+    void FireDiscreteScrollEvent(const KRRenderCallback &callback);
+    KRMotionSample MakeScrollSample(const KRPoint &point);
     void ApplyContentInsetWhenDragEnd();
     void InnerSetBouncesEnable(bool enable);
     void AdjustHeaderBouncesEnableWhenWillScroll(ArkUI_NodeEvent *event);
@@ -163,6 +167,7 @@ class KRScrollerView : public IKRRenderViewExport {
     bool is_fling_enabled_ = true;
     float last_fired_scroll_x_ = 0;
     float last_fired_scroll_y_ = 0;
+    std::shared_ptr<KREventCoalescer> scroll_coalescer_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRSCROLLERVIEW_H
@@ -15,6 +15,7 @@
 
 #include "libohos_render/expand/components/view/KRView.h"
 
+#include "libohos_render/foundation/KRPropKeys.h"
 #include "libohos_render/manager/KRSnapshotManager.h"
 
 #define NS_PER_MS 1000000
@@ -28,6 +29,14 @@ constexpr char kPropNameSuperTouch[] = "superTouch";
 constexpr char kPropNameHitTestModeOhos[] = "hit-test-ohos";
 constexpr char kPropNameStopPropagation[] = "stop-propagation-ohos";
 
+static const int32_t kPropIdTouchDown = KRPropKeys::Register(kPropNameTouchDown);
+static const int32_t kPropIdTouchMove = KRPropKeys::Register(kPropNameTouchMove);
+static const int32_t kPropIdTouchUp = KRPropKeys::Register(kPropNameTouchUp);
+static const int32_t kPropIdPreventTouch = KRPropKeys::Register(kPropNamePreventTouch);
+static const int32_t kPropIdSuperTouch = KRPropKeys::Register(kPropNameSuperTouch);
+static const int32_t kPropIdHitTestModeOhos = KRPropKeys::Register(kPropNameHitTestModeOhos);
+static const int32_t kPropIdStopPropagation = KRPropKeys::Register(kPropNameStopPropagation);
+
 constexpr char kOhosHitTestModeDefault[] = "default";
 constexpr char kOhosHitTestModeBlock[] = "block";
 constexpr char kOhosHitTestModeNone[] = "none";
@@ -45,18 +54,19 @@ void KRView::WillReuse() {
 bool KRView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
                      const KRRenderCallback event_call_back) {
     auto didHand = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameTouchDown)) {
+    auto prop_id = PropIdOf(prop_key);
+    if (prop_id == kPropIdTouchDown) {
         didHand = RegisterTouchDownEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
+    } else if (prop_id == kPropIdTouchMove) {
         didHand = RegisterTouchMoveEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
+    } else if (prop_id == kPropIdTouchUp) {
         didHand = RegisterTouchUpEvent(event_call_back);
-    } else if (kuikly::util::isEqual(prop_key, kPropNamePreventTouch)) {
+    } else if (prop_id == kPropIdPreventTouch) {
         if (super_touch_handler_) {
             super_touch_handler_->PreventTouch(prop_value->toBool());
         }
         didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameSuperTouch)) {
+    } else if (prop_id == kPropIdSuperTouch) {
         if (prop_value->toBool()) {
             if (!super_touch_handler_) {
                 super_touch_handler_ = std::make_shared<SuperTouchHandler>();
@@ -67,9 +77,9 @@ bool KRView::SetProp(const std::string &prop_key, const KRAnyValue &prop_value,
             }
         }
         didHand = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameHitTestModeOhos)) {
+    } else if (prop_id == kPropIdHitTestModeOhos) {
         didHand = SetTargetHitTestMode(prop_value->toString());
-    } else if (kuikly::util::isEqual(prop_key, kPropNameStopPropagation)) {
+    } else if (prop_id == kPropIdStopPropagation) {
         stop_propagation_ = prop_value->toBool();
         didHand = true;
     }
@@ -93,26 +103,27 @@ void KRView::OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_ty
 bool KRView::ResetProp(const std::string &prop_key) {
     auto didHande = false;
     register_touch_event_ = false;
-    if (kuikly::util::isEqual(prop_key, kPropNameTouchDown)) {
+    auto prop_id = KRPropKeys::IdOf(prop_key);
+    if (prop_id == kPropIdTouchDown) {
         touch_down_callback_ = nullptr;
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchMove)) {
+    } else if (prop_id == kPropIdTouchMove) {
         touch_move_callback_ = nullptr;
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameTouchUp)) {
+    } else if (prop_id == kPropIdTouchUp) {
         touch_up_callback_ = nullptr;
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNamePreventTouch)) {
+    } else if (prop_id == kPropIdPreventTouch) {
         // reset handled by kPropNameSuperTouch, do nothing here
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameSuperTouch)) {
+    } else if (prop_id == kPropIdSuperTouch) {
         super_touch_handler_ = nullptr;
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameHitTestModeOhos)) {
+    } else if (prop_id == kPropIdHitTestModeOhos) {
         target_hit_test_mode = ARKUI_HIT_TEST_MODE_DEFAULT;
         UpdateHitTestMode(HasBaseEvent() || HasTouchEvent());
         didHande = true;
-    } else if (kuikly::util::isEqual(prop_key, kPropNameStopPropagation)) {
+    } else if (prop_id == kPropIdStopPropagation) {
         stop_propagation_ = false;
         didHande = true;
     } else {
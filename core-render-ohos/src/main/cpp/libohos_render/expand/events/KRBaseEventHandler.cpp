@@ -18,44 +18,48 @@
 #include <arkui/native_node.h>
 #include "libohos_render/expand/events/KREventDispatchCenter.h"
 #include "libohos_render/export/IKRRenderViewExport.h"
+#include "libohos_render/foundation/KRPropKeys.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRStringUtil.h"
 
-constexpr char kClickEventName[] = "click";
-constexpr char kDoubleClickEventName[] = "doubleClick";
-constexpr char kLongPressEventName[] = "longPress";
-constexpr char kPanEventName[] = "pan";
-constexpr char kPinchEventName[] = "pinch";
-constexpr char kCaptureAttrName[] = "capture";
-
 constexpr char kParamKeyX[] = "x";
 constexpr char kParamKeyY[] = "y";
 constexpr char kParamKeyPageX[] = "pageX";
 constexpr char kParamKeyPageY[] = "pageY";
 constexpr char kParamKeyState[] = "state";
 constexpr char kStartState[] = "start";
+constexpr char kMoveState[] = "move";
 constexpr char kEndState[] = "end";
 constexpr char kParamKeyScale[] = "scale";
 constexpr char kParamKeyIsCancel[] = "isCancel";
 
 KRBaseEventHandler::KRBaseEventHandler(const std::shared_ptr<KRConfig> &kr_config) : kr_config_(kr_config) {}
 
-bool KRBaseEventHandler::SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
-                                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back) {
+bool KRBaseEventHandler::SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, int32_t prop_id,
+                                 const std::string &prop_key, const KRAnyValue &prop_value,
+                                 const KRRenderCallback event_call_back) {
     auto didHanded = false;
     if (event_call_back != nullptr) {
-        if (kuikly::util::isEqual(prop_key, kClickEventName)) {
-            didHanded = RegisterOnClick(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kDoubleClickEventName)) {
-            didHanded = RegisterOnDoubleClick(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kLongPressEventName)) {
-            didHanded = RegisterOnLongPress(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
-            didHanded = RegisterOnPan(view_export, event_call_back);
-        } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
-            didHanded = RegisterOnPinch(view_export, event_call_back);
+        switch (prop_id) {
+            case kPropKeyClick:
+                didHanded = RegisterOnClick(view_export, event_call_back);
+                break;
+            case kPropKeyDoubleClick:
+                didHanded = RegisterOnDoubleClick(view_export, event_call_back);
+                break;
+            case kPropKeyLongPress:
+                didHanded = RegisterOnLongPress(view_export, event_call_back);
+                break;
+            case kPropKeyPan:
+                didHanded = RegisterOnPan(view_export, event_call_back);
+                break;
+            case kPropKeyPinch:
+                didHanded = RegisterOnPinch(view_export, event_call_back);
+                break;
+            default:
+                break;
         }
-    } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
+    } else if (prop_id == kPropKeyCapture) {
         didHanded = SetCaptureRule(view_export, prop_value->toString());
     }
     return didHanded;
@@ -87,26 +91,36 @@ bool KRBaseEventHandler::OnGestureEvent(const std::shared_ptr<KRGestureEventData
 }
 
 bool KRBaseEventHandler::ResetProp(const std::string &prop_key) {
-    auto didHanded = false;
-    if (kuikly::util::isEqual(prop_key, kClickEventName)) {
-        click_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kDoubleClickEventName)) {
-        double_click_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kLongPressEventName)) {
-        long_press_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPanEventName)) {
-        pan_event_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kPinchEventName)) {
-        pinch_event_callback_ = nullptr;
-        didHanded = true;
-    } else if (kuikly::util::isEqual(prop_key, kCaptureAttrName)) {
-        // KREventDispatchCenter has reset by view_export->UnregisterEvent()
-        has_capture_rule_ = false;
-        didHanded = true;
+    auto didHanded = true;
+    switch (KRPropKeys::IdOf(prop_key)) {
+        case kPropKeyClick:
+            click_callback_ = nullptr;
+            break;
+        case kPropKeyDoubleClick:
+            double_click_callback_ = nullptr;
+            break;
+        case kPropKeyLongPress:
+            long_press_callback_ = nullptr;
+            break;
+        case kPropKeyPan:
+            pan_event_callback_ = nullptr;
+            if (pan_coalescer_) {
+                pan_coalescer_->Reset();
+            }
+            break;
+        case kPropKeyPinch:
+            pinch_event_callback_ = nullptr;
+            if (pinch_coalescer_) {
+                pinch_coalescer_->Reset();
+            }
+            break;
+        case kPropKeyCapture:
+            // KREventDispatchCenter has reset by view_export->UnregisterEvent()
+            has_capture_rule_ = false;
+            break;
+        default:
+            didHanded = false;
+            break;
     }
     return didHanded;
 }
@@ -117,6 +131,12 @@ void KRBaseEventHandler::OnDestroy() {
     long_press_callback_ = nullptr;
     pan_event_callback_ = nullptr;
     pinch_event_callback_ = nullptr;
+    if (pan_coalescer_) {
+        pan_coalescer_->Reset();
+    }
+    if (pinch_coalescer_) {
+        pinch_coalescer_->Reset();
+    }
 }
 
 bool KRBaseEventHandler::RegisterOnClick(const std::shared_ptr<IKRRenderViewExport> &view_export,
@@ -191,6 +211,9 @@ bool KRBaseEventHandler::FireOnLongPressCallback(const std::shared_ptr<KRGesture
 bool KRBaseEventHandler::RegisterOnPan(const std::shared_ptr<IKRRenderViewExport> &view_export,
                                        const KRRenderCallback &event_callback) {
     pan_event_callback_ = event_callback;
+    if (!pan_coalescer_) {
+        pan_coalescer_ = KREventCoalescer::Create();
+    }
     KREventDispatchCenter::GetInstance().RegisterGestureEvent(view_export, KRGestureEventType::kPan);
     return true;
 }
@@ -200,19 +223,31 @@ bool KRBaseEventHandler::FireOnPanCallback(const std::shared_ptr<KRGestureEventD
         return false;
     }
 
-    KRRenderValueMap params;
-    params[kParamKeyX] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_point_.x));
-    params[kParamKeyY] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_point_.y));
-    params[kParamKeyPageX] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_window_point_.x));
-    params[kParamKeyPageY] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_window_point_.y));
-    params[kParamKeyState] = NewKRRenderValue(kuikly::util::GetArkUIGestureActionState(gesture_event_data->gesture_event_));
-    pan_event_callback_(NewKRRenderValue(params));
+    auto sample = MakeMotionSample(gesture_event_data);
+    auto action = kuikly::util::GetArkUIGestureActionType(gesture_event_data->gesture_event_);
+    if (action == GESTURE_EVENT_ACTION_UPDATE) {
+        // 同一帧内的 move 合并为一次回调
+        std::weak_ptr<KRBaseEventHandler> weak_self = shared_from_this();
+        pan_coalescer_->PostMotion(sample, [weak_self](const KRCoalescedMotion &motion) {
+            auto self = weak_self.lock();
+            if (self && self->pan_event_callback_) {
+                self->pan_event_callback_(self->MakeGestureParams(motion.latest, kMoveState, false));
+            }
+        });
+    } else {
+        auto params = MakeGestureParams(sample, kuikly::util::GetArkUIGestureActionState(gesture_event_data->gesture_event_),
+                                        false);
+        pan_coalescer_->PostDiscrete(sample, [this, params] { pan_event_callback_(params); });
+    }
     return true;
 }
 
 bool KRBaseEventHandler::RegisterOnPinch(const std::shared_ptr<IKRRenderViewExport> &view_export,
                                          const KRRenderCallback &event_callback) {
     pinch_event_callback_ = event_callback;
+    if (!pinch_coalescer_) {
+        pinch_coalescer_ = KREventCoalescer::Create();
+    }
     KREventDispatchCenter::GetInstance().RegisterGestureEvent(view_export, KRGestureEventType::kPinch);
     return true;
 }
@@ -222,17 +257,47 @@ bool KRBaseEventHandler::FireOnPinchCallback(const std::shared_ptr<KRGestureEven
         return false;
     }
 
-    KRRenderValueMap params;
-    params[kParamKeyX] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_point_.x));
-    params[kParamKeyY] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_point_.y));
-    params[kParamKeyPageX] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_window_point_.x));
-    params[kParamKeyPageY] = NewKRRenderValue(kr_config_->Px2Vp(gesture_event_data->gesture_event_window_point_.y));
-    params[kParamKeyScale] = NewKRRenderValue(kuikly::util::GetArkUIGesturePinchScale(gesture_event_data->gesture_event_));
-    params[kParamKeyState] = NewKRRenderValue(kuikly::util::GetArkUIGestureActionState(gesture_event_data->gesture_event_));
-    pinch_event_callback_(NewKRRenderValue(params));
+    auto sample = MakeMotionSample(gesture_event_data);
+    sample.scale = kuikly::util::GetArkUIGesturePinchScale(gesture_event_data->gesture_event_);
+    auto action = kuikly::util::GetArkUIGestureActionType(gesture_event_data->gesture_event_);
+    if (action == GESTURE_EVENT_ACTION_UPDATE) {
+        std::weak_ptr<KRBaseEventHandler> weak_self = shared_from_this();
+        pinch_coalescer_->PostMotion(sample, [weak_self](const KRCoalescedMotion &motion) {
+            auto self = weak_self.lock();
+            if (self && self->pinch_event_callback_) {
+                self->pinch_event_callback_(self->MakeGestureParams(motion.latest, kMoveState, true));
+            }
+        });
+    } else {
+        auto params = MakeGestureParams(sample, kuikly::util::GetArkUIGestureActionState(gesture_event_data->gesture_event_),
+                                        true);
+        pinch_coalescer_->PostDiscrete(sample, [this, params] { pinch_event_callback_(params); });
+    }
     return true;
 }
 
+KRMotionSample KRBaseEventHandler::MakeMotionSample(const std::shared_ptr<KRGestureEventData> &gesture_event_data) {
+    KRMotionSample sample;
+    sample.point = gesture_event_data->gesture_event_point_;
+    sample.window_point = gesture_event_data->gesture_event_window_point_;
+    sample.timestamp_ns = kuikly::util::GetArkUIGestureEventTime(gesture_event_data->gesture_event_);
+    return sample;
+}
+
+KRAnyValue KRBaseEventHandler::MakeGestureParams(const KRMotionSample &sample, const std::string &state,
+                                                 bool with_scale) {
+    KRRenderValueMap params;
+    params[kParamKeyX] = NewKRRenderValue(kr_config_->Px2Vp(sample.point.x));
+    params[kParamKeyY] = NewKRRenderValue(kr_config_->Px2Vp(sample.point.y));
+    params[kParamKeyPageX] = NewKRRenderValue(kr_config_->Px2Vp(sample.window_point.x));
+    params[kParamKeyPageY] = NewKRRenderValue(kr_config_->Px2Vp(sample.window_point.y));
+    if (with_scale) {
+        params[kParamKeyScale] = NewKRRenderValue(sample.scale);
+    }
+    params[kParamKeyState] = NewKRRenderValue(state);
+    return NewKRRenderValue(params);
+}
+
 bool KRBaseEventHandler::HasTouchEvent() {
     return click_callback_ != nullptr || double_click_callback_ != nullptr || pan_event_callback_ != nullptr ||
            long_press_callback_ != nullptr;
@@ -19,6 +19,7 @@
 #include <arkui/native_node.h>
 #include <string>
 #include "gesture/KRGestueEventType.h"
+#include "libohos_render/expand/events/KREventCoalescer.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/utils/KREventUtil.h"
 #include "libohos_render/view/IKRRenderView.h"
@@ -32,8 +33,10 @@ class KRBaseEventHandler : public std::enable_shared_from_this<KRBaseEventHandle
     KRBaseEventHandler &operator=(const KRBaseEventHandler &) = delete;
     KRBaseEventHandler &operator=(const KRBaseEventHandler &&) = delete;
 
-    virtual bool SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
-                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back = nullptr);
+    // prop_id 为 KRPropKeys::IdOf(prop_key)
+    virtual bool SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, int32_t prop_id,
+                         const std::string &prop_key, const KRAnyValue &prop_value,
+                         const KRRenderCallback event_call_back = nullptr);
     virtual bool OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type);
     virtual bool OnCustomEvent(ArkUI_NodeCustomEvent *event, const ArkUI_NodeCustomEventType &event_type);
     virtual bool OnGestureEvent(const std::shared_ptr<KRGestureEventData> &gesture_event_data,
@@ -63,6 +66,8 @@ class KRBaseEventHandler : public std::enable_shared_from_this<KRBaseEventHandle
     bool RegisterOnPinch(const std::shared_ptr<IKRRenderViewExport> &view_export,
                          const KRRenderCallback &event_callback);
     bool FireOnPinchCallback(const std::shared_ptr<KRGestureEventData> &gesture_event_data);
+    KRMotionSample MakeMotionSample(const std::shared_ptr<KRGestureEventData> &gesture_event_data);
+    KRAnyValue MakeGestureParams(const KRMotionSample &sample, const std::string &state, bool with_scale);
     bool SetCaptureRule(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &rule_data);
 
  private:
@@ -71,6 +76,9 @@ class KRBaseEventHandler : public std::enable_shared_from_this<KRBaseEventHandle
     KRRenderCallback long_press_callback_ = nullptr;
     KRRenderCallback pan_event_callback_ = nullptr;
     KRRenderCallback pinch_event_callback_ = nullptr;
+    // pan/pinch 的 move 事件按帧合并后回调
+    std::shared_ptr<KREventCoalescer> pan_coalescer_;
+    std::shared_ptr<KREventCoalescer> pinch_coalescer_;
     std::shared_ptr<KRConfig> kr_config_;
     bool has_capture_rule_ = false;
     bool is_long_press_happening = false;
@@ -82,8 +90,9 @@ class KRArkTSBaseEventHandler : public KRBaseEventHandler {
     KRBaseEventHandler(kr_config){
             // blank
     }
-    bool SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, const std::string &prop_key,
-                 const KRAnyValue &prop_value, const KRRenderCallback event_call_back = nullptr) override {
+    bool SetProp(const std::shared_ptr<IKRRenderViewExport> &view_export, int32_t prop_id,
+                 const std::string &prop_key, const KRAnyValue &prop_value,
+                 const KRRenderCallback event_call_back = nullptr) override {
         return false;
     }
     bool OnEvent(ArkUI_NodeEvent *event, const ArkUI_NodeEventType &event_type) override {
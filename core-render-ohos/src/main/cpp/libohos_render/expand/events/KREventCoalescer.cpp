@@ -0,0 +1,113 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/events/KREventCoalescer.h"
+
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/foundation/thread/KRVSync.h"
+
+static constexpr float kNanosPerSecond = 1e9f;
+
+std::shared_ptr<KREventCoalescer> KREventCoalescer::Create(const FrameScheduler &scheduler) {
+    if (scheduler) {
+        return std::make_shared<KREventCoalescer>(scheduler);
+    }
+    return std::make_shared<KREventCoalescer>([](const std::function<void()> &task) {
+        auto on_frame = [task](int64_t) { KRMainThread::RunOnMainThread(task); };
+        if (!KRVSync::GetInstance().RequestFrame(on_frame)) {
+            KRMainThread::RunOnMainThread(task);
+        }
+    });
+}
+
+KREventCoalescer::KREventCoalescer(const FrameScheduler &scheduler) : scheduler_(scheduler) {}
+
+void KREventCoalescer::PostMotion(const KRMotionSample &sample, const MotionCallback &callback) {
+    received_count_++;
+    if (pending_.merged_count == 0) {
+        pending_.delta = KRPoint();
+        span_start_ns_ = has_anchor_ ? anchor_.timestamp_ns : sample.timestamp_ns;
+    }
+    if (has_anchor_) {
+        pending_.delta.x += sample.point.x - anchor_.point.x;
+        pending_.delta.y += sample.point.y - anchor_.point.y;
+    }
+    auto span_ns = sample.timestamp_ns - span_start_ns_;
+    if (span_ns > 0) {
+        pending_.velocity.x = pending_.delta.x * kNanosPerSecond / span_ns;
+        pending_.velocity.y = pending_.delta.y * kNanosPerSecond / span_ns;
+    }
+    pending_.latest = sample;
+    pending_.merged_count++;
+    pending_callback_ = callback;
+    anchor_ = sample;
+    has_anchor_ = true;
+    ScheduleFlush();
+}
+
+void KREventCoalescer::PostDiscrete(const KRMotionSample &sample, const std::function<void()> &task) {
+    Flush();
+    anchor_ = sample;
+    has_anchor_ = true;
+    received_count_++;
+    delivered_count_++;
+    if (task) {
+        task();
+    }
+}
+
+void KREventCoalescer::PostDiscrete(const std::function<void()> &task) {
+    Flush();
+    has_anchor_ = false;
+    received_count_++;
+    delivered_count_++;
+    if (task) {
+        task();
+    }
+}
+
+void KREventCoalescer::Flush() {
+    if (pending_.merged_count == 0) {
+        return;
+    }
+    auto motion = pending_;
+    auto callback = std::move(pending_callback_);
+    pending_callback_ = nullptr;
+    pending_.merged_count = 0;
+    delivered_count_++;
+    if (callback) {
+        callback(motion);
+    }
+}
+
+void KREventCoalescer::Reset() {
+    pending_.merged_count = 0;
+    pending_callback_ = nullptr;
+    has_anchor_ = false;
+}
+
+void KREventCoalescer::ScheduleFlush() {
+    if (flush_scheduled_) {
+        return;
+    }
+    flush_scheduled_ = true;
+    std::weak_ptr<KREventCoalescer> weak_self = shared_from_this();
+    scheduler_([weak_self] {
+        if (auto self = weak_self.lock()) {
+            self->flush_scheduled_ = false;
+            self->Flush();
+        }
+    });
+}
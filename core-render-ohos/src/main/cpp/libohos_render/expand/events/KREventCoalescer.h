@@ -0,0 +1,110 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KREVENTCOALESCER_H
+#define CORE_RENDER_OHOS_KREVENTCOALESCER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include "libohos_render/foundation/KRPoint.h"
+
+/**
+ * 单次连续事件（move/scroll）的采样
+ */
+struct KRMotionSample {
+    KRPoint point;         // 相对 View 的位置
+    KRPoint window_point;  // 相对窗口的位置
+    float scale = 1;       // 缩放手势的缩放比例
+    int64_t timestamp_ns = 0;
+};
+
+/**
+ * 合并后的连续事件
+ */
+struct KRCoalescedMotion {
+    KRMotionSample latest;  // 最新一次采样
+    KRPoint delta;          // 自上次派发以来的累计位移
+    KRPoint velocity;       // 累计位移 / 时间跨度，单位：像素每秒
+    int32_t merged_count = 0;
+};
+
+/**
+ * 连续事件合并器，每个 View 持有一个，只在主线程使用
+ * - 同一帧内连续的 move/scroll 事件合并为一次，在下一个显示帧（vsync）到来时于主线程派发
+ * - begin/end/cancel 等事件不合并：先派发积压的合并事件，再立即派发，保证先后顺序
+ */
+class KREventCoalescer : public std::enable_shared_from_this<KREventCoalescer> {
+ public:
+    using FrameScheduler = std::function<void(const std::function<void()> &task)>;
+    using MotionCallback = std::function<void(const KRCoalescedMotion &motion)>;
+
+    /**
+     * @param scheduler 派发时机，为空时在下一个 vsync 抛到主线程（与 UI 同步节拍共用 KRVSync），vsync 不可用时直接抛到主线程
+     */
+    static std::shared_ptr<KREventCoalescer> Create(const FrameScheduler &scheduler = nullptr);
+
+    explicit KREventCoalescer(const FrameScheduler &scheduler);
+    KREventCoalescer(const KREventCoalescer &) = delete;
+    KREventCoalescer &operator=(const KREventCoalescer &) = delete;
+
+    /**
+     * 可合并事件，同一帧内只以最后一次的 callback 派发一次
+     */
+    void PostMotion(const KRMotionSample &sample, const MotionCallback &callback);
+
+    /**
+     * 不可合并事件，sample 作为后续 move 计算位移的起点
+     */
+    void PostDiscrete(const KRMotionSample &sample, const std::function<void()> &task);
+
+    /**
+     * 不可合并事件，清空位移起点
+     */
+    void PostDiscrete(const std::function<void()> &task);
+
+    /**
+     * 立即派发积压的合并事件
+     */
+    void Flush();
+
+    /**
+     * 丢弃积压的合并事件，View 销毁或事件解绑时调用
+     */
+    void Reset();
+
+    uint64_t GetReceivedCount() const {
+        return received_count_;
+    }
+
+    uint64_t GetDeliveredCount() const {
+        return delivered_count_;
+    }
+
+ private:
+    void ScheduleFlush();
+
+    FrameScheduler scheduler_;
+    MotionCallback pending_callback_;
+    KRCoalescedMotion pending_;
+    bool flush_scheduled_ = false;
+    bool has_anchor_ = false;
+    KRMotionSample anchor_;      // 上一次采样，计算位移
+    int64_t span_start_ns_ = 0;  // 本次合并的起始时间，计算速度
+    uint64_t received_count_ = 0;
+    uint64_t delivered_count_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KREVENTCOALESCER_H
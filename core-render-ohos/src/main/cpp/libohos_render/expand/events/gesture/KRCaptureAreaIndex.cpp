@@ -0,0 +1,93 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/events/gesture/KRCaptureAreaIndex.h"
+
+#include <algorithm>
+
+size_t KRCaptureAreaIndex::Slot(float v, float min, float cell, size_t count) {
+    if (v < min) {
+        return 0;
+    }
+    auto slot = static_cast<double>(v - min) / cell;
+    if (slot >= count) {
+        // 恰好落在包围盒右/下边界上的坐标归入最后一个网格单元
+        return v <= min + cell * count ? count : count + 1;
+    }
+    return static_cast<size_t>(slot) + 1;
+}
+
+void KRCaptureAreaIndex::Build(std::vector<Area> areas) {
+    areas_ = std::move(areas);
+    cols_ = rows_ = 0;
+    cell_offsets_.clear();
+    cell_areas_.clear();
+    if (areas_.size() < kMinGridAreaCount) {
+        return;
+    }
+
+    // 有限坐标的包围盒
+    float min_x = INFINITY, max_x = -INFINITY, min_y = INFINITY, max_y = -INFINITY;
+    for (const auto &area : areas_) {
+        for (float v : {area.left, area.right}) {
+            if (std::isfinite(v)) {
+                min_x = std::min(min_x, v);
+                max_x = std::max(max_x, v);
+            }
+        }
+        for (float v : {area.top, area.bottom}) {
+            if (std::isfinite(v)) {
+                min_y = std::min(min_y, v);
+                max_y = std::max(max_y, v);
+            }
+        }
+    }
+    if (!(min_x < max_x) || !(min_y < max_y)) {
+        return;
+    }
+    size_t grid = std::min(kMaxGridSize, static_cast<size_t>(std::ceil(std::sqrt(areas_.size()))));
+    cols_ = rows_ = grid;
+    min_x_ = min_x;
+    min_y_ = min_y;
+    cell_width_ = (max_x - min_x) / cols_;
+    cell_height_ = (max_y - min_y) / rows_;
+
+    // 两遍：先统计每个单元的区域数，再按下标升序填充
+    size_t cell_count = (cols_ + 2) * (rows_ + 2);
+    cell_offsets_.assign(cell_count + 1, 0);
+    auto for_each_cell = [this](const Area &area, auto &&fn) {
+        if (area.left > area.right || area.top > area.bottom) {
+            return;  // 不可能命中
+        }
+        auto c0 = Column(area.left), c1 = Column(area.right);
+        auto r0 = Row(area.top), r1 = Row(area.bottom);
+        for (auto r = r0; r <= r1; ++r) {
+            for (auto c = c0; c <= c1; ++c) {
+                fn(Cell(c, r));
+            }
+        }
+    };
+    for (const auto &area : areas_) {
+        for_each_cell(area, [this](size_t cell) { cell_offsets_[cell + 1]++; });
+    }
+    for (size_t i = 0; i < cell_count; ++i) {
+        cell_offsets_[i + 1] += cell_offsets_[i];
+    }
+    cell_areas_.resize(cell_offsets_[cell_count]);
+    std::vector<uint32_t> cursor(cell_offsets_.begin(), cell_offsets_.end() - 1);
+    for (uint32_t i = 0; i < areas_.size(); ++i) {
+        for_each_cell(areas_[i], [this, &cursor, i](size_t cell) { cell_areas_[cursor[cell]++] = i; });
+    }
+}
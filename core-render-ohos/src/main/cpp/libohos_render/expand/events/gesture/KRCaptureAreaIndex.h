@@ -0,0 +1,109 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRCAPTUREAREAINDEX_H
+#define CORE_RENDER_OHOS_KRCAPTUREAREAINDEX_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * 捕获区域的网格索引，用于按触点坐标查找可能命中的区域
+ * - 区域为闭区间，无界的边用 ±INFINITY 表示
+ * - 有限坐标的包围盒划分为网格，外侧各加一圈无界单元，区域登记到其覆盖的所有单元
+ * - 区域较少时不建网格，直接遍历
+ * 不依赖 ArkUI，可直接在 host 上编译
+ */
+class KRCaptureAreaIndex {
+ public:
+    struct Area {
+        float left = -INFINITY;
+        float top = -INFINITY;
+        float right = INFINITY;
+        float bottom = INFINITY;
+
+        bool Contains(float x, float y) const {
+            return x >= left && x <= right && y >= top && y <= bottom;
+        }
+    };
+
+    // 少于该数量时不建网格
+    static constexpr size_t kMinGridAreaCount = 8;
+    static constexpr size_t kMaxGridSize = 16;
+
+    /**
+     * 重建索引，区域的下标即其在 areas 中的位置
+     */
+    void Build(std::vector<Area> areas);
+
+    /**
+     * 依次访问包含 (x, y) 的区域下标（按下标升序），visitor 返回 true 时停止
+     * @return visitor 是否返回过 true
+     */
+    template <typename Visitor> bool AnyContains(float x, float y, Visitor &&visitor) const {
+        if (cols_ == 0 || std::isnan(x) || std::isnan(y)) {
+            for (size_t i = 0; i < areas_.size(); ++i) {
+                if (ContainsOrNaN(areas_[i], x, y) && visitor(i)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        auto cell = Cell(Column(x), Row(y));
+        for (uint32_t i = cell_offsets_[cell]; i < cell_offsets_[cell + 1]; ++i) {
+            auto index = cell_areas_[i];
+            if (areas_[index].Contains(x, y) && visitor(index)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t Size() const {
+        return areas_.size();
+    }
+
+ private:
+    // 与比较运算的语义一致：NaN 坐标不会被任何边界排除
+    static bool ContainsOrNaN(const Area &area, float x, float y) {
+        return !(x < area.left || x > area.right || y < area.top || y > area.bottom);
+    }
+
+    // 0 与 cols_ + 1 为网格外侧的无界列
+    size_t Column(float x) const {
+        return Slot(x, min_x_, cell_width_, cols_);
+    }
+    size_t Row(float y) const {
+        return Slot(y, min_y_, cell_height_, rows_);
+    }
+    size_t Cell(size_t column, size_t row) const {
+        return row * (cols_ + 2) + column;
+    }
+    static size_t Slot(float v, float min, float cell, size_t count);
+
+    std::vector<Area> areas_;
+    size_t cols_ = 0;
+    size_t rows_ = 0;
+    float min_x_ = 0;
+    float min_y_ = 0;
+    float cell_width_ = 0;
+    float cell_height_ = 0;
+    std::vector<uint32_t> cell_offsets_;  // 每个单元在 cell_areas_ 中的起止位置
+    std::vector<uint32_t> cell_areas_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRCAPTUREAREAINDEX_H
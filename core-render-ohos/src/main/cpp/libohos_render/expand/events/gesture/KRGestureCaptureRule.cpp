@@ -84,6 +84,19 @@ bool KRGestureCaptureRule::TestArea(const float interrupt_x, const float interru
     return true;
 }
 
+KRCaptureAreaIndex::Area KRGestureCaptureRule::GetArea() const {
+    KRCaptureAreaIndex::Area area;
+    if (!isnan(x) && !isnan(width)) {
+        area.left = x;
+        area.right = x + width;
+    }
+    if (!isnan(y) && !isnan(height)) {
+        area.top = y;
+        area.bottom = y + height;
+    }
+    return area;
+}
+
 bool KRGestureCaptureRule::TestPanDirection(const ArkUI_GestureEvent *gesture_event) {
     if ((direction & ALL) == ALL) {
         return true;
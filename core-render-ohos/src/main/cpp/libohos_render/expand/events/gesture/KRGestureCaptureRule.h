@@ -18,6 +18,8 @@
 
 #include <arkui/native_gesture.h>
 #include <vector>
+#include "libohos_render/expand/events/gesture/KRCaptureAreaIndex.h"
+
 class KRGestureCaptureRule {
     enum Type { TYPE_UNKNOWN = 0, TYPE_CLICK = 1, TYPE_DOUBLE_CLICK = 2, TYPE_LONG_PRESS = 3, TYPE_PAN = 4 };
     enum Direction {
@@ -35,9 +37,13 @@ class KRGestureCaptureRule {
     bool Valid();
     bool Test(const ArkUI_GestureRecognizerType gesture_type, const ArkUI_GestureEvent *gesture_event,
               const float interrupt_x, const float interrupt_y);
+    bool TestType(const ArkUI_GestureRecognizerType gesture_type);
+    /**
+     * 捕获区域，未指定的方向无界
+     */
+    KRCaptureAreaIndex::Area GetArea() const;
 
  private:
-    bool TestType(const ArkUI_GestureRecognizerType gesture_type);
     bool TestArea(const float interrupt_x, const float interrupt_y);
     bool TestPanDirection(const ArkUI_GestureEvent *gesture_event);
     int type = TYPE_UNKNOWN;
@@ -32,6 +32,7 @@ KRGestureGroupHandler::~KRGestureGroupHandler() {
     });
     gesture_event_handlers_.clear();
     capture_rules_.clear();
+    capture_rule_groups_ = {};
 
     auto gesture_api = kuikly::util::GetGestureApi();
     gesture_api->removeGestureFromNode(node_handle_, gesture_group_);
@@ -102,9 +103,34 @@ void KRGestureGroupHandler::RefreshGestureRegistration() {
     gesture_api->addGestureToNode(node_handle_, gesture_group_, mode, NORMAL_GESTURE_MASK);
 }
 
+static int CaptureRuleGroupOf(const ArkUI_GestureRecognizerType gesture_type) {
+    switch (gesture_type) {
+    case TAP_GESTURE:
+        return 0;
+    case LONG_PRESS_GESTURE:
+        return 1;
+    case PAN_GESTURE:
+        return 2;
+    default:
+        return -1;
+    }
+}
+
 void KRGestureGroupHandler::SetCaptureRule(const std::vector<KRGestureCaptureRule> &&rules) {
     bool old_empty = capture_rules_.empty();
     capture_rules_ = std::move(rules);
+    for (auto gesture_type : {TAP_GESTURE, LONG_PRESS_GESTURE, PAN_GESTURE}) {
+        auto &group = capture_rule_groups_[CaptureRuleGroupOf(gesture_type)];
+        group.rules.clear();
+        std::vector<KRCaptureAreaIndex::Area> areas;
+        for (size_t i = 0; i < capture_rules_.size(); ++i) {
+            if (capture_rules_[i].TestType(gesture_type)) {
+                group.rules.push_back(i);
+                areas.push_back(capture_rules_[i].GetArea());
+            }
+        }
+        group.index.Build(std::move(areas));
+    }
     if (capture_rules_.empty() != old_empty) {
         RefreshGestureRegistration();
     }
@@ -114,10 +140,12 @@ bool KRGestureGroupHandler::TestCaptureRule(const ArkUI_GestureRecognizerType ge
                                             const ArkUI_GestureEvent *gesture_event,
                                             const float interrupt_x,
                                             const float interrupt_y) {
-    for (auto& rule : capture_rules_) {
-        if (rule.Test(gesture_type, gesture_event, interrupt_x, interrupt_y)) {
-            return true;
-        }
+    auto group_index = CaptureRuleGroupOf(gesture_type);
+    if (group_index < 0) {
+        return false;
     }
-    return false;
+    auto &group = capture_rule_groups_[group_index];
+    return group.index.AnyContains(interrupt_x, interrupt_y, [&](size_t i) {
+        return capture_rules_[group.rules[i]].Test(gesture_type, gesture_event, interrupt_x, interrupt_y);
+    });
 }
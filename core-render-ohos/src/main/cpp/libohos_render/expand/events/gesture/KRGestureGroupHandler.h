@@ -17,6 +17,7 @@
 #define CORE_RENDER_OHOS_KRGESTUREGROUPHANDLER_H
 
 #include <arkui/native_gesture.h>
+#include <array>
 #include <functional>
 #include "KRGestureCaptureRule.h"
 #include "libohos_render/expand/events/gesture/KRGestueEventType.h"
@@ -44,6 +45,12 @@ class KRGestureGroupHandler {
     ArkUI_GestureRecognizer *gesture_group_ = nullptr;
     KRGestureEventCallback gesture_event_callback_;
     std::vector<KRGestureCaptureRule> capture_rules_;
+    // 按手势类型（点击、长按、拖动）分组的捕获区域索引
+    struct CaptureRuleGroup {
+        std::vector<size_t> rules;  // capture_rules_ 中的下标
+        KRCaptureAreaIndex index;
+    };
+    std::array<CaptureRuleGroup, 3> capture_rule_groups_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRGESTUREGROUPHANDLER_H
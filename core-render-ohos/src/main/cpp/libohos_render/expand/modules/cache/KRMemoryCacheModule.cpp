@@ -14,23 +14,15 @@
  */
 
 #include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
+#include "libohos_render/expand/components/image/KRImageDecoder.h"
 #include "libohos_render/expand/components/image/KRImageView.h"
-#include "libohos_render/expand/modules/codec/KRCodec.h"
 #include "libohos_render/expand/modules/network/KRNetworkModule.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRTextCodec.h"
 #include "libohos_render/utils/KRURIHelper.h"
 #include <cstdint>
-#include <multimedia/image_framework/image/image_source_native.h>
 #include <multimedia/image_framework/image/pixelmap_native.h>
-#include <shared_mutex>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-// Remove this declaration if compatable api is raised to 18 and above
-extern Image_ErrorCode OH_PixelmapNative_Destroy(OH_PixelmapNative **pixelmap) __attribute__((weak));
-#ifdef __cplusplus
-};
-#endif
+#include <unordered_set>
 
 constexpr char kMethodNameSetObject[] = "setObject";
 constexpr char kMethodNameCacheImage[] = "cacheImage";
@@ -48,6 +40,15 @@ constexpr char kCacheStateComplete[] = "Complete";
 constexpr char kCacheStateInProgress[] = "InProgress";
 constexpr char kCacheKeyPrefix[] = "data:image_Md5_";
 
+// 通用对象按条目数淘汰，图片按像素字节数淘汰
+constexpr size_t kObjectCacheMaxCount = 256;
+constexpr size_t kImageCacheMaxBytes = 64 * 1024 * 1024;
+// AbilityConstant.MemoryLevel
+constexpr int32_t kMemoryLevelModerate = 0;
+constexpr int32_t kMemoryLevelLow = 1;
+// 内存等级回调后图片预算减半的持续时间
+constexpr std::chrono::seconds kMemoryPressureHoldDuration(30);
+
 constexpr char kHttpPrefix[] = "http:";
 constexpr char kHttpsPrefix[] = "https:";
 
@@ -58,25 +59,113 @@ static bool isNetwork(const std::string &src) {
 
 static bool isAssets(const std::string &src) { return src.compare(0, KR_ASSET_PREFIX.size(), KR_ASSET_PREFIX) == 0; }
 
+static std::mutex &LiveModulesMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::unordered_set<KRMemoryCacheModule *> &LiveModules() {
+    static std::unordered_set<KRMemoryCacheModule *> modules;
+    return modules;
+}
+
+KRMemoryCacheModule::KRMemoryCacheModule()
+    : cache_map_(0, kObjectCacheMaxCount), image_cache_map_(kImageCacheMaxBytes, 0) {
+    std::lock_guard<std::mutex> lock(LiveModulesMutex());
+    LiveModules().insert(this);
+}
+
+KRMemoryCacheModule::~KRMemoryCacheModule() {
+    std::lock_guard<std::mutex> lock(LiveModulesMutex());
+    LiveModules().erase(this);
+}
+
 KRAnyValue KRMemoryCacheModule::Get(const std::string &key) {
-    auto it = cache_map_.find(key);
-    if (it == cache_map_.end()) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto value = cache_map_.Get(key);
+    if (value == nullptr) {
         return KREmptyValue();
     } else {
-        return it->second;
+        return *value;
     }
 }
 
-OH_PixelmapNative *KRMemoryCacheModule::GetImage(const std::string &key) {
-    std::shared_lock<std::shared_mutex> lock(mtx_);
-    auto it = image_cache_map_.find(key);
-    if (it == image_cache_map_.end()) {
+std::shared_ptr<OH_PixelmapNative> KRMemoryCacheModule::GetImage(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto pixelmap = image_cache_map_.Get(key);
+    if (pixelmap == nullptr) {
         return nullptr;
     } else {
-        return it->second;
+        return *pixelmap;
+    }
+}
+
+bool KRMemoryCacheModule::PinImage(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return image_cache_map_.Pin(key);
+}
+
+void KRMemoryCacheModule::UnpinImage(const std::string &key) {
+    std::vector<std::shared_ptr<OH_PixelmapNative>> removed;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        image_cache_map_.Unpin(key, &removed);
+    }
+}
+
+void KRMemoryCacheModule::TrimOnMemoryLevel(int32_t level) {
+    std::vector<KRAnyValue> removed_objects;
+    std::vector<std::shared_ptr<OH_PixelmapNative>> removed_images;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        // 任何等级都重新开始减半预算的计时，避免裁剪后立即涨回原预算
+        under_pressure_ = true;
+        pressure_deadline_ = std::chrono::steady_clock::now() + kMemoryPressureHoldDuration;
+        image_cache_map_.SetLimits(kImageCacheMaxBytes / 2, 0, &removed_images);
+        if (level > kMemoryLevelModerate) {
+            image_cache_map_.TrimUnpinned(&removed_images);
+            if (level > kMemoryLevelLow) {
+                cache_map_.TrimUnpinned(&removed_objects);
+            }
+        }
+    }
+    KR_LOG_INFO_WITH_TAG(kMemoryCacheModuleName) << "trim on memory level: " << level
+                                                 << ", images: " << removed_images.size()
+                                                 << ", objects: " << removed_objects.size();
+}
+
+KRMemoryCacheModule::Stats KRMemoryCacheModule::GetStats() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return Stats{cache_map_.GetStats(), image_cache_map_.GetStats()};
+}
+
+void KRMemoryCacheModule::TrimAllOnMemoryLevel(int32_t level) {
+    std::lock_guard<std::mutex> lock(LiveModulesMutex());
+    for (auto module : LiveModules()) {
+        module->TrimOnMemoryLevel(level);
     }
 }
 
+template <typename CacheStats> static void AccumulateStats(CacheStats &total, const CacheStats &stats) {
+    total.hit_count += stats.hit_count;
+    total.miss_count += stats.miss_count;
+    total.eviction_count += stats.eviction_count;
+    total.count += stats.count;
+    total.cost += stats.cost;
+    total.pinned_count += stats.pinned_count;
+}
+
+KRMemoryCacheModule::Stats KRMemoryCacheModule::GetAllStats() {
+    Stats total;
+    std::lock_guard<std::mutex> lock(LiveModulesMutex());
+    for (auto module : LiveModules()) {
+        auto stats = module->GetStats();
+        AccumulateStats(total.object, stats.object);
+        AccumulateStats(total.image, stats.image);
+    }
+    return total;
+}
+
 KRAnyValue KRMemoryCacheModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                                            const KRRenderCallback &callback) {
     if (std::strcmp(method.c_str(), kMethodNameSetObject) == 0) {
@@ -92,50 +181,56 @@ KRAnyValue KRMemoryCacheModule::SetObject(const KRAnyValue &params) {
     auto map = params->toMap();
     auto key = map[kParamNameKey]->toString();
     auto value = map[kParamNameValue];
-    cache_map_[key] = value;
 
-    bool found = false;
+    // 被移除的值在锁外释放
+    std::vector<KRAnyValue> removed_objects;
+    std::vector<std::shared_ptr<OH_PixelmapNative>> removed_images;
     {
-        std::shared_lock<std::shared_mutex> lock(mtx_);
-        found = image_cache_map_.find(key) != image_cache_map_.end();
-    }
-    if (found) {
-        OH_PixelmapNative *pixelmap = nullptr;
-        {
-            std::unique_lock<std::shared_mutex> lock(mtx_);
-            auto it = image_cache_map_.find(key);
-            if (it != image_cache_map_.end()) {
-                pixelmap = it->second;
-                image_cache_map_.erase(it);
-            }
-        }
-        if (pixelmap) {
-            ReleasePixelmap(pixelmap);
-        }
+        std::lock_guard<std::mutex> lock(mtx_);
+        cache_map_.Put(key, value, 1, &removed_objects);
+        image_cache_map_.Remove(key, &removed_images);
     }
 
     return KREmptyValue();
 }
 
-OH_PixelmapNative *KRMemoryCacheModule::LoadPixelmapFromLocal(std::string &src) {
-    OH_PixelmapNative *pixelmap = nullptr;
-    OH_ImageSourceNative *source;
-    auto code = OH_ImageSourceNative_CreateFromUri(src.data(), src.length(), &source);
-    if (code == IMAGE_SUCCESS) {
-        // 通过图片解码参数创建PixelMap对象
-        OH_DecodingOptions *ops;
-        if (OH_DecodingOptions_Create(&ops) == IMAGE_SUCCESS) {
-            // 设置为AUTO会根据图片资源格式解码，如果图片资源为HDR资源则会解码为HDR的pixelmap。
-            OH_DecodingOptions_SetDesiredDynamicRange(ops, IMAGE_DYNAMIC_RANGE_AUTO);
-            OH_ImageSourceNative_CreatePixelmap(source, ops, &pixelmap);
-            OH_DecodingOptions_Release(ops);
-        }
-        OH_ImageSourceNative_Release(source);
-    } else {
-        KR_LOG_ERROR_WITH_TAG(kMemoryCacheModuleName) << "failed to create image source from uri: " << src
-                                                      << ", error code: " << code;
-    }
-    return pixelmap;
+void KRMemoryCacheModule::DecodeImageAsync(const std::string &path, const std::string &cache_key,
+                                           const KRRenderCallback &callback) {
+    KRImageDecodePipeline::Request request;
+    request.src = path;
+    // 结果由本模块缓存
+    request.cacheable = false;
+    std::weak_ptr<IKRRenderModuleExport> weak_self = shared_from_this();
+    KRImageDecoder::SharedPipeline()->Load(request, [weak_self, cache_key,
+                                                     callback](const std::shared_ptr<OH_PixelmapNative> &pixelmap) {
+        // 解码在工作线程完成，回到主线程写缓存并回调
+        KRMainThread::RunOnMainThread([weak_self, cache_key, callback, pixelmap] {
+            auto self = weak_self.lock();
+            if (!self) {
+                return;
+            }
+            auto module_self = reinterpret_cast<KRMemoryCacheModule *>(self.get());
+            KRRenderValueMap result;
+            if (!pixelmap) {
+                result = module_self->GenerateError(-1, "failed to decode image: " + cache_key);
+            } else if (auto cached_pixelmap = module_self->SetImage(cache_key, pixelmap)) {
+                result = module_self->GenerateResult(cache_key, cached_pixelmap.get());
+            } else {
+                result = module_self->GenerateError(-1, "image exceeds memory cache budget: " + cache_key);
+            }
+            if (callback) {
+                callback(NewKRRenderValue(result));
+            }
+        });
+    });
+}
+
+KRRenderValueMap KRMemoryCacheModule::GenerateInProgress() {
+    KRRenderValueMap result;
+    result[kStatusKeyState] = NewKRRenderValue(kCacheStateInProgress);
+    result[kStatusKeyErrorCode] = NewKRRenderValue(0);
+    result[kStatusKeyErrorMsg] = NewKRRenderValue("loading async");
+    return result;
 }
 
 KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRenderCallback &callback) {
@@ -143,10 +238,9 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
     auto src = map[kParamNameSrc]->toString();
     auto cache_key = GenerateCacheKey(src);
 
-    OH_PixelmapNative *pixelmap = GetImage(cache_key);
-    if (pixelmap) {
+    if (auto cached_pixelmap = GetImage(cache_key)) {
         // already cached, return directly
-        auto result = GenerateResult(cache_key, pixelmap);
+        auto result = GenerateResult(cache_key, cached_pixelmap.get());
         if (callback) {
             callback(NewKRRenderValue(result));
         }
@@ -164,21 +258,21 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
         }
     }
     if (!isNetwork(src)) {
-        pixelmap = LoadPixelmapFromLocal(src);
-        if (pixelmap) {
-            SetImage(cache_key, pixelmap);
-            auto result = GenerateResult(cache_key, pixelmap);
-            if (callback) {
-                callback(NewKRRenderValue(result));
-            }
-            return NewKRRenderValue(std::move(result));
-        } else {
-            KRRenderValueMap result = GenerateError(-1, "failed to load image from local: invalid src");
-            if (callback) {
-                callback(NewKRRenderValue(result));
-            }
-            return NewKRRenderValue(std::move(result));
+        if (callback) {
+            // 有回调时在后台解码，不阻塞调用线程
+            DecodeImageAsync(src, cache_key, callback);
+            return NewKRRenderValue(GenerateInProgress());
+        }
+        KRImageDecodePipeline::Request request;
+        request.src = src;
+        auto pixelmap = KRImageDecoder::Decode(request);
+        if (!pixelmap) {
+            return NewKRRenderValue(GenerateError(-1, "failed to load image from local: invalid src"));
+        }
+        if (auto cached_pixelmap = SetImage(cache_key, pixelmap)) {
+            return NewKRRenderValue(GenerateResult(cache_key, cached_pixelmap.get()));
         }
+        return NewKRRenderValue(GenerateError(-1, "image exceeds memory cache budget"));
     }
 
     // auto sync = map[kParamNameSync]->toBool(); // FIXME: sync mode is not supported yet
@@ -195,27 +289,13 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
                 } else {
                     return;
                 }
-                OH_PixelmapNative *pixelmap = nullptr;
-                if (res) {
-                    auto filePath = res->toString();
-                    pixelmap = module_self->LoadPixelmapFromLocal(filePath);
-                }
-                KRRenderValueMap result;
-                if (pixelmap) {
-                    module_self->SetImage(cache_key, pixelmap);
-                    result = module_self->GenerateResult(cache_key, pixelmap);
-                } else {
-                    result = module_self->GenerateError(-1, "fetch failed");
-                }
-                if (callback) {
-                    callback(NewKRRenderValue(result));
+                if (res && !res->toString().empty()) {
+                    module_self->DecodeImageAsync(res->toString(), cache_key, callback);
+                } else if (callback) {
+                    callback(NewKRRenderValue(module_self->GenerateError(-1, "fetch failed")));
                 }
             });
-            KRRenderValueMap result;
-            result[kStatusKeyState] = NewKRRenderValue(kCacheStateInProgress);
-            result[kStatusKeyErrorCode] = NewKRRenderValue(0);
-            result[kStatusKeyErrorMsg] = NewKRRenderValue("loading async");
-            return NewKRRenderValue(result);
+            return NewKRRenderValue(GenerateInProgress());
         }
     }
     KRRenderValueMap result = GenerateError(-1, "network module required");
@@ -225,30 +305,41 @@ KRAnyValue KRMemoryCacheModule::CacheImage(const KRAnyValue &params, const KRRen
     return NewKRRenderValue(std::move(result));
 }
 
-void KRMemoryCacheModule::SetImage(const std::string &cache_key, OH_PixelmapNative *pixelmap) {
-    OH_PixelmapNative *exist_pixelmap = nullptr;
+std::shared_ptr<OH_PixelmapNative> KRMemoryCacheModule::SetImage(const std::string &cache_key,
+                                                                 const std::shared_ptr<OH_PixelmapNative> &value) {
+    auto byte_count = KRImageDecoder::GetByteCount(value.get());
+    // 被替换或淘汰的 pixelmap 在锁外释放，仍被 GetImage 调用方持有的会延后到其释放时
+    std::vector<std::shared_ptr<OH_PixelmapNative>> removed;
     {
-        std::unique_lock<std::shared_mutex> lock(mtx_);
-        auto it = image_cache_map_.find(cache_key);
-        if (it != image_cache_map_.end()) {
-            exist_pixelmap = it->second;
+        std::lock_guard<std::mutex> lock(mtx_);
+        RestoreImageBudgetIfNeeded(removed);
+        if (byte_count > image_cache_map_.MaxCost()) {
+            // 写入后会被立即淘汰，调用方拿到的 cacheKey 将无法命中
+            KR_LOG_ERROR_WITH_TAG(kMemoryCacheModuleName)
+                << "image exceeds memory cache budget: " << byte_count << " > " << image_cache_map_.MaxCost();
+            return nullptr;
         }
-        image_cache_map_[cache_key] = pixelmap;
+        image_cache_map_.Put(cache_key, value, byte_count, &removed);
     }
-    if (exist_pixelmap) {
-        ReleasePixelmap(exist_pixelmap);
+    return value;
+}
+
+void KRMemoryCacheModule::RestoreImageBudgetIfNeeded(std::vector<std::shared_ptr<OH_PixelmapNative>> &removed) {
+    if (under_pressure_ && std::chrono::steady_clock::now() >= pressure_deadline_) {
+        under_pressure_ = false;
+        image_cache_map_.SetLimits(kImageCacheMaxBytes, 0, &removed);
     }
 }
 
 std::string KRMemoryCacheModule::GenerateCacheKey(const std::string &src) {
-    std::ostringstream oss;
-    oss << kCacheKeyPrefix;
+    std::string key(kCacheKeyPrefix);
     if (src.length() > 200) {
-        oss << std::hash<std::string>{}(src);
+        key.append(std::to_string(std::hash<std::string>{}(src)));
     } else {
-        oss << kuikly::KRBase64Encode(src);
+        key.reserve(key.size() + KRTextCodec::Base64EncodedLength(src.size()));
+        KRTextCodec::Base64Encode(src, key);
     }
-    return oss.str();
+    return key;
 }
 
 KRRenderValueMap KRMemoryCacheModule::GenerateResult(const std::string &cache_key, OH_PixelmapNative *pixelmap) {
@@ -280,23 +371,11 @@ KRRenderValueMap KRMemoryCacheModule::GenerateError(int32_t code, const std::str
 }
 
 void KRMemoryCacheModule::OnDestroy() {
-    std::vector<OH_PixelmapNative *> to_destroy;
+    std::vector<KRAnyValue> removed_objects;
+    std::vector<std::shared_ptr<OH_PixelmapNative>> removed_images;
     {
-        std::unique_lock<std::shared_mutex> lock(mtx_);
-        for (const auto &entry : image_cache_map_) {
-            to_destroy.push_back(entry.second);
-        }
-        image_cache_map_.clear();
-    }
-    for (OH_PixelmapNative *pixelmap : to_destroy) {
-        ReleasePixelmap(pixelmap);
-    }
-}
-
-void KRMemoryCacheModule::ReleasePixelmap(OH_PixelmapNative *pixelmap) {
-    if (OH_PixelmapNative_Destroy) {
-        OH_PixelmapNative_Destroy(&pixelmap);
-    } else {
-        OH_PixelmapNative_Release(pixelmap);
+        std::lock_guard<std::mutex> lock(mtx_);
+        cache_map_.Clear(&removed_objects);
+        image_cache_map_.Clear(&removed_images);
     }
 }
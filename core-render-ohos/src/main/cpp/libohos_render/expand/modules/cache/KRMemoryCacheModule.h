@@ -16,37 +16,82 @@
 #ifndef CORE_RENDER_OHOS_KRMEMORYCACHEMODULE_H
 #define CORE_RENDER_OHOS_KRMEMORYCACHEMODULE_H
 
+#include <chrono>
 #include <cstdint>
-#include <shared_mutex>
+#include <memory>
+#include <mutex>
 
 #include "libohos_render/export/IKRRenderModuleExport.h"
+#include "libohos_render/foundation/KRLRUCache.h"
 
 constexpr char kMemoryCacheModuleName[] = "KRMemoryCacheModule";
 
 class KRMemoryCacheModule : public IKRRenderModuleExport {
  public:
-    KRMemoryCacheModule() = default;
+    struct Stats {
+        KRLRUCache<std::string, KRAnyValue>::Stats object;
+        KRLRUCache<std::string, std::shared_ptr<OH_PixelmapNative>>::Stats image;  // cost 为像素字节数
+    };
+
+    KRMemoryCacheModule();
+    ~KRMemoryCacheModule();
     KRAnyValue CallMethod(bool sync, const std::string &method, KRAnyValue params,
                           const KRRenderCallback &callback) override;
 
     KRAnyValue Get(const std::string &key);
-    OH_PixelmapNative *GetImage(const std::string &key);
+    /**
+     * 返回的 pixelmap 在持有期间不会因淘汰而被释放
+     */
+    std::shared_ptr<OH_PixelmapNative> GetImage(const std::string &key);
+    /**
+     * 正在上屏的图片可 pin 住以免被淘汰，与 UnpinImage 成对调用
+     */
+    bool PinImage(const std::string &key);
+    void UnpinImage(const std::string &key);
+    /**
+     * 按系统内存等级裁剪缓存，level 与 AbilityConstant.MemoryLevel 一致
+     * 每次回调都会把图片预算减半并重新开始计时，一段时间内没有新的回调才恢复原预算
+     */
+    void TrimOnMemoryLevel(int32_t level);
+    Stats GetStats();
     void OnDestroy() override;
 
+    /**
+     * 通知所有存活的缓存模块裁剪内存
+     */
+    static void TrimAllOnMemoryLevel(int32_t level);
+    /**
+     * 所有存活缓存模块的统计之和，供内存监控使用
+     */
+    static Stats GetAllStats();
+
  private:
     KRAnyValue SetObject(const KRAnyValue &params);
     KRAnyValue CacheImage(const KRAnyValue &params, const KRRenderCallback &callback);
     std::string GenerateCacheKey(const std::string &src);
-    void SetImage(const std::string &cache_key, OH_PixelmapNative *pixelmap);
+    /**
+     * 写入图片缓存，超出当前字节预算的图片不缓存并返回 nullptr
+     */
+    std::shared_ptr<OH_PixelmapNative> SetImage(const std::string &cache_key,
+                                                const std::shared_ptr<OH_PixelmapNative> &pixelmap);
+    /**
+     * 在后台解码 path 指向的图片，完成后在主线程写入缓存并回调
+     */
+    void DecodeImageAsync(const std::string &path, const std::string &cache_key, const KRRenderCallback &callback);
     KRRenderValueMap GenerateResult(const std::string &cache_key, OH_PixelmapNative *pixelmap);
     KRRenderValueMap GenerateError(int32_t code, const std::string &message);
-    OH_PixelmapNative *LoadPixelmapFromLocal(std::string &src);
-    void ReleasePixelmap(OH_PixelmapNative *pixelmap);
+    KRRenderValueMap GenerateInProgress();
+    /**
+     * 内存压力解除后恢复图片预算，需持有 mtx_
+     */
+    void RestoreImageBudgetIfNeeded(std::vector<std::shared_ptr<OH_PixelmapNative>> &removed);
 
  private:
-    std::unordered_map<std::string, KRAnyValue> cache_map_;
-    std::unordered_map<std::string, OH_PixelmapNative *> image_cache_map_;
-    std::shared_mutex mtx_;
+    KRLRUCache<std::string, KRAnyValue> cache_map_;
+    KRLRUCache<std::string, std::shared_ptr<OH_PixelmapNative>> image_cache_map_;
+    std::chrono::steady_clock::time_point pressure_deadline_;  // 图片预算减半的截止时间
+    bool under_pressure_ = false;
+    std::mutex mtx_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRMEMORYCACHEMODULE_H
@@ -15,116 +15,41 @@
 
 #include "KRCodec.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+#include <algorithm>
+#include <cerrno>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 #include "md5.h"
+#include "sha1.h"
 #include "sha256.h"
+#include "libohos_render/utils/KRTextCodec.h"
 
 #define MD5_DIGEST_LENGTH 16
-static const char *TAG = __FILE_NAME__;
 namespace kuikly {
 inline namespace model_util {
-const char HEX_DIGITS[] = "0123456789abcdef";
-// Maps integer in the range [0,16) to a hex digit.
-
-const char HEX_DIGITS_URI[] = "0123456789ABCDEF";
-// RFC 3986 section 2.1 says "For consistency, URI producers and normalizers should use uppercase
-// hexadecimal digits for all percent-encodings.
-
-const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                            "abcdefghijklmnopqrstuvwxyz"
-                            "0123456789+/";
-// Maps integer in the range [0,16) to a hex digit.
-
+// URL 与 base64 编解码统一由 KRTextCodec 实现
 std::string KREncodeURLComponent(const std::string &in) {
-    std::string out;
-    for (auto &b : in) {
-        if (('A' <= b && b <= 'Z') || ('a' <= b && b <= 'z') || ('0' <= b && b <= '9') || b == '-' || b == '_' ||
-            b == '.' || b == '!' || b == '~' || b == '*' || b == '\'' || b == '(' || b == ')') {
-            out.push_back(b);
-        } else {
-            out.push_back('%');
-            out.push_back(HEX_DIGITS_URI[b / 16]);
-            out.push_back(HEX_DIGITS_URI[b % 16]);
-        }
-    }
-    return out;
+    return KRTextCodec::EncodeURIComponent(in);
 }
 
 std::string KRDecodeURLComponent(const std::string &in) {
-    std::string res;
-    for (size_t i = 0; i < in.size(); ++i) {
-        if (in[i] == '%' && i + 2 < in.size()) {
-            char d1 = in[i + 1];
-            char d2 = in[i + 2];
-            if (std::isxdigit(d1) && std::isxdigit(d2)) {
-                char b = (std::isdigit(d1) ? (d1 - '0') : (std::toupper(d1) - 'A' + 10)) << 4;
-                b |= (std::isdigit(d2) ? (d2 - '0') : (std::toupper(d2) - 'A' + 10));
-                res.push_back(b);
-                i += 2;
-            } else {
-                res.push_back(in[i]);
-            }
-        } else {
-            res.push_back(in[i]);
-        }
-    }
-    return res;
+    return KRTextCodec::DecodeURIComponent(in);
 }
 
 std::string KRBase64Encode(const std::string &in) {
-    std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
-    }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
-    return out;
+    return KRTextCodec::Base64Encode(in);
 }
 
 std::string KRBase64Encode(const std::string_view in) {
-    std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
-    }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
-    return out;
+    return KRTextCodec::Base64Encode(in);
 }
 
 std::string KRBase64Decode(const std::string &in) {
-    std::string out;
-    std::vector<int> T(256, -1);
-    for (int i = 0; i < 64; i++)
-        T[base64_chars[i]] = i;
-    int val = 0, valb = -8;
-    for (unsigned char c : in) {
-        if (T[c] == -1)
-            break;
-        val = (val << 6) + T[c];
-        valb += 6;
-        if (valb >= 0) {
-            out.push_back(static_cast<char>((val >> valb) & 0xFF));
-            valb -= 8;
-        }
-    }
-    return out;
+    return KRTextCodec::Base64Decode(in);
 }
 
 std::string KRMd5(const std::string &in) {
@@ -149,5 +74,132 @@ std::string KRSha256(const std::string &in) {
     }
     return out.str();
 }
+
+static constexpr size_t kHashFileChunkSize = 256 * 1024;
+
+static std::string ToHex(const uint8_t *data, size_t size) {
+    static const char kHexDigits[] = "0123456789abcdef";
+    std::string out(size * 2, '0');
+    for (size_t i = 0; i < size; ++i) {
+        out[i * 2] = kHexDigits[data[i] >> 4];
+        out[i * 2 + 1] = kHexDigits[data[i] & 0x0F];
+    }
+    return out;
+}
+
+std::string KRSha1(const std::string &in) {
+    KRHasher hasher(KRHashAlgorithm::kSha1);
+    hasher.Update(in.data(), in.size());
+    return hasher.FinalHex();
+}
+
+std::string KRCrc32(const std::string &in) {
+    KRHasher hasher(KRHashAlgorithm::kCrc32);
+    hasher.Update(in.data(), in.size());
+    return hasher.FinalHex();
+}
+
+bool KRParseHashAlgorithm(const std::string &name, KRHashAlgorithm &algorithm) {
+    if (name == "md5") {
+        algorithm = KRHashAlgorithm::kMd5;
+    } else if (name == "sha1") {
+        algorithm = KRHashAlgorithm::kSha1;
+    } else if (name == "sha256") {
+        algorithm = KRHashAlgorithm::kSha256;
+    } else if (name == "crc32") {
+        algorithm = KRHashAlgorithm::kCrc32;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+KRHasher::KRHasher(KRHashAlgorithm algorithm) : algorithm_(algorithm) {
+    switch (algorithm_) {
+    case KRHashAlgorithm::kMd5:
+        MD5_Init(&md5_);
+        break;
+    case KRHashAlgorithm::kSha1:
+        SHA1_init(&hash_);
+        break;
+    case KRHashAlgorithm::kSha256:
+        SHA256_init(&hash_);
+        break;
+    case KRHashAlgorithm::kCrc32:
+        crc_ = static_cast<uint32_t>(crc32(0L, Z_NULL, 0));
+        break;
+    }
+}
+
+void KRHasher::Update(const void *data, size_t size) {
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    // 底层接口的长度为 int / unsigned long / uInt，分段传入
+    while (size > 0) {
+        size_t n = std::min<size_t>(size, 1 << 30);
+        switch (algorithm_) {
+        case KRHashAlgorithm::kMd5:
+            MD5_Update(&md5_, p, n);
+            break;
+        case KRHashAlgorithm::kSha1:
+        case KRHashAlgorithm::kSha256:
+            HASH_update(&hash_, p, static_cast<int>(n));
+            break;
+        case KRHashAlgorithm::kCrc32:
+            crc_ = static_cast<uint32_t>(crc32(crc_, p, static_cast<uInt>(n)));
+            break;
+        }
+        p += n;
+        size -= n;
+    }
+}
+
+std::string KRHasher::FinalHex() {
+    switch (algorithm_) {
+    case KRHashAlgorithm::kMd5: {
+        unsigned char md[MD5_DIGEST_LENGTH];
+        MD5_Final(md, &md5_);
+        return ToHex(md, MD5_DIGEST_LENGTH);
+    }
+    case KRHashAlgorithm::kSha1:
+    case KRHashAlgorithm::kSha256: {
+        int size = HASH_size(&hash_);
+        return ToHex(HASH_final(&hash_), size);
+    }
+    case KRHashAlgorithm::kCrc32: {
+        uint8_t bytes[4] = {static_cast<uint8_t>(crc_ >> 24), static_cast<uint8_t>(crc_ >> 16),
+                            static_cast<uint8_t>(crc_ >> 8), static_cast<uint8_t>(crc_)};
+        return ToHex(bytes, sizeof(bytes));
+    }
+    }
+    return "";
+}
+
+bool KRHashFile(const std::string &path, KRHashAlgorithm algorithm, std::string &hex_digest) {
+    // 用 read 而不是 mmap：下载中的缓存文件可能被截断，mmap 访问越界会触发 SIGBUS
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    KRHasher hasher(algorithm);
+    std::vector<uint8_t> buffer(kHashFileChunkSize);
+    bool ok = true;
+    while (true) {
+        ssize_t n = read(fd, buffer.data(), buffer.size());
+        if (n > 0) {
+            hasher.Update(buffer.data(), static_cast<size_t>(n));
+        } else if (n == 0) {
+            break;
+        } else if (errno != EINTR) {
+            ok = false;
+            break;
+        }
+    }
+    close(fd);
+    if (ok) {
+        hex_digest = hasher.FinalHex();
+    }
+    return ok;
+}
 }  //  namespace util
 }  //  namespace kuikly
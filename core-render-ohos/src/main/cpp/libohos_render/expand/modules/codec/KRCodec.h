@@ -14,7 +14,11 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include "md5.h"
+#include "hash-internal.h"
 
 namespace kuikly {
 inline namespace model_util {
@@ -30,5 +34,37 @@ std::string KRBase64Decode(const std::string &str);
 std::string KRMd5(const std::string &str);
 
 std::string KRSha256(const std::string &str);
+
+std::string KRSha1(const std::string &str);
+
+// crc32 (zlib/IEEE)，8 位小写十六进制
+std::string KRCrc32(const std::string &str);
+
+enum class KRHashAlgorithm { kMd5, kSha1, kSha256, kCrc32 };
+
+// "md5" / "sha1" / "sha256" / "crc32"
+bool KRParseHashAlgorithm(const std::string &name, KRHashAlgorithm &algorithm);
+
+/**
+ * 增量哈希，多次 Update 后调用一次 FinalHex 得到完整摘要（小写十六进制，md5 不截断）
+ */
+class KRHasher {
+ public:
+    explicit KRHasher(KRHashAlgorithm algorithm);
+
+    void Update(const void *data, size_t size);
+    std::string FinalHex();
+
+ private:
+    KRHashAlgorithm algorithm_;
+    MD5_CTX md5_;
+    HASH_CTX hash_;
+    uint32_t crc_ = 0;
+};
+
+/**
+ * 分块读取文件计算摘要，不把整个文件读入内存；阻塞调用，应在工作线程执行
+ */
+bool KRHashFile(const std::string &path, KRHashAlgorithm algorithm, std::string &hex_digest);
 }  //  namespace util
 }  //  namespace kuikly
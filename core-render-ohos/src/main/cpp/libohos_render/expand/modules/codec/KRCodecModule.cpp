@@ -16,6 +16,9 @@
 #include "KRCodecModule.h"
 
 #include "libohos_render/expand/modules/codec/KRCodec.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 
 namespace kuikly {
 namespace module {
@@ -27,13 +30,36 @@ const char KRCodecModule::METHOD_BASE64_ENCODE[] = "base64Encode";
 const char KRCodecModule::METHOD_BASE64_DECODE[] = "base64Decode";
 const char KRCodecModule::METHOD_MD5[] = "md5";
 const char KRCodecModule::METHOD_SHA256[] = "sha256";
+const char KRCodecModule::METHOD_SHA1[] = "sha1";
+const char KRCodecModule::METHOD_CRC32[] = "crc32";
+const char KRCodecModule::METHOD_HASH_FILE[] = "hashFile";
+const char KRCodecModule::METHOD_HASH_CREATE[] = "hashCreate";
+const char KRCodecModule::METHOD_HASH_UPDATE[] = "hashUpdate";
+const char KRCodecModule::METHOD_HASH_FINAL[] = "hashFinal";
+
+static constexpr char kParamPath[] = "path";
+static constexpr char kParamAlgorithm[] = "algorithm";
+static constexpr char kParamHandle[] = "handle";
+static constexpr char kParamData[] = "data";
 
 bool KRCodecModule::SyncMode() {
     return true;
 }
-void KRCodecModule::OnDestroy() {}
+void KRCodecModule::OnDestroy() {
+    std::lock_guard<std::mutex> lock(hashers_mutex_);
+    hashers_.Clear();
+}
 KRAnyValue KRCodecModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                                      const KRRenderCallback &callback) {
+    if (method == METHOD_HASH_FILE) {
+        return this->HashFile(params, callback);
+    } else if (method == METHOD_HASH_CREATE) {
+        return this->HashCreate(params);
+    } else if (method == METHOD_HASH_UPDATE) {
+        return this->HashUpdate(params);
+    } else if (method == METHOD_HASH_FINAL) {
+        return this->HashFinal(params);
+    }
     auto str = params->toString();
     if (method == this->METHOD_URL_ENCODE) {
         return this->UrlEncode(str);
@@ -47,6 +73,10 @@ KRAnyValue KRCodecModule::CallMethod(bool sync, const std::string &method, KRAny
         return this->Md5(str);
     } else if (method == METHOD_SHA256) {
         return this->Sha256(str);
+    } else if (method == METHOD_SHA1) {
+        return this->Sha1(str);
+    } else if (method == METHOD_CRC32) {
+        return this->Crc32(str);
     }
     return std::make_shared<KRRenderValue>();
 }
@@ -74,5 +104,98 @@ KRAnyValue KRCodecModule::Md5(const std::string str) {
 KRAnyValue KRCodecModule::Sha256(const std::string str) {
     return std::make_shared<KRRenderValue>(KRSha256(str));
 }
+
+KRAnyValue KRCodecModule::Sha1(const std::string str) {
+    return std::make_shared<KRRenderValue>(KRSha1(str));
+}
+
+KRAnyValue KRCodecModule::Crc32(const std::string str) {
+    return std::make_shared<KRRenderValue>(KRCrc32(str));
+}
+
+static KRRenderValueMap HashResult(int code, const std::string &value) {
+    KRRenderValueMap result;
+    result["code"] = std::make_shared<KRRenderValue>(code);
+    result[code == 0 ? "data" : "message"] = std::make_shared<KRRenderValue>(value);
+    return result;
+}
+
+KRAnyValue KRCodecModule::HashFile(const KRAnyValue &params, const KRRenderCallback &callback) {
+    auto map = params->toMap();
+    std::string path = map[kParamPath] ? map[kParamPath]->toString() : "";
+    KRHashAlgorithm algorithm;
+    if (path.empty() || !map[kParamAlgorithm] ||
+        !KRParseHashAlgorithm(map[kParamAlgorithm]->toString(), algorithm)) {
+        if (callback) {
+            callback(std::make_shared<KRRenderValue>(HashResult(-1, "invalid params")));
+        }
+        return std::make_shared<KRRenderValue>();
+    }
+    KRGCDQueue::GetInstance().DispatchAsync([path, algorithm, callback] {
+        std::string digest;
+        bool ok = KRHashFile(path, algorithm, digest);
+        KRMainThread::RunOnMainThread([ok, path, digest, callback] {
+            if (callback) {
+                callback(std::make_shared<KRRenderValue>(ok ? HashResult(0, digest)
+                                                            : HashResult(-1, "failed to read file: " + path)));
+            }
+        });
+    });
+    return std::make_shared<KRRenderValue>();
+}
+
+KRAnyValue KRCodecModule::HashCreate(const KRAnyValue &params) {
+    auto map = params->toMap();
+    KRHashAlgorithm algorithm;
+    if (!map[kParamAlgorithm] || !KRParseHashAlgorithm(map[kParamAlgorithm]->toString(), algorithm)) {
+        return std::make_shared<KRRenderValue>(0);
+    }
+    std::lock_guard<std::mutex> lock(hashers_mutex_);
+    int handle = next_hasher_id_++;
+    std::vector<std::unique_ptr<KRHasher>> evicted;
+    hashers_.Put(handle, std::make_unique<KRHasher>(algorithm), 1, &evicted);
+    if (!evicted.empty()) {
+        KR_LOG_ERROR << "hashCreate: too many live hashers, released " << evicted.size() << " idle handle(s)";
+    }
+    return std::make_shared<KRRenderValue>(handle);
+}
+
+KRAnyValue KRCodecModule::HashUpdate(const KRAnyValue &params) {
+    auto map = params->toMap();
+    auto data = map[kParamData];
+    if (!map[kParamHandle] || !data) {
+        return std::make_shared<KRRenderValue>(false);
+    }
+    std::lock_guard<std::mutex> lock(hashers_mutex_);
+    auto hasher = hashers_.Get(map[kParamHandle]->toInt());
+    if (hasher == nullptr) {
+        return std::make_shared<KRRenderValue>(false);
+    }
+    if (data->isByteArray()) {
+        auto &bytes = data->toByteArray();
+        (*hasher)->Update(bytes->data(), bytes->size());
+    } else {
+        auto str = data->toString();
+        (*hasher)->Update(str.data(), str.size());
+    }
+    return std::make_shared<KRRenderValue>(true);
+}
+
+KRAnyValue KRCodecModule::HashFinal(const KRAnyValue &params) {
+    auto map = params->toMap();
+    if (!map[kParamHandle]) {
+        return std::make_shared<KRRenderValue>("");
+    }
+    std::unique_ptr<KRHasher> hasher;
+    {
+        std::lock_guard<std::mutex> lock(hashers_mutex_);
+        std::vector<std::unique_ptr<KRHasher>> removed;
+        if (!hashers_.Remove(map[kParamHandle]->toInt(), &removed)) {
+            return std::make_shared<KRRenderValue>("");
+        }
+        hasher = std::move(removed.front());
+    }
+    return std::make_shared<KRRenderValue>(hasher->FinalHex());
+}
 }  // namespace module
 }  // namespace kuikly
@@ -14,7 +14,11 @@
  */
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include "libohos_render/export/IKRRenderModuleExport.h"
+#include "libohos_render/expand/modules/codec/KRCodec.h"
+#include "libohos_render/foundation/KRLRUCache.h"
 
 namespace kuikly {
 namespace module {
@@ -34,6 +38,12 @@ class KRCodecModule : public IKRRenderModuleExport {
     static const char METHOD_BASE64_DECODE[];
     static const char METHOD_MD5[];
     static const char METHOD_SHA256[];
+    static const char METHOD_SHA1[];
+    static const char METHOD_CRC32[];
+    static const char METHOD_HASH_FILE[];
+    static const char METHOD_HASH_CREATE[];
+    static const char METHOD_HASH_UPDATE[];
+    static const char METHOD_HASH_FINAL[];
 
     KRAnyValue UrlEncode(std::string);
     KRAnyValue UrlDecode(std::string);
@@ -41,6 +51,22 @@ class KRCodecModule : public IKRRenderModuleExport {
     KRAnyValue Base64Decode(std::string);
     KRAnyValue Md5(std::string);
     KRAnyValue Sha256(std::string);
+    KRAnyValue Sha1(std::string);
+    KRAnyValue Crc32(std::string);
+
+    // 在工作线程流式计算文件摘要，结果在主线程回调
+    KRAnyValue HashFile(const KRAnyValue &params, const KRRenderCallback &callback);
+    // 增量哈希：create 返回句柄，update 追加数据，final 返回摘要并释放句柄
+    KRAnyValue HashCreate(const KRAnyValue &params);
+    KRAnyValue HashUpdate(const KRAnyValue &params);
+    KRAnyValue HashFinal(const KRAnyValue &params);
+
+    // 同时存在的增量哈希句柄上限，超出时释放最久未使用的句柄（未调用 final 的句柄不会一直占用内存）
+    static constexpr size_t kMaxLiveHashers = 32;
+
+    std::mutex hashers_mutex_;
+    KRLRUCache<int, std::unique_ptr<KRHasher>> hashers_{0, kMaxLiveHashers};
+    int next_hasher_id_ = 1;
 };
 }  // namespace module
 }  // namespace kuikly
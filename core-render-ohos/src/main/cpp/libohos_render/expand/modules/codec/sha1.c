@@ -0,0 +1,127 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SHA-1 (FIPS 180-4), same HASH_CTX layout as sha256.c
+#include "sha1.h"
+#include <string.h>
+#include <stdint.h>
+#define rol(value, bits) (((value) << (bits)) | ((value) >> (32 - (bits))))
+static void SHA1_Transform(SHA1_CTX *ctx, const uint8_t *p) {
+    uint32_t W[80];
+    uint32_t A, B, C, D, E;
+    int t;
+    for (t = 0; t < 16; ++t) {
+        W[t] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+        p += 4;
+    }
+    for (; t < 80; t++) {
+        W[t] = rol(W[t - 3] ^ W[t - 8] ^ W[t - 14] ^ W[t - 16], 1);
+    }
+    A = ctx->state[0];
+    B = ctx->state[1];
+    C = ctx->state[2];
+    D = ctx->state[3];
+    E = ctx->state[4];
+#define SHA1_ROUND(f, k)                                     \
+    do {                                                     \
+        uint32_t tmp = rol(A, 5) + (f) + E + (k) + W[t];     \
+        E = D;                                               \
+        D = C;                                               \
+        C = rol(B, 30);                                      \
+        B = A;                                               \
+        A = tmp;                                             \
+    } while (0)
+    for (t = 0; t < 20; t++) {
+        SHA1_ROUND((B & C) | ((~B) & D), 0x5a827999);
+    }
+    for (; t < 40; t++) {
+        SHA1_ROUND(B ^ C ^ D, 0x6ed9eba1);
+    }
+    for (; t < 60; t++) {
+        SHA1_ROUND((B & C) | (B & D) | (C & D), 0x8f1bbcdc);
+    }
+    for (; t < 80; t++) {
+        SHA1_ROUND(B ^ C ^ D, 0xca62c1d6);
+    }
+#undef SHA1_ROUND
+    ctx->state[0] += A;
+    ctx->state[1] += B;
+    ctx->state[2] += C;
+    ctx->state[3] += D;
+    ctx->state[4] += E;
+}
+static const HASH_VTAB SHA1_VTAB = {SHA1_init, SHA1_update, SHA1_final, SHA1_hash, SHA1_DIGEST_SIZE};
+void SHA1_init(SHA1_CTX *ctx) {
+    ctx->f = &SHA1_VTAB;
+    ctx->state[0] = 0x67452301;
+    ctx->state[1] = 0xefcdab89;
+    ctx->state[2] = 0x98badcfe;
+    ctx->state[3] = 0x10325476;
+    ctx->state[4] = 0xc3d2e1f0;
+    ctx->count = 0;
+}
+void SHA1_update(SHA1_CTX *ctx, const void *data, int len) {
+    int i = (int)(ctx->count & 63);
+    const uint8_t *p = (const uint8_t *)data;
+    if (len <= 0) {
+        return;
+    }
+    ctx->count += len;
+    if (i > 0) {
+        int fill = 64 - i;
+        if (len < fill) {
+            memcpy(ctx->buf + i, p, len);
+            return;
+        }
+        memcpy(ctx->buf + i, p, fill);
+        SHA1_Transform(ctx, ctx->buf);
+        p += fill;
+        len -= fill;
+    }
+    // whole blocks are hashed in place
+    for (; len >= 64; len -= 64, p += 64) {
+        SHA1_Transform(ctx, p);
+    }
+    memcpy(ctx->buf, p, len);
+}
+const uint8_t *SHA1_final(SHA1_CTX *ctx) {
+    uint8_t *p = ctx->buf;
+    uint64_t cnt = ctx->count * 8;
+    int i;
+    SHA1_update(ctx, (uint8_t *)"\x80", 1);
+    while ((ctx->count & 63) != 56) {
+        SHA1_update(ctx, (uint8_t *)"\0", 1);
+    }
+    for (i = 0; i < 8; ++i) {
+        uint8_t tmp = (uint8_t)(cnt >> ((7 - i) * 8));
+        SHA1_update(ctx, &tmp, 1);
+    }
+    for (i = 0; i < 5; i++) {
+        uint32_t tmp = ctx->state[i];
+        *p++ = tmp >> 24;
+        *p++ = tmp >> 16;
+        *p++ = tmp >> 8;
+        *p++ = tmp >> 0;
+    }
+    return ctx->buf;
+}
+/* Convenience function */
+const uint8_t *SHA1_hash(const void *data, int len, uint8_t *digest) {
+    SHA1_CTX ctx;
+    SHA1_init(&ctx);
+    SHA1_update(&ctx, data, len);
+    memcpy(digest, SHA1_final(&ctx), SHA1_DIGEST_SIZE);
+    return digest;
+}
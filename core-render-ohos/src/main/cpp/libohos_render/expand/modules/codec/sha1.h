@@ -0,0 +1,33 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_SHA1_H
+#define CORE_RENDER_OHOS_SHA1_H
+#include <stdint.h>
+#include "hash-internal.h"
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+typedef HASH_CTX SHA1_CTX;
+void SHA1_init(SHA1_CTX *ctx);
+void SHA1_update(SHA1_CTX *ctx, const void *data, int len);
+const uint8_t *SHA1_final(SHA1_CTX *ctx);
+// Convenience method. Returns digest address.
+const uint8_t *SHA1_hash(const void *data, int len, uint8_t *digest);
+#define SHA1_DIGEST_SIZE 20
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // CORE_RENDER_OHOS_SHA1_H
@@ -22,28 +22,38 @@ constexpr char kMethodNameLogInfo[] = "logInfo";
 constexpr char kMethodNameLogDebug[] = "logDebug";
 constexpr char kMethodNameLogError[] = "logError";
 
+static bool LevelForMethod(const std::string &method, LogLevel &level) {
+    if (kuikly::util::isEqual(method, kMethodNameLogInfo)) {
+        level = LOG_INFO;
+    } else if (kuikly::util::isEqual(method, kMethodNameLogDebug)) {
+        level = LOG_DEBUG;
+    } else if (kuikly::util::isEqual(method, kMethodNameLogError)) {
+        level = LOG_ERROR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
 KRAnyValue KRLogModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
                                    const KRRenderCallback &callback) {
+    LogLevel level = LOG_INFO;
+    if (!LevelForMethod(method, level) || !KRRenderLog::IsLoggable(level)) {
+        return KREmptyValue();
+    }
     // if use has set a C/C++ adapter, then redirect it directly throw it,
     // otherwise redirect logs to the arkts version.
     if (KRRenderAdapterManager::GetInstance().HasCustomLogAdapter()) {
-        if (kuikly::util::isEqual(method, kMethodNameLogInfo)) {
+        if (level == LOG_INFO) {
             LogInfo(params);
-        } else if (kuikly::util::isEqual(method, kMethodNameLogDebug)) {
+        } else if (level == LOG_DEBUG) {
             LogDebug(params);
-        } else if (kuikly::util::isEqual(method, kMethodNameLogError)) {
+        } else {
             LogError(params);
         }
     } else {
-        auto instance_id = GetInstanceId();
-        auto method_name = method;
-        KRContextScheduler::ScheduleTaskOnMainThread(false, [instance_id, method_name, params] {
-            auto module_name = NewKRRenderValue("KRLogModuleArkTS");
-
-            KRArkTSManager::GetInstance().CallArkTSMethod(instance_id, KRNativeCallArkTSMethod::CallModuleMethod,
-                                                          module_name, NewKRRenderValue(method_name), params, nullptr,
-                                                          nullptr, nullptr);
-        });
+        // 由日志线程按实例合并后批量转发给 ArkTS，不再每条日志切一次主线程
+        KRLogDispatcher::GetInstance().Post(level, "", params->toString(), GetInstanceId());
     }
     return KREmptyValue();
 }
@@ -16,13 +16,26 @@
 #include "KRPreferences.h"
 
 #include <fcntl.h>
+#include <unistd.h>
+#include <filesystem>
 #include <fstream>
-#include <thread>
+#include "libohos_render/foundation/thread/KRThread.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 #include "thirdparty/tinyXml/tinyxml2.h"
 
 namespace kuikly {
 namespace util {
 
+static constexpr char kLogFileSuffix[] = ".kv";
+static constexpr int kFlushDelayMs = 100;             // 合并该时间窗口内的 Flush
+static constexpr size_t kCompactMinGarbage = 8 * 1024;  // 无效数据超过该值且超过有效数据时压缩
+
+// 所有 DataPreferences 共用的落盘线程，不随实例销毁
+static KRThread &PreferencesWriterThread() {
+    static KRThread *thread = new KRThread("KRPreferences");
+    return *thread;
+}
+
 std::unordered_map<std::string, std::string> DataPreferences::LoadFileToMap(const std::string &preferencesFullPath) {
     std::unordered_map<std::string, std::string> krMap;
     tinyxml2::XMLDocument doc;
@@ -82,24 +95,85 @@ DataPreferences::DataPreferences(const std::string &filesDir, const std::string
     std::filesystem::path preferencesName = filesName;
     std::filesystem::path fullPath = preferencesPath / preferencesName;
     this->preferencesFullPath_ = fullPath;
-    try {
-        keyValueMap_ = this->LoadFileToMap(this->preferencesFullPath_);
-    } catch (const std::exception &e) {
-        // KLOG_ERROR(TAG) << "Failed to load keyValueMap_ via file";
+    std::string logPath = this->preferencesFullPath_ + kLogFileSuffix;
+    std::error_code ec;
+    if (!std::filesystem::exists(logPath, ec) && std::filesystem::exists(this->preferencesFullPath_, ec)) {
+        // 从旧版 xml 文件迁移，日志文件写入完整后才删除 xml
+        try {
+            keyValueMap_ = this->LoadFileToMap(this->preferencesFullPath_);
+        } catch (const std::exception &e) {
+            KR_LOG_ERROR << "DataPreferences load xml failed: " << e.what();
+        }
+        if (log_.Create(logPath, keyValueMap_)) {
+            std::filesystem::remove(this->preferencesFullPath_, ec);
+        } else {
+            KR_LOG_ERROR << "DataPreferences migrate failed: " << logPath;
+        }
+    } else if (!log_.Open(logPath, &keyValueMap_)) {
+        KR_LOG_ERROR << "DataPreferences open failed: " << logPath;
+    }
+    for (const auto &pair : keyValueMap_) {
+        liveBytes_ += PreferencesLog::RecordSize(pair.first, pair.second);
     }
 }
 
+void DataPreferences::RefreshLocked() {
+    if (!log_.Refresh(&this->keyValueMap_)) {
+        return;
+    }
+    liveBytes_ = PreferencesLog::kHeaderSize;
+    for (const auto &pair : keyValueMap_) {
+        liveBytes_ += PreferencesLog::RecordSize(pair.first, pair.second);
+    }
+}
+
+DataPreferences::~DataPreferences() {
+    FlushSync();
+}
+
 std::shared_ptr<util::DataPreferences> DataPreferences::GetInstance(const std::string &filesDir, const std::string &filesName) {
-    static std::once_flag flag;
+    static std::mutex mutex;
     static std::shared_ptr<util::DataPreferences> preference;
-    std::call_once(flag, [&]() { preference = std::make_shared<util::DataPreferences>(filesDir, filesName); });
+    std::lock_guard<std::mutex> lock(mutex);
+    if (preference == nullptr) {
+        auto created = std::make_shared<util::DataPreferences>(filesDir, filesName);
+        if (!created->IsOpen()) {
+            return nullptr;
+        }
+        preference = created;
+    }
     return preference;
 }
 
-void DataPreferences::SetSync(const std::string &key, const std::string &value) {
+bool DataPreferences::SetSync(const std::string &key, const std::string &value) {
     std::unique_lock<std::mutex> lock(this->mtx_);
-    this->keyValueMap_[key] = value;
-    lock.unlock();
+    // 先读入其他进程的写入，避免覆盖或压缩时丢失
+    PreferencesLog::ScopedFileLock fileLock(log_);
+    RefreshLocked();
+    auto it = this->keyValueMap_.find(key);
+    if (it != this->keyValueMap_.end()) {
+        if (it->second == value) {
+            return log_.IsOpen();
+        }
+        liveBytes_ -= PreferencesLog::RecordSize(key, it->second);
+        it->second = value;
+    } else {
+        this->keyValueMap_.emplace(key, value);
+    }
+    auto recordSize = PreferencesLog::RecordSize(key, value);
+    liveBytes_ += recordSize;
+    if (!log_.IsOpen()) {
+        return false;
+    }
+    // 空间不足时优先压缩，避免日志无限增长
+    if (!log_.HasRoom(recordSize) && NeedCompactLocked() && log_.Rewrite(this->keyValueMap_)) {
+        return true;
+    }
+    if (!log_.Append(key, value)) {
+        KR_LOG_ERROR << "DataPreferences append failed, key: " << key;
+        return false;
+    }
+    return true;
 }
 
 std::string DataPreferences::GetSync(const std::string &key, const std::string &defaultValue) {
@@ -110,52 +184,57 @@ std::string DataPreferences::GetSync(const std::string &key, const std::string &
     return value;
 }
 
-void DataPreferences::Flush() {
-    std::thread([this]() { this->FlushSync(); }).detach();
+bool DataPreferences::NeedCompactLocked() const {
+    auto used = log_.UsedBytes();
+    return used > liveBytes_ * 2 && used - liveBytes_ >= kCompactMinGarbage;
 }
 
-void DataPreferences::FlushSync() {
-    std::filesystem::path preferencesFullPath = this->preferencesFullPath_;
-    tinyxml2::XMLDocument doc;
-    tinyxml2::XMLDeclaration *decl = doc.NewDeclaration();
-    doc.InsertFirstChild(decl);
-
-    tinyxml2::XMLElement *root = doc.NewElement("preferences");
-    root->SetAttribute("version", "1.0");
-    doc.InsertEndChild(root);
+void DataPreferences::Flush() {
     std::unique_lock<std::mutex> lock(this->mtx_);
-    auto copyMap = this->keyValueMap_;
-    lock.unlock();
-    for (const auto &pair : copyMap) {
-        tinyxml2::XMLElement *element = doc.NewElement("string");
-        element->SetAttribute("key", pair.first.c_str());
-        element->SetText(pair.second.c_str());
-        root->InsertEndChild(element);
+    if (flushScheduled_) {
+        return;
     }
-    FILE *fp = fopen(preferencesFullPath.c_str(), "w");
-    if (fp == nullptr) {
-        // KLOG_ERROR(TAG) << "Error opening file: " << preferencesFullPath;
+    flushScheduled_ = true;
+    lock.unlock();
+    std::weak_ptr<DataPreferences> weakSelf = weak_from_this();
+    if (weakSelf.expired()) {
+        FlushSync();
         return;
     }
-    // 文件加锁
-    int fd = fileno(fp);
-    struct flock fileLock;
-    fileLock.l_type = F_WRLCK;
-    fileLock.l_whence = SEEK_SET;
-    fileLock.l_start = 0;
-    fileLock.l_len = 0;
-    fcntl(fd, F_SETLKW, &fileLock);  // F_SETLKW:阻塞模式
+    PreferencesWriterThread().DispatchAsync(
+        [weakSelf] {
+            if (auto self = weakSelf.lock()) {
+                self->FlushSync();
+            }
+        },
+        kFlushDelayMs);
+}
 
-    if (doc.SaveFile(fp) == tinyxml2::XML_SUCCESS) {
-        // KLOG_INFO(TAG) << "Preferences Flush success";
-    } else {
-        // KLOG_ERROR(TAG) << "Preferences Flush: tinyxml2 save error";
-    }
+void DataPreferences::FlushSync() {
+    std::unique_lock<std::mutex> lock(this->mtx_);
+    FlushLocked(lock);
+}
 
-    // 文件解锁
-    fileLock.l_type = F_UNLCK;
-    fcntl(fd, F_SETLKW, &fileLock);
-    fclose(fp);
+void DataPreferences::FlushLocked(std::unique_lock<std::mutex> &lock) {
+    flushScheduled_ = false;
+    if (!log_.IsOpen()) {
+        return;
+    }
+    {
+        PreferencesLog::ScopedFileLock fileLock(log_);
+        RefreshLocked();
+        // 压缩会 fsync 新文件
+        if (NeedCompactLocked() && log_.Rewrite(this->keyValueMap_)) {
+            return;
+        }
+    }
+    // 数据已在 page cache 中，落盘在锁外进行，不阻塞读写
+    int fd = log_.DupFd();
+    lock.unlock();
+    if (fd >= 0) {
+        fdatasync(fd);
+        close(fd);
+    }
 }
 
 }  //  namespace util
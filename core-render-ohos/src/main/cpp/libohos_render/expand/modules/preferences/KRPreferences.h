@@ -13,9 +13,11 @@
  * limitations under the License.
  */
 #pragma once
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
+#include "libohos_render/expand/modules/preferences/KRPreferencesLog.h"
 
 namespace kuikly {
 namespace util {
@@ -28,21 +30,43 @@ namespace util {
 // #define PREFERENCES_PATH "/data/storage/el2/base/haps/entry/CAPIpreferences/"
 static const char *TAG = __FILE_NAME__;
 
-class DataPreferences {
+/**
+ * 持久化 key/value 存储
+ * - SetSync 立即追加到 mmap 日志（进程崩溃不丢数据），Flush 在后台单线程合并落盘，并按需压缩日志
+ * - 多进程共用同一文件时，写入前在文件锁内读入其他进程的写入；GetSync 不加文件锁，只反映最近一次同步的数据
+ * - 首次打开时从旧版 tinyxml2 文件迁移数据，迁移成功后删除旧文件
+ */
+class DataPreferences : public std::enable_shared_from_this<DataPreferences> {
  public:
     DataPreferences(const std::string &filesDir, const std::string &filesName);
-    void SetSync(const std::string &key, const std::string &value);
+    ~DataPreferences();
+    /**
+     * @return 是否已写入日志，失败时内存中的值仍会更新
+     */
+    bool SetSync(const std::string &key, const std::string &value);
     std::string GetSync(const std::string &key, const std::string &defaultValue);
     void Flush();
     void FlushSync();
+    bool IsOpen() const {
+        return log_.IsOpen();
+    }
+    /**
+     * 日志文件打开失败时返回 nullptr，之后的调用会重试
+     */
     static std::shared_ptr<util::DataPreferences> GetInstance(const std::string &filesDir, const std::string &filesName);
 
  private:
     std::string preferencesFullPath_;
     std::unordered_map<std::string, std::string> keyValueMap_;
     std::mutex mtx_;
+    PreferencesLog log_;
+    size_t liveBytes_ = PreferencesLog::kHeaderSize;  // 压缩后日志的大小
+    bool flushScheduled_ = false;
     std::unordered_map<std::string, std::string> LoadFileToMap(const std::string &preferencesFullPath);
     void CreatePreferencesDirectoryIfNeeded(const std::string &filePath);
+    void RefreshLocked();
+    bool NeedCompactLocked() const;
+    void FlushLocked(std::unique_lock<std::mutex> &lock);
 };
 }  //  namespace util
 }  //  namespace kuikly
@@ -0,0 +1,367 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "KRPreferencesLog.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace kuikly {
+namespace util {
+
+static constexpr uint8_t kMagic[4] = {'K', 'R', 'K', 'V'};
+static constexpr uint32_t kVersion = 1;
+static constexpr size_t kInitialCapacity = 16 * 1024;
+static constexpr size_t kPageSize = 4096;
+static constexpr uint32_t kMaxFieldLength = 64 * 1024 * 1024;
+
+static uint32_t Crc32(const uint8_t *data, size_t length) {
+    static const auto table = [] {
+        std::vector<uint32_t> t(256);
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+static size_t RoundCapacity(size_t size) {
+    size_t capacity = kInitialCapacity;
+    while (capacity < size) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+static void WriteHeader(uint8_t *dst) {
+    memset(dst, 0, PreferencesLog::kHeaderSize);
+    memcpy(dst, kMagic, sizeof(kMagic));
+    memcpy(dst + sizeof(kMagic), &kVersion, sizeof(kVersion));
+}
+
+// 写入一条记录，crc 最后写入
+static void WriteRecord(uint8_t *dst, const std::string &key, const std::string &value) {
+    uint32_t key_len = static_cast<uint32_t>(key.size());
+    uint32_t value_len = static_cast<uint32_t>(value.size());
+    memcpy(dst + 4, &key_len, 4);
+    memcpy(dst + 8, &value_len, 4);
+    memcpy(dst + PreferencesLog::kRecordHeaderSize, key.data(), key.size());
+    memcpy(dst + PreferencesLog::kRecordHeaderSize + key.size(), value.data(), value.size());
+    uint32_t crc = Crc32(dst + 4, 8 + key.size() + value.size());
+    memcpy(dst, &crc, 4);
+}
+
+static bool WriteFully(int fd, const uint8_t *data, size_t length) {
+    while (length > 0) {
+        ssize_t n = write(fd, data, length);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += n;
+        length -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+static void SyncParentDirectory(const std::string &path) {
+    auto dir = std::filesystem::path(path).parent_path();
+    int fd = open(dir.empty() ? "." : dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+PreferencesLog::~PreferencesLog() {
+    Close();
+    if (lock_fd_ >= 0) {
+        close(lock_fd_);
+    }
+}
+
+bool PreferencesLog::Map(int fd, size_t capacity) {
+    void *addr = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    Close();
+    fd_ = fd;
+    base_ = static_cast<uint8_t *>(addr);
+    capacity_ = capacity;
+    return true;
+}
+
+PreferencesLog::ScopedFileLock::ScopedFileLock(const PreferencesLog &log) : fd_(log.lock_fd_) {
+    if (fd_ < 0) {
+        return;
+    }
+    struct flock fileLock = {};
+    fileLock.l_type = F_WRLCK;
+    fileLock.l_whence = SEEK_SET;
+    while (fcntl(fd_, F_SETLKW, &fileLock) != 0 && errno == EINTR) {
+    }
+}
+
+PreferencesLog::ScopedFileLock::~ScopedFileLock() {
+    if (fd_ < 0) {
+        return;
+    }
+    struct flock fileLock = {};
+    fileLock.l_type = F_UNLCK;
+    fileLock.l_whence = SEEK_SET;
+    fcntl(fd_, F_SETLK, &fileLock);
+}
+
+bool PreferencesLog::OpenLockFile(const std::string &path) {
+    if (lock_fd_ >= 0) {
+        close(lock_fd_);
+    }
+    lock_fd_ = open((path + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0660);
+    return lock_fd_ >= 0;
+}
+
+bool PreferencesLog::Open(const std::string &path, std::unordered_map<std::string, std::string> *entries) {
+    Close();
+    path_ = path;
+    if (!OpenLockFile(path)) {
+        return false;
+    }
+    ScopedFileLock lock(*this);
+    return OpenLocked(entries);
+}
+
+bool PreferencesLog::OpenLocked(std::unordered_map<std::string, std::string> *entries) {
+    int fd = open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0660);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    bool fresh = size < kHeaderSize;
+    if (fresh) {
+        // 新文件，或创建时崩溃留下的不完整文件头
+        size = kInitialCapacity;
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            close(fd);
+            return false;
+        }
+    }
+    if (!Map(fd, size)) {
+        close(fd);
+        return false;
+    }
+    if (fresh) {
+        WriteHeader(base_);
+        used_ = kHeaderSize;
+        return true;
+    }
+    uint32_t version = 0;
+    memcpy(&version, base_ + sizeof(kMagic), sizeof(version));
+    if (memcmp(base_, kMagic, sizeof(kMagic)) != 0 || version != kVersion) {
+        Close();
+        return false;
+    }
+    bool torn = false;
+    used_ = Replay(kHeaderSize, entries, &torn);
+    if (torn) {
+        DropTornTail();
+    }
+    return true;
+}
+
+void PreferencesLog::DropTornTail() {
+    // 丢弃半条记录，避免之后追加的记录与残留字节拼接
+    memset(base_ + used_, 0, capacity_ - used_);
+    size_t sync_start = used_ / kPageSize * kPageSize;
+    msync(base_ + sync_start, capacity_ - sync_start, MS_SYNC);
+}
+
+bool PreferencesLog::Refresh(std::unordered_map<std::string, std::string> *entries) {
+    if (!IsOpen()) {
+        return false;
+    }
+    struct stat path_st;
+    struct stat fd_st;
+    if (stat(path_.c_str(), &path_st) != 0 || fstat(fd_, &fd_st) != 0) {
+        return false;
+    }
+    if (path_st.st_ino != fd_st.st_ino || path_st.st_dev != fd_st.st_dev) {
+        // 其他进程压缩后替换了文件，新文件包含全部有效数据
+        entries->clear();
+        OpenLocked(entries);
+        return true;
+    }
+    size_t size = static_cast<size_t>(fd_st.st_size);
+    if (size > capacity_) {
+        // 其他进程扩容了文件
+        void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (addr == MAP_FAILED) {
+            return false;
+        }
+        munmap(base_, capacity_);
+        base_ = static_cast<uint8_t *>(addr);
+        capacity_ = size;
+    }
+    bool torn = false;
+    size_t used = Replay(used_, entries, &torn);
+    bool changed = used != used_;
+    used_ = used;
+    if (torn) {
+        // 持锁期间没有其他写入者，残留的半条记录来自崩溃的进程
+        DropTornTail();
+    }
+    return changed;
+}
+
+size_t PreferencesLog::Replay(size_t pos, std::unordered_map<std::string, std::string> *entries, bool *torn) {
+    while (pos + kRecordHeaderSize <= capacity_) {
+        const uint8_t *record = base_ + pos;
+        uint32_t crc = 0;
+        uint32_t key_len = 0;
+        uint32_t value_len = 0;
+        memcpy(&crc, record, 4);
+        memcpy(&key_len, record + 4, 4);
+        memcpy(&value_len, record + 8, 4);
+        if (crc == 0 && key_len == 0 && value_len == 0) {
+            break;  // 有效数据结尾
+        }
+        if (key_len > kMaxFieldLength || value_len > kMaxFieldLength ||
+            pos + kRecordHeaderSize + key_len + value_len > capacity_ ||
+            Crc32(record + 4, 8 + key_len + value_len) != crc) {
+            *torn = true;
+            break;
+        }
+        const char *key = reinterpret_cast<const char *>(record + kRecordHeaderSize);
+        (*entries)[std::string(key, key_len)] = std::string(key + key_len, value_len);
+        pos += kRecordHeaderSize + key_len + value_len;
+    }
+    return pos;
+}
+
+bool PreferencesLog::Grow(size_t min_capacity) {
+    size_t capacity = RoundCapacity(min_capacity);
+    if (ftruncate(fd_, static_cast<off_t>(capacity)) != 0) {
+        return false;
+    }
+    void *addr = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+    munmap(base_, capacity_);
+    base_ = static_cast<uint8_t *>(addr);
+    capacity_ = capacity;
+    return true;
+}
+
+bool PreferencesLog::Append(const std::string &key, const std::string &value) {
+    if (!IsOpen() || key.size() > kMaxFieldLength || value.size() > kMaxFieldLength) {
+        return false;
+    }
+    size_t record_size = RecordSize(key, value);
+    if (!HasRoom(record_size) && !Grow(used_ + record_size)) {
+        return false;
+    }
+    WriteRecord(base_ + used_, key, value);
+    used_ += record_size;
+    return true;
+}
+
+bool PreferencesLog::Create(const std::string &path, const std::unordered_map<std::string, std::string> &entries) {
+    Close();
+    path_ = path;
+    if (!OpenLockFile(path)) {
+        return false;
+    }
+    ScopedFileLock lock(*this);
+    return Rewrite(entries);
+}
+
+bool PreferencesLog::Rewrite(const std::unordered_map<std::string, std::string> &entries) {
+    if (path_.empty()) {
+        return false;
+    }
+    size_t used = kHeaderSize;
+    for (const auto &pair : entries) {
+        used += RecordSize(pair.first, pair.second);
+    }
+    std::vector<uint8_t> buffer(used);
+    WriteHeader(buffer.data());
+    size_t pos = kHeaderSize;
+    for (const auto &pair : entries) {
+        WriteRecord(buffer.data() + pos, pair.first, pair.second);
+        pos += RecordSize(pair.first, pair.second);
+    }
+    // 预留与有效数据等量的追加空间
+    size_t capacity = RoundCapacity(used * 2);
+    std::string tmp_path = path_ + ".tmp";
+    int fd = open(tmp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0660);
+    if (fd < 0) {
+        return false;
+    }
+    if (!WriteFully(fd, buffer.data(), buffer.size()) || ftruncate(fd, static_cast<off_t>(capacity)) != 0 ||
+        fsync(fd) != 0 || rename(tmp_path.c_str(), path_.c_str()) != 0) {
+        close(fd);
+        unlink(tmp_path.c_str());
+        return false;
+    }
+    SyncParentDirectory(path_);
+    if (!Map(fd, capacity)) {
+        close(fd);
+        return false;
+    }
+    used_ = used;
+    return true;
+}
+
+int PreferencesLog::DupFd() const {
+    return fd_ < 0 ? -1 : fcntl(fd_, F_DUPFD_CLOEXEC, 0);
+}
+
+void PreferencesLog::Close() {
+    if (base_ != nullptr) {
+        munmap(base_, capacity_);
+        base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+    capacity_ = 0;
+    used_ = 0;
+}
+
+}  //  namespace util
+}  //  namespace kuikly
@@ -0,0 +1,117 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace kuikly {
+namespace util {
+
+/**
+ * 追加写的 key/value 日志文件，通过 mmap 读写
+ * 文件格式：16 字节文件头（magic + version）之后依次为记录
+ * 记录格式：crc32(4) | key_len(4) | value_len(4) | key | value，crc 覆盖 crc 之后的全部字节
+ * - 同一个 key 以最后一条记录为准，Rewrite 时只保留有效数据
+ * - crc 最后写入，进程或系统崩溃导致的半条记录在下次 Open 时被丢弃
+ * - 多进程通过 <path>.lock 上的 fcntl 写锁互斥，持锁后先 Refresh 读入其他进程的写入
+ * - 本类不加线程锁，由使用方保证线程安全
+ */
+class PreferencesLog {
+ public:
+    /**
+     * 持有跨进程文件锁（阻塞等待），Refresh/Append/Rewrite 需在持锁期间调用
+     */
+    class ScopedFileLock {
+     public:
+        explicit ScopedFileLock(const PreferencesLog &log);
+        ~ScopedFileLock();
+        ScopedFileLock(const ScopedFileLock &) = delete;
+        ScopedFileLock &operator=(const ScopedFileLock &) = delete;
+
+     private:
+        int fd_;
+    };
+
+    PreferencesLog() = default;
+    ~PreferencesLog();
+    PreferencesLog(const PreferencesLog &) = delete;
+    PreferencesLog &operator=(const PreferencesLog &) = delete;
+
+    /**
+     * 打开日志文件并回放到 entries，文件不存在时创建；内部持有文件锁
+     */
+    bool Open(const std::string &path, std::unordered_map<std::string, std::string> *entries);
+    /**
+     * 以 entries 为内容创建日志文件（先写临时文件再原子替换），用于首次迁移；内部持有文件锁
+     */
+    bool Create(const std::string &path, const std::unordered_map<std::string, std::string> &entries);
+    /**
+     * 读入其他进程在 used 之后追加的记录；文件被其他进程压缩替换时重新打开并整体回放
+     * @return 是否有新数据写入 entries
+     */
+    bool Refresh(std::unordered_map<std::string, std::string> *entries);
+    /**
+     * 追加一条记录，空间不足时扩容
+     */
+    bool Append(const std::string &key, const std::string &value);
+    /**
+     * 压缩：只写入 entries 生成新文件并 fsync 后原子替换当前文件
+     */
+    bool Rewrite(const std::unordered_map<std::string, std::string> &entries);
+    /**
+     * 返回复制的文件描述符，供锁外 fdatasync，调用方负责 close；未打开时返回 -1
+     */
+    int DupFd() const;
+    void Close();
+
+    bool IsOpen() const {
+        return base_ != nullptr;
+    }
+    bool HasRoom(size_t record_size) const {
+        return used_ + record_size <= capacity_;
+    }
+    size_t UsedBytes() const {
+        return used_;
+    }
+    size_t Capacity() const {
+        return capacity_;
+    }
+
+    static constexpr size_t kHeaderSize = 16;
+    static constexpr size_t kRecordHeaderSize = 12;
+    static size_t RecordSize(const std::string &key, const std::string &value) {
+        return kRecordHeaderSize + key.size() + value.size();
+    }
+
+ private:
+    bool OpenLockFile(const std::string &path);
+    bool OpenLocked(std::unordered_map<std::string, std::string> *entries);
+    bool Map(int fd, size_t capacity);
+    bool Grow(size_t min_capacity);
+    size_t Replay(size_t pos, std::unordered_map<std::string, std::string> *entries, bool *torn);
+    void DropTornTail();
+
+    std::string path_;
+    int lock_fd_ = -1;  // <path>.lock，不随日志文件替换
+    int fd_ = -1;
+    uint8_t *base_ = nullptr;
+    size_t capacity_ = 0;
+    size_t used_ = 0;
+};
+
+}  //  namespace util
+}  //  namespace kuikly
@@ -27,7 +27,7 @@ const char KRSharedPreferencesModule::SET_ITEM[] = "setItem";
 bool KRSharedPreferencesModule::SyncMode() {
     return true;
 }
-void KRSharedPreferencesModule::InitIfNeeded() {
+bool KRSharedPreferencesModule::InitIfNeeded() {
     if (this->preferences == nullptr) {
         std::string options = this->MODULE_NAME;
         if (auto root = GetRootView().lock()) {
@@ -37,6 +37,7 @@ void KRSharedPreferencesModule::InitIfNeeded() {
             }
         }
     }
+    return this->preferences != nullptr;
 }
 
 KRAnyValue KRSharedPreferencesModule::CallMethod(bool sync, const std::string &method, KRAnyValue params,
@@ -50,7 +51,9 @@ KRAnyValue KRSharedPreferencesModule::CallMethod(bool sync, const std::string &m
 }
 
 std::string KRSharedPreferencesModule::GetItem(const KRAnyValue &params) {
-    InitIfNeeded();
+    if (!InitIfNeeded()) {
+        return "";
+    }
     auto key = params->toString();
     auto value = this->preferences->GetSync(key, "");
     // KLOG_INFO(TAG) << "==== get item key = " << key << ' ' << value;
@@ -58,13 +61,17 @@ std::string KRSharedPreferencesModule::GetItem(const KRAnyValue &params) {
 }
 
 std::string KRSharedPreferencesModule::SetItem(const KRAnyValue &params) {
-    InitIfNeeded();
+    if (!InitIfNeeded()) {
+        return "preferences unavailable";
+    }
 
     auto jsonObj = util::JSONObject::Parse(params->toString());
     std::string key = jsonObj->GetString("key");
     std::string value = jsonObj->GetString("value");
     // KLOG_INFO(TAG) << "==== set item key = " << key << " value = " << value;
-    this->preferences->SetSync(key, value);
+    if (!this->preferences->SetSync(key, value)) {
+        return "preferences write failed";
+    }
     this->preferences->Flush();
     return "";
 }
@@ -37,7 +37,7 @@ class KRSharedPreferencesModule : public IKRRenderModuleExport {
     std::string GetItem(const KRAnyValue &params);
     std::string SetItem(const KRAnyValue &params);
     std::shared_ptr<util::DataPreferences> preferences;
-    void InitIfNeeded();
+    bool InitIfNeeded();
 };
 
 }  // namespace expand
@@ -17,6 +17,7 @@
 
 #include "libohos_render/api/include/Kuikly/Kuikly.h"
 #include "libohos_render/api/src/KRAnyDataInternal.h"
+#include "libohos_render/foundation/KRPropKeys.h"
 #include "libohos_render/manager/KRSnapshotManager.h"
 #include "libohos_render/manager/KRWeakObjectManager.h"
 
@@ -162,7 +163,7 @@ void IKRRenderViewExport::DestroyTouchInterrupter() {
     }
 }
 
-void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+void IKRRenderViewExport::ToSetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                                     const KRRenderCallback event_call_back) {
     if (node_ == nullptr) {
         return;
@@ -174,9 +175,9 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
 
     auto didHanded = false;
     if (base_props_handler_ != nullptr) {
-        auto isFrameProp = kuikly::util::isEqual(prop_key, "frame");
+        auto isFrameProp = prop_id == kPropKeyFrame;
         if (!(isFrameProp && CustomSetViewFrame())) {
-            didHanded = ToSetBaseProp(prop_key, prop_value, event_call_back);  // 基础属性设置分发处理
+            didHanded = ToSetBaseProp(prop_id, prop_key, prop_value, event_call_back);  // 基础属性设置分发处理
         }
         if (isFrameProp) {
             const std::string &s = prop_value->toString();
@@ -185,11 +186,18 @@ void IKRRenderViewExport::ToSetProp(const std::string &prop_key, const KRAnyValu
         }
     }
     if (!didHanded && base_event_handler_ != nullptr) {
-        didHanded = base_event_handler_->SetProp(shared_from_this(), prop_key, prop_value,
+        didHanded = base_event_handler_->SetProp(shared_from_this(), prop_id, prop_key, prop_value,
                                                  event_call_back);  // 基础事件分发处理
     }
     if (!didHanded) {
-        if (!SetProp(prop_key, prop_value, event_call_back)) {
+        auto last_prop_key = setting_prop_key_;
+        auto last_prop_id = setting_prop_id_;
+        setting_prop_key_ = &prop_key;
+        setting_prop_id_ = prop_id;
+        auto handled = SetProp(prop_key, prop_value, event_call_back);
+        setting_prop_key_ = last_prop_key;
+        setting_prop_id_ = last_prop_id;
+        if (!handled) {
             // prop not handled, pass it forward to extern handler
             if (gExternalPropHandlerOnSet) {
                 struct KRAnyDataInternal anyDataInternal;
@@ -206,7 +214,7 @@ bool IKRRenderViewExport::ResetProp(const std::string &prop_key) {
 }
 
 bool IKRRenderViewExport::CanReuse() {
-    if(g_kuikly_disable_view_reuse || !is_leaf_node_){
+    if (g_kuikly_disable_view_reuse) {
         return false;
     }
     if (base_props_handler_->isAnimationNode()) {  // 对齐iOS（避免执行中动画影响新的复用）
@@ -27,6 +27,7 @@
 #include "libohos_render/export/IKRRenderModuleExport.h"
 #include "libohos_render/export/IKRRenderShadowExport.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKeys.h"
 #include "libohos_render/foundation/KRRect.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/manager/KRArkTSManager.h"
@@ -217,9 +218,14 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     }
     /**
      * 最终判断能否复用Api
+     * 非叶子节点由 KRRenderLayerHandler 连同随后一起删除的子view作为子树回收，未被删除的子view会先从节点上摘下
      */
     bool CanReuse();
 
+    bool IsLeafNode() const {
+        return is_leaf_node_;
+    }
+
     /**
      * 注册View创建器
      * @param creator
@@ -290,46 +296,19 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         KREventDispatchCenter::GetInstance().RegisterGestureInterrupter(shared_from_this());
     }
 
-    virtual bool ToSetBaseProp(const std::string &prop_key, const KRAnyValue &prop_value,
+    virtual bool ToSetBaseProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                                const KRRenderCallback event_call_back = nullptr) {
         KREnsureMainThread();
 
-        return base_props_handler_->SetProp(prop_key, prop_value, event_call_back);
+        return base_props_handler_->SetProp(prop_id, prop_key, prop_value, event_call_back);
     }
 
-    virtual void ToSetProp(const std::string &prop_key, const KRAnyValue &prop_value,
+    /**
+     * 属性设置分发入口
+     * @param prop_id 属性 key 的 ID（KRPropKeys::IdOf），由桥接层计算一次后向下传递
+     */
+    virtual void ToSetProp(int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value,
                            const KRRenderCallback event_call_back = nullptr);
-#if 0  // implementation move to cpp file
-    {
-        if (node_ == nullptr) {
-            return;
-        }
-        // 把设置过的key收集下, 以便ResetProp
-        if (CanReuse()) {
-            CollectReuseKeyIfNeed(prop_key);
-        }
-
-        auto didHanded = false;
-        if (base_props_handler_ != nullptr) {
-            auto isFrameProp = kuikly::util::isEqual(prop_key, "frame");
-            if (!(isFrameProp && CustomSetViewFrame())) {
-                didHanded = ToSetBaseProp(prop_key, prop_value, event_call_back);  // 基础属性设置分发处理
-            }
-            if (isFrameProp) {
-                frame_ = *reinterpret_cast<KRRect *>(prop_value->toObjectAddress());
-                SetRenderViewFrame(frame_);
-            }
-        }
-        if (!didHanded && base_event_handler_ != nullptr) {
-            didHanded = base_event_handler_->SetProp(shared_from_this(), prop_key, prop_value,
-                                                     event_call_back);  // 基础事件分发处理
-        }
-        if (!didHanded) {
-            SetProp(prop_key, prop_value, event_call_back);
-        }
-        DidSetProp(prop_key);
-    }
-#endif
     void ToResetProp(const std::string &prop_key) {
         KREnsureMainThread();
 
@@ -387,6 +366,29 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         DidRemoveFromParentView();
     }
 
+    /**
+     * 随父view一起回收时调用：触发移除回调，但保留节点的挂载关系，以便整棵子树复用
+     */
+    void ToRecycleWithSuperView() {
+        KREnsureMainThread();
+
+        WillRemoveFromParentView();
+        parent_tag_ = -1;
+        DidRemoveFromParentView();
+    }
+
+    bool HasSuperView() const {
+        return parent_node_ != nullptr;
+    }
+
+    bool IsAttachedTo(const std::shared_ptr<IKRRenderViewExport> &parent_view) const {
+        return parent_node_ != nullptr && parent_node_ == parent_view->GetNode();
+    }
+
+    int GetParentTag() const {
+        return parent_tag_;
+    }
+
     virtual void InsertChildNode(ArkUI_NodeHandle parent, ArkUI_NodeHandle child, int index,
                                  const std::shared_ptr<IKRRenderViewExport> &sub_render_view) {
         kuikly::util::GetNodeApi()->insertChildAt(parent, child, index);
@@ -411,6 +413,18 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
         DidInsertSubRenderView(sub_render_view, index);
     }
 
+    /**
+     * 子树复用时子view的节点已挂载在本view下，只更新父子关系并触发插入回调
+     */
+    void ToReattachSubRenderView(const std::shared_ptr<IKRRenderViewExport> &sub_render_view, int index) {
+        KREnsureMainThread();
+
+        sub_render_view->WillMoveToParentView();
+        sub_render_view->parent_tag_ = this->GetViewTag();
+        sub_render_view->DidMoveToParentView();
+        DidInsertSubRenderView(sub_render_view, index);
+    }
+
     int32_t GetChildCount() {
         if (node_ == nullptr) {
             return 0;
@@ -503,6 +517,13 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     }
 
  protected:
+    /**
+     * SetProp 中获取属性 ID，ToSetProp 分发中的 key 直接复用桥接层算好的 ID，否则查表
+     */
+    int32_t PropIdOf(const std::string &prop_key) const {
+        return &prop_key == setting_prop_key_ ? setting_prop_id_ : KRPropKeys::IdOf(prop_key);
+    }
+
     virtual std::shared_ptr<KRBaseEventHandler>  CreateBaseEventHandler(std::shared_ptr<IKRRenderView> rootView){
         if(rootView){
             return std::make_shared<KRBaseEventHandler>(rootView->GetContext()->Config());
@@ -550,6 +571,9 @@ class IKRRenderViewExport : public std::enable_shared_from_this<IKRRenderViewExp
     float interrupt_y_ = -1;
     bool handling_capture_event_ = false;
     bool is_leaf_node_ = true;
+    // 正在 SetProp 分发的 key 及其 ID
+    const std::string *setting_prop_key_ = nullptr;
+    int32_t setting_prop_id_ = kPropKeyUnknown;
  public:
     ArkUI_NodeContentHandle parent_node_content_handle_ = nullptr;
 };
@@ -0,0 +1,263 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRDECODEPIPELINE_H
+#define CORE_RENDER_OHOS_KRDECODEPIPELINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "libohos_render/foundation/KRLRUCache.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+
+/**
+ * 后台解码管线
+ * - 解码在 KRGCDQueue 工作线程执行，可按目标尺寸降采样
+ * - 同一键（src + 量化后的目标尺寸 + 选项）的并发请求合并为一次解码
+ * - 请求可单独取消，某次解码的请求全部取消后，尚未开始的解码直接丢弃，进行中的解码可通过令牌提前结束
+ * - 解码结果按开销放入 LRU 缓存
+ * 解码器与派发方式可注入，不依赖 ArkUI，可直接在 host 上编译；需通过 std::make_shared 创建
+ */
+template <typename Image> class KRDecodePipeline : public std::enable_shared_from_this<KRDecodePipeline<Image>> {
+ public:
+    using ImagePtr = std::shared_ptr<Image>;
+
+    struct Request {
+        std::string src;
+        uint32_t width = 0;  // 目标像素尺寸，为 0 时按原尺寸解码
+        uint32_t height = 0;
+        int32_t options = 0;     // 解码器自定义选项，参与去重
+        bool cacheable = true;   // 结果是否放入缓存，已由调用方自行缓存时置为 false
+    };
+
+    struct Stats {
+        uint64_t request_count = 0;
+        uint64_t decode_count = 0;   // 实际发起的解码次数
+        uint64_t dedup_count = 0;    // 合并到进行中解码的请求数
+        uint64_t cancel_count = 0;   // 因请求全部取消而放弃的解码数
+        uint64_t failure_count = 0;
+        size_t in_flight_count = 0;
+        typename KRLRUCache<std::string, ImagePtr>::Stats cache;
+    };
+
+    // 在工作线程执行，失败时返回 nullptr；可在耗时步骤之间检查 token 提前结束
+    using Decoder = std::function<ImagePtr(const Request &request, const KRCancelToken &token)>;
+    using CostFunc = std::function<size_t(const Image &image)>;
+    // 解码失败时 image 为 nullptr
+    using Callback = std::function<void(const ImagePtr &image)>;
+    using Dispatcher = std::function<void(KRTask task, const KRCancelToken &token)>;
+
+    // 目标尺寸向上取整到该步长，尺寸相近的请求可共享解码结果
+    static constexpr uint32_t kSizeStep = 32;
+
+    KRDecodePipeline(Decoder decoder, CostFunc cost, size_t max_cache_cost, Dispatcher dispatcher = nullptr)
+        : decoder_(std::move(decoder)), cost_(std::move(cost)), cache_(max_cache_cost, 0),
+          dispatcher_(dispatcher ? std::move(dispatcher) : [](KRTask task, const KRCancelToken &token) {
+              KRGCDQueue::GetInstance().DispatchAsync(std::move(task), KRTaskPriority::kUserVisible, token);
+          }) {}
+
+    KRDecodePipeline(const KRDecodePipeline &) = delete;
+    KRDecodePipeline &operator=(const KRDecodePipeline &) = delete;
+
+    static uint32_t QuantizeSize(uint32_t size) {
+        return (size + kSizeStep - 1) / kSizeStep * kSizeStep;
+    }
+
+    /**
+     * 加载图片，可在任意线程调用
+     * @return 命中缓存时在当前线程同步回调并返回 0，否则返回请求 id，回调在工作线程执行
+     */
+    uint64_t Load(Request request, Callback callback) {
+        request.width = QuantizeSize(request.width);
+        request.height = QuantizeSize(request.height);
+        auto key = MakeKey(request);
+        ImagePtr cached;
+        std::shared_ptr<InFlight> flight;
+        uint64_t id = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stats_.request_count++;
+            if (auto value = cache_.Get(key)) {
+                cached = *value;
+            } else {
+                id = ++next_id_;
+                auto it = in_flight_.find(key);
+                if (it != in_flight_.end()) {
+                    stats_.dedup_count++;
+                    it->second->waiters.emplace_back(id, std::move(callback));
+                    it->second->cacheable |= request.cacheable;
+                    request_keys_[id] = key;
+                    return id;
+                }
+                flight = std::make_shared<InFlight>();
+                flight->waiters.emplace_back(id, std::move(callback));
+                flight->cacheable = request.cacheable;
+                in_flight_[key] = flight;
+                request_keys_[id] = key;
+                stats_.decode_count++;
+            }
+        }
+        if (cached) {
+            if (callback) {
+                callback(cached);
+            }
+            return 0;
+        }
+
+        std::weak_ptr<KRDecodePipeline> weak_self = this->shared_from_this();
+        auto token = flight->token;
+        dispatcher_(
+            [weak_self, request = std::move(request), key = std::move(key), flight = std::move(flight)] {
+                auto self = weak_self.lock();
+                if (!self) {
+                    return;
+                }
+                auto image = self->decoder_(request, flight->token);
+                self->Finish(key, flight, flight->token.IsCancelled() ? nullptr : image);
+            },
+            token);
+        return id;
+    }
+
+    /**
+     * 取消请求，不再回调；该解码的请求全部取消时放弃解码
+     * @return 请求仍在等待中时返回 true
+     */
+    bool Cancel(uint64_t id) {
+        if (id == 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto key_it = request_keys_.find(id);
+        if (key_it == request_keys_.end()) {
+            return false;
+        }
+        auto it = in_flight_.find(key_it->second);
+        request_keys_.erase(key_it);
+        if (it == in_flight_.end()) {
+            return false;
+        }
+        auto &waiters = it->second->waiters;
+        for (auto waiter = waiters.begin(); waiter != waiters.end(); ++waiter) {
+            if (waiter->first == id) {
+                waiters.erase(waiter);
+                break;
+            }
+        }
+        if (waiters.empty()) {
+            it->second->token.Cancel();
+            in_flight_.erase(it);
+            stats_.cancel_count++;
+        }
+        return true;
+    }
+
+    /**
+     * 只查缓存，不发起解码
+     */
+    ImagePtr GetCached(Request request) {
+        request.width = QuantizeSize(request.width);
+        request.height = QuantizeSize(request.height);
+        auto key = MakeKey(request);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto value = cache_.Get(key);
+        return value ? *value : nullptr;
+    }
+
+    /**
+     * 裁剪缓存到 max_cost 以内（max_cost 为 0 时不裁剪），不影响进行中的解码
+     */
+    void TrimCache(size_t max_cost) {
+        std::vector<ImagePtr> removed;
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.TrimTo(max_cost, 0, &removed);
+    }
+
+    /**
+     * 清空缓存，不影响进行中的解码
+     */
+    void ClearCache() {
+        std::vector<ImagePtr> removed;
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.TrimUnpinned(&removed);
+    }
+
+    Stats GetStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats = stats_;
+        stats.in_flight_count = in_flight_.size();
+        stats.cache = cache_.GetStats();
+        return stats;
+    }
+
+ private:
+    struct InFlight {
+        KRCancelToken token = KRCancelToken::Create();
+        std::vector<std::pair<uint64_t, Callback>> waiters;
+        bool cacheable = false;
+    };
+
+    static std::string MakeKey(const Request &request) {
+        return request.src + "#" + std::to_string(request.width) + "x" + std::to_string(request.height) + "#" +
+               std::to_string(request.options);
+    }
+
+    void Finish(const std::string &key, const std::shared_ptr<InFlight> &flight, const ImagePtr &image) {
+        std::vector<std::pair<uint64_t, Callback>> waiters;
+        // 被替换或淘汰的图片在锁外释放
+        std::vector<ImagePtr> removed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = in_flight_.find(key);
+            // 请求已全部取消，或同一键已发起了新的解码
+            if (it == in_flight_.end() || it->second != flight) {
+                return;
+            }
+            waiters.swap(flight->waiters);
+            in_flight_.erase(it);
+            for (const auto &waiter : waiters) {
+                request_keys_.erase(waiter.first);
+            }
+            if (!image) {
+                stats_.failure_count++;
+            } else if (flight->cacheable) {
+                cache_.Put(key, image, cost_(*image), &removed);
+            }
+        }
+        for (auto &waiter : waiters) {
+            if (waiter.second) {
+                waiter.second(image);
+            }
+        }
+    }
+
+    Decoder decoder_;
+    CostFunc cost_;
+    std::mutex mutex_;
+    KRLRUCache<std::string, ImagePtr> cache_;
+    std::unordered_map<std::string, std::shared_ptr<InFlight>> in_flight_;
+    std::unordered_map<uint64_t, std::string> request_keys_;
+    uint64_t next_id_ = 0;
+    Stats stats_;
+    Dispatcher dispatcher_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRDECODEPIPELINE_H
@@ -0,0 +1,239 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRLRUCACHE_H
+#define CORE_RENDER_OHOS_KRLRUCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * 按条目数与开销（如像素字节数）双预算淘汰的 LRU 缓存
+ * - 被 Pin 的条目不会被淘汰（但仍计入开销），Unpin 后按正常 LRU 参与淘汰
+ * - 本类不加锁，由使用方保证线程安全；不依赖 ArkUI，可直接在 host 上编译
+ * - 被移除的值可通过 removed 参数取出，便于使用方在锁外释放
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>> class KRLRUCache {
+ public:
+    struct Stats {
+        uint64_t hit_count = 0;
+        uint64_t miss_count = 0;
+        uint64_t eviction_count = 0;
+        size_t count = 0;
+        size_t cost = 0;
+        size_t pinned_count = 0;
+
+        double HitRate() const {
+            auto total = hit_count + miss_count;
+            return total == 0 ? 0 : static_cast<double>(hit_count) / total;
+        }
+    };
+
+    // max_cost/max_count 为 0 时表示对应维度不限制
+    KRLRUCache(size_t max_cost, size_t max_count) : max_cost_(max_cost), max_count_(max_count) {}
+
+    /**
+     * 查找并标记为最近使用，未命中返回 nullptr
+     * 注：返回的指针在下一次修改缓存前有效
+     */
+    Value *Get(const Key &key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            stats_.miss_count++;
+            return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, it->second);
+        stats_.hit_count++;
+        return &it->second->value;
+    }
+
+    /**
+     * 查找但不影响 LRU 顺序与命中统计
+     */
+    const Value *Peek(const Key &key) const {
+        auto it = index_.find(key);
+        return it == index_.end() ? nullptr : &it->second->value;
+    }
+
+    bool Contains(const Key &key) const {
+        return index_.find(key) != index_.end();
+    }
+
+    /**
+     * 写入或替换，替换时保留原有的 pin 计数；写入后超出预算则淘汰最久未使用的未 pin 条目
+     */
+    void Put(const Key &key, Value value, size_t cost, std::vector<Value> *removed = nullptr) {
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            auto &entry = *it->second;
+            stats_.cost = stats_.cost - entry.cost + cost;
+            entry.cost = cost;
+            std::swap(entry.value, value);
+            Collect(std::move(value), removed);
+            entries_.splice(entries_.begin(), entries_, it->second);
+        } else {
+            entries_.push_front(Entry{key, std::move(value), cost, 0});
+            index_[key] = entries_.begin();
+            stats_.cost += cost;
+        }
+        TrimTo(max_cost_, max_count_, removed);
+    }
+
+    bool Remove(const Key &key, std::vector<Value> *removed = nullptr) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return false;
+        }
+        Erase(it->second, removed);
+        return true;
+    }
+
+    /**
+     * 增加 pin 计数，key 不存在时返回 false
+     */
+    bool Pin(const Key &key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return false;
+        }
+        if (it->second->pin_count++ == 0) {
+            stats_.pinned_count++;
+        }
+        return true;
+    }
+
+    void Unpin(const Key &key, std::vector<Value> *removed = nullptr) {
+        auto it = index_.find(key);
+        if (it == index_.end() || it->second->pin_count == 0) {
+            return;
+        }
+        if (--it->second->pin_count == 0) {
+            stats_.pinned_count--;
+            // pin 期间可能已超出预算
+            TrimTo(max_cost_, max_count_, removed);
+        }
+    }
+
+    /**
+     * 从最久未使用端淘汰未 pin 的条目，直到开销与条目数均不超过给定值（0 表示该维度不限制）
+     */
+    void TrimTo(size_t max_cost, size_t max_count, std::vector<Value> *removed = nullptr) {
+        auto it = entries_.end();
+        while (it != entries_.begin() && OverBudget(max_cost, max_count)) {
+            --it;
+            if (it->pin_count > 0) {
+                continue;
+            }
+            it = Erase(it, removed);
+            stats_.eviction_count++;
+        }
+    }
+
+    /**
+     * 淘汰所有未 pin 的条目
+     */
+    void TrimUnpinned(std::vector<Value> *removed = nullptr) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (it->pin_count > 0) {
+                ++it;
+                continue;
+            }
+            it = Erase(it, removed);
+            stats_.eviction_count++;
+        }
+    }
+
+    /**
+     * 移除全部条目（包括被 pin 的）
+     */
+    void Clear(std::vector<Value> *removed = nullptr) {
+        if (removed) {
+            for (auto &entry : entries_) {
+                removed->push_back(std::move(entry.value));
+            }
+        }
+        entries_.clear();
+        index_.clear();
+        stats_.cost = 0;
+        stats_.pinned_count = 0;
+    }
+
+    void SetLimits(size_t max_cost, size_t max_count, std::vector<Value> *removed = nullptr) {
+        max_cost_ = max_cost;
+        max_count_ = max_count;
+        TrimTo(max_cost_, max_count_, removed);
+    }
+
+    size_t MaxCost() const {
+        return max_cost_;
+    }
+    size_t MaxCount() const {
+        return max_count_;
+    }
+    size_t Count() const {
+        return entries_.size();
+    }
+    size_t Cost() const {
+        return stats_.cost;
+    }
+
+    Stats GetStats() const {
+        Stats stats = stats_;
+        stats.count = entries_.size();
+        return stats;
+    }
+
+ private:
+    struct Entry {
+        Key key;
+        Value value;
+        size_t cost;
+        uint32_t pin_count;
+    };
+    using EntryList = std::list<Entry>;
+
+    bool OverBudget(size_t max_cost, size_t max_count) const {
+        return (max_cost > 0 && stats_.cost > max_cost) || (max_count > 0 && entries_.size() > max_count);
+    }
+
+    typename EntryList::iterator Erase(typename EntryList::iterator it, std::vector<Value> *removed) {
+        stats_.cost -= it->cost;
+        if (it->pin_count > 0) {
+            stats_.pinned_count--;
+        }
+        index_.erase(it->key);
+        Collect(std::move(it->value), removed);
+        return entries_.erase(it);
+    }
+
+    static void Collect(Value &&value, std::vector<Value> *removed) {
+        if (removed) {
+            removed->push_back(std::move(value));
+        }
+    }
+
+    size_t max_cost_;
+    size_t max_count_;
+    EntryList entries_;  // 头部为最近使用
+    std::unordered_map<Key, typename EntryList::iterator, Hash> index_;
+    Stats stats_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRLRUCACHE_H
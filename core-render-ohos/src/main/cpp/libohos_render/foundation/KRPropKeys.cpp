@@ -0,0 +1,53 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/KRPropKeys.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+static std::shared_mutex &CustomKeysMutex() {
+    static std::shared_mutex mutex;
+    return mutex;
+}
+
+static std::unordered_map<std::string, int32_t> &CustomKeys() {
+    static std::unordered_map<std::string, int32_t> keys;
+    return keys;
+}
+
+int32_t KRPropKeys::Register(const std::string &key) {
+    int32_t id = BuiltinIdOf(key.data(), key.size());
+    if (id != kPropKeyUnknown) {
+        return id;
+    }
+    std::unique_lock<std::shared_mutex> lock(CustomKeysMutex());
+    auto &keys = CustomKeys();
+    auto it = keys.find(key);
+    if (it != keys.end()) {
+        return it->second;
+    }
+    id = kPropKeyBuiltinCount + static_cast<int32_t>(keys.size());
+    keys.emplace(key, id);
+    return id;
+}
+
+int32_t KRPropKeys::CustomIdOf(const std::string &key) {
+    std::shared_lock<std::shared_mutex> lock(CustomKeysMutex());
+    auto &keys = CustomKeys();
+    auto it = keys.find(key);
+    return it != keys.end() ? it->second : kPropKeyUnknown;
+}
@@ -0,0 +1,165 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPROPKEYS_H
+#define CORE_RENDER_OHOS_KRPROPKEYS_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * 属性 key 的整数 ID，0 表示未知属性
+ * 内置属性 ID 固定，自定义 View 通过 KRPropKeys::Register 注册的 ID 从 kPropKeyBuiltinCount 开始
+ */
+enum KRPropKeyId : int32_t {
+    kPropKeyUnknown = 0,
+    // 基础属性
+    kPropKeyBackgroundColor,
+    kPropKeyFrame,
+    kPropKeyBorderRadius,
+    kPropKeyBorder,
+    kPropKeyBackgroundImage,
+    kPropKeyTransform,
+    kPropKeyOpacity,
+    kPropKeyVisibility,
+    kPropKeyOverflow,
+    kPropKeyZIndex,
+    kPropKeyTouchEnable,
+    kPropKeyAccessibility,
+    kPropKeyBoxShadow,
+    kPropKeyAnimation,
+    kPropKeyAnimationCompletion,
+    kPropKeyClipPath,
+    // 基础事件
+    kPropKeyClick,
+    kPropKeyDoubleClick,
+    kPropKeyLongPress,
+    kPropKeyPan,
+    kPropKeyPinch,
+    kPropKeyCapture,
+    kPropKeyBuiltinCount
+};
+
+namespace kr_prop_keys_detail {
+
+constexpr size_t kTableSize = 64;
+
+constexpr std::string_view kBuiltinKeys[kPropKeyBuiltinCount] = {
+    "",
+    "backgroundColor",
+    "frame",
+    "borderRadius",
+    "border",
+    "backgroundImage",
+    "transform",
+    "opacity",
+    "visibility",
+    "overflow",
+    "zIndex",
+    "touchEnable",
+    "accessibility",
+    "boxShadow",
+    "animation",
+    "animationCompletion",
+    "clipPath",
+    "click",
+    "doubleClick",
+    "longPress",
+    "pan",
+    "pinch",
+    "capture",
+};
+
+// 只取长度和首、中、尾三个字符，seed 在编译期搜索到无冲突为止
+constexpr uint32_t Hash(const char *key, size_t length, uint32_t seed) {
+    uint32_t h = seed ^ static_cast<uint32_t>(length);
+    if (length > 0) {
+        h = (h ^ static_cast<uint8_t>(key[0])) * 0x01000193u;
+        h = (h ^ static_cast<uint8_t>(key[length / 2])) * 0x01000193u;
+        h = (h ^ static_cast<uint8_t>(key[length - 1])) * 0x01000193u;
+    }
+    return h ^ (h >> 16);
+}
+
+constexpr bool IsPerfect(uint32_t seed) {
+    bool used[kTableSize] = {};
+    for (int32_t id = 1; id < kPropKeyBuiltinCount; id++) {
+        auto slot = Hash(kBuiltinKeys[id].data(), kBuiltinKeys[id].size(), seed) & (kTableSize - 1);
+        if (used[slot]) {
+            return false;
+        }
+        used[slot] = true;
+    }
+    return true;
+}
+
+constexpr uint32_t FindSeed() {
+    for (uint32_t seed = 1; seed < 100000; seed++) {
+        if (IsPerfect(seed)) {
+            return seed;
+        }
+    }
+    return 0;
+}
+
+constexpr uint32_t kSeed = FindSeed();
+static_assert(kSeed != 0, "no perfect hash seed for builtin prop keys");
+
+constexpr std::array<int8_t, kTableSize> BuildTable() {
+    std::array<int8_t, kTableSize> table = {};
+    for (int32_t id = 1; id < kPropKeyBuiltinCount; id++) {
+        table[Hash(kBuiltinKeys[id].data(), kBuiltinKeys[id].size(), kSeed) & (kTableSize - 1)] =
+            static_cast<int8_t>(id);
+    }
+    return table;
+}
+
+constexpr std::array<int8_t, kTableSize> kTable = BuildTable();
+
+}  // namespace kr_prop_keys_detail
+
+/**
+ * 属性 key 到整数 ID 的映射
+ * - 内置 key 使用编译期生成的完美哈希表，查找为一次哈希加一次比较
+ * - 其余 key 查自定义注册表
+ */
+class KRPropKeys {
+ public:
+    static int32_t IdOf(const std::string &key) {
+        int32_t id = BuiltinIdOf(key.data(), key.size());
+        return id != kPropKeyUnknown ? id : CustomIdOf(key);
+    }
+
+    /**
+     * 注册自定义属性 key，已注册（包括内置 key）时返回原 ID，线程安全
+     */
+    static int32_t Register(const std::string &key);
+
+    static constexpr int32_t BuiltinIdOf(const char *key, size_t length) {
+        using namespace kr_prop_keys_detail;
+        int32_t id = kTable[Hash(key, length, kSeed) & (kTableSize - 1)];
+        if (id == kPropKeyUnknown || kBuiltinKeys[id] != std::string_view(key, length)) {
+            return kPropKeyUnknown;
+        }
+        return id;
+    }
+
+ private:
+    static int32_t CustomIdOf(const std::string &key);
+};
+
+#endif  // CORE_RENDER_OHOS_KRPROPKEYS_H
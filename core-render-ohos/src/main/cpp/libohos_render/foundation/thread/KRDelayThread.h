@@ -20,22 +20,17 @@
 #include <condition_variable>
 #include <functional>
 #include <mutex>
-#include <queue>
+#include <string>
 #include <thread>
+#include <vector>
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
 
-struct Task {
-    std::chrono::steady_clock::time_point execTime;
-    std::function<void()> func;
-
-    bool operator<(const Task &other) const {
-        // 注意：我们需要反转比较运算符，因为 std::priority_queue 是最大堆
-        return execTime > other.execTime;
-    }
-};
-
+/**
+ * 延时任务线程，延时任务存放在分层时间轮中，插入、取消 O(1)，同一毫秒到期的任务批量执行
+ */
 class KRDelayThread {
  public:
-    explicit KRDelayThread(const std::string &name) : m_stop(false) {
+    explicit KRDelayThread(const std::string &name) : m_origin(std::chrono::steady_clock::now()) {
         m_dispatcherThread = std::thread([this] { this->Dispatcher(); });
         pthread_setname_np(m_dispatcherThread.native_handle(), name.c_str());
     }
@@ -49,40 +44,74 @@ class KRDelayThread {
         m_dispatcherThread.join();
     }
 
-    void DispatchAsync(const std::function<void()> &task, int delayMilliseconds = 0) {
+    /**
+     * @return 定时器句柄，可用于 Cancel；无延时的任务不可取消，返回 0
+     */
+    KRTimerId DispatchAsync(const std::function<void()> &task, int delayMilliseconds = 0) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (delayMilliseconds <= 0) {
+            m_immediate.emplace_back(task);
+            m_condition.notify_one();
+            return 0;
+        }
+        auto expire = NowMs() + delayMilliseconds;
+        auto id = m_wheel.Schedule(expire, task);
+        // 仅当新任务早于当前等待的唤醒时间时才唤醒线程
+        if (m_wakeup < 0 || expire < m_wakeup) {
+            m_condition.notify_one();
+        }
+        return id;
+    }
+
+    /**
+     * 取消尚未执行的延时任务
+     */
+    bool Cancel(KRTimerId id) {
         std::unique_lock<std::mutex> lock(m_mutex);
-        m_tasks.emplace(Task{std::chrono::steady_clock::now() + std::chrono::milliseconds(delayMilliseconds), task});
-        m_condition.notify_one();
+        return m_wheel.Cancel(id);
     }
 
  private:
+    int64_t NowMs() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_origin)
+            .count();
+    }
+
     void Dispatcher() {
+        std::vector<KRTask> batch;
         while (true) {
-            Task task;
             {
                 std::unique_lock<std::mutex> lock(m_mutex);
-                while (!m_stop && (m_tasks.empty() || std::chrono::steady_clock::now() < m_tasks.top().execTime)) {
-                    if (m_tasks.empty()) {
+                while (true) {
+                    if (m_stop) {
+                        return;
+                    }
+                    batch.swap(m_immediate);
+                    m_wheel.Advance(NowMs(), batch);
+                    if (!batch.empty()) {
+                        break;
+                    }
+                    m_wakeup = m_wheel.NextWakeup();
+                    if (m_wakeup < 0) {
                         m_condition.wait(lock);
                     } else {
-                        auto time = m_tasks.top().execTime;
-                        m_condition.wait_until(lock, time);
+                        m_condition.wait_until(lock, m_origin + std::chrono::milliseconds(m_wakeup));
                     }
+                    m_wakeup = -1;
                 }
-
-                if (m_stop) {
-                    break;
-                }
-
-                task = std::move(const_cast<Task &>(m_tasks.top()));
-                m_tasks.pop();
             }
 
-            task.func();
+            for (auto &task : batch) {
+                task();
+            }
+            batch.clear();
         }
     }
 
-    std::priority_queue<Task> m_tasks;
+    std::chrono::steady_clock::time_point m_origin;
+    KRTimerWheel m_wheel;
+    std::vector<KRTask> m_immediate;
+    int64_t m_wakeup = -1;  // 线程等待中的唤醒时间，-1 表示未在定时等待
     std::mutex m_mutex;
     std::condition_variable m_condition;
     bool m_stop = false;
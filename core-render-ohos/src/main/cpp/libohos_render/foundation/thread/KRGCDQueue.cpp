@@ -14,3 +14,156 @@
  */
 
 #include "KRGCDQueue.h"
+
+#include <pthread.h>
+#include <algorithm>
+#include <string>
+
+static thread_local KRGCDQueue *tls_queue = nullptr;
+static thread_local size_t tls_worker_index = 0;
+
+static size_t DefaultThreadCount() {
+    size_t cores = std::thread::hardware_concurrency();
+    if (cores == 0) {
+        return 4;
+    }
+    // 留一个核给主线程，线程数限制在 [2, 8]
+    return std::min<size_t>(std::max<size_t>(cores - 1, 2), 8);
+}
+
+KRGCDQueue &KRGCDQueue::GetInstance() {
+    // 常驻不析构，避免进程退出时析构仍在运行的工作线程
+    static KRGCDQueue *instance = new KRGCDQueue(DefaultThreadCount());
+    return *instance;
+}
+
+KRGCDQueue::KRGCDQueue(size_t num_threads) {
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(std::make_unique<Worker>());
+    }
+    for (size_t i = 0; i < num_threads; ++i) {
+        std::thread thread([this, i] { WorkerLoop(i); });
+        pthread_setname_np(thread.native_handle(), ("kuikly_gcd_" + std::to_string(i)).c_str());
+        thread.detach();
+    }
+}
+
+void KRGCDQueue::DispatchAsync(KRTask task, KRTaskPriority priority, const KRCancelToken &token) {
+    if (!task) {
+        return;
+    }
+    Submit(Job{std::move(task), token, nullptr}, priority);
+}
+
+void KRGCDQueue::Submit(Job job, KRTaskPriority priority) {
+    // 工作线程内派发的任务放入自己的队列，其余轮流分配
+    size_t index = tls_queue == this ? tls_worker_index
+                                     : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    // 先计数再入队，工作线程看到计数但暂时取不到任务时会重试而不是挂起
+    pending_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(workers_[index]->mutex);
+        workers_[index]->lanes[static_cast<int>(priority)].push_back(std::move(job));
+    }
+    if (idle_count_.load() > 0) {
+        std::lock_guard<std::mutex> lock(park_mutex_);
+        park_cond_.notify_one();
+    }
+}
+
+bool KRGCDQueue::TryTake(Job &job) {
+    size_t count = workers_.size();
+    size_t start = tls_queue == this ? tls_worker_index : 0;
+    for (int lane = 0; lane < 2; ++lane) {
+        // 先取自己的队列，再按顺序窃取其他线程的队列
+        for (size_t i = 0; i < count; ++i) {
+            if (TryTakeFrom((start + i) % count, lane, job)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool KRGCDQueue::TryTakeFrom(size_t index, int lane, Job &job) {
+    Worker &worker = *workers_[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    auto &deque = worker.lanes[lane];
+    if (deque.empty()) {
+        return false;
+    }
+    job = std::move(deque.front());
+    deque.pop_front();
+    pending_.fetch_sub(1);
+    return true;
+}
+
+bool KRGCDQueue::RunOne() {
+    Job job;
+    if (!TryTake(job)) {
+        return false;
+    }
+    Run(job);
+    return true;
+}
+
+void KRGCDQueue::WorkerLoop(size_t index) {
+    tls_queue = this;
+    tls_worker_index = index;
+    while (true) {
+        if (RunOne()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(park_mutex_);
+        idle_count_.fetch_add(1);
+        // 与 Submit 中先计数、后检查空闲线程数配合，避免丢失唤醒
+        if (pending_.load() == 0) {
+            park_cond_.wait(lock);
+        }
+        idle_count_.fetch_sub(1);
+    }
+}
+
+void KRGCDQueue::Run(Job &job) {
+    if (!job.token.IsCancelled()) {
+        job.task();
+    }
+    job.task.Reset();
+    if (job.group) {
+        std::lock_guard<std::mutex> lock(job.group->mutex);
+        if (--job.group->pending == 0) {
+            job.group->cond.notify_all();
+        }
+    }
+    job.group = nullptr;
+}
+
+void KRTaskGroup::DispatchAsync(KRTask task, KRTaskPriority priority) {
+    if (!task) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->pending++;
+    }
+    KRGCDQueue::GetInstance().Submit(KRGCDQueue::Job{std::move(task), state_->token, state_}, priority);
+}
+
+void KRTaskGroup::Wait() {
+    auto &queue = KRGCDQueue::GetInstance();
+    if (tls_queue == &queue) {
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(state_->mutex);
+                if (state_->pending == 0) {
+                    return;
+                }
+            }
+            if (!queue.RunOne()) {
+                break;
+            }
+        }
+    }
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->cond.wait(lock, [this] { return state_->pending == 0; });
+}
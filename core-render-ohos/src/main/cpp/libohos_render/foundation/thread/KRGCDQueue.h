@@ -18,65 +18,146 @@
 
 #include <atomic>
 #include <condition_variable>
-#include <functional>
-#include <iostream>
+#include <cstddef>
+#include <deque>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
+#include "libohos_render/foundation/thread/KRTask.h"
 
+/**
+ * 后台任务优先级
+ */
+enum class KRTaskPriority {
+    kUserVisible = 0,  // 影响当前画面的任务，如图片、APNG 解析解码
+    kPrefetch = 1,     // 预取、子线程释放、采样等，只在没有 kUserVisible 任务时执行
+};
+
+/**
+ * 取消令牌，默认构造的令牌不可取消
+ * 任务开始执行前检查，已取消的任务直接丢弃；执行中的任务需自行检查 IsCancelled
+ */
+class KRCancelToken {
+ public:
+    KRCancelToken() = default;
+
+    static KRCancelToken Create() {
+        KRCancelToken token;
+        token.cancelled_ = std::make_shared<std::atomic<bool>>(false);
+        return token;
+    }
+
+    void Cancel() const {
+        if (cancelled_) {
+            cancelled_->store(true, std::memory_order_release);
+        }
+    }
+
+    bool IsCancelled() const {
+        return cancelled_ && cancelled_->load(std::memory_order_acquire);
+    }
+
+ private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+class KRTaskGroup;
+
+/**
+ * 后台工作线程池
+ * - 线程数按 CPU 核数确定，每个工作线程有自己的任务队列，空闲时从其他线程的队列窃取
+ * - 工作线程内派发的任务放入自己的队列，其他线程派发的任务轮流分配
+ * - 每个队列分 kUserVisible / kPrefetch 两条通道，所有线程的 kUserVisible 任务优先执行
+ */
 class KRGCDQueue {
  public:
-    // 删除拷贝构造函数和赋值操作符
     KRGCDQueue(const KRGCDQueue &) = delete;
     KRGCDQueue &operator=(const KRGCDQueue &) = delete;
 
-    // 提供一个静态方法来获取类的唯一实例
-    static KRGCDQueue &GetInstance() {
-        static KRGCDQueue instance(4);  // 最大4条线程并行
-        return instance;
-    }
-
-    ~KRGCDQueue() {}
+    static KRGCDQueue &GetInstance();
 
     /**
      * 切换到多线程环境执行任务
      * @param task 任务
+     * @param priority 优先级
+     * @param token 取消令牌
      */
-    void DispatchAsync(std::function<void()> task) {
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            tasks.emplace(task);
-        }
-        condition.notify_one();
+    void DispatchAsync(KRTask task, KRTaskPriority priority = KRTaskPriority::kUserVisible,
+                       const KRCancelToken &token = KRCancelToken());
+
+    size_t GetWorkerCount() const {
+        return workers_.size();
     }
 
  private:
-    // 将构造函数设为私有
-    explicit KRGCDQueue(size_t num_threads) {
-        for (size_t i = 0; i < num_threads; ++i) {
-            threads.emplace_back([this] {
-                while (true) {
-                    std::function<void()> task;
-                    {
-                        std::unique_lock<std::mutex> lock(queue_mutex);
-                        condition.wait(lock, [this] { return !tasks.empty(); });
-                        if (tasks.empty()) {
-                            return;
-                        }
-                        task = std::move(tasks.front());
-                        tasks.pop();
-                    }
-                    task();
-                }
-            });
-        }
+    friend class KRTaskGroup;
+
+    struct GroupState {
+        std::mutex mutex;
+        std::condition_variable cond;
+        size_t pending = 0;
+        KRCancelToken token = KRCancelToken::Create();
+    };
+
+    struct Job {
+        KRTask task;
+        KRCancelToken token;
+        std::shared_ptr<GroupState> group;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Job> lanes[2];
+    };
+
+    explicit KRGCDQueue(size_t num_threads);
+
+    void Submit(Job job, KRTaskPriority priority);
+    bool TryTake(Job &job);
+    bool TryTakeFrom(size_t index, int lane, Job &job);
+    /**
+     * 在当前线程执行一个排队中的任务，没有任务时返回 false
+     */
+    bool RunOne();
+    void WorkerLoop(size_t index);
+    static void Run(Job &job);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<size_t> pending_{0};
+    std::atomic<size_t> next_worker_{0};
+    std::mutex park_mutex_;
+    std::condition_variable park_cond_;
+    std::atomic<size_t> idle_count_{0};
+};
+
+/**
+ * 任务组，可等待组内所有任务完成，也可整体取消尚未开始的任务
+ */
+class KRTaskGroup {
+ public:
+    KRTaskGroup() : state_(std::make_shared<KRGCDQueue::GroupState>()) {}
+    KRTaskGroup(const KRTaskGroup &) = delete;
+    KRTaskGroup &operator=(const KRTaskGroup &) = delete;
+
+    void DispatchAsync(KRTask task, KRTaskPriority priority = KRTaskPriority::kUserVisible);
+
+    /**
+     * 阻塞等待组内已派发的任务全部完成或被取消
+     * 在工作线程中调用时会先帮忙执行排队中的任务，避免线程池被占满导致死锁
+     */
+    void Wait();
+
+    void Cancel() {
+        state_->token.Cancel();
     }
 
-    std::vector<std::thread> threads;
-    std::queue<std::function<void()>> tasks;
-    std::mutex queue_mutex;
-    std::condition_variable condition;
+    bool IsCancelled() const {
+        return state_->token.IsCancelled();
+    }
+
+ private:
+    std::shared_ptr<KRGCDQueue::GroupState> state_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRGCDQUEUE_H
@@ -21,9 +21,13 @@
 
 napi_threadsafe_function g_threadsafe_func_handle = NULL;
 // 延时Api
-static void DispatchAsync(std::function<void()> task, int delayMilliseconds = 0) {
+static KRDelayThread *GetDelayThread() {
     static KRDelayThread *gDelayThread = new KRDelayThread("kuiklyasync");
-    gDelayThread->DispatchAsync(task, delayMilliseconds);
+    return gDelayThread;
+}
+
+static KRTimerId DispatchAsync(std::function<void()> task, int delayMilliseconds = 0) {
+    return GetDelayThread()->DispatchAsync(task, delayMilliseconds);
 }
 class MainThreadTask {
  public:
@@ -65,9 +69,9 @@ void KRMainThread::Export(napi_env env, napi_value exports) {
     }
 }
 
-void KRMainThread::RunOnMainThread(const std::function<void()> &task, int delayMilliseconds) {
+KRTimerId KRMainThread::RunOnMainThread(const std::function<void()> &task, int delayMilliseconds) {
     if (delayMilliseconds > 0) {
-        DispatchAsync([task] { RunOnMainThread(task); }, delayMilliseconds);
+        return DispatchAsync([task] { RunOnMainThread(task); }, delayMilliseconds);
     } else {
         if (g_threadsafe_func_handle) {
             MainThreadTask *mainTask = new MainThreadTask(task);
@@ -76,6 +80,11 @@ void KRMainThread::RunOnMainThread(const std::function<void()> &task, int delayM
             OH_LOG_Print(LOG_APP, LOG_ERROR, 0x7, "KRMainThread", "function handle is null");
         }
     }
+    return 0;
+}
+
+bool KRMainThread::CancelDelayed(KRTimerId id) {
+    return GetDelayThread()->Cancel(id);
 }
 
 static std::vector<std::function<void()>> &NextRunLoopTasks(bool isClear, const std::function<void()> &task) {
@@ -18,6 +18,7 @@
 
 #include <napi/native_api.h>
 #include <functional>
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
 
 class KRMainThread {
  public:
@@ -32,8 +33,14 @@ class KRMainThread {
      * @brief 在主线程上执行任务，可以选择延迟执行
      * @param task 需要在主线程上执行的任务
      * @param delayMilliseconds 延迟执行任务的毫秒数，默认为0，表示立即执行
+     * @return 延时任务的句柄，可用于 CancelDelayed；无延时的任务返回 0
      */
-    static void RunOnMainThread(const std::function<void()> &task, int delayMilliseconds = 0);
+    static KRTimerId RunOnMainThread(const std::function<void()> &task, int delayMilliseconds = 0);
+
+    /**
+     * @brief 取消尚未到期的延时任务
+     */
+    static bool CancelDelayed(KRTimerId id);
 
     /**
      * @brief 在主线程的下一个事件循环中执行任务
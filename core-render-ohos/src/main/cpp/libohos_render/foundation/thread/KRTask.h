@@ -0,0 +1,145 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTASK_H
+#define CORE_RENDER_OHOS_KRTASK_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * 只可移动的任务对象，小闭包（包括 std::function）直接存放在对象内部，避免堆分配
+ */
+class KRTask {
+ public:
+    static constexpr size_t kInlineSize = 48;
+
+    KRTask() = default;
+    KRTask(std::nullptr_t) {}  // NOLINT
+
+    template <typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, KRTask>::value>>
+    KRTask(F &&f) {  // NOLINT
+        using Fn = std::decay_t<F>;
+        if (IsNull(f)) {
+            return;
+        }
+        if constexpr (kFitsInline<Fn>) {
+            new (m_storage) Fn(std::forward<F>(f));
+            m_ops = &InlineOps<Fn>::kOps;
+        } else {
+            *reinterpret_cast<Fn **>(m_storage) = new Fn(std::forward<F>(f));
+            m_ops = &HeapOps<Fn>::kOps;
+        }
+    }
+
+    KRTask(KRTask &&other) noexcept {
+        MoveFrom(other);
+    }
+
+    KRTask &operator=(KRTask &&other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    KRTask(const KRTask &) = delete;
+    KRTask &operator=(const KRTask &) = delete;
+
+    ~KRTask() {
+        Reset();
+    }
+
+    void operator()() {
+        m_ops->invoke(m_storage);
+    }
+
+    explicit operator bool() const {
+        return m_ops != nullptr;
+    }
+
+    void Reset() {
+        if (m_ops) {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+ private:
+    struct Ops {
+        void (*invoke)(void *storage);
+        void (*move)(void *dst, void *src);  // 移动后销毁 src
+        void (*destroy)(void *storage);
+    };
+
+    template <typename Fn>
+    static constexpr bool kFitsInline = sizeof(Fn) <= kInlineSize && alignof(Fn) <= alignof(std::max_align_t) &&
+                                        std::is_nothrow_move_constructible<Fn>::value;
+
+    template <typename Fn> struct InlineOps {
+        static void Invoke(void *storage) {
+            (*static_cast<Fn *>(storage))();
+        }
+        static void Move(void *dst, void *src) {
+            new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+            static_cast<Fn *>(src)->~Fn();
+        }
+        static void Destroy(void *storage) {
+            static_cast<Fn *>(storage)->~Fn();
+        }
+        static constexpr Ops kOps = {Invoke, Move, Destroy};
+    };
+
+    template <typename Fn> struct HeapOps {
+        static void Invoke(void *storage) {
+            (**static_cast<Fn **>(storage))();
+        }
+        static void Move(void *dst, void *src) {
+            *static_cast<Fn **>(dst) = *static_cast<Fn **>(src);
+        }
+        static void Destroy(void *storage) {
+            delete *static_cast<Fn **>(storage);
+        }
+        static constexpr Ops kOps = {Invoke, Move, Destroy};
+    };
+
+    template <typename F> static bool IsNull(const F &f) {
+        if constexpr (std::is_pointer<F>::value || std::is_member_pointer<F>::value) {
+            return f == nullptr;
+        } else if constexpr (std::is_constructible<bool, const F &>::value) {
+            // std::function 等可判空的可调用对象
+            return !static_cast<bool>(f);
+        } else {
+            return false;
+        }
+    }
+
+    void MoveFrom(KRTask &other) {
+        if (other.m_ops) {
+            other.m_ops->move(m_storage, other.m_storage);
+            m_ops = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_storage[kInlineSize];
+    const Ops *m_ops = nullptr;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTASK_H
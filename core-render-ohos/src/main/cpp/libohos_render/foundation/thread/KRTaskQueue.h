@@ -0,0 +1,206 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTASKQUEUE_H
+#define CORE_RENDER_OHOS_KRTASKQUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include "libohos_render/foundation/thread/KRTask.h"
+
+/**
+ * 多生产者单消费者任务队列
+ * - 主体为定长无锁环形缓冲区，入队/出队不加锁
+ * - 环形缓冲区满时溢出到加锁的链表，保证任务不丢失、生产者不阻塞，且同一生产者的任务保持先后顺序
+ * - 消费者无任务时挂起在条件变量上，生产者仅在消费者挂起时才加锁唤醒
+ */
+class KRTaskQueue {
+ public:
+    static constexpr size_t kDefaultCapacity = 1024;
+
+    explicit KRTaskQueue(size_t capacity = kDefaultCapacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    KRTaskQueue(const KRTaskQueue &) = delete;
+    KRTaskQueue &operator=(const KRTaskQueue &) = delete;
+
+    /**
+     * 入队，可在任意线程调用
+     */
+    void Push(KRTask task) {
+        if (!task) {
+            return;
+        }
+        // 已有溢出任务时继续走溢出链表，保证顺序
+        if (m_overflow_size.load(std::memory_order_acquire) > 0 || !TryPushRing(task)) {
+            std::lock_guard<std::mutex> lock(m_overflow_mutex);
+            m_overflow.push_back(std::move(task));
+            m_overflow_size.fetch_add(1, std::memory_order_release);
+        }
+        WakeConsumer();
+    }
+
+    /**
+     * 非阻塞出队，只能在消费者线程调用
+     */
+    bool TryPop(KRTask &task) {
+        if (TryPopRing(task)) {
+            return true;
+        }
+        if (m_overflow_size.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_overflow_mutex);
+        if (m_overflow.empty()) {
+            return false;
+        }
+        // 溢出链表中的任务晚于环形缓冲区中已有的任务，包括已占位但尚未写完的
+        if (TryPopRing(task)) {
+            return true;
+        }
+        if (m_enqueue_pos.load(std::memory_order_acquire) != m_dequeue_pos.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        task = std::move(m_overflow.front());
+        m_overflow.pop_front();
+        m_overflow_size.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * 阻塞出队，只能在消费者线程调用
+     * @return 队列已关闭且为空时返回 false
+     */
+    bool WaitPop(KRTask &task) {
+        while (true) {
+            if (TryPop(task)) {
+                return true;
+            }
+            std::unique_lock<std::mutex> lock(m_park_mutex);
+            m_consumer_parked.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            // 挂起前再检查一次，与 WakeConsumer 配合避免丢失唤醒
+            bool got = TryPop(task);
+            if (!got && !m_closed.load(std::memory_order_acquire)) {
+                m_park_cond.wait(lock);
+            }
+            m_consumer_parked.store(false, std::memory_order_relaxed);
+            if (got) {
+                return true;
+            }
+            if (m_closed.load(std::memory_order_acquire) && IsEmpty()) {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * 关闭队列，唤醒消费者；已入队的任务仍可取出
+     */
+    void Close() {
+        m_closed.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(m_park_mutex);
+        m_park_cond.notify_all();
+    }
+
+    /**
+     * 近似判空，仅供参考
+     */
+    bool IsEmpty() const {
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        const Cell &cell = m_cells[pos & m_mask];
+        return cell.sequence.load(std::memory_order_acquire) != pos + 1 &&
+               m_overflow_size.load(std::memory_order_acquire) == 0;
+    }
+
+ private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        KRTask task;
+    };
+
+    bool TryPushRing(KRTask &task) {
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        Cell *cell = nullptr;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // 已满
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->task = std::move(task);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPopRing(KRTask &task) {
+        size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        Cell &cell = m_cells[pos & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;  // 为空，或生产者尚未写完
+        }
+        task = std::move(cell.task);
+        cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+        m_dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void WakeConsumer() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_consumer_parked.load(std::memory_order_relaxed)) {
+            // 加锁保证消费者已进入等待或尚未完成二次检查
+            std::lock_guard<std::mutex> lock(m_park_mutex);
+            m_park_cond.notify_one();
+        }
+    }
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+    alignas(64) std::atomic<size_t> m_enqueue_pos{0};
+    alignas(64) std::atomic<size_t> m_dequeue_pos{0};
+
+    std::mutex m_overflow_mutex;
+    std::deque<KRTask> m_overflow;
+    std::atomic<size_t> m_overflow_size{0};
+
+    std::mutex m_park_mutex;
+    std::condition_variable m_park_cond;
+    std::atomic<bool> m_consumer_parked{false};
+    std::atomic<bool> m_closed{false};
+};
+
+#endif  // CORE_RENDER_OHOS_KRTASKQUEUE_H
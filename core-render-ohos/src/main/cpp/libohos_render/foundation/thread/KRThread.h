@@ -22,14 +22,14 @@
 #include <functional>
 #include <future>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include "KRDelayThread.h"
+#include "libohos_render/foundation/thread/KRTaskQueue.h"
 
 #include "libohos_render/utils/KRRenderLoger.h"
 class KRThread {
  public:
-    explicit KRThread(const std::string &name) : m_stop(false) {
+    explicit KRThread(const std::string &name) {
         m_workerThread = std::thread([this] {
             m_workerThreadId = std::this_thread::get_id();
             this->Worker();
@@ -42,31 +42,26 @@ class KRThread {
     ~KRThread() {
         delete m_delayThread;
         m_delayThread = nullptr;
-        {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_stop = true;
-            m_condition.notify_one();
-        }
+        m_tasks.Close();
         m_workerThread.join();
     }
 
-    void DispatchAsync(const std::function<void()> &task, int delayMilliseconds = 0) {
+    /**
+     * @return 延时任务的句柄，可用于 CancelDelayed；无延时的任务返回 0
+     */
+    KRTimerId DispatchAsync(const std::function<void()> &task, int delayMilliseconds = 0) {
         if (delayMilliseconds > 0) {
-            m_delayThread->DispatchAsync([task, this] { this->DispatchAsync(task, 0); }, delayMilliseconds);
-            return;
-        }
-        if (IsCurrentThreadWorkerThread()) {
-            // 如果当前线程已经是工作线程，直接将任务添加到队列
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_tasks.emplace(task);
-        } else {
-            // 否则，将任务添加到队列
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                m_tasks.emplace(task);
-            }
-            m_condition.notify_one();
+            return m_delayThread->DispatchAsync([task, this] { this->DispatchAsync(task, 0); }, delayMilliseconds);
         }
+        m_tasks.Push(task);
+        return 0;
+    }
+
+    /**
+     * 取消尚未到期的延时任务
+     */
+    bool CancelDelayed(KRTimerId id) {
+        return m_delayThread->Cancel(id);
     }
 
     void DispatchSync(const std::function<void()> &task) {
@@ -74,66 +69,56 @@ class KRThread {
         return;
     }
 
+    /**
+     * 在当前线程直接执行任务，执行期间工作线程不会执行其他任务
+     * 工作线程正在同步等待主线程，或 100ms 内未能获得执行权时，退化为异步派发
+     */
     void DirectRunOnCurThread(const std::function<void()> &task) {
-        if (m_isExecutingTask.load()) {
+        // 嵌套调用，或工作线程自身调用（已持有执行权）
+        if (m_isExecutingTask.load() || IsCurrentThreadWorkerThread()) {
             task();
-        } else {
-            auto start = std::chrono::steady_clock::now();  // 记录开始时间
-            bool didHandleTask = false;
-            while (!SyncMainTaskMutex(false, false, false)) {
-                // 检查是否超时
-                auto now = std::chrono::steady_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
-                if (duration.count() > 100) {
-                    break;  // 超时，跳出循环
-                }
-                // 尝试获取互斥锁
-                if (TaskMutex(true, false, false)) {
-                    m_isExecutingTask.store(true);  // 设置正在执行任务标志
-                    task();
-                    m_isExecutingTask.store(false);  // 清除正在执行任务标志
-                    TaskMutex(false, true, false);
-                    didHandleTask = true;
-                    break;  // 任务执行完成，跳出循环
-                }
-            }
-            if (!didHandleTask) {
-                KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
-                DispatchAsync(task);
-            }
+            return;
         }
-    }
-
-    bool TaskMutex(bool try_lock, bool is_set, bool value) {
-        std::unique_lock<std::mutex> lock(m_taskMutex);
-        if (try_lock) {
-            if (m_mutex_locked) {
-                return false;
-            } else {
-                m_mutex_locked = true;
-                return true;
+        bool acquired = false;
+        {
+            std::unique_lock<std::mutex> lock(m_stateMutex);
+            m_stateCondition.wait_for(lock, std::chrono::milliseconds(100),
+                                      [this] { return !m_executing || m_sync_main_task_locked; });
+            if (!m_executing && !m_sync_main_task_locked) {
+                m_executing = true;
+                acquired = true;
             }
         }
-        if (is_set) {
-            m_mutex_locked = value;
+        if (!acquired) {
+            KR_LOG_INFO << "DispatchAsync when run DirectRunOnCurThread";
+            DispatchAsync(task);
+            return;
         }
-        return m_mutex_locked;
+        m_isExecutingTask.store(true);  // 设置正在执行任务标志
+        task();
+        m_isExecutingTask.store(false);  // 清除正在执行任务标志
+        ReleaseExecution();
     }
 
+    /**
+     * 工作线程同步等待主线程期间的标记，避免主线程再同步等待工作线程导致死锁
+     */
     bool SyncMainTaskMutex(bool try_lock, bool is_set, bool value) {
-        std::unique_lock<std::mutex> lock(m_syncMainTaskMutex);
-        if (try_lock) {
-            if (m_sync_main_task_locked) {
-                return false;
-            } else {
+        bool result = false;
+        {
+            std::unique_lock<std::mutex> lock(m_stateMutex);
+            if (try_lock) {
+                result = !m_sync_main_task_locked;
                 m_sync_main_task_locked = true;
-                return true;
+            } else {
+                if (is_set) {
+                    m_sync_main_task_locked = value;
+                }
+                result = m_sync_main_task_locked;
             }
         }
-        if (is_set) {
-            m_sync_main_task_locked = value;
-        }
-        return m_sync_main_task_locked;
+        m_stateCondition.notify_all();
+        return result;
     }
 
     bool IsCurrentThreadWorkerThread() const {
@@ -145,46 +130,40 @@ class KRThread {
     }
 
  private:
-    void Worker() {
-        while (true) {
-            std::queue<std::function<void()>> tasks;
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+    // 单次获得执行权后最多连续执行的任务数，避免长时间阻塞 DirectRunOnCurThread
+    static constexpr int kMaxBatchSize = 64;
 
-                if (m_stop && m_tasks.empty()) {
-                    break;
-                }
-
-                std::swap(tasks, m_tasks);  // 将m_tasks所有任务一次性移动到tasks
-            }
+    void Worker() {
+        KRTask task;
+        while (m_tasks.WaitPop(task)) {
             {
-                if (TaskMutex(true, false, false)) {
-                    while (!tasks.empty()) {
-                        auto &task = tasks.front();
-                        task();
-                        tasks.pop();
-                    }
-                    TaskMutex(false, true, false);
-                } else {
-                    std::unique_lock<std::mutex> lock(m_mutex);
-                    while (!tasks.empty()) {
-                        m_tasks.push(std::move(tasks.front()));
-                        tasks.pop();
-                    }
-                }
+                std::unique_lock<std::mutex> lock(m_stateMutex);
+                m_stateCondition.wait(lock, [this] { return !m_executing; });
+                m_executing = true;
             }
+            int count = 0;
+            do {
+                task();
+                task.Reset();
+            } while (++count < kMaxBatchSize && m_tasks.TryPop(task));
+            ReleaseExecution();
+        }
+    }
+
+    void ReleaseExecution() {
+        {
+            std::unique_lock<std::mutex> lock(m_stateMutex);
+            m_executing = false;
         }
+        m_stateCondition.notify_all();
     }
 
-    std::queue<std::function<void()>> m_tasks;
-    std::mutex m_mutex;
-    std::mutex m_taskMutex;
-    bool m_mutex_locked = false;
-    std::mutex m_syncMainTaskMutex;
+    KRTaskQueue m_tasks;
+    // 执行权：工作线程与 DirectRunOnCurThread 的调用线程互斥执行任务
+    std::mutex m_stateMutex;
+    std::condition_variable m_stateCondition;
+    bool m_executing = false;
     bool m_sync_main_task_locked = false;
-    std::condition_variable m_condition;
-    bool m_stop = false;
     std::thread m_workerThread;
     std::thread::id m_workerThreadId;
     KRDelayThread *m_delayThread = nullptr;
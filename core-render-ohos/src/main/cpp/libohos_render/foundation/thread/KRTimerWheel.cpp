@@ -0,0 +1,222 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
+
+#include <climits>
+
+// 256 位环形位图中，从 from 的下一个槽开始第一个非空槽的距离 [1, 256]，为空返回 -1
+static int RingDistance256(const uint64_t *words, int from) {
+    int start = (from + 1) & 255;
+    for (int i = 0; i <= 4; ++i) {
+        int w = ((start >> 6) + i) & 3;
+        uint64_t bits = words[w];
+        if (i == 0) {
+            bits &= ~0ULL << (start & 63);
+        } else if (i == 4) {
+            bits &= (start & 63) ? ((1ULL << (start & 63)) - 1) : 0;
+        }
+        if (bits) {
+            int pos = w * 64 + __builtin_ctzll(bits);
+            return ((pos - start) & 255) + 1;
+        }
+    }
+    return -1;
+}
+
+// 64 位环形位图中，从 from 的下一个槽开始第一个非空槽的距离 [1, 64]，为空返回 -1
+static int RingDistance64(uint64_t bits, int from) {
+    if (!bits) {
+        return -1;
+    }
+    int start = (from + 1) & 63;
+    uint64_t rotated = start ? (bits >> start) | (bits << (64 - start)) : bits;
+    return __builtin_ctzll(rotated) + 1;
+}
+
+KRTimerWheel::KRTimerWheel(int64_t now_ms) : current_(now_ms) {
+    for (auto &head : heads_) {
+        head = kNil;
+    }
+    for (auto &tail : tails_) {
+        tail = kNil;
+    }
+}
+
+KRTimerId KRTimerWheel::Schedule(int64_t expire_ms, KRTask task) {
+    uint32_t index;
+    if (free_head_ != kNil) {
+        index = free_head_;
+        free_head_ = nodes_[index].next;
+    } else {
+        index = static_cast<uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+    }
+    Node &node = nodes_[index];
+    node.expire = expire_ms > current_ ? expire_ms : current_ + 1;
+    node.task = std::move(task);
+    Place(index);
+    size_++;
+    return (static_cast<uint64_t>(node.generation) << 32) | (index + 1);
+}
+
+bool KRTimerWheel::Cancel(KRTimerId id) {
+    uint32_t low = static_cast<uint32_t>(id);
+    if (low == 0 || low > nodes_.size()) {
+        return false;
+    }
+    uint32_t index = low - 1;
+    Node &node = nodes_[index];
+    if (node.bucket < 0 || node.generation != static_cast<uint32_t>(id >> 32)) {
+        return false;
+    }
+    Unlink(index);
+    Release(index);
+    size_--;
+    return true;
+}
+
+void KRTimerWheel::Advance(int64_t now_ms, std::vector<KRTask> &expired) {
+    while (size_ > 0) {
+        int64_t tick = NextEventTick();
+        if (tick > now_ms) {
+            break;
+        }
+        current_ = tick;
+        // 高层先下沉，下沉到低层同一时刻槽位的定时器随后一并处理
+        for (int level = kLevels - 1; level >= 1; --level) {
+            int shift = Shift(level);
+            if ((tick & ((int64_t(1) << shift) - 1)) == 0) {
+                Cascade(level, static_cast<int>((tick >> shift) & (kLevelNSlots - 1)));
+            }
+        }
+        int bucket = static_cast<int>(tick & (kLevel0Slots - 1));
+        while (heads_[bucket] != kNil) {
+            uint32_t index = heads_[bucket];
+            Unlink(index);
+            expired.push_back(std::move(nodes_[index].task));
+            Release(index);
+            size_--;
+        }
+    }
+    if (now_ms > current_) {
+        current_ = now_ms;
+    }
+}
+
+int64_t KRTimerWheel::NextWakeup() const {
+    return size_ > 0 ? NextEventTick() : -1;
+}
+
+void KRTimerWheel::Place(uint32_t index) {
+    int64_t expire = nodes_[index].expire;
+    int64_t delta = expire - current_;
+    if (delta < kLevel0Slots) {
+        Link(index, BucketOf(0, static_cast<int>(expire & (kLevel0Slots - 1))));
+        return;
+    }
+    int level = 1;
+    while (level < kLevels - 1 && delta >= (int64_t(1) << Shift(level + 1))) {
+        level++;
+    }
+    if (delta >= (int64_t(1) << Shift(kLevels))) {
+        // 超出范围，先放在最高层最远的槽，下沉时按真实到期时间重新放置
+        expire = current_ + (int64_t(1) << Shift(kLevels)) - 1;
+    }
+    Link(index, BucketOf(level, static_cast<int>((expire >> Shift(level)) & (kLevelNSlots - 1))));
+}
+
+void KRTimerWheel::Link(uint32_t index, int bucket) {
+    Node &node = nodes_[index];
+    node.bucket = bucket;
+    node.next = kNil;
+    node.prev = tails_[bucket];
+    if (tails_[bucket] != kNil) {
+        nodes_[tails_[bucket]].next = index;
+    } else {
+        heads_[bucket] = index;
+    }
+    tails_[bucket] = index;
+    if (bucket < kLevel0Slots) {
+        level0_bitmap_[bucket >> 6] |= 1ULL << (bucket & 63);
+    } else {
+        int offset = bucket - kLevel0Slots;
+        levelN_bitmap_[offset / kLevelNSlots] |= 1ULL << (offset % kLevelNSlots);
+    }
+}
+
+void KRTimerWheel::Unlink(uint32_t index) {
+    Node &node = nodes_[index];
+    int bucket = node.bucket;
+    if (node.prev != kNil) {
+        nodes_[node.prev].next = node.next;
+    } else {
+        heads_[bucket] = node.next;
+    }
+    if (node.next != kNil) {
+        nodes_[node.next].prev = node.prev;
+    } else {
+        tails_[bucket] = node.prev;
+    }
+    node.prev = kNil;
+    node.next = kNil;
+    node.bucket = -1;
+    if (heads_[bucket] == kNil) {
+        if (bucket < kLevel0Slots) {
+            level0_bitmap_[bucket >> 6] &= ~(1ULL << (bucket & 63));
+        } else {
+            int offset = bucket - kLevel0Slots;
+            levelN_bitmap_[offset / kLevelNSlots] &= ~(1ULL << (offset % kLevelNSlots));
+        }
+    }
+}
+
+void KRTimerWheel::Release(uint32_t index) {
+    Node &node = nodes_[index];
+    node.task.Reset();
+    node.bucket = -1;
+    node.generation++;
+    node.next = free_head_;
+    free_head_ = index;
+}
+
+void KRTimerWheel::Cascade(int level, int slot) {
+    int bucket = BucketOf(level, slot);
+    while (heads_[bucket] != kNil) {
+        uint32_t index = heads_[bucket];
+        Unlink(index);
+        Place(index);
+    }
+}
+
+int64_t KRTimerWheel::NextEventTick() const {
+    int64_t next = LLONG_MAX;
+    int distance = RingDistance256(level0_bitmap_, static_cast<int>(current_ & (kLevel0Slots - 1)));
+    if (distance > 0) {
+        next = current_ + distance;
+    }
+    for (int level = 1; level < kLevels; ++level) {
+        int shift = Shift(level);
+        int64_t block = current_ >> shift;
+        distance = RingDistance64(levelN_bitmap_[level - 1], static_cast<int>(block & (kLevelNSlots - 1)));
+        if (distance > 0) {
+            int64_t tick = (block + distance) << shift;
+            if (tick < next) {
+                next = tick;
+            }
+        }
+    }
+    return next;
+}
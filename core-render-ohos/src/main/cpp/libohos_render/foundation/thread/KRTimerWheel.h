@@ -0,0 +1,111 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTIMERWHEEL_H
+#define CORE_RENDER_OHOS_KRTIMERWHEEL_H
+
+#include <cstdint>
+#include <vector>
+#include "libohos_render/foundation/thread/KRTask.h"
+
+/**
+ * 定时器句柄，0 为无效值
+ */
+using KRTimerId = uint64_t;
+
+/**
+ * 分层时间轮，时间单位为毫秒，不加锁也不读时钟，由调用方传入当前时间推进
+ * - 第 0 层 256 个槽，精度 1ms；其上 4 层各 64 个槽，精度逐层放大 64 倍，覆盖约 49 天
+ * - 高层定时器在所在槽到期时逐层下沉，最终在第 0 层按 1ms 精度到期
+ * - 插入、取消 O(1)；推进时跳过空槽，同一毫秒到期的任务批量取出
+ */
+class KRTimerWheel {
+ public:
+    explicit KRTimerWheel(int64_t now_ms = 0);
+    KRTimerWheel(const KRTimerWheel &) = delete;
+    KRTimerWheel &operator=(const KRTimerWheel &) = delete;
+
+    /**
+     * 添加定时器，expire_ms 不晚于当前时间时在下一次推进时到期
+     */
+    KRTimerId Schedule(int64_t expire_ms, KRTask task);
+
+    /**
+     * 取消尚未到期的定时器，已到期或句柄无效时返回 false
+     */
+    bool Cancel(KRTimerId id);
+
+    /**
+     * 推进到 now_ms，按到期时间先后把到期任务追加到 expired，不执行任务
+     */
+    void Advance(int64_t now_ms, std::vector<KRTask> &expired);
+
+    /**
+     * 下一次需要推进的时间（定时器到期或高层槽下沉），没有定时器时返回 -1
+     */
+    int64_t NextWakeup() const;
+
+    int64_t Now() const {
+        return current_;
+    }
+
+    size_t Size() const {
+        return size_;
+    }
+
+ private:
+    static constexpr int kLevels = 5;
+    static constexpr int kLevel0Bits = 8;
+    static constexpr int kLevelNBits = 6;
+    static constexpr int kLevel0Slots = 1 << kLevel0Bits;
+    static constexpr int kLevelNSlots = 1 << kLevelNBits;
+    static constexpr int kBuckets = kLevel0Slots + (kLevels - 1) * kLevelNSlots;
+    static constexpr uint32_t kNil = UINT32_MAX;
+
+    struct Node {
+        int64_t expire = 0;
+        uint32_t prev = kNil;
+        uint32_t next = kNil;
+        uint32_t generation = 0;
+        int32_t bucket = -1;  // -1 表示空闲
+        KRTask task;
+    };
+
+    static int Shift(int level) {
+        return level == 0 ? 0 : kLevel0Bits + (level - 1) * kLevelNBits;
+    }
+    static int BucketOf(int level, int slot) {
+        return level == 0 ? slot : kLevel0Slots + (level - 1) * kLevelNSlots + slot;
+    }
+
+    void Place(uint32_t index);
+    void Link(uint32_t index, int bucket);
+    void Unlink(uint32_t index);
+    void Release(uint32_t index);
+    void Cascade(int level, int slot);
+    int64_t NextEventTick() const;
+
+    std::vector<Node> nodes_;
+    uint32_t free_head_ = kNil;
+    uint32_t heads_[kBuckets];
+    uint32_t tails_[kBuckets];
+    // 每层非空槽位图，用于跳过空槽
+    uint64_t level0_bitmap_[kLevel0Slots / 64] = {};
+    uint64_t levelN_bitmap_[kLevels - 1] = {};
+    int64_t current_;
+    size_t size_ = 0;
+};
+
+#endif  // CORE_RENDER_OHOS_KRTIMERWHEEL_H
@@ -0,0 +1,73 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRVSync.h"
+
+#include <hilog/log.h>
+#include <cstring>
+
+static constexpr char kVSyncName[] = "kuikly_vsync";
+
+KRVSync &KRVSync::GetInstance() {
+    static KRVSync *instance = new KRVSync();  // 不析构，避免退出时 vsync 线程回调到已销毁对象
+    return *instance;
+}
+
+KRVSync::KRVSync() {
+    vsync_ = OH_NativeVSync_Create(kVSyncName, strlen(kVSyncName));
+    if (vsync_ == nullptr) {
+        OH_LOG_Print(LOG_APP, LOG_ERROR, 0x7, "KRVSync", "OH_NativeVSync_Create failed");
+        return;
+    }
+    UpdatePeriod();
+}
+
+bool KRVSync::RequestFrame(const FrameCallback &callback) {
+    if (vsync_ == nullptr || !callback) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!requested_) {
+        if (OH_NativeVSync_RequestFrame(vsync_, &KRVSync::OnFrame, this) != 0) {
+            return false;
+        }
+        requested_ = true;
+    }
+    callbacks_.push_back(callback);
+    return true;
+}
+
+void KRVSync::OnFrame(long long timestamp, void *data) {
+    auto self = static_cast<KRVSync *>(data);
+    self->last_frame_nanos_.store(timestamp, std::memory_order_relaxed);
+    self->UpdatePeriod();
+    {
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        self->requested_ = false;
+        self->running_callbacks_.swap(self->callbacks_);
+    }
+    // running_callbacks_ 只在 vsync 线程访问
+    for (auto &callback : self->running_callbacks_) {
+        callback(timestamp);
+    }
+    self->running_callbacks_.clear();
+}
+
+void KRVSync::UpdatePeriod() {
+    long long period = 0;
+    if (OH_NativeVSync_GetPeriod(vsync_, &period) == 0 && period > 0) {
+        period_nanos_.store(period, std::memory_order_relaxed);
+    }
+}
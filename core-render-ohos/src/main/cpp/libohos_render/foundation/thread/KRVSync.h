@@ -0,0 +1,81 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRVSYNC_H
+#define CORE_RENDER_OHOS_KRVSYNC_H
+
+#include <native_vsync/native_vsync.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * 显示帧信号，基于 OH_NativeVSync
+ * - RequestFrame 的回调在下一个 vsync 到来时执行一次，执行线程为 vsync 线程
+ * - 帧间隔取自系统上报的刷新周期，随刷新率变化
+ */
+class KRVSync {
+ public:
+    using FrameCallback = std::function<void(int64_t frame_time_nanos)>;
+
+    static KRVSync &GetInstance();
+
+    /**
+     * 是否接入了真实的显示帧信号，创建 vsync 失败时为 false
+     */
+    bool IsAvailable() const {
+        return vsync_ != nullptr;
+    }
+
+    /**
+     * 请求下一帧回调，同一帧内的多次请求在同一次 vsync 中依次回调
+     * @return 不可用或请求失败时返回 false，callback 不会被执行
+     */
+    bool RequestFrame(const FrameCallback &callback);
+
+    /**
+     * 显示帧间隔，单位纳秒，尚未取到时为 0
+     */
+    int64_t FramePeriodNanos() const {
+        return period_nanos_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 最近一次 vsync 的时间戳（CLOCK_MONOTONIC），单位纳秒，尚未收到时为 0
+     */
+    int64_t LastFrameNanos() const {
+        return last_frame_nanos_.load(std::memory_order_relaxed);
+    }
+
+ private:
+    KRVSync();
+    KRVSync(const KRVSync &) = delete;
+    KRVSync &operator=(const KRVSync &) = delete;
+
+    static void OnFrame(long long timestamp, void *data);
+    void UpdatePeriod();
+
+    OH_NativeVSync *vsync_ = nullptr;
+    std::mutex mutex_;
+    std::vector<FrameCallback> callbacks_;
+    std::vector<FrameCallback> running_callbacks_;
+    bool requested_ = false;
+    std::atomic<int64_t> period_nanos_{0};
+    std::atomic<int64_t> last_frame_nanos_{0};
+};
+
+#endif  // CORE_RENDER_OHOS_KRVSYNC_H
@@ -25,7 +25,8 @@
  */
 typedef struct KRRenderCValue {
     // 定义一个枚举类型来表示值的类型
-    enum Type { NULL_VALUE, INT, LONG, FLOAT, DOUBLE, BOOL, STRING, BYTES, ARRAY } type;
+    // ENCODED 为 KRRenderValueCodec 编码的 map or array, 数据与长度的存放方式同 BYTES
+    enum Type { NULL_VALUE, INT, LONG, FLOAT, DOUBLE, BOOL, STRING, BYTES, ARRAY, ENCODED } type;
 
     // 定义一个联合体来存储不同类型的值
     union Value {
@@ -52,5 +53,6 @@ extern int com_tencent_kuikly_SetCallKotlin(CallKotlin callKotlin);
 extern const KRRenderCValue com_tencent_kuikly_CallNative(int methodId, KRRenderCValue arg0, KRRenderCValue arg1,
                                                           KRRenderCValue arg2, KRRenderCValue arg3, KRRenderCValue arg4,
                                                           KRRenderCValue arg5);
+extern int com_tencent_kuikly_BinaryRenderValueEnabled();
 }
 #endif  // CORE_RENDER_OHOS_KRRENDERCVALUE_H
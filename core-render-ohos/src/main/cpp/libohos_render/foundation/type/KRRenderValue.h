@@ -23,6 +23,7 @@
 #include <js_native_api_types.h>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -32,6 +33,7 @@
 #include "KRRenderCValue.h"
 #include "libohos_render/foundation/ark_ts.h"
 #include "libohos_render/foundation/type/KRRenderCValue.h"
+#include "libohos_render/foundation/type/KRRenderValueCodec.h"
 #include "libohos_render/utils/KRJsUtil.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/NAPIUtil.h"
@@ -123,6 +125,20 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     }
 
     explicit KRRenderValue(const KRRenderCValue &cValue) : KRRenderValue() {
+        resetFromCValue(cValue);
+    }
+
+    /**
+     * 用 cValue 原地重置当前值，清空各类转换缓存，供 KRRenderValuePool 复用对象
+     * 字符串与二进制负载在容量允许时复用已有内存
+     */
+    void resetFromCValue(const KRRenderCValue &cValue) {
+        ResetCaches();
+        encoded_kind_ = EncodedKind::kNone;
+        auto *str = std::get_if<std::string>(&value_);
+        if (str != nullptr && cValue.type != KRRenderCValue::Type::STRING && str->capacity() <= kReusableCapacity) {
+            spare_string_ = std::move(*str);  // 类型切换时暂存字符串内存，留给之后的字符串值
+        }
         if (cValue.type == KRRenderCValue::Type::BOOL) {
             value_ = cValue.value.boolValue != 0;
         } else if (cValue.type == KRRenderCValue::Type::INT) {
@@ -134,15 +150,21 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (cValue.type == KRRenderCValue::Type::DOUBLE) {
             value_ = cValue.value.doubleValue;
         } else if (cValue.type == KRRenderCValue::Type::STRING) {
-            value_ = std::string(cValue.value.stringValue);
-        } else if (cValue.type == KRRenderCValue::Type::BYTES) {
-            auto length = cValue.size;
-            auto start_address = cValue.value.bytesValue;
-            auto bytes = std::make_shared<std::vector<uint8_t>>();
-            for (int i = 0; i < length; i++) {
-                bytes->push_back(*(reinterpret_cast<uint8_t *>(start_address + i)));
+            AssignString(cValue.value.stringValue, strlen(cValue.value.stringValue));
+        } else if (cValue.type == KRRenderCValue::Type::BYTES || cValue.type == KRRenderCValue::Type::ENCODED) {
+            auto start_address = reinterpret_cast<uint8_t *>(cValue.value.bytesValue);
+            auto size = (start_address != nullptr && cValue.size > 0) ? cValue.size : 0;
+            auto *bytes = std::get_if<ByteArray>(&value_);
+            // 二进制数据未被外部持有时原地复用
+            if (bytes != nullptr && *bytes && bytes->use_count() == 1 && (*bytes)->capacity() <= kReusableCapacity) {
+                (*bytes)->assign(start_address, start_address + size);
+            } else {
+                value_ = std::make_shared<std::vector<uint8_t>>(start_address, start_address + size);
+            }
+            if (cValue.type == KRRenderCValue::Type::ENCODED) {
+                encoded_kind_ = KRRenderValueCodec::IsEncodedArray(start_address, size) ? EncodedKind::kArray
+                                                                                         : EncodedKind::kMap;
             }
-            value_ = bytes;
         } else if (cValue.type == KRRenderCValue::Type::ARRAY) {
             auto array_size = cValue.size;
             Array array;
@@ -155,6 +177,26 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         }
     }
 
+    /**
+     * 用 [data, data + size) 原地重置为字符串值，可包含 '\0'，其余同 resetFromCValue
+     */
+    void resetFromString(const char *data, size_t size) {
+        ResetCaches();
+        encoded_kind_ = EncodedKind::kNone;
+        AssignString(data, size);
+    }
+
+    /**
+     * 标记该对象会被长期共享（如以 weak_ptr 持有），此后不再被 KRRenderValuePool 复用
+     */
+    void MarkShared() {
+        marked_shared_ = true;
+    }
+
+    bool IsMarkedShared() const {
+        return marked_shared_;
+    }
+
     explicit KRRenderValue(const NapiValue &value) : KRRenderValue() {
         value_ = value;
     }
@@ -324,16 +366,17 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         return std::holds_alternative<std::string>(value_);
     }
 
+    // 来自 ENCODED 类型的 map or array 同样视为 map or array，首次 toMap/toArray 时才解码
     bool isMap() const {
-        return std::holds_alternative<Map>(value_);
+        return std::holds_alternative<Map>(value_) || encoded_kind_ == EncodedKind::kMap;
     }
 
     bool isArray() const {
-        return std::holds_alternative<Array>(value_);
+        return std::holds_alternative<Array>(value_) || encoded_kind_ == EncodedKind::kArray;
     }
 
     bool isByteArray() const {
-        return std::holds_alternative<ByteArray>(value_);
+        return std::holds_alternative<ByteArray>(value_) && encoded_kind_ == EncodedKind::kNone;
     }
 
     bool isNapiValue() const {
@@ -434,7 +477,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     }
 
     const Map &toMap() const {
-        if (isMap()) {
+        if (std::holds_alternative<Map>(value_)) {
             return std::get<Map>(value_);
         } else if (std::holds_alternative<Map>(json_to_map_or_array_value_)) {
             return std::get<Map>(json_to_map_or_array_value_);
@@ -451,6 +494,14 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             json_to_map_or_array_value_ = map;
             cJSON_Delete(cjson);
             return std::get<Map>(json_to_map_or_array_value_);
+        } else if (IsBinaryEncoded()) {  // 首次访问时才解码
+            auto decoded = DecodeBinary();
+            if (decoded && decoded->isMap()) {
+                json_to_map_or_array_value_ = std::move(std::get<Map>(decoded->value_));
+            } else {
+                json_to_map_or_array_value_ = Map();
+            }
+            return std::get<Map>(json_to_map_or_array_value_);
         } else {
             json_to_map_or_array_value_ = Map();
             return std::get<Map>(json_to_map_or_array_value_);
@@ -458,7 +509,7 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     }
 
     const Array &toArray() const {
-        if (isArray()) {
+        if (std::holds_alternative<Array>(value_)) {
             return std::get<Array>(value_);
         } else if (std::holds_alternative<Array>(json_to_map_or_array_value_)) {
             return std::get<Array>(json_to_map_or_array_value_);
@@ -475,6 +526,14 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
             json_to_map_or_array_value_ = json_vec;
             cJSON_Delete(cjson);
             return std::get<Array>(json_to_map_or_array_value_);
+        } else if (IsBinaryEncoded()) {  // 首次访问时才解码
+            auto decoded = DecodeBinary();
+            if (decoded && decoded->isArray()) {
+                json_to_map_or_array_value_ = std::move(std::get<Array>(decoded->value_));
+            } else {
+                json_to_map_or_array_value_ = Array();
+            }
+            return std::get<Array>(json_to_map_or_array_value_);
         } else {
             json_to_map_or_array_value_ = Array();
             return std::get<Array>(json_to_map_or_array_value_);
@@ -512,11 +571,18 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         } else if (isString()) {
             c_value_.type = KRRenderCValue::Type::STRING;
             c_value_.value.stringValue = const_cast<char *>(toString().c_str());
+        } else if (IsBinaryEncoded()) {  // 原样传回收到的编码数据，不重新编码
+            c_value_.type = KRRenderCValue::Type::ENCODED;
+            auto byte_array = std::get<ByteArray>(value_).get();
+            c_value_.size = byte_array->size();
+            c_value_.value.bytesValue = reinterpret_cast<char *>(byte_array->data());
         } else if (isByteArray()) {
             c_value_.type = KRRenderCValue::Type::BYTES;
             auto byte_array = std::get<ByteArray>(value_).get();
             c_value_.size = byte_array->size();
             c_value_.value.bytesValue = reinterpret_cast<char *>(byte_array->data());
+        } else if ((isMap() || isArray()) && KRRenderValueCodec::IsEnabled()) {
+            ToBinaryMapOrArray();
         } else if (isMap()) {
             ToJsonMapOrArray();
         } else if (isArray()) {
@@ -651,14 +717,54 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
     }
 
  private:
+    // 复用时保留的最大缓冲区容量，超出则释放，避免复用对象长期占用大块内存
+    static constexpr size_t kReusableCapacity = 4096;
+
     std::variant<std::monostate, bool, int32_t, int64_t, float, double, std::string, Map, Array, void *, ByteArray,
                  NapiValue>
         value_;
     mutable std::string map_or_array_json_value_;  // 缓存经过序列化的 map或者 array, 用于缓存经过序列化的std::string
+    mutable std::vector<uint8_t> map_or_array_binary_value_;  // 缓存经过二进制编码的 map或者 array
     mutable KRRenderCValue c_value_;
     mutable std::variant<std::monostate, Map, Array> json_to_map_or_array_value_;
     mutable std::string outputToStringResult_;
     mutable KRRenderCValue *array_ptr_ = nullptr;  // 指向数组的指针, 用于防止数组元素copy
+    std::string spare_string_;  // resetFromCValue 复用时暂存的字符串内存
+    enum class EncodedKind : uint8_t { kNone, kMap, kArray };
+    EncodedKind encoded_kind_ = EncodedKind::kNone;  // 来自 ENCODED 类型的 cValue，value_ 中为编码后的 map or array
+    bool marked_shared_ = false;
+
+    static void ResetBuffer(std::string &buffer) {
+        if (buffer.capacity() > kReusableCapacity) {
+            std::string().swap(buffer);
+        } else {
+            buffer.clear();
+        }
+    }
+
+    void AssignString(const char *data, size_t size) {
+        auto *str = std::get_if<std::string>(&value_);
+        if (str == nullptr || str->capacity() > kReusableCapacity) {
+            str = &value_.emplace<std::string>(std::move(spare_string_));
+        }
+        str->assign(data, size);
+    }
+
+    void ResetCaches() {
+        if (array_ptr_) {
+            delete[] array_ptr_;
+            array_ptr_ = nullptr;
+        }
+        c_value_.type = KRRenderCValue::Type::NULL_VALUE;
+        json_to_map_or_array_value_ = std::monostate();
+        ResetBuffer(map_or_array_json_value_);
+        ResetBuffer(outputToStringResult_);
+        if (map_or_array_binary_value_.capacity() > kReusableCapacity) {
+            std::vector<uint8_t>().swap(map_or_array_binary_value_);
+        } else {
+            map_or_array_binary_value_.clear();
+        }
+    }
 
     const void ToJsonMapOrArray() const {
         cJSON* cjson = toJson( shared_from_this());
@@ -670,6 +776,23 @@ class KRRenderValue : public std::enable_shared_from_this<KRRenderValue> {
         cJSON_Delete(cjson);
     }
 
+    void ToBinaryMapOrArray() const {
+        map_or_array_binary_value_.clear();
+        KRRenderValueCodec::Encode(*this, map_or_array_binary_value_);
+        c_value_.type = KRRenderCValue::Type::ENCODED;
+        c_value_.size = map_or_array_binary_value_.size();
+        c_value_.value.bytesValue = reinterpret_cast<char *>(map_or_array_binary_value_.data());
+    }
+
+    bool IsBinaryEncoded() const {
+        return encoded_kind_ != EncodedKind::kNone;
+    }
+
+    std::shared_ptr<KRRenderValue> DecodeBinary() const {
+        auto &bytes = std::get<ByteArray>(value_);
+        return KRRenderValueCodec::Decode(bytes->data(), bytes->size());
+    }
+
     const JSVM_Status ToJsonMapOrArray(JSVM_Env js_env, JSVM_Value *js_value) const {
         cJSON* cjson = toJson( shared_from_this());
         if(char* p = cJSON_PrintUnformatted(cjson)){
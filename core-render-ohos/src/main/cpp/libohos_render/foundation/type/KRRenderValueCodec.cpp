@@ -0,0 +1,314 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/type/KRRenderValueCodec.h"
+
+#include <atomic>
+#include <cstring>
+#include "libohos_render/foundation/type/KRRenderValue.h"
+
+namespace {
+
+enum class Tag : uint8_t {
+    kNull = 0,
+    kFalse = 1,
+    kTrue = 2,
+    kInt = 3,
+    kLong = 4,
+    kFloat = 5,
+    kDouble = 6,
+    kString = 7,
+    kBytes = 8,
+    kArray = 9,
+    kMap = 10,
+};
+
+constexpr uint8_t kMagic[] = {'K', 'R', 'B'};
+// 防止恶意/损坏数据导致递归过深
+constexpr int kMaxDepth = 64;
+
+std::atomic<bool> g_codec_enabled{false};
+
+inline uint64_t ZigZagEncode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t ZigZagDecode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+class Writer {
+ public:
+    explicit Writer(std::vector<uint8_t> &out) : out_(out) {}
+
+    void WriteTag(Tag tag) {
+        out_.push_back(static_cast<uint8_t>(tag));
+    }
+
+    void WriteVarint(uint64_t value) {
+        while (value >= 0x80) {
+            out_.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out_.push_back(static_cast<uint8_t>(value));
+    }
+
+    template <typename T> void WriteFixed(T value) {
+        uint8_t buffer[sizeof(T)];
+        std::memcpy(buffer, &value, sizeof(T));  // ohos 平台均为小端
+        out_.insert(out_.end(), buffer, buffer + sizeof(T));
+    }
+
+    void WriteBytes(const void *data, size_t size) {
+        WriteVarint(size);
+        auto bytes = static_cast<const uint8_t *>(data);
+        out_.insert(out_.end(), bytes, bytes + size);
+    }
+
+    void WriteValue(const KRRenderValue &value) {
+        if (value.isBool()) {
+            WriteTag(value.toBool() ? Tag::kTrue : Tag::kFalse);
+        } else if (value.isInt()) {
+            WriteTag(Tag::kInt);
+            WriteVarint(ZigZagEncode(value.toInt()));
+        } else if (value.isLong()) {
+            WriteTag(Tag::kLong);
+            WriteVarint(ZigZagEncode(value.toLong()));
+        } else if (value.isFloat()) {
+            WriteTag(Tag::kFloat);
+            WriteFixed(value.toFloat());
+        } else if (value.isDouble()) {
+            WriteTag(Tag::kDouble);
+            WriteFixed(value.toDouble());
+        } else if (value.isString()) {
+            WriteTag(Tag::kString);
+            auto &str = value.toString();
+            WriteBytes(str.data(), str.size());
+        } else if (value.isByteArray()) {
+            WriteTag(Tag::kBytes);
+            auto bytes = value.toByteArray();
+            WriteBytes(bytes->data(), bytes->size());
+        } else if (value.isArray()) {
+            WriteTag(Tag::kArray);
+            auto &array = value.toArray();
+            WriteVarint(array.size());
+            for (auto &item : array) {
+                WriteItem(item);
+            }
+        } else if (value.isMap()) {
+            WriteTag(Tag::kMap);
+            auto &map = value.toMap();
+            WriteVarint(map.size());
+            for (auto &entry : map) {
+                WriteBytes(entry.first.data(), entry.first.size());
+                WriteItem(entry.second);
+            }
+        } else {
+            WriteTag(Tag::kNull);
+        }
+    }
+
+ private:
+    void WriteItem(const std::shared_ptr<KRRenderValue> &item) {
+        if (item) {
+            WriteValue(*item);
+        } else {
+            WriteTag(Tag::kNull);
+        }
+    }
+
+    std::vector<uint8_t> &out_;
+};
+
+class Reader {
+ public:
+    Reader(const uint8_t *data, size_t size) : cur_(data), end_(data + size) {}
+
+    bool AtEnd() const {
+        return cur_ == end_;
+    }
+
+    std::shared_ptr<KRRenderValue> ReadValue(int depth) {
+        if (depth > kMaxDepth || cur_ >= end_) {
+            return nullptr;
+        }
+        auto tag = static_cast<Tag>(*cur_++);
+        switch (tag) {
+        case Tag::kNull:
+            return std::make_shared<KRRenderValue>();
+        case Tag::kFalse:
+            return std::make_shared<KRRenderValue>(false);
+        case Tag::kTrue:
+            return std::make_shared<KRRenderValue>(true);
+        case Tag::kInt: {
+            uint64_t raw = 0;
+            if (!ReadVarint(raw)) {
+                return nullptr;
+            }
+            return std::make_shared<KRRenderValue>(static_cast<int32_t>(ZigZagDecode(raw)));
+        }
+        case Tag::kLong: {
+            uint64_t raw = 0;
+            if (!ReadVarint(raw)) {
+                return nullptr;
+            }
+            return std::make_shared<KRRenderValue>(ZigZagDecode(raw));
+        }
+        case Tag::kFloat: {
+            float value = 0;
+            if (!ReadFixed(value)) {
+                return nullptr;
+            }
+            return std::make_shared<KRRenderValue>(value);
+        }
+        case Tag::kDouble: {
+            double value = 0;
+            if (!ReadFixed(value)) {
+                return nullptr;
+            }
+            return std::make_shared<KRRenderValue>(value);
+        }
+        case Tag::kString: {
+            const uint8_t *data = nullptr;
+            size_t size = 0;
+            if (!ReadBytes(data, size)) {
+                return nullptr;
+            }
+            return std::make_shared<KRRenderValue>(std::string(reinterpret_cast<const char *>(data), size));
+        }
+        case Tag::kBytes: {
+            const uint8_t *data = nullptr;
+            size_t size = 0;
+            if (!ReadBytes(data, size)) {
+                return nullptr;
+            }
+            return std::make_shared<KRRenderValue>(std::make_shared<std::vector<uint8_t>>(data, data + size));
+        }
+        case Tag::kArray: {
+            uint64_t count = 0;
+            // 每个元素至少占 1 字节，提前拦截非法长度
+            if (!ReadVarint(count) || count > static_cast<uint64_t>(end_ - cur_)) {
+                return nullptr;
+            }
+            KRRenderValue::Array array;
+            array.reserve(count);
+            for (uint64_t i = 0; i < count; i++) {
+                auto item = ReadValue(depth + 1);
+                if (!item) {
+                    return nullptr;
+                }
+                array.push_back(std::move(item));
+            }
+            return std::make_shared<KRRenderValue>(array);
+        }
+        case Tag::kMap: {
+            uint64_t count = 0;
+            if (!ReadVarint(count) || count > static_cast<uint64_t>(end_ - cur_)) {
+                return nullptr;
+            }
+            KRRenderValue::Map map;
+            map.reserve(count);
+            for (uint64_t i = 0; i < count; i++) {
+                const uint8_t *key = nullptr;
+                size_t key_size = 0;
+                if (!ReadBytes(key, key_size)) {
+                    return nullptr;
+                }
+                auto item = ReadValue(depth + 1);
+                if (!item) {
+                    return nullptr;
+                }
+                map[std::string(reinterpret_cast<const char *>(key), key_size)] = std::move(item);
+            }
+            return std::make_shared<KRRenderValue>(map);
+        }
+        default:
+            return nullptr;
+        }
+    }
+
+ private:
+    bool ReadVarint(uint64_t &value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && cur_ < end_; shift += 7) {
+            uint8_t byte = *cur_++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename T> bool ReadFixed(T &value) {
+        if (static_cast<size_t>(end_ - cur_) < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, cur_, sizeof(T));
+        cur_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadBytes(const uint8_t *&data, size_t &size) {
+        uint64_t length = 0;
+        if (!ReadVarint(length) || length > static_cast<uint64_t>(end_ - cur_)) {
+            return false;
+        }
+        data = cur_;
+        size = static_cast<size_t>(length);
+        cur_ += size;
+        return true;
+    }
+
+    const uint8_t *cur_;
+    const uint8_t *end_;
+};
+
+}  // namespace
+
+void KRRenderValueCodec::SetEnabled(bool enabled) {
+    g_codec_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool KRRenderValueCodec::IsEnabled() {
+    return g_codec_enabled.load(std::memory_order_relaxed);
+}
+
+bool KRRenderValueCodec::IsEncoded(const uint8_t *data, size_t size) {
+    return data != nullptr && size > kHeaderSize && std::memcmp(data, kMagic, sizeof(kMagic)) == 0 &&
+           data[sizeof(kMagic)] == kVersion;
+}
+
+bool KRRenderValueCodec::IsEncodedArray(const uint8_t *data, size_t size) {
+    return IsEncoded(data, size) && data[kHeaderSize] == static_cast<uint8_t>(Tag::kArray);
+}
+
+void KRRenderValueCodec::Encode(const KRRenderValue &value, std::vector<uint8_t> &out) {
+    out.insert(out.end(), kMagic, kMagic + sizeof(kMagic));
+    out.push_back(kVersion);
+    Writer(out).WriteValue(value);
+}
+
+std::shared_ptr<KRRenderValue> KRRenderValueCodec::Decode(const uint8_t *data, size_t size) {
+    if (!IsEncoded(data, size)) {
+        return nullptr;
+    }
+    Reader reader(data + kHeaderSize, size - kHeaderSize);
+    auto value = reader.ReadValue(0);
+    if (!value || !reader.AtEnd()) {
+        return nullptr;
+    }
+    return value;
+}
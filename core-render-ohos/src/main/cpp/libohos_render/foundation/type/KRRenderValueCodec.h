@@ -0,0 +1,69 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERVALUECODEC_H
+#define CORE_RENDER_OHOS_KRRENDERVALUECODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class KRRenderValue;
+
+/**
+ * KRRenderValue 的 Map/Array 二进制编码，用于替代跨 kotlin 桥时的 json 序列化
+ * 编码结果通过 KRRenderCValue 的 ENCODED 类型传递（不从 BYTES 数据中嗅探），格式如下：
+ *   header: 'K' 'R' 'B' version(1 byte)
+ *   value : tag(1 byte) + payload
+ *     - 整数使用 zigzag varint，float/double 使用小端定长
+ *     - string/bytes 使用 varint 长度前缀 + 原始字节(UTF-8)
+ *     - array 为 varint 元素个数 + 逐个 value，map 为 varint 键值对个数 + (string key, value)
+ * 未开启二进制编码时（如对端为旧版本 core），仍使用 json 字符串通信
+ * kotlin 侧对应实现为 BinaryValueCodec
+ */
+class KRRenderValueCodec {
+ public:
+    static constexpr uint8_t kVersion = 1;
+    static constexpr size_t kHeaderSize = 4;
+
+    /**
+     * 是否在 toCValue 时对 Map/Array 使用二进制编码，默认关闭（兼容只认识 json 的 kotlin core）
+     */
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    /**
+     * 校验 header 及版本号，只用于校验 ENCODED 类型的数据，不能用来区分普通二进制数据
+     */
+    static bool IsEncoded(const uint8_t *data, size_t size);
+
+    /**
+     * 编码数据的根节点是否为 array，否则按 map 处理（ENCODED 只用于传递 map or array）
+     */
+    static bool IsEncodedArray(const uint8_t *data, size_t size);
+
+    /**
+     * 将 value 编码（包含 header）追加到 out 中
+     */
+    static void Encode(const KRRenderValue &value, std::vector<uint8_t> &out);
+
+    /**
+     * 解码数据，数据非法时返回 nullptr
+     */
+    static std::shared_ptr<KRRenderValue> Decode(const uint8_t *data, size_t size);
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERVALUECODEC_H
@@ -0,0 +1,90 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/type/KRRenderValuePool.h"
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// 每次获取最多探测的槽位数，避免被长期持有的对象拖慢查找
+constexpr size_t kMaxProbeCount = 8;
+
+struct KRRenderValueSlots {
+    std::vector<std::shared_ptr<KRRenderValue>> values;
+    size_t cursor = 0;
+
+    KRRenderValueSlots() {
+        values.reserve(KRRenderValuePool::kCapacity);
+    }
+};
+
+thread_local KRRenderValueSlots tls_slots;
+
+}  // namespace
+
+std::shared_ptr<KRRenderValue> KRRenderValuePool::Acquire(const KRRenderCValue &cValue) {
+    if (auto value = TakeIdle()) {
+        value->resetFromCValue(cValue);
+        return value;
+    }
+    auto value = std::make_shared<KRRenderValue>(cValue);
+    Track(value);
+    return value;
+}
+
+std::shared_ptr<KRRenderValue> KRRenderValuePool::AcquireString(const char *data, size_t size) {
+    auto value = TakeIdle();
+    if (!value) {
+        value = std::make_shared<KRRenderValue>();
+        Track(value);
+    }
+    value->resetFromString(data, size);
+    return value;
+}
+
+std::shared_ptr<KRRenderValue> KRRenderValuePool::TakeIdle() {
+    auto &slots = tls_slots;
+    for (size_t i = 0; i < kMaxProbeCount && !slots.values.empty(); ++i) {
+        if (slots.cursor >= slots.values.size()) {
+            slots.cursor = 0;
+        }
+        auto &value = slots.values[slots.cursor];
+        if (value.use_count() != 1) {
+            slots.cursor++;
+            continue;
+        }
+        // 与其他线程释放引用时的 release 语义配对，保证其对该对象的访问已全部完成
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (value->IsMarkedShared()) {
+            // 可能仍有 weak_ptr 引用，复用会让其 lock 到被改写的值，移出池并由末尾对象填补该槽位
+            std::swap(value, slots.values.back());
+            slots.values.pop_back();
+            continue;
+        }
+        slots.cursor++;
+        return value;
+    }
+    return nullptr;
+}
+
+void KRRenderValuePool::Track(const std::shared_ptr<KRRenderValue> &value) {
+    auto &slots = tls_slots;
+    if (slots.values.size() < kCapacity) {
+        slots.values.push_back(value);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERVALUEPOOL_H
+#define CORE_RENDER_OHOS_KRRENDERVALUEPOOL_H
+
+#include <memory>
+#include "libohos_render/foundation/type/KRRenderCValue.h"
+#include "libohos_render/foundation/type/KRRenderValue.h"
+
+/**
+ * Kotlin <-> Native 调用链路上的 KRRenderValue 复用池
+ * - 每个线程一个池，无锁；池中对象仅被池持有（use_count == 1）时才会被复用
+ * - 复用时原地重置，保留字符串等负载的内存，稳态下单次调用不再产生堆分配
+ * - 被业务长期持有的对象自然跳过，池中找不到空闲对象时退化为 make_shared
+ * - 只以 use_count 判断空闲，weak_ptr 不计入；需要以 weak_ptr 长期持有的对象应先调用 KRRenderValue::MarkShared，
+ *   被标记的对象空闲后移出池而不复用
+ */
+class KRRenderValuePool {
+ public:
+    /**
+     * 池容量上限，需覆盖单次调用的参数个数以及嵌套调用
+     */
+    static constexpr size_t kCapacity = 32;
+
+    /**
+     * 获取一个以 cValue 初始化的值，调用方释放引用后即归还到当前线程的池中
+     */
+    static std::shared_ptr<KRRenderValue> Acquire(const KRRenderCValue &cValue);
+
+    /**
+     * 获取一个字符串值，内容为 [data, data + size)
+     */
+    static std::shared_ptr<KRRenderValue> AcquireString(const char *data, size_t size);
+
+ private:
+    KRRenderValuePool() = default;
+
+    /**
+     * 取出当前线程池中的空闲对象，没有时返回 nullptr
+     */
+    static std::shared_ptr<KRRenderValue> TakeIdle();
+    /**
+     * 池未满时将新建对象加入池中
+     */
+    static void Track(const std::shared_ptr<KRRenderValue> &value);
+};
+
+#endif  // CORE_RENDER_OHOS_KRRENDERVALUEPOOL_H
@@ -60,18 +60,20 @@ class IKRRenderLayer {
     /**
      * 设置渲染视图属性
      * @param tag 视图 ID
+     * @param prop_id 属性 key 的 ID（KRPropKeys::IdOf），由桥接层计算一次后向下传递
      * @param propKey 属性 key
      * @param propValue 属性值
      */
-    virtual void SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) = 0;
+    virtual void SetProp(int tag, int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value) = 0;
 
     /**
      * 设置渲染视图事件
      * @param tag 视图 ID
+     * @param prop_id 属性 key 的 ID（KRPropKeys::IdOf）
      * @param propKey 属性 key
      * @param propValue 事件
      */
-    virtual void SetEvent(int tag, const std::string &prop_key, const KRRenderCallback &callback) = 0;
+    virtual void SetEvent(int tag, int32_t prop_id, const std::string &prop_key, const KRRenderCallback &callback) = 0;
 
     /**
      * 设置 view 对应的 shadow 对象
@@ -194,5 +196,12 @@ class IKRRenderLayer {
      * 销毁时调用，用于清理资源
      */
     virtual void OnDestroy() = 0;
+
+    /**
+     * 空闲时预创建可复用的view，默认不处理
+     * @param viewName 视图标签名字
+     * @param count 复用池中该类型的目标数量
+     */
+    virtual void PrewarmReusableViews(const std::string &view_name, int count) {}
 };
 #endif  // CORE_RENDER_OHOS_IKRRENDERLAYER_H
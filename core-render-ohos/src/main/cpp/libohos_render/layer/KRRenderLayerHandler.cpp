@@ -15,6 +15,8 @@
 
 #include "libohos_render/layer/KRRenderLayerHandler.h"
 
+#include <algorithm>
+
 /**
  * 初始化
  * @param rootView 渲染根容器view
@@ -36,6 +38,7 @@ void KRRenderLayerHandler::CreateRenderView(int tag, const std::string &view_nam
         // noop if the root view has been destroyed
         return;
     }
+    FlushRecyclingSubtrees();
     auto it = view_registry_.find(tag);
     if (it == view_registry_.end() || it->second == nullptr) {
         auto view = PopViewFromReuseQueue(view_name);
@@ -46,6 +49,9 @@ void KRRenderLayerHandler::CreateRenderView(int tag, const std::string &view_nam
                 view->SetViewName(view_name);
                 view->SetViewTag(tag);
                 view->ToInit();
+                if (view->ReuseEnable()) {
+                    view_reuse_pool_.RecordMiss();
+                }
             }else{
                 KR_LOG_ERROR << "Failed to create view with name:"<<view_name<<", tag:"<<tag;
             }
@@ -72,16 +78,18 @@ void KRRenderLayerHandler::RemoveRenderView(int tag) {
         return;
     }
 
-    view->ToRemoveFromSuperView();
+    if (!replaying_subtree_.nodes.empty()) {
+        EndReplayingSubtree();
+    }
     view_registry_.erase(it);
-    if (view->CanReuse()) {
-        PushViewToReuseQueue(view);  // 放入复用队列
-    } else {
-        // 触摸事件分发子系统涉及多个子系统，存在衔接问题，表现上5.0.0.102版本后比较容易出现节点析构后系统内部会因为事件派发出现crash，
-        // 这里暂时做个兜底，延缓两帧再销毁view，后续系统OK后再恢复回来。
-        KRContextScheduler::ScheduleTask(false, 32, [view]() {
-            KRContextScheduler::ScheduleTaskOnMainThread(false, [view]() { view->ToDestroy(); });
-        });
+    UntrackChild(view->GetParentTag(), tag);
+    if (!PushViewToReuseQueue(tag, view)) {  // 放入复用队列
+        view->ToRemoveFromSuperView();
+        DestroyViewLater(view);
+    }
+    // 正在回收的父view的子view记录保留到 FlushRecyclingSubtrees
+    if (recycling_parents_.count(tag) == 0) {
+        child_tags_.erase(tag);
     }
 }
 
@@ -92,43 +100,67 @@ void KRRenderLayerHandler::RemoveRenderView(int tag) {
  * @param index 插入的位置
  */
 void KRRenderLayerHandler::InsertSubRenderView(int parent_tag, int child_tag, int index) {
+    FlushRecyclingSubtrees();
     auto isRootViewTag = parent_tag == -1;
     auto &child_view = view_registry_[child_tag];
+    if (child_view != nullptr) {
+        UntrackChild(child_view->GetParentTag(), child_tag);
+    }
     if (isRootViewTag) {
         if (auto lock = root_view_.lock()) {
+            if (child_view != nullptr && child_view->HasSuperView()) {
+                child_view->ToRemoveFromSuperView();
+            }
             lock->AddContentView(child_view, index);
         }
     } else {
         auto &parent_view = view_registry_[parent_tag];
         if (parent_view != nullptr && child_view != nullptr) {
-            parent_view->ToInsertSubRenderView(child_view, index);
+            if (child_view->IsAttachedTo(parent_view)) {
+                // 复用子树中的子view，节点仍挂载在原位置
+                parent_view->ToReattachSubRenderView(child_view, index);
+            } else {
+                if (child_view->HasSuperView()) {
+                    child_view->ToRemoveFromSuperView();
+                }
+                parent_view->ToInsertSubRenderView(child_view, index);
+            }
+            child_tags_[parent_tag].insert(child_tag);
         }
     }
+    // 复用子树的根节点在其所有后代创建并插入后才会被插入，此时结束认领
+    if (!replaying_subtree_.nodes.empty() && child_view == replaying_subtree_.nodes[0].view) {
+        EndReplayingSubtree();
+    }
 }
 
 /**
  * 设置渲染视图属性
  * @param tag 视图 ID
+ * @param prop_id 属性 key 的 ID
  * @param propKey 属性 key
  * @param propValue 属性值
  */
-void KRRenderLayerHandler::SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) {
+void KRRenderLayerHandler::SetProp(int tag, int32_t prop_id, const std::string &prop_key,
+                                   const KRAnyValue &prop_value) {
     auto &view = view_registry_[tag];
     if (view != nullptr) {
-        view->ToSetProp(prop_key, prop_value, nullptr);
+        view->ToSetProp(prop_id, prop_key, prop_value, nullptr);
     }
 }
 
 /**
  * 设置渲染视图事件
  * @param tag 视图 ID
+ * @param prop_id 属性 key 的 ID
  * @param propKey 属性 key
  * @param propValue 事件
  */
-void KRRenderLayerHandler::SetEvent(int tag, const std::string &prop_key, const KRRenderCallback &callback) {
+void KRRenderLayerHandler::SetEvent(int tag, int32_t prop_id, const std::string &prop_key,
+                                    const KRRenderCallback &callback) {
     auto &view = view_registry_[tag];
     if (view != nullptr) {
-        view->ToSetProp(prop_key, nullptr, callback);
+        view->ToSetProp(prop_id, prop_key, nullptr, callback);
     }
 }
 
@@ -321,36 +353,251 @@ void KRRenderLayerHandler::OnDestroy() {
         module_registry_.clear();
     }
 
-    for (const auto &entry0 : view_reuse_queue_) {
-        for (const auto &entry1 : entry0.second) {
-            if (entry1) {
-                entry1->ToDestroy();
-            }
-        }
+    // 正在认领的子树中已被认领的view在 view_registry_ 中，已随之销毁
+    std::vector<KRViewReusePool::Subtree> removed = std::move(recycling_subtrees_);
+    recycling_subtrees_.clear();
+    recycling_parents_.clear();
+    child_tags_.clear();
+    if (!replaying_subtree_.nodes.empty()) {
+        auto &nodes = replaying_subtree_.nodes;
+        nodes.erase(nodes.begin(), nodes.begin() + replay_cursor_);
+        removed.push_back(std::move(replaying_subtree_));
+        replaying_subtree_ = KRViewReusePool::Subtree();
+        replay_cursor_ = 0;
+    }
+    view_reuse_pool_.Clear(&removed);
+    DestroySubtrees(removed, true);
+    DestroyPendingViewsNow();
+
+    auto stats = view_reuse_pool_.GetStats();
+    if (stats.hit_count + stats.miss_count > 0) {
+        KR_LOG_INFO << "view reuse hit: " << stats.hit_count << ", miss: " << stats.miss_count
+                    << ", subtree hit: " << stats.subtree_hit_count << ", full match: " << stats.full_match_count
+                    << ", eviction: " << stats.eviction_count << ", prewarm: " << stats.prewarm_count;
     }
-    view_reuse_queue_.clear();
+}
+
+void KRRenderLayerHandler::PrewarmReusableViews(const std::string &view_name, int count) {
+    // 每个主线程循环只创建一个，避免集中创建占用当前帧
+    std::weak_ptr<KRRenderLayerHandler> weak_self = shared_from_this();
+    KRMainThread::RunOnMainThreadForNextLoop([weak_self, view_name, count] {
+        auto self = weak_self.lock();
+        if (self == nullptr || self->destroying_ || self->root_view_.lock() == nullptr) {
+            return;
+        }
+        auto &pool = self->view_reuse_pool_;
+        auto target = std::min(static_cast<size_t>(std::max(count, 0)), pool.TypeCapacity(view_name));
+        if (pool.CountOf(view_name) >= target) {
+            return;
+        }
+        auto view = IKRRenderViewExport::CreateView(view_name);
+        if (view == nullptr) {
+            return;
+        }
+        view->SetRootView(self->root_view_, self->context_->InstanceId());
+        view->SetViewName(view_name);
+        view->ToInit();
+        if (!view->CanReuse()) {
+            view->ToDestroy();
+            return;
+        }
+        pool.RecordPrewarm();
+        std::vector<KRViewReusePool::Subtree> subtrees(1);
+        subtrees[0].nodes.push_back({view, view_name, 0});
+        self->PutSubtreesToReusePool(std::move(subtrees));
+        self->PrewarmReusableViews(view_name, count);
+    });
+}
+
+void KRRenderLayerHandler::SetViewReuseCapacity(const std::string &view_name, size_t max_subtree_count) {
+    std::vector<KRViewReusePool::Subtree> evicted;
+    view_reuse_pool_.SetTypeCapacity(view_name, max_subtree_count, &evicted);
+    DestroySubtrees(evicted, false);
+}
+
+KRViewReusePool::Stats KRRenderLayerHandler::GetViewReuseStats() const {
+    return view_reuse_pool_.GetStats();
 }
 /*** private ****/
 
 std::shared_ptr<IKRRenderViewExport> KRRenderLayerHandler::PopViewFromReuseQueue(const std::string &view_name) {
-    auto it = view_reuse_queue_.find(view_name);
-    if (it != view_reuse_queue_.end()) {
-        // 键存在，可以安全地访问元素
-        auto &queue = it->second;
-        if (!queue.empty()) {
-            auto view = queue.back();
-            queue.pop_back();
+    if (!replaying_subtree_.nodes.empty()) {
+        // Kotlin 侧按前序创建子树，依次认领子树中仍挂载着的后代
+        auto &nodes = replaying_subtree_.nodes;
+        if (replay_cursor_ < nodes.size() && nodes[replay_cursor_].view_name == view_name) {
+            auto view = nodes[replay_cursor_++].view;
+            view_reuse_pool_.RecordHit();
+            view->WillReuse();
             return view;
         }
+        EndReplayingSubtree();
     }
-    return nullptr;
+    KRViewReusePool::Subtree subtree;
+    if (!view_reuse_pool_.Pop(view_name, &subtree)) {
+        return nullptr;
+    }
+    view_reuse_pool_.RecordHit();
+    auto view = subtree.nodes[0].view;
+    if (subtree.nodes.size() > 1) {
+        replaying_subtree_ = std::move(subtree);
+        replay_cursor_ = 1;
+    }
+    view->WillReuse();
+    return view;
 }
 
-void KRRenderLayerHandler::PushViewToReuseQueue(std::shared_ptr<IKRRenderViewExport> view) {
-    auto view_name = view->GetViewName();
-    auto &queue = view_reuse_queue_[view_name];
+bool KRRenderLayerHandler::PushViewToReuseQueue(int tag, const std::shared_ptr<IKRRenderViewExport> &view) {
+    if (!view->CanReuse()) {
+        return false;
+    }
+    auto parent_it = recycling_parents_.find(view->GetParentTag());
+    if (parent_it != recycling_parents_.end() && view->HasSuperView()) {
+        // Kotlin 侧按前序删除子树，父view正在回收时保留挂载关系，记入同一子树
+        auto index = parent_it->second.first;
+        auto depth = parent_it->second.second + 1;
+        view->ToRecycleWithSuperView();
+        view->ToReuse();
+        recycling_subtrees_[index].nodes.push_back({view, view->GetViewName(), depth});
+        if (!view->IsLeafNode()) {
+            recycling_parents_[tag] = std::make_pair(index, depth);
+        }
+        return true;
+    }
+    view->ToRemoveFromSuperView();
     view->ToReuse();
-    queue.push_back(view);
+    KRViewReusePool::Subtree subtree;
+    subtree.nodes.push_back({view, view->GetViewName(), 0});
+    recycling_subtrees_.push_back(std::move(subtree));
+    if (!view->IsLeafNode()) {
+        recycling_parents_[tag] = std::make_pair(recycling_subtrees_.size() - 1, 0);
+    }
+    return true;
+}
+
+void KRRenderLayerHandler::FlushRecyclingSubtrees() {
+    DetachRemainingChildren();
+    recycling_parents_.clear();
+    if (recycling_subtrees_.empty()) {
+        return;
+    }
+    auto subtrees = std::move(recycling_subtrees_);
+    recycling_subtrees_.clear();
+    PutSubtreesToReusePool(std::move(subtrees));
+}
+
+void KRRenderLayerHandler::DetachRemainingChildren() {
+    // 同一轮中被删除的子view已随父view记入子树并从 child_tags_ 中移除，剩下的没有被删除（如稍后会移到别处），
+    // 不属于回收的子树，需从正在回收的父view上摘下，否则会随父view一起进入复用池
+    for (const auto &parent : recycling_parents_) {
+        auto children_it = child_tags_.find(parent.first);
+        if (children_it == child_tags_.end()) {
+            continue;
+        }
+        for (auto child_tag : children_it->second) {
+            auto view_it = view_registry_.find(child_tag);
+            if (view_it == view_registry_.end() || view_it->second == nullptr) {
+                continue;
+            }
+            auto &view = view_it->second;
+            if (view->HasSuperView() && view->GetParentTag() == parent.first) {
+                view->ToRemoveFromSuperView();
+            }
+        }
+        child_tags_.erase(children_it);
+    }
+}
+
+void KRRenderLayerHandler::UntrackChild(int parent_tag, int child_tag) {
+    auto it = child_tags_.find(parent_tag);
+    if (it == child_tags_.end()) {
+        return;
+    }
+    it->second.erase(child_tag);
+    if (it->second.empty()) {
+        child_tags_.erase(it);
+    }
+}
+
+void KRRenderLayerHandler::EndReplayingSubtree() {
+    auto &nodes = replaying_subtree_.nodes;
+    if (replay_cursor_ >= nodes.size()) {
+        view_reuse_pool_.DidFullyMatch(nodes[0].view_name, replaying_subtree_.key);
+    } else {
+        // 未被认领的部分按前序拆成若干棵独立子树，从原父节点上摘下后放回复用池
+        std::vector<KRViewReusePool::Subtree> rest;
+        size_t i = replay_cursor_;
+        while (i < nodes.size()) {
+            auto base_depth = nodes[i].depth;
+            nodes[i].view->ToRemoveFromSuperView();
+            KRViewReusePool::Subtree subtree;
+            do {
+                subtree.nodes.push_back({std::move(nodes[i].view), std::move(nodes[i].view_name),
+                                         nodes[i].depth - base_depth});
+                ++i;
+            } while (i < nodes.size() && nodes[i].depth > base_depth);
+            rest.push_back(std::move(subtree));
+        }
+        PutSubtreesToReusePool(std::move(rest));
+    }
+    replaying_subtree_ = KRViewReusePool::Subtree();
+    replay_cursor_ = 0;
+}
+
+void KRRenderLayerHandler::PutSubtreesToReusePool(std::vector<KRViewReusePool::Subtree> subtrees) {
+    std::vector<KRViewReusePool::Subtree> evicted;
+    for (auto &subtree : subtrees) {
+        view_reuse_pool_.Put(std::move(subtree), &evicted);
+    }
+    DestroySubtrees(evicted, false);
+}
+
+void KRRenderLayerHandler::DestroySubtrees(std::vector<KRViewReusePool::Subtree> &subtrees, bool immediately) {
+    for (auto &subtree : subtrees) {
+        // 先销毁后代，再销毁根节点
+        for (auto it = subtree.nodes.rbegin(); it != subtree.nodes.rend(); ++it) {
+            if (it->view == nullptr) {
+                continue;
+            }
+            if (immediately) {
+                it->view->ToDestroy();
+            } else {
+                DestroyViewLater(it->view);
+            }
+        }
+    }
+    subtrees.clear();
+}
+
+void KRRenderLayerHandler::DestroyViewLater(const std::shared_ptr<IKRRenderViewExport> &view) {
+    // 触摸事件分发子系统涉及多个子系统，存在衔接问题，表现上5.0.0.102版本后比较容易出现节点析构后系统内部会因为事件派发出现crash，
+    // 这里暂时做个兜底，延缓两帧再销毁view，后续系统OK后再恢复回来。
+    std::weak_ptr<KRRenderLayerHandler> weak_self = shared_from_this();
+    auto tag = view->GetViewTag();
+    auto timer_id = KRContextScheduler::ScheduleTask(false, 32, [weak_self, view, tag]() {
+        KRContextScheduler::ScheduleTaskOnMainThread(false, [weak_self, view, tag]() {
+            if (auto self = weak_self.lock()) {
+                auto range = self->pending_destroys_.equal_range(tag);
+                for (auto it = range.first; it != range.second; ++it) {
+                    if (it->second.view == view) {
+                        self->pending_destroys_.erase(it);
+                        break;
+                    }
+                }
+            }
+            view->ToDestroy();
+        });
+    });
+    pending_destroys_.emplace(tag, PendingDestroy{timer_id, view});
+}
+
+void KRRenderLayerHandler::DestroyPendingViewsNow() {
+    for (auto &entry : pending_destroys_) {
+        // 取消失败说明已在派发到主线程的途中，由该任务负责销毁
+        if (KRContextScheduler::CancelTask(entry.second.timer_id)) {
+            entry.second.view->ToDestroy();
+        }
+    }
+    pending_destroys_.clear();
 }
 
 std::shared_ptr<IKRRenderModuleExport> KRRenderLayerHandler::GetModuleOrCreate(const std::string &module_name) {
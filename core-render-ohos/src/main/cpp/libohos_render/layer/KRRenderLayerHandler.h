@@ -17,10 +17,13 @@
 #define CORE_RENDER_OHOS_KRRENDERLAYERHANDLER_H
 
 #include <shared_mutex>
+#include <unordered_set>
 #include "libohos_render/context/KRRenderContextParams.h"
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
 #include "libohos_render/layer/IKRRenderLayer.h"
+#include "libohos_render/layer/KRViewReusePool.h"
 
-class KRRenderLayerHandler : public IKRRenderLayer {
+class KRRenderLayerHandler : public IKRRenderLayer, public std::enable_shared_from_this<KRRenderLayerHandler> {
  public:
     KRRenderLayerHandler() {}
     /**
@@ -53,18 +56,20 @@ class KRRenderLayerHandler : public IKRRenderLayer {
     /**
      * 设置渲染视图属性
      * @param tag 视图 ID
+     * @param prop_id 属性 key 的 ID（KRPropKeys::IdOf），由桥接层计算一次后向下传递
      * @param propKey 属性 key
      * @param propValue 属性值
      */
-    void SetProp(int tag, const std::string &prop_key, const KRAnyValue &prop_value) override;
+    void SetProp(int tag, int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value) override;
 
     /**
      * 设置渲染视图事件
      * @param tag 视图 ID
+     * @param prop_id 属性 key 的 ID（KRPropKeys::IdOf）
      * @param propKey 属性 key
      * @param propValue 事件
      */
-    void SetEvent(int tag, const std::string &prop_key, const KRRenderCallback &callback) override;
+    void SetEvent(int tag, int32_t prop_id, const std::string &prop_key, const KRRenderCallback &callback) override;
 
     /**
      * 设置 view 对应的 shadow 对象
@@ -181,20 +186,62 @@ class KRRenderLayerHandler : public IKRRenderLayer {
 
     std::shared_ptr<IKRRenderModuleExport> GetModuleOrCreate(const std::string &name);
 
+    /**
+     * 空闲时预创建可复用的view
+     * @param viewName 视图标签名字
+     * @param count 复用池中该类型的目标数量（不超过该类型的容量上限）
+     */
+    void PrewarmReusableViews(const std::string &view_name, int count) override;
+
+    /**
+     * 设置某类型view在复用池中可缓存的子树数，0 表示不复用
+     */
+    void SetViewReuseCapacity(const std::string &view_name, size_t max_subtree_count);
+
+    KRViewReusePool::Stats GetViewReuseStats() const;
+
  private:
     std::shared_ptr<KRRenderContextParams> context_;
     std::weak_ptr<IKRRenderView> root_view_;
-    std::unordered_map<std::string, std::vector<std::shared_ptr<IKRRenderViewExport>>> view_reuse_queue_;
+    KRViewReusePool view_reuse_pool_;
+    // 本轮删除中正在回收的子树，收到后续创建/插入操作时放入复用池
+    std::vector<KRViewReusePool::Subtree> recycling_subtrees_;
+    // 正在回收的非叶子view：旧 tag -> (所在子树下标, 深度)
+    std::unordered_map<int, std::pair<size_t, int>> recycling_parents_;
+    // 父view tag -> 插入其下的子view tag，回收父view时据此找到未被删除的子view
+    std::unordered_map<int, std::unordered_set<int>> child_tags_;
+    // 正在按前序认领的复用子树，nodes[0, replay_cursor_) 已被认领
+    KRViewReusePool::Subtree replaying_subtree_;
+    size_t replay_cursor_ = 0;
     std::unordered_map<int, std::shared_ptr<IKRRenderViewExport>> view_registry_;
     std::unordered_map<std::string, std::shared_ptr<IKRRenderModuleExport>> module_registry_;
     std::unordered_map<int, std::shared_ptr<IKRRenderShadowExport>> shadow_registry_;
     mutable std::shared_mutex module_rw_mutex_;  // 用于module读写安全用的读写锁
     bool destroying_ = false;
-
-    /** 从复用队列中弹出一个view */
+    struct PendingDestroy {
+        KRTimerId timer_id;
+        std::shared_ptr<IKRRenderViewExport> view;
+    };
+    // 延迟销毁中、定时器尚未到期的view，以 view tag 为 key（预创建后未被使用过的view没有 tag，可能重复），只在主线程访问
+    std::unordered_multimap<int, PendingDestroy> pending_destroys_;
+
+    /** 从复用池中取出一个view，优先认领正在复用的子树中的下一个后代 */
     std::shared_ptr<IKRRenderViewExport> PopViewFromReuseQueue(const std::string &view_name);
-    /** 把view放进复用队列里复用 */
-    void PushViewToReuseQueue(std::shared_ptr<IKRRenderViewExport> view);
+    /** 回收被删除的view，其父view正在回收时保留挂载关系并记入同一子树 */
+    bool PushViewToReuseQueue(int tag, const std::shared_ptr<IKRRenderViewExport> &view);
+    /** 把本轮回收的子树放入复用池 */
+    void FlushRecyclingSubtrees();
+    /** 摘下正在回收的父view下未被删除的子view */
+    void DetachRemainingChildren();
+    /** 子view离开父view时移除 child_tags_ 中的记录 */
+    void UntrackChild(int parent_tag, int child_tag);
+    /** 结束子树认领，未被认领的部分拆成独立子树放回复用池 */
+    void EndReplayingSubtree();
+    void PutSubtreesToReusePool(std::vector<KRViewReusePool::Subtree> subtrees);
+    void DestroySubtrees(std::vector<KRViewReusePool::Subtree> &subtrees, bool immediately);
+    void DestroyViewLater(const std::shared_ptr<IKRRenderViewExport> &view);
+    /** 取消延迟销毁的定时器并立即销毁，页面销毁时调用 */
+    void DestroyPendingViewsNow();
 };
 
 #endif  // CORE_RENDER_OHOS_KRRENDERLAYERHANDLER_H
@@ -0,0 +1,155 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/layer/KRViewReusePool.h"
+
+#include <utility>
+
+std::string KRViewReusePool::MakeReuseKey(const std::vector<Node> &nodes) {
+    std::string key;
+    for (const auto &node : nodes) {
+        key.append(std::to_string(node.depth));
+        key.push_back(':');
+        key.append(node.view_name);
+        key.push_back(';');
+    }
+    return key;
+}
+
+void KRViewReusePool::Put(Subtree subtree, std::vector<Subtree> *evicted) {
+    if (subtree.nodes.empty()) {
+        return;
+    }
+    if (subtree.key.empty()) {
+        subtree.key = MakeReuseKey(subtree.nodes);
+    }
+    auto &bucket = buckets_[subtree.nodes[0].view_name];
+    auto capacity = bucket.has_capacity ? bucket.capacity : max_subtree_count_per_type_;
+    if (capacity == 0) {
+        stats_.eviction_count += subtree.nodes.size();
+        if (evicted) {
+            evicted->push_back(std::move(subtree));
+        }
+        return;
+    }
+    view_count_ += subtree.nodes.size();
+    lru_list_.push_front(std::move(subtree));
+    bucket.entries.push_back(lru_list_.begin());
+    TrimType(bucket, capacity, evicted);
+    TrimTo(max_view_count_, evicted);
+}
+
+bool KRViewReusePool::Pop(const std::string &view_name, Subtree *subtree) {
+    auto it = buckets_.find(view_name);
+    if (it == buckets_.end() || it->second.entries.empty()) {
+        return false;
+    }
+    auto &bucket = it->second;
+    auto &entries = bucket.entries;
+    // 默认取最近放入的，若有与上次完整匹配相同结构的子树则优先取出
+    size_t index = entries.size() - 1;
+    if (!bucket.preferred_key.empty()) {
+        for (size_t i = entries.size(); i-- > 0;) {
+            if (entries[i]->key == bucket.preferred_key) {
+                index = i;
+                break;
+            }
+        }
+    }
+    Erase(bucket, index, subtree, false);
+    if (subtree->nodes.size() > 1) {
+        stats_.subtree_hit_count++;
+    }
+    return true;
+}
+
+void KRViewReusePool::DidFullyMatch(const std::string &view_name, const std::string &key) {
+    buckets_[view_name].preferred_key = key;
+    stats_.full_match_count++;
+}
+
+void KRViewReusePool::SetTypeCapacity(const std::string &view_name, size_t max_subtree_count,
+                                      std::vector<Subtree> *evicted) {
+    auto &bucket = buckets_[view_name];
+    bucket.capacity = max_subtree_count;
+    bucket.has_capacity = true;
+    TrimType(bucket, max_subtree_count, evicted);
+}
+
+size_t KRViewReusePool::TypeCapacity(const std::string &view_name) const {
+    auto it = buckets_.find(view_name);
+    if (it != buckets_.end() && it->second.has_capacity) {
+        return it->second.capacity;
+    }
+    return max_subtree_count_per_type_;
+}
+
+size_t KRViewReusePool::CountOf(const std::string &view_name) const {
+    auto it = buckets_.find(view_name);
+    return it == buckets_.end() ? 0 : it->second.entries.size();
+}
+
+void KRViewReusePool::TrimTo(size_t max_view_count, std::vector<Subtree> *evicted) {
+    while (view_count_ > max_view_count && !lru_list_.empty()) {
+        // 各类型内部按放入先后排列，全局最久的子树必然位于其类型队列的头部
+        auto &bucket = buckets_[lru_list_.back().nodes[0].view_name];
+        Subtree subtree;
+        Erase(bucket, 0, &subtree, true);
+        if (evicted) {
+            evicted->push_back(std::move(subtree));
+        }
+    }
+}
+
+void KRViewReusePool::Clear(std::vector<Subtree> *removed) {
+    if (removed) {
+        for (auto &subtree : lru_list_) {
+            removed->push_back(std::move(subtree));
+        }
+    }
+    lru_list_.clear();
+    for (auto &entry : buckets_) {
+        entry.second.entries.clear();
+    }
+    view_count_ = 0;
+}
+
+KRViewReusePool::Stats KRViewReusePool::GetStats() const {
+    Stats stats = stats_;
+    stats.subtree_count = lru_list_.size();
+    stats.view_count = view_count_;
+    return stats;
+}
+
+void KRViewReusePool::Erase(TypeBucket &bucket, size_t index, Subtree *out, bool evict) {
+    auto it = bucket.entries[index];
+    view_count_ -= it->nodes.size();
+    if (evict) {
+        stats_.eviction_count += it->nodes.size();
+    }
+    *out = std::move(*it);
+    lru_list_.erase(it);
+    bucket.entries.erase(bucket.entries.begin() + index);
+}
+
+void KRViewReusePool::TrimType(TypeBucket &bucket, size_t capacity, std::vector<Subtree> *evicted) {
+    while (bucket.entries.size() > capacity) {
+        Subtree subtree;
+        Erase(bucket, 0, &subtree, true);
+        if (evicted) {
+            evicted->push_back(std::move(subtree));
+        }
+    }
+}
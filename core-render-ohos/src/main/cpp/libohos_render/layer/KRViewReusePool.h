@@ -0,0 +1,147 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRVIEWREUSEPOOL_H
+#define CORE_RENDER_OHOS_KRVIEWREUSEPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class IKRRenderViewExport;
+
+/**
+ * 可复用 view 子树池，只做记账，不直接操作 view，由 KRRenderLayerHandler 在主线程使用
+ * - 回收单元为子树：根节点及仍挂在其下的可复用后代（叶子 view 即只有根节点的子树）
+ * - 子树以结构签名（前序的深度与 view 名）作为复用 key，按根 view 名取出，优先取该类型上次完整匹配的结构
+ * - 同时限制每种类型的子树数与池内 view 总数，超出时按 LRU 淘汰，被淘汰的子树交由调用方销毁
+ */
+class KRViewReusePool {
+ public:
+    struct Node {
+        std::shared_ptr<IKRRenderViewExport> view;
+        std::string view_name;
+        int depth = 0;  // 相对子树根节点的深度
+    };
+
+    struct Subtree {
+        std::string key;
+        std::vector<Node> nodes;  // 前序排列，nodes[0] 为根节点
+    };
+
+    struct Stats {
+        uint64_t hit_count = 0;           // 从池中取得的 view 数（包括子树中被认领的后代）
+        uint64_t miss_count = 0;          // 池中无可用 view 而新建的次数
+        uint64_t subtree_hit_count = 0;   // 取出的子树根节点带有后代的次数
+        uint64_t full_match_count = 0;    // 取出的子树被完整认领的次数
+        uint64_t eviction_count = 0;      // 被淘汰的 view 数
+        uint64_t prewarm_count = 0;       // 预创建的 view 数
+        size_t subtree_count = 0;
+        size_t view_count = 0;
+
+        double HitRate() const {
+            auto total = hit_count + miss_count;
+            return total == 0 ? 0 : static_cast<double>(hit_count) / total;
+        }
+    };
+
+    static constexpr size_t kDefaultMaxViewCount = 512;
+    static constexpr size_t kDefaultMaxSubtreeCountPerType = 32;
+
+    explicit KRViewReusePool(size_t max_view_count = kDefaultMaxViewCount,
+                             size_t max_subtree_count_per_type = kDefaultMaxSubtreeCountPerType)
+        : max_view_count_(max_view_count), max_subtree_count_per_type_(max_subtree_count_per_type) {}
+
+    KRViewReusePool(const KRViewReusePool &) = delete;
+    KRViewReusePool &operator=(const KRViewReusePool &) = delete;
+
+    /**
+     * 生成子树的复用 key
+     */
+    static std::string MakeReuseKey(const std::vector<Node> &nodes);
+
+    /**
+     * 放入子树（key 为空时自动生成），超出容量时淘汰的子树追加到 evicted
+     */
+    void Put(Subtree subtree, std::vector<Subtree> *evicted);
+
+    /**
+     * 按根 view 名取出子树，无可用子树返回 false
+     */
+    bool Pop(const std::string &view_name, Subtree *subtree);
+
+    /**
+     * 子树被完整认领后调用，之后同类型优先取出相同结构的子树
+     */
+    void DidFullyMatch(const std::string &view_name, const std::string &key);
+
+    void RecordHit(size_t count = 1) {
+        stats_.hit_count += count;
+    }
+    void RecordMiss() {
+        stats_.miss_count++;
+    }
+    void RecordPrewarm() {
+        stats_.prewarm_count++;
+    }
+
+    /**
+     * 设置某类型可缓存的子树数，0 表示该类型不缓存；未设置的类型使用默认值
+     */
+    void SetTypeCapacity(const std::string &view_name, size_t max_subtree_count, std::vector<Subtree> *evicted);
+
+    size_t TypeCapacity(const std::string &view_name) const;
+
+    /**
+     * 某类型当前缓存的子树数
+     */
+    size_t CountOf(const std::string &view_name) const;
+
+    /**
+     * 按 LRU 淘汰，直到池内 view 总数不超过 max_view_count
+     */
+    void TrimTo(size_t max_view_count, std::vector<Subtree> *evicted);
+
+    void Clear(std::vector<Subtree> *removed);
+
+    Stats GetStats() const;
+
+ private:
+    using EntryList = std::list<Subtree>;
+
+    struct TypeBucket {
+        std::deque<EntryList::iterator> entries;  // 按放入先后排列，尾部为最近放入
+        std::string preferred_key;
+        size_t capacity = 0;
+        bool has_capacity = false;
+    };
+
+    void Erase(TypeBucket &bucket, size_t index, Subtree *out, bool evict);
+    void TrimType(TypeBucket &bucket, size_t capacity, std::vector<Subtree> *evicted);
+
+    size_t max_view_count_;
+    size_t max_subtree_count_per_type_;
+    size_t view_count_ = 0;
+    EntryList lru_list_;  // 头部为最近放入
+    std::unordered_map<std::string, TypeBucket> buckets_;
+    Stats stats_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRVIEWREUSEPOOL_H
@@ -0,0 +1,212 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/manager/KRInstanceTable.h"
+
+#include <cstring>
+#include <thread>
+#include "libohos_render/utils/KRRenderLoger.h"
+
+namespace {
+
+constexpr uint64_t kIndexMask = 0xFFFFFFFFull;
+constexpr size_t kResolveCacheSize = 8;
+
+struct KRResolveCacheEntry {
+    std::string instance_id;
+    KRInstanceHandle handle = kInvalidInstanceHandle;
+};
+
+// 多实例交替调用时按轮转替换
+struct KRResolveCache {
+    KRResolveCacheEntry entries[kResolveCacheSize];
+    size_t next = 0;
+};
+
+thread_local KRResolveCache tls_resolve_cache;
+
+}  // namespace
+
+KRInstanceTable &KRInstanceTable::GetInstance() {
+    static KRInstanceTable instance;
+    return instance;
+}
+
+KRInstanceTable::KRInstanceTable() {
+    free_slots_.reserve(kCapacity);
+    for (size_t i = kCapacity; i > 0; --i) {
+        free_slots_.push_back(static_cast<uint32_t>(i - 1));
+    }
+}
+
+KRInstanceHandle KRInstanceTable::Acquire(const std::string &instance_id) {
+    KRScopedSpinLock lock(&lock_);
+    auto it = handle_map_.find(instance_id);
+    if (it != handle_map_.end()) {
+        return it->second;
+    }
+    if (free_slots_.empty()) {
+        KR_LOG_ERROR << "instance table is full, instance: " << instance_id;
+        return kInvalidInstanceHandle;
+    }
+    auto index = free_slots_.back();
+    free_slots_.pop_back();
+    auto &slot = slots_[index];
+    KRInstanceHandle handle = (static_cast<uint64_t>(slot.generation) << 32) | (index + 1);
+    slot.handle.store(handle, std::memory_order_release);
+    handle_map_.emplace(instance_id, handle);
+    return handle;
+}
+
+void KRInstanceTable::Release(const std::string &instance_id) {
+    // 在锁外析构，避免对象析构时重入
+    std::shared_ptr<KRRenderView> render_view;
+    std::shared_ptr<IKRRenderNativeContextHandler> context_handler;
+    KRScopedSpinLock lock(&lock_);
+    auto it = handle_map_.find(instance_id);
+    if (it == handle_map_.end()) {
+        return;
+    }
+    auto index = static_cast<uint32_t>((it->second & kIndexMask) - 1);
+    handle_map_.erase(it);
+    Write(slots_[index], [&](Slot &slot) {
+        slot.handle.store(kInvalidInstanceHandle, std::memory_order_release);
+        ++slot.generation;
+        slot.has_render_view.store(false, std::memory_order_relaxed);
+        render_view = std::move(slot.render_view);
+        context_handler = std::move(slot.context_handler);
+    });
+    free_slots_.push_back(index);
+}
+
+KRInstanceHandle KRInstanceTable::Find(const std::string &instance_id) const {
+    KRScopedSpinLock lock(&lock_);
+    auto it = handle_map_.find(instance_id);
+    return it != handle_map_.end() ? it->second : kInvalidInstanceHandle;
+}
+
+KRInstanceHandle KRInstanceTable::Resolve(const char *instance_id) const {
+    if (instance_id == nullptr) {
+        return kInvalidInstanceHandle;
+    }
+    auto &cache = tls_resolve_cache;
+    for (auto &entry : cache.entries) {
+        if (IsAlive(entry.handle) && std::strcmp(entry.instance_id.c_str(), instance_id) == 0) {
+            return entry.handle;
+        }
+    }
+    auto &entry = cache.entries[cache.next];
+    entry.instance_id.assign(instance_id);
+    entry.handle = Find(entry.instance_id);
+    cache.next = (cache.next + 1) % kResolveCacheSize;
+    return entry.handle;
+}
+
+bool KRInstanceTable::IsAlive(KRInstanceHandle handle) const {
+    auto slot = SlotOf(handle);
+    return slot != nullptr && slot->handle.load(std::memory_order_acquire) == handle;
+}
+
+const KRInstanceTable::Slot *KRInstanceTable::SlotOf(KRInstanceHandle handle) const {
+    auto index = handle & kIndexMask;
+    if (index == 0 || index > kCapacity) {
+        return nullptr;
+    }
+    return &slots_[index - 1];
+}
+
+KRInstanceTable::Slot *KRInstanceTable::SlotOf(KRInstanceHandle handle) {
+    return const_cast<Slot *>(static_cast<const KRInstanceTable *>(this)->SlotOf(handle));
+}
+
+template <typename F> bool KRInstanceTable::Read(KRInstanceHandle handle, F &&reader) const {
+    auto slot = SlotOf(handle);
+    if (slot == nullptr || slot->handle.load(std::memory_order_acquire) != handle) {
+        return false;
+    }
+    while (true) {
+        // 与 Write 中 writing / readers 的读写构成 Dekker 式同步，需 seq_cst
+        slot->readers.fetch_add(1, std::memory_order_seq_cst);
+        if (!slot->writing.load(std::memory_order_seq_cst)) {
+            break;
+        }
+        slot->readers.fetch_sub(1, std::memory_order_release);
+        while (slot->writing.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+    bool alive = slot->handle.load(std::memory_order_acquire) == handle;
+    if (alive) {
+        reader(*slot);
+    }
+    slot->readers.fetch_sub(1, std::memory_order_release);
+    return alive;
+}
+
+template <typename F> void KRInstanceTable::Write(Slot &slot, F &&writer) {
+    slot.writing.store(true, std::memory_order_seq_cst);
+    while (slot.readers.load(std::memory_order_seq_cst) != 0) {
+        std::this_thread::yield();
+    }
+    writer(slot);
+    slot.writing.store(false, std::memory_order_release);
+}
+
+void KRInstanceTable::SetRenderView(KRInstanceHandle handle, const std::shared_ptr<KRRenderView> &render_view) {
+    std::shared_ptr<KRRenderView> old_value;  // 在锁外析构
+    KRScopedSpinLock lock(&lock_);
+    auto slot = SlotOf(handle);
+    if (slot != nullptr && slot->handle.load(std::memory_order_relaxed) == handle) {
+        Write(*slot, [&](Slot &target) {
+            old_value = std::move(target.render_view);
+            target.render_view = render_view;
+            target.has_render_view.store(render_view != nullptr, std::memory_order_release);
+        });
+    }
+}
+
+void KRInstanceTable::SetContextHandler(KRInstanceHandle handle,
+                                        const std::shared_ptr<IKRRenderNativeContextHandler> &handler) {
+    std::shared_ptr<IKRRenderNativeContextHandler> old_value;  // 在锁外析构
+    KRScopedSpinLock lock(&lock_);
+    auto slot = SlotOf(handle);
+    if (slot != nullptr && slot->handle.load(std::memory_order_relaxed) == handle) {
+        Write(*slot, [&](Slot &target) {
+            old_value = std::move(target.context_handler);
+            target.context_handler = handler;
+        });
+    }
+}
+
+std::shared_ptr<KRRenderView> KRInstanceTable::GetRenderView(KRInstanceHandle handle) const {
+    std::shared_ptr<KRRenderView> render_view;
+    Read(handle, [&](const Slot &slot) { render_view = slot.render_view; });
+    return render_view;
+}
+
+std::shared_ptr<IKRRenderNativeContextHandler> KRInstanceTable::GetContextHandler(KRInstanceHandle handle) const {
+    std::shared_ptr<IKRRenderNativeContextHandler> handler;
+    Read(handle, [&](const Slot &slot) { handler = slot.context_handler; });
+    return handler;
+}
+
+bool KRInstanceTable::HasRenderView(KRInstanceHandle handle) const {
+    auto slot = SlotOf(handle);
+    if (slot == nullptr || !slot->has_render_view.load(std::memory_order_acquire)) {
+        return false;
+    }
+    // 回收时先使句柄失效，再次校验可排除读取期间被回收或复用的情况
+    return slot->handle.load(std::memory_order_acquire) == handle;
+}
@@ -0,0 +1,120 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRINSTANCETABLE_H
+#define CORE_RENDER_OHOS_KRINSTANCETABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "libohos_render/utils/KRScopedSpinLock.h"
+
+class KRRenderView;
+class IKRRenderNativeContextHandler;
+
+/**
+ * 页面实例句柄，高 32 位为代数，低 32 位为槽位下标 + 1，0 为无效句柄
+ * 实例销毁后槽位代数递增，旧句柄查询失败，可据此发现销毁后的访问
+ */
+using KRInstanceHandle = uint64_t;
+constexpr KRInstanceHandle kInvalidInstanceHandle = 0;
+
+/**
+ * 页面实例槽位表，按句柄查找 render view 与 context handler
+ * - 句柄在首次登记实例（创建 KRRenderView 或注册 context handler）时分配，实例销毁时回收
+ * - 回收的槽位按后进先出复用，复用时代数已递增，新旧句柄低 32 位相同而高 32 位不同，旧句柄不会命中新实例
+ * - 同时存活的实例最多 kCapacity 个，超出时 Acquire 返回 kInvalidInstanceHandle 并记错误日志，
+ *   该实例的 view 与 context handler 不会登记，按句柄查找均返回空；有实例销毁后新实例可再次分配
+ * - 按句柄查找不加锁：读方只登记槽位读者计数并校验代数，读方之间互不阻塞；写方（登记、回收）等待读者退出后再修改
+ * - 实例 id 到句柄的映射加锁，调用线程通过 Resolve 的线程内缓存避开该锁与字符串哈希
+ */
+class KRInstanceTable {
+ public:
+    static constexpr size_t kCapacity = 1024;
+
+    static KRInstanceTable &GetInstance();
+
+    KRInstanceTable(const KRInstanceTable &) = delete;
+    KRInstanceTable &operator=(const KRInstanceTable &) = delete;
+
+    /**
+     * 获取实例句柄，已登记时返回原句柄，未登记时分配新句柄；槽位耗尽时返回 kInvalidInstanceHandle
+     */
+    KRInstanceHandle Acquire(const std::string &instance_id);
+
+    /**
+     * 回收实例句柄，之后该句柄的查询均失败
+     */
+    void Release(const std::string &instance_id);
+
+    /**
+     * 按实例 id 查找句柄，未登记时返回 kInvalidInstanceHandle
+     */
+    KRInstanceHandle Find(const std::string &instance_id) const;
+
+    /**
+     * 按实例 id 查找句柄，优先命中当前线程最近使用的句柄，供 Kotlin call native 热路径使用
+     */
+    KRInstanceHandle Resolve(const char *instance_id) const;
+
+    bool IsAlive(KRInstanceHandle handle) const;
+
+    void SetRenderView(KRInstanceHandle handle, const std::shared_ptr<KRRenderView> &render_view);
+    void SetContextHandler(KRInstanceHandle handle, const std::shared_ptr<IKRRenderNativeContextHandler> &handler);
+
+    /**
+     * 句柄失效或对应对象未设置时返回 nullptr
+     */
+    std::shared_ptr<KRRenderView> GetRenderView(KRInstanceHandle handle) const;
+    std::shared_ptr<IKRRenderNativeContextHandler> GetContextHandler(KRInstanceHandle handle) const;
+    bool HasRenderView(KRInstanceHandle handle) const;
+
+ private:
+    struct Slot {
+        std::atomic<KRInstanceHandle> handle{kInvalidInstanceHandle};
+        mutable std::atomic<uint32_t> readers{0};
+        std::atomic<bool> writing{false};
+        std::atomic<bool> has_render_view{false};  // 供 HasRenderView 免登记读者快速判断
+        uint32_t generation = 0;
+        // 读方在 Read 内访问，写方在 Write 内修改
+        std::shared_ptr<KRRenderView> render_view;
+        std::shared_ptr<IKRRenderNativeContextHandler> context_handler;
+    };
+
+    KRInstanceTable();
+
+    const Slot *SlotOf(KRInstanceHandle handle) const;
+    Slot *SlotOf(KRInstanceHandle handle);
+
+    /**
+     * 句柄有效时在读者计数保护下执行 reader，返回句柄是否有效
+     */
+    template <typename F> bool Read(KRInstanceHandle handle, F &&reader) const;
+    /**
+     * 等待槽位读者全部退出后执行 writer，需持有 lock_
+     */
+    template <typename F> static void Write(Slot &slot, F &&writer);
+
+    Slot slots_[kCapacity];
+    mutable KRSpinLock lock_;  // 保护以下成员，仅在实例创建、销毁以及 Resolve 未命中时使用
+    std::vector<uint32_t> free_slots_;
+    std::unordered_map<std::string, KRInstanceHandle> handle_map_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRINSTANCETABLE_H
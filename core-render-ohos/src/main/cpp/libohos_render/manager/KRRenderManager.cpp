@@ -20,6 +20,7 @@
 #include "libohos_render/expand/events/KREventDispatchCenter.h"
 #include "libohos_render/expand/modules/ModulesRegisterEntry.h"
 #include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/manager/KRInstanceTable.h"
 #include "libohos_render/utils/KRRenderLoger.h"
 #include "libohos_render/utils/KRViewUtil.h"
 #include "libohos_render/utils/KRScopedSpinLock.h"
@@ -84,6 +85,8 @@ bool KRRenderManager::SetRenderView(std::string &instanceId, std::shared_ptr<KRR
     KRScopedSpinLock lock(&render_view_map_lock_);
     if (render_view_map_.find(instanceId) == render_view_map_.end()) {
         render_view_map_[instanceId] = renderView;
+        auto &table = KRInstanceTable::GetInstance();
+        table.SetRenderView(table.Acquire(instanceId), renderView);
         return true;
     }
     return false;
@@ -107,6 +110,7 @@ void KRRenderManager::DestroyRenderViewCallBack(const std::string &instanceId) {
             render_view_map_.erase(instanceId);
         }
     }
+    KRInstanceTable::GetInstance().Release(instanceId);
     {
         KRScopedSpinLock lock(&launch_init_time_map_lock_);
         if (launch_init_time_map_.find(instanceId) != launch_init_time_map_.end()) {
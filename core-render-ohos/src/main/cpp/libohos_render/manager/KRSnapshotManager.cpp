@@ -19,132 +19,204 @@
 #include <arkui/native_interface.h>
 #include <arkui/native_node.h>
 #include <arkui/native_node_napi.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
 #include <multimedia/image_framework/image_packer_mdk.h>
 #include <multimedia/image_framework/image_pixel_map_mdk.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 
 #include "libohos_render/expand/components/view/KRView.h"
 #include "libohos_render/foundation/KRCommon.h"
 #include "libohos_render/foundation/ark_ts.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
 #include "libohos_render/scheduler/KRContextScheduler.h"
 #include "libohos_render/utils/KRBase64Util.h"
+#include "libohos_render/utils/KRRenderLoger.h"
 
-constexpr static int TIME_TO_REMOVE_SNAPSHOT_DRAWABLE_MS = 100;  // remove the cached drawable after 6 frames
-constexpr static int MAX_DELAY_DURATION_MS = 1000;
+constexpr static size_t MAX_SNAPSHOT_CACHE_COST = 32 * 1024 * 1024;
+constexpr static size_t MAX_SNAPSHOT_CACHE_COUNT = 256;
+constexpr static char PNG_MIME_TYPE[] = "image/png";
 
-static void DisposeItem(struct KRSnapshotItem *item) {
-    if (item) {
-        if (item->drawableDescriptor) {
-            OH_ArkUI_DrawableDescriptor_Dispose(item->drawableDescriptor);
-            item->drawableDescriptor = nullptr;
+KRSnapshotItem::~KRSnapshotItem() {
+    if (drawableDescriptor) {
+        OH_ArkUI_DrawableDescriptor_Dispose(drawableDescriptor);
+        drawableDescriptor = nullptr;
+    }
+}
+
+/**
+ * 像素是否预乘 alpha；类型未知时按组件截图的预乘像素处理，不透明像素无需还原
+ */
+static bool IsPremultiplied(napi_env env, napi_value pixelMap) {
+    int32_t alphaType = PIXELMAP_ALPHA_TYPE_UNKNOWN;
+    OH_PixelmapNative *pixelmap = nullptr;
+    if (OH_PixelmapNative_ConvertPixelmapNativeFromNapi(env, pixelMap, &pixelmap) == IMAGE_SUCCESS && pixelmap) {
+        OH_Pixelmap_ImageInfo *info = nullptr;
+        if (OH_PixelmapImageInfo_Create(&info) == IMAGE_SUCCESS) {
+            if (OH_PixelmapNative_GetImageInfo(pixelmap, info) == IMAGE_SUCCESS) {
+                OH_PixelmapImageInfo_GetAlphaType(info, &alphaType);
+            }
+            OH_PixelmapImageInfo_Release(info);
         }
-        item->uri = "";
+        OH_PixelmapNative_Release(pixelmap);
     }
+    return alphaType != PIXELMAP_ALPHA_TYPE_OPAQUE && alphaType != PIXELMAP_ALPHA_TYPE_UNPREMULTIPLIED;
 }
 
-KRSnapshotManager::~KRSnapshotManager() {
-    std::for_each(drawableDescriptorCache_.begin(), drawableDescriptorCache_.end(),
-                  [](auto desc) { DisposeItem(&desc.second); });
-    drawableDescriptorCache_.clear();
+/**
+ * 在主线程拷贝 PixelMap 的像素，之后的编码与 napi 无关，可放到后台线程
+ */
+static bool ReadPixels(napi_env env, napi_value pixelMap, KRRawImage &image) {
+    NativePixelMap *nativePixelMap = OH_PixelMap_InitNativePixelMap(env, pixelMap);
+    if (nativePixelMap == nullptr) {
+        return false;
+    }
+    OhosPixelMapInfos info;
+    if (OH_PixelMap_GetImageInfo(nativePixelMap, &info) != IMAGE_RESULT_SUCCESS ||
+        info.pixelFormat != OHOS_PIXEL_MAP_FORMAT_RGBA_8888 || info.width == 0 || info.height == 0 ||
+        info.rowSize < info.width * 4) {
+        return false;
+    }
+    void *addr = nullptr;
+    if (OH_PixelMap_AccessPixels(nativePixelMap, &addr) != IMAGE_RESULT_SUCCESS || addr == nullptr) {
+        return false;
+    }
+    image.width = info.width;
+    image.height = info.height;
+    image.row_bytes = info.rowSize;
+    image.bgra = false;
+    image.premultiplied = IsPremultiplied(env, pixelMap);
+    image.pixels.resize(static_cast<size_t>(info.rowSize) * info.height);
+    memcpy(image.pixels.data(), addr, image.pixels.size());
+    OH_PixelMap_UnAccessPixels(nativePixelMap);
+    return true;
 }
 
-void KRSnapshotManager::CacheSnapshot(ArkUI_DrawableDescriptor *descriptor, const std::string &key) {
-    auto item = drawableDescriptorCache_.find(key);
-    if (item != drawableDescriptorCache_.end()) {
-        DisposeItem(&item->second);
+// 无法读取像素时的兜底：在主线程由系统编码写入文件
+static bool PackToFileOnMainThread(napi_env env, napi_value pixelMap, const std::string &path) {
+    int fd = open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
     }
+    struct ImagePacker_Opts_ opts;
+    opts.format = PNG_MIME_TYPE;
+    opts.quality = 80;
+    napi_value packer;
+    OH_ImagePacker_Create(env, &packer);
+    ImagePacker_Native *imagePacker = OH_ImagePacker_InitNative(env, packer);
+    int err = OH_ImagePacker_PackToFile(imagePacker, pixelMap, &opts, fd);
+    OH_ImagePacker_Release(imagePacker);
+    close(fd);
+    return err == 0;
+}
 
-    if (descriptor) {
-        struct KRSnapshotItem item;
-        item.drawableDescriptor = descriptor;
-        drawableDescriptorCache_[key] = item;
-    } else {
-        drawableDescriptorCache_.erase(key);
+KRSnapshotManager::KRSnapshotManager() : drawableDescriptorCache_(MAX_SNAPSHOT_CACHE_COST, MAX_SNAPSHOT_CACHE_COUNT) {}
+
+KRSnapshotManager::~KRSnapshotManager() {
+    drawableDescriptorCache_.Clear();
+}
+
+void KRSnapshotManager::CacheSnapshot(ArkUI_DrawableDescriptor *descriptor, const std::string &key) {
+    if (descriptor == nullptr) {
+        drawableDescriptorCache_.Remove(key);
+        return;
     }
+    auto item = std::make_shared<KRSnapshotItem>();
+    item->drawableDescriptor = descriptor;
+    // 磁盘副本就绪前 drawable 可能已设置到节点上，pin 住且不计入开销，避免被淘汰释放
+    drawableDescriptorCache_.Put(key, item, 0);
+    drawableDescriptorCache_.Pin(key);
 }
 
 void KRSnapshotManager::UpdateSnapshot(const std::string &uri, const std::string &key) {
-    auto item = drawableDescriptorCache_.find(key);
-    if (item != drawableDescriptorCache_.end()) {
-        if (item->second.drawableDescriptor) {
-            OH_ArkUI_DrawableDescriptor_Dispose(item->second.drawableDescriptor);
-            item->second.drawableDescriptor = nullptr;
-        }
-        item->second.uri = uri;
+    // 磁盘副本就绪后只保留 uri，释放内存中的 drawable
+    auto item = std::make_shared<KRSnapshotItem>();
+    item->uri = uri;
+    drawableDescriptorCache_.Put(key, item, key.size() + uri.size());
+    drawableDescriptorCache_.Unpin(key);
+}
+
+void KRSnapshotManager::KeepSnapshotInMemory(const std::string &key, size_t byteCount) {
+    // 没有磁盘副本，drawable 按像素字节数计入开销，之后可以被淘汰
+    auto item = drawableDescriptorCache_.Peek(key);
+    if (item == nullptr) {
+        return;
     }
+    drawableDescriptorCache_.Put(key, *item, std::max<size_t>(byteCount, 1));
+    drawableDescriptorCache_.Unpin(key);
 }
 
 void KRSnapshotManager::SetCachedSnapshotToNode(ArkUI_NodeHandle node, const std::string &key) {
-    auto item = drawableDescriptorCache_.find(key);
-    if (item != drawableDescriptorCache_.end()) {
-        if (item->second.uri.length() > 0) {
-            // when uri become valid, the cached drawable descriptor must had been disposed
-            kuikly::util::SetArkUIImageSrc(node, item->second.uri);
-            return;
-        }
-        if (item->second.drawableDescriptor) {
-            // FIXME: using drawable would cause memory leak.
-            // Looks lie the internal pixelmap is retained somewhere by the system internally
-            kuikly::util::SetArkUIImageSrc(node, item->second.drawableDescriptor);
-            return;
-        }
+    auto item = drawableDescriptorCache_.Get(key);
+    if (item == nullptr || *item == nullptr) {
+        return;
+    }
+    if ((*item)->uri.length() > 0) {
+        // when uri become valid, the cached drawable descriptor must had been disposed
+        kuikly::util::SetArkUIImageSrc(node, (*item)->uri);
+        return;
+    }
+    if ((*item)->drawableDescriptor) {
+        // FIXME: using drawable would cause memory leak.
+        // Looks lie the internal pixelmap is retained somewhere by the system internally
+        kuikly::util::SetArkUIImageSrc(node, (*item)->drawableDescriptor);
     }
 }
 
-struct KRSnapshotManager::ResultData KRSnapshotManager::ProcessSnapshotResultWithDataType(
-    napi_env env, napi_value pixelMap, const std::string &path, const std::string &pathUri,
-    ArkUI_DrawableDescriptor *drawableDescriptorPtr, std::weak_ptr<IKRRenderViewExport> weak_view) {
-    struct ResultData resultData;
-    NativePixelMap *nativePixelMap = OH_PixelMap_InitNativePixelMap(env, pixelMap);
-    OhosPixelMapInfos info;
-    OH_PixelMap_GetImageInfo(nativePixelMap, &info);
-    struct ImagePacker_Opts_ opts;
-    opts.format = "image/png";
-    opts.quality = 80;
-
-    size_t size = info.width * info.height * 4;
-    uint8_t *outData = reinterpret_cast<uint8_t *>(malloc(size));
+void KRSnapshotManager::EncodePngInBackground(KRRawImage image, int level, const std::string &path,
+                                              const std::function<void(std::string png)> &callback) {
+    auto shared_image = std::make_shared<KRRawImage>(std::move(image));
+    KRGCDQueue::GetInstance().DispatchAsync([shared_image, level, path, callback] {
+        auto png = std::make_shared<std::string>();
+        if (!KRPngEncoder::EncodeToFile(*shared_image, level, path, *png)) {
+            KR_LOG_ERROR << "snapshot encode failed: " << path;
+        }
+        shared_image->pixels = std::vector<uint8_t>();
+        KRMainThread::RunOnMainThread([png, callback] { callback(std::move(*png)); });
+    });
+}
 
-    napi_value packer;
-    OH_ImagePacker_Create(env, &packer);
-    ImagePacker_Native *imagePacker = OH_ImagePacker_InitNative(env, packer);
-    int err = OH_ImagePacker_PackToData(imagePacker, pixelMap, &opts, outData, &size);
-    OH_ImagePacker_Release(imagePacker);
-    if (err == 0) {
-        std::string_view imageData((const char *)outData, size);
-        std::string base64Data = KRBase64Util::Encode(imageData);
-        std::stringstream base64ImageSS;
-        base64ImageSS << "data:" << opts.format << ";base64," << base64Data;
-        resultData.data = base64ImageSS.str();
-        resultData.code = 0;
+void KRSnapshotManager::InvokeCallback(const KRRenderCallback &callback, const ResultData &resultData) {
+    if (!callback) {
+        return;
     }
-    free(outData);
-    return resultData;
+    KRRenderValue::Map resultMap;
+    resultMap["code"] = std::make_shared<KRRenderValue>(resultData.code);
+    if (resultData.code == 0) {
+        resultMap["data"] = std::make_shared<KRRenderValue>(resultData.data);
+    } else {
+        resultMap["message"] = std::make_shared<KRRenderValue>(resultData.message);
+    }
+    callback(std::make_shared<KRRenderValue>(resultMap));
 }
 
-void KRSnapshotManager::RemoveCachedDrawableAfterDelay(int delayMS, const std::string &key, const std::string &path,
-                                                       const std::string &pathUri,
-                                                       std::weak_ptr<IKRRenderViewExport> weak_view) {
-    KRContextScheduler::ScheduleTask(false, delayMS, [delayMS, weak_view, path, pathUri, key]() {
-        if (access(path.c_str(), F_OK) == 0) {
-            KRContextScheduler::ScheduleTaskOnMainThread(false, [delayMS, weak_view, pathUri, key] {
-                if (auto strong_view = weak_view.lock()) {
-                    if (auto strong_root = strong_view->GetRootView().lock()) {
-                        auto snapshotManager = strong_root->GetSnapshotManager();
-                        snapshotManager->UpdateSnapshot(pathUri, key);
-                    }
-                }
-            });
-        } else if (delayMS < MAX_DELAY_DURATION_MS) {
-            auto strongView = weak_view.lock();
-            if (strongView == nullptr) {
-                return;
-            }
-            if (auto root = strongView->GetRootView().lock()) {
-                auto snapshotManager = root->GetSnapshotManager();
-                snapshotManager->RemoveCachedDrawableAfterDelay(delayMS * 2, key, path, pathUri, weak_view);
-            }
+void KRSnapshotManager::ProcessSnapshotResultWithDataType(napi_env env, napi_value pixelMap,
+                                                          const KRRenderCallback &callback) {
+    KRRawImage image;
+    if (!ReadPixels(env, pixelMap, image)) {
+        struct ResultData resultData;
+        resultData.message = "ERROR: FAILED TO READ SNAPSHOT PIXELS";
+        InvokeCallback(callback, resultData);
+        return;
+    }
+    // 压缩与 base64 编码耗时与像素数成正比，放到后台线程，避免阻塞主线程
+    EncodePngInBackground(std::move(image), KRPngEncoder::kLevelDefault, "", [callback](std::string png) {
+        struct ResultData resultData;
+        if (png.empty()) {
+            resultData.message = "ERROR: FAILED TO ENCODE SNAPSHOT";
+        } else {
+            std::string base64Data = KRBase64Util::Encode(std::string_view(png));
+            std::string dataUri;
+            dataUri.reserve(base64Data.size() + 32);
+            dataUri.append("data:").append(PNG_MIME_TYPE).append(";base64,").append(base64Data);
+            resultData.data = std::move(dataUri);
+            resultData.code = 0;
         }
+        InvokeCallback(callback, resultData);
     });
 }
 
@@ -155,15 +227,33 @@ struct KRSnapshotManager::ResultData KRSnapshotManager::ProcessSnapshotResultWit
     std::stringstream kss;
     kss << "data:image_Md5_Pixelmap" << drawableDescriptorPtr;
     std::string key = kss.str();
-    if (auto strong_view = weak_view.lock()) {
-        if (auto strong_root = strong_view->GetRootView().lock()) {
-            auto snapshotManager = strong_root->GetSnapshotManager();
-            snapshotManager->CacheSnapshot(drawableDescriptorPtr, key);
-            // users would typically use the result immediately,
-            // keep the drawable for a while, and remove it after the disk copy is ready
-            snapshotManager->RemoveCachedDrawableAfterDelay(TIME_TO_REMOVE_SNAPSHOT_DRAWABLE_MS, key, path, pathUri,
-                                                            weak_view);
-        }
+
+    KRRawImage image;
+    bool hasPixels = ReadPixels(env, pixelMap, image);
+    // users would typically use the result immediately,
+    // keep the drawable until the disk copy is ready
+    CacheSnapshot(drawableDescriptorPtr, key);
+    if (hasPixels) {
+        size_t byteCount = image.pixels.size();
+        // 磁盘副本只在本机使用，优先编码速度
+        EncodePngInBackground(std::move(image), KRPngEncoder::kLevelFast, path,
+                              [weak_view, pathUri, key, byteCount](std::string png) {
+                                  auto strong_view = weak_view.lock();
+                                  auto strong_root = strong_view ? strong_view->GetRootView().lock() : nullptr;
+                                  if (strong_root == nullptr) {
+                                      return;
+                                  }
+                                  auto snapshotManager = strong_root->GetSnapshotManager();
+                                  if (png.empty()) {
+                                      snapshotManager->KeepSnapshotInMemory(key, byteCount);
+                                  } else {
+                                      snapshotManager->UpdateSnapshot(pathUri, key);
+                                  }
+                              });
+    } else if (PackToFileOnMainThread(env, pixelMap, path)) {
+        UpdateSnapshot(pathUri, key);
+    } else {
+        KeepSnapshotInMemory(key, 0);
     }
     resultData.data = key;
     resultData.code = 0;
@@ -221,36 +311,28 @@ void KRSnapshotManager::TakeSnapshot(const std::string &instance_id, const std::
                     if (auto root = strongView->GetRootView().lock()) {
                         auto snapshotManager = root->GetSnapshotManager();
                         if (type == "dataUri") {
-                            resultData = snapshotManager->ProcessSnapshotResultWithDataType(
-                                env, pixelMap, "", "", drawableDescriptorPtr, weak_view);
-                        } else {
-                            napi_value path = arkTs.GetObjectProperty(snapshotData, "path");
-                            pathStr = arkTs.GetString(path);
-                            napi_value uri = arkTs.GetObjectProperty(snapshotData, "pathURI");
-                            pathURI = arkTs.GetString(uri);
-                            if (type == "cacheKey") {
-                                resultData = snapshotManager->ProcessSnapshotResultWithCacheKeyType(
-                                    env, pixelMap, pathStr, pathURI, drawableDescriptorPtr, weak_view);
-                            } else if (type == "file") {
-                                resultData = snapshotManager->ProcessSnapshotResultWithFileType(
-                                    env, pixelMap, pathStr, pathURI, drawableDescriptorPtr, weak_view);
-                            }
+                            // 编码完成后异步回调
+                            snapshotManager->ProcessSnapshotResultWithDataType(env, pixelMap, callback);
+                            return;
+                        }
+                        napi_value path = arkTs.GetObjectProperty(snapshotData, "path");
+                        pathStr = arkTs.GetString(path);
+                        napi_value uri = arkTs.GetObjectProperty(snapshotData, "pathURI");
+                        pathURI = arkTs.GetString(uri);
+                        if (type == "cacheKey") {
+                            resultData = snapshotManager->ProcessSnapshotResultWithCacheKeyType(
+                                env, pixelMap, pathStr, pathURI, drawableDescriptorPtr, weak_view);
+                        } else if (type == "file") {
+                            resultData = snapshotManager->ProcessSnapshotResultWithFileType(
+                                env, pixelMap, pathStr, pathURI, drawableDescriptorPtr, weak_view);
                         }
                     }
                 }
-                KRRenderValue::Map resultMap;
-                resultMap["code"] = std::make_shared<KRRenderValue>(resultData.code);
-                if (resultData.code == 0) {
-                    resultMap["data"] = std::make_shared<KRRenderValue>(resultData.data);
-                } else {
-                    resultMap["message"] = std::make_shared<KRRenderValue>(resultData.message);
-                }
-                callback(std::make_shared<KRRenderValue>(resultMap));
+                KRSnapshotManager::InvokeCallback(callback, resultData);
             } else {
-                KRRenderValue::Map resultMap;
-                resultMap["code"] = std::make_shared<KRRenderValue>(-1);
-                resultMap["message"] = std::make_shared<KRRenderValue>("invalid result from arkts");
-                callback(std::make_shared<KRRenderValue>(resultMap));
+                KRSnapshotManager::ResultData resultData;
+                resultData.message = "invalid result from arkts";
+                KRSnapshotManager::InvokeCallback(callback, resultData);
             }
         };
         KRArkTSManager::GetInstance().CallArkTSMethod(
@@ -16,19 +16,30 @@
 #ifndef CORE_RENDER_OHOS_KRSNAPSHOTMANAGER_H
 #define CORE_RENDER_OHOS_KRSNAPSHOTMANAGER_H
 #include <arkui/drawable_descriptor.h>
+#include <functional>
+#include <memory>
 #include <string>
-#include <unordered_map>
 #include "libohos_render/expand/components/view/KRView.h"
 #include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRLRUCache.h"
+#include "libohos_render/utils/KRPngEncoder.h"
 
+/**
+ * 缓存的快照，drawableDescriptor 与 uri 二选一；析构时释放 drawableDescriptor
+ */
 struct KRSnapshotItem {
     KRSnapshotItem() : drawableDescriptor(nullptr) {}
+    ~KRSnapshotItem();
+    KRSnapshotItem(const KRSnapshotItem &) = delete;
+    KRSnapshotItem &operator=(const KRSnapshotItem &) = delete;
+
     ArkUI_DrawableDescriptor *drawableDescriptor;
     std::string uri;
 };
 
 class KRSnapshotManager {
  public:
+    KRSnapshotManager();
     ~KRSnapshotManager();
 
     void SetCachedSnapshotToNode(ArkUI_NodeHandle node, const std::string &key);
@@ -36,17 +47,23 @@ class KRSnapshotManager {
                       const KRAnyValue &params, const KRRenderCallback &cb,
                       std::weak_ptr<IKRRenderViewExport> weak_view);
 
+    /**
+     * 在后台线程编码 PNG，完成后在主线程回调，失败时 png 为空
+     * @param path 非空时同时写入该文件（先写临时文件再重命名）
+     */
+    static void EncodePngInBackground(KRRawImage image, int level, const std::string &path,
+                                      const std::function<void(std::string png)> &callback);
+
  private:
     struct ResultData {
-        int code;
+        int code = -1;
         std::string data;
         std::string message;
     };
 
-    struct ResultData ProcessSnapshotResultWithDataType(napi_env env, napi_value pixelMap, const std::string &path,
-                                                        const std::string &pathUri,
-                                                        ArkUI_DrawableDescriptor *drawableDescriptorPtr,
-                                                        std::weak_ptr<IKRRenderViewExport> weak_view);
+    static void InvokeCallback(const KRRenderCallback &callback, const ResultData &resultData);
+
+    void ProcessSnapshotResultWithDataType(napi_env env, napi_value pixelMap, const KRRenderCallback &callback);
     struct ResultData ProcessSnapshotResultWithCacheKeyType(napi_env env, napi_value pixelMap, const std::string &path,
                                                             const std::string &pathUri,
                                                             ArkUI_DrawableDescriptor *drawableDescriptorPtr,
@@ -56,12 +73,15 @@ class KRSnapshotManager {
                                                         ArkUI_DrawableDescriptor *drawableDescriptorPtr,
                                                         std::weak_ptr<IKRRenderViewExport> weak_view);
 
+    // 缓存待落盘的 drawable，落盘完成前保持 pin
     void CacheSnapshot(ArkUI_DrawableDescriptor *descriptor, const std::string &key);
+    // 落盘成功，以 uri 替换 drawable
     void UpdateSnapshot(const std::string &uri, const std::string &key);
-    void RemoveCachedDrawableAfterDelay(int delayMS, const std::string &key, const std::string &path,
-                                        const std::string &pathUri, std::weak_ptr<IKRRenderViewExport> weak_view);
+    // 落盘失败，解除 pin 并按像素字节数计入开销
+    void KeepSnapshotInMemory(const std::string &key, size_t byteCount);
 
-    std::unordered_map<std::string, struct KRSnapshotItem> drawableDescriptorCache_;
+    // 只在主线程访问；待落盘的 drawable 被 pin 且不计开销，已落盘的只记 uri
+    KRLRUCache<std::string, std::shared_ptr<KRSnapshotItem>> drawableDescriptorCache_;
 };
 
 #endif  // CORE_RENDER_OHOS_KRSNAPSHOTMANAGER_H
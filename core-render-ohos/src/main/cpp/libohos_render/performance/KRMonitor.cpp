@@ -15,6 +15,8 @@
 
 #include "libohos_render/performance/KRMonitor.h"
 
+#include <chrono>
+
 KRMonitor::KRMonitor() {}
 
 KRMonitor::~KRMonitor() {}
@@ -32,4 +34,11 @@ void KRMonitor::OnResume() {}
 void KRMonitor::OnPause() {}
 
 void KRMonitor::OnDestroy() {}
-void KRMonitor::SetArkLaunchTime(int64_t timestamp) {}
\ No newline at end of file
+void KRMonitor::OnUITasksWillPerform() {}
+void KRMonitor::OnUITasksDidPerform() {}
+void KRMonitor::SetArkLaunchTime(int64_t timestamp) {}
+
+int64_t KRMonitor::SteadyClockMicros() {
+    auto now = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+}
@@ -16,8 +16,15 @@
 #ifndef CORE_RENDER_OHOS_KRMONITOR_H
 #define CORE_RENDER_OHOS_KRMONITOR_H
 
+#include <cstdint>
+#include <functional>
 #include <string>
 
+/**
+ * 单调时钟，返回微秒；监控类可注入自定义时钟便于测试
+ */
+using KRMonitorClock = std::function<int64_t()>;
+
 /**
  * 采集监控数据基类
  */
@@ -36,8 +43,14 @@ class KRMonitor {
     virtual void OnResume();
     virtual void OnPause();
     virtual void OnDestroy();
+    /** 主线程一批UI任务执行前后回调 */
+    virtual void OnUITasksWillPerform();
+    virtual void OnUITasksDidPerform();
     virtual std::string GetMonitorData() = 0;
     virtual void SetArkLaunchTime(int64_t timestamp);
     //    virtual void OnRenderException();
+
+    /** 默认时钟：steady_clock 微秒 */
+    static int64_t SteadyClockMicros();
 };
 #endif  // CORE_RENDER_OHOS_KRMONITOR_H
@@ -24,6 +24,7 @@ constexpr char kKeyIsFirstPageLaunch[] = "isFirstLaunchOfPage";
 constexpr char kKeyMainFPS[] = "mainFPS";
 constexpr char kKeyKotlinFPS[] = "kotlinFPS";
 constexpr char kKeyMemory[] = "memory";
+constexpr char kKeyFrame[] = "frame";
 constexpr char kKeyPageLoadTime[] = "pageLoadTime";
 
 KRPerformanceData::KRPerformanceData(std::string page_name, int excute_mode, int spent_time, bool is_cold_launch,
@@ -31,13 +32,29 @@ KRPerformanceData::KRPerformanceData(std::string page_name, int excute_mode, int
     : page_name_(page_name), excute_mode_(excute_mode), spent_time_(spent_time), is_cold_launch_(is_cold_launch),
       is_page_cold_launch_(is_page_cold_launch), launch_data_(launch_data) {}
 
+void KRPerformanceData::SetFrameData(std::string frame_data) {
+    frame_data_ = std::move(frame_data);
+}
+
+void KRPerformanceData::SetMemoryData(std::string memory_data) {
+    memory_data_ = std::move(memory_data);
+}
+
 std::string KRPerformanceData::ToJsonString() {
     cJSON *performance_data = cJSON_CreateObject();
     cJSON_AddNumberToObject(performance_data, kKeyMode, excute_mode_);
     cJSON_AddNumberToObject(performance_data, kKeyPageExistTime, spent_time_);
     cJSON_AddBoolToObject(performance_data, kKeyIsFirstPageProcess, is_cold_launch_);
     cJSON_AddBoolToObject(performance_data, kKeyIsFirstPageLaunch, is_page_cold_launch_);
-    cJSON_AddStringToObject(performance_data, kKeyPageLoadTime, launch_data_.c_str());
+    if (!launch_data_.empty()) {
+        cJSON_AddStringToObject(performance_data, kKeyPageLoadTime, launch_data_.c_str());
+    }
+    if (!frame_data_.empty()) {
+        cJSON_AddStringToObject(performance_data, kKeyFrame, frame_data_.c_str());
+    }
+    if (!memory_data_.empty()) {
+        cJSON_AddStringToObject(performance_data, kKeyMemory, memory_data_.c_str());
+    }
     std::string result = cJSON_Print(performance_data);
     cJSON_Delete(performance_data);
     return result;
@@ -25,6 +25,8 @@ class KRPerformanceData {
  public:
     KRPerformanceData(std::string page_name, int excute_mode, int spent_time, bool is_cold_launch,
                       bool is_page_cold_launch, std::string lanch_data);
+    void SetFrameData(std::string frame_data);
+    void SetMemoryData(std::string memory_data);
     std::string ToJsonString();
 
  private:
@@ -34,5 +36,7 @@ class KRPerformanceData {
     bool is_page_cold_launch_;
     int excute_mode_;
     std::string launch_data_ = "{}";
+    std::string frame_data_;   //  帧监控未开启时为空
+    std::string memory_data_;  //  内存监控未开启时为空
 };
 #endif  // CORE_RENDER_OHOS_KRPERFORMANCEDATA_H
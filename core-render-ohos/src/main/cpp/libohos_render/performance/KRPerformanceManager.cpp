@@ -32,6 +32,12 @@ KRPerformanceManager::KRPerformanceManager(int performance_monitor_types_mask, s
         auto launch_monitor = std::make_shared<KRLaunchMonitor>();
         monitors_[KRLaunchMonitor::kMonitorName] = launch_monitor;
     }
+    if (performance_monitor_types_mask_ & kMonitorTypeFrame) {
+        monitors_[KRFrameMonitor::kMonitorName] = std::make_shared<KRFrameMonitor>();
+    }
+    if (performance_monitor_types_mask_ & kMonitorTypeMemory) {
+        monitors_[KRMemoryMonitor::kMonitorName] = std::make_shared<KRMemoryMonitor>();
+    }
     auto it = std::find(page_record_.begin(), page_record_.end(), page_name_);
     if (it == page_record_.end()) {  //  页面未曾加载过
         is_page_cold_launch = true;
@@ -102,8 +108,27 @@ void KRPerformanceManager::OnPageCreateFinish(KRPageCreateTrace &trace) {  //  K
         OnLaunchResult();
     }
 }
-void KRPerformanceManager::OnResume() {}
-void KRPerformanceManager::OnPause() {}
+void KRPerformanceManager::OnResume() {
+    for (const auto &monitor : monitors_) {
+        monitor.second->OnResume();
+    }
+}
+void KRPerformanceManager::OnPause() {
+    for (const auto &monitor : monitors_) {
+        monitor.second->OnPause();
+    }
+}
+
+void KRPerformanceManager::OnUITasksWillPerform() {
+    for (const auto &monitor : monitors_) {
+        monitor.second->OnUITasksWillPerform();
+    }
+}
+void KRPerformanceManager::OnUITasksDidPerform() {
+    for (const auto &monitor : monitors_) {
+        monitor.second->OnUITasksDidPerform();
+    }
+}
 
 void KRPerformanceManager::OnDestroy() {
     for (auto &monitor: monitors_) {
@@ -127,24 +152,31 @@ std::string KRPerformanceManager::GetLaunchData() {  //  收集启动数据
 }
 
 std::string KRPerformanceManager::GetPerformanceData() {  //  收集所有性能数据
-    auto monitor = GetMonitor(KRLaunchMonitor::kMonitorName);
-    if (monitor) {
-        auto now = std::chrono::system_clock::
-            now();  //  这里用system_clock。原因是KuiklyCore回调的页面创建事件都是epoch_time。
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch());
-        auto spent_time = duration.count() - init_time_stamps_;
-        int kuikly_core_mode_value = mode_->ModeToCoreValue();
-        KRPerformanceData performance =
-            KRPerformanceData(page_name_, kuikly_core_mode_value, spent_time, is_cold_launch, is_page_cold_launch,
-                              monitor->GetMonitorData());
-        return performance.ToJsonString();
+    if (monitors_.empty()) {
+        return "{}";
     }
-    return "{}";
+    auto now = std::chrono::system_clock::
+        now();  //  这里用system_clock。原因是KuiklyCore回调的页面创建事件都是epoch_time。
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch());
+    auto spent_time = duration.count() - init_time_stamps_;
+    int kuikly_core_mode_value = mode_->ModeToCoreValue();
+    KRPerformanceData performance =
+        KRPerformanceData(page_name_, kuikly_core_mode_value, spent_time, is_cold_launch, is_page_cold_launch,
+                          GetMonitorData(KRLaunchMonitor::kMonitorName));
+    performance.SetFrameData(GetMonitorData(KRFrameMonitor::kMonitorName));
+    performance.SetMemoryData(GetMonitorData(KRMemoryMonitor::kMonitorName));
+    return performance.ToJsonString();
+}
+
+std::string KRPerformanceManager::GetMonitorData(const char *monitor_name) {
+    auto monitor = GetMonitor(monitor_name);
+    return monitor ? monitor->GetMonitorData() : "";
 }
 
 std::shared_ptr<KRMonitor> KRPerformanceManager::GetMonitor(std::string monitor_name) {
-    if (monitors_.find(KRLaunchMonitor::kMonitorName) != monitors_.end()) {
-        return monitors_[monitor_name];
+    auto it = monitors_.find(monitor_name);
+    if (it != monitors_.end()) {
+        return it->second;
     }
     return nullptr;
 }
@@ -20,7 +20,9 @@
 #include <string>
 #include "libohos_render/context/KRRenderContextParams.h"
 #include "libohos_render/expand/modules/performance/KRPageCreateTrace.h"
+#include "libohos_render/performance/frame/KRFrameMonitor.h"
 #include "libohos_render/performance/launch/KRLaunchMonitor.h"
+#include "libohos_render/performance/memory/KRMemoryMonitor.h"
 
 enum class MonitorType { kLaunch = 0, KFrame = 1, KMemory = 2 };
 
@@ -40,6 +42,9 @@ class KRPerformanceManager {
     void OnResume();
     void OnPause();
     void OnDestroy();
+    /** 主线程一批UI任务执行前后回调（主线程） */
+    void OnUITasksWillPerform();
+    void OnUITasksDidPerform();
     std::string GetInstanceId();
     std::string GetLaunchData();
     std::string GetPerformanceData();
@@ -57,6 +62,7 @@ class KRPerformanceManager {
 
 private:
     void CallArkTsPerformanceModule(const char* module_name, std::string &data);
+    std::string GetMonitorData(const char *monitor_name);  //  监控未开启时返回空串
     
  private:
     int performance_monitor_types_mask_ = 0;
@@ -73,6 +79,8 @@ private:
 
 enum MonitorTypeMask {
     kMonitorTypeLaunch = 1 << 0,  // 1 启动监控
+    kMonitorTypeFrame = 1 << 1,   // 2 帧监控
+    kMonitorTypeMemory = 1 << 2,  // 4 内存监控
 };
 
 #endif  // CORE_RENDER_OHOS_KRPERFORMANCEMANAGER_H
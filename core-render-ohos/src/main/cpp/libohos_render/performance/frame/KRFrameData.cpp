@@ -0,0 +1,76 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRFrameData.h"
+
+#include "thirdparty/cJSON/cJSON.h"
+
+constexpr char kKeyFrameCount[] = "frameCount";
+constexpr char kKeyTotalCost[] = "totalCost";
+constexpr char kKeyAvgCost[] = "avgCost";
+constexpr char kKeyMaxCost[] = "maxCost";
+constexpr char kKeyJankyFrameCount[] = "jankyFrameCount";
+constexpr char kKeyDroppedFrameCount[] = "droppedFrameCount";
+constexpr char kKeyHistogram[] = "histogram";
+constexpr char kKeyBucketBound[] = "le";
+constexpr char kKeyBucketCount[] = "count";
+
+const int64_t KRFrameData::kHistogramBucketBoundsMs[kHistogramBucketCount - 1] = {4, 8, 16, 33, 50, 100};
+
+void KRFrameData::AddFrame(int64_t cost_us, int64_t frame_interval_us) {
+    if (cost_us < 0) {
+        cost_us = 0;
+    }
+    frame_count_++;
+    total_cost_us_ += cost_us;
+    if (cost_us > max_cost_us_) {
+        max_cost_us_ = cost_us;
+    }
+    if (frame_interval_us > 0 && cost_us > frame_interval_us) {
+        janky_frame_count_++;
+        dropped_frame_count_ += (cost_us - 1) / frame_interval_us;
+    }
+    int bucket = 0;
+    while (bucket < kHistogramBucketCount - 1 && cost_us > kHistogramBucketBoundsMs[bucket] * 1000) {
+        bucket++;
+    }
+    histogram_[bucket]++;
+}
+
+std::string KRFrameData::ToJSONString() const {
+    //  耗时单位均为毫秒
+    cJSON *frame_monitor = cJSON_CreateObject();
+    cJSON_AddNumberToObject(frame_monitor, kKeyFrameCount, frame_count_);
+    cJSON_AddNumberToObject(frame_monitor, kKeyTotalCost, total_cost_us_ / 1000.0);
+    cJSON_AddNumberToObject(frame_monitor, kKeyAvgCost,
+                            frame_count_ > 0 ? total_cost_us_ / 1000.0 / frame_count_ : 0);
+    cJSON_AddNumberToObject(frame_monitor, kKeyMaxCost, max_cost_us_ / 1000.0);
+    cJSON_AddNumberToObject(frame_monitor, kKeyJankyFrameCount, janky_frame_count_);
+    cJSON_AddNumberToObject(frame_monitor, kKeyDroppedFrameCount, dropped_frame_count_);
+    cJSON *histogram = cJSON_AddArrayToObject(frame_monitor, kKeyHistogram);
+    for (int i = 0; i < kHistogramBucketCount; i++) {
+        cJSON *bucket = cJSON_CreateObject();
+        //  最后一个桶没有上界，le 记为 -1
+        cJSON_AddNumberToObject(bucket, kKeyBucketBound,
+                                i < kHistogramBucketCount - 1 ? kHistogramBucketBoundsMs[i] : -1);
+        cJSON_AddNumberToObject(bucket, kKeyBucketCount, histogram_[i]);
+        cJSON_AddItemToArray(histogram, bucket);
+    }
+    char *json = cJSON_PrintUnformatted(frame_monitor);
+    std::string result = json ? json : "{}";
+    cJSON_free(json);
+    cJSON_Delete(frame_monitor);
+    return result;
+}
@@ -0,0 +1,66 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFRAMEDATA_H
+#define CORE_RENDER_OHOS_KRFRAMEDATA_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * 帧耗时统计，一帧指主线程执行的一批UI任务
+ */
+class KRFrameData {
+ public:
+    /** 耗时分布桶上界（毫秒），最后一个桶收集超出上界的帧 */
+    static constexpr int kHistogramBucketCount = 7;
+    static const int64_t kHistogramBucketBoundsMs[kHistogramBucketCount - 1];
+
+    /**
+     * 记录一帧
+     * @param cost_us 本帧UI任务耗时（微秒）
+     * @param frame_interval_us 屏幕刷新间隔（微秒），超过即为卡顿帧
+     */
+    void AddFrame(int64_t cost_us, int64_t frame_interval_us);
+    std::string ToJSONString() const;
+
+    int64_t FrameCount() const {
+        return frame_count_;
+    }
+    int64_t JankyFrameCount() const {
+        return janky_frame_count_;
+    }
+    int64_t DroppedFrameCount() const {
+        return dropped_frame_count_;
+    }
+    int64_t MaxCostUs() const {
+        return max_cost_us_;
+    }
+    int64_t TotalCostUs() const {
+        return total_cost_us_;
+    }
+    int64_t HistogramCount(int bucket) const {
+        return histogram_[bucket];
+    }
+
+ private:
+    int64_t frame_count_ = 0;
+    int64_t total_cost_us_ = 0;
+    int64_t max_cost_us_ = 0;
+    int64_t janky_frame_count_ = 0;    //  耗时超过一个刷新间隔的帧数
+    int64_t dropped_frame_count_ = 0;  //  因超时错过的刷新次数之和
+    int64_t histogram_[kHistogramBucketCount] = {0};
+};
+#endif  // CORE_RENDER_OHOS_KRFRAMEDATA_H
@@ -0,0 +1,57 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRFrameMonitor.h"
+
+const char KRFrameMonitor::kMonitorName[] = "FrameMonitor";
+
+KRFrameMonitor::KRFrameMonitor(KRMonitorClock clock, int64_t frame_interval_us)
+    : clock_(std::move(clock)), frame_interval_us_(frame_interval_us) {}
+
+void KRFrameMonitor::OnUITasksWillPerform() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (perform_depth_++ == 0) {
+        frame_start_us_ = clock_();
+    }
+}
+
+void KRFrameMonitor::OnUITasksDidPerform() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (perform_depth_ == 0 || --perform_depth_ > 0) {
+        return;
+    }
+    if (!paused_) {
+        frame_data_.AddFrame(clock_() - frame_start_us_, frame_interval_us_);
+    }
+}
+
+void KRFrameMonitor::OnResume() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = false;
+}
+
+void KRFrameMonitor::OnPause() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = true;
+}
+
+KRFrameData KRFrameMonitor::GetFrameData() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frame_data_;
+}
+
+std::string KRFrameMonitor::GetMonitorData() {
+    return GetFrameData().ToJSONString();
+}
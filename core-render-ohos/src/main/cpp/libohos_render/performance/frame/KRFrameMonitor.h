@@ -0,0 +1,49 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFRAMEMONITOR_H
+#define CORE_RENDER_OHOS_KRFRAMEMONITOR_H
+
+#include <mutex>
+#include "libohos_render/performance/KRMonitor.h"
+#include "libohos_render/performance/frame/KRFrameData.h"
+
+/**
+ * 帧监控：统计 KRUIScheduler 每批主线程UI任务的耗时、卡顿/丢帧数和耗时分布，页面暂停期间不统计
+ */
+class KRFrameMonitor : public KRMonitor {
+ public:
+    static constexpr int64_t kDefaultFrameIntervalUs = 16667;  //  60Hz
+
+    explicit KRFrameMonitor(KRMonitorClock clock = KRMonitor::SteadyClockMicros,
+                            int64_t frame_interval_us = kDefaultFrameIntervalUs);
+    void OnUITasksWillPerform() override;
+    void OnUITasksDidPerform() override;
+    void OnResume() override;
+    void OnPause() override;
+    std::string GetMonitorData() override;
+    KRFrameData GetFrameData();
+    static const char kMonitorName[];
+
+ private:
+    std::mutex mutex_;
+    KRMonitorClock clock_;
+    int64_t frame_interval_us_;
+    int64_t frame_start_us_ = 0;
+    int perform_depth_ = 0;  //  UI任务嵌套执行时只统计最外层
+    bool paused_ = false;
+    KRFrameData frame_data_;
+};
+#endif  // CORE_RENDER_OHOS_KRFRAMEMONITOR_H
@@ -0,0 +1,82 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRMemoryData.h"
+
+#include <algorithm>
+#include "thirdparty/cJSON/cJSON.h"
+
+constexpr char kKeySampleCount[] = "sampleCount";
+constexpr char kKeyRssInit[] = "rssInit";
+constexpr char kKeyRssLast[] = "rssLast";
+constexpr char kKeyRssPeak[] = "rssPeak";
+constexpr char kKeyRssAvg[] = "rssAvg";
+constexpr char kKeyPssInit[] = "pssInit";
+constexpr char kKeyPssLast[] = "pssLast";
+constexpr char kKeyPssPeak[] = "pssPeak";
+constexpr char kKeyImageCacheBytes[] = "imageCacheBytes";
+constexpr char kKeyImageCachePeakBytes[] = "imageCachePeakBytes";
+constexpr char kKeyImageCacheCount[] = "imageCacheCount";
+constexpr char kKeyObjectCacheCount[] = "objectCacheCount";
+constexpr char kKeyTextMeasureCacheCount[] = "textMeasureCacheCount";
+constexpr char kKeyTextMeasureCacheHitCount[] = "textMeasureCacheHitCount";
+constexpr char kKeyTextMeasureCacheMissCount[] = "textMeasureCacheMissCount";
+
+void KRMemoryData::AddSample(const KRMemorySample &sample) {
+    if (sample_count_ == 0) {
+        first_ = sample;
+    }
+    sample_count_++;
+    last_ = sample;
+    if (sample.rss_kb >= 0) {
+        rss_sample_count_++;
+        rss_sum_kb_ += sample.rss_kb;
+    }
+    peak_.rss_kb = std::max(peak_.rss_kb, sample.rss_kb);
+    peak_.pss_kb = std::max(peak_.pss_kb, sample.pss_kb);
+    peak_.image_cache_bytes = std::max(peak_.image_cache_bytes, sample.image_cache_bytes);
+    peak_.image_cache_count = std::max(peak_.image_cache_count, sample.image_cache_count);
+    peak_.object_cache_count = std::max(peak_.object_cache_count, sample.object_cache_count);
+    peak_.text_measure_cache_count = std::max(peak_.text_measure_cache_count, sample.text_measure_cache_count);
+    peak_.text_measure_cache_hit_count =
+        std::max(peak_.text_measure_cache_hit_count, sample.text_measure_cache_hit_count);
+    peak_.text_measure_cache_miss_count =
+        std::max(peak_.text_measure_cache_miss_count, sample.text_measure_cache_miss_count);
+}
+
+std::string KRMemoryData::ToJSONString() const {
+    //  rss/pss 单位为 KB
+    cJSON *memory_monitor = cJSON_CreateObject();
+    cJSON_AddNumberToObject(memory_monitor, kKeySampleCount, sample_count_);
+    cJSON_AddNumberToObject(memory_monitor, kKeyRssInit, first_.rss_kb);
+    cJSON_AddNumberToObject(memory_monitor, kKeyRssLast, last_.rss_kb);
+    cJSON_AddNumberToObject(memory_monitor, kKeyRssPeak, peak_.rss_kb);
+    cJSON_AddNumberToObject(memory_monitor, kKeyRssAvg, AvgRssKb());
+    cJSON_AddNumberToObject(memory_monitor, kKeyPssInit, first_.pss_kb);
+    cJSON_AddNumberToObject(memory_monitor, kKeyPssLast, last_.pss_kb);
+    cJSON_AddNumberToObject(memory_monitor, kKeyPssPeak, peak_.pss_kb);
+    cJSON_AddNumberToObject(memory_monitor, kKeyImageCacheBytes, last_.image_cache_bytes);
+    cJSON_AddNumberToObject(memory_monitor, kKeyImageCachePeakBytes, peak_.image_cache_bytes);
+    cJSON_AddNumberToObject(memory_monitor, kKeyImageCacheCount, last_.image_cache_count);
+    cJSON_AddNumberToObject(memory_monitor, kKeyObjectCacheCount, last_.object_cache_count);
+    cJSON_AddNumberToObject(memory_monitor, kKeyTextMeasureCacheCount, last_.text_measure_cache_count);
+    cJSON_AddNumberToObject(memory_monitor, kKeyTextMeasureCacheHitCount, last_.text_measure_cache_hit_count);
+    cJSON_AddNumberToObject(memory_monitor, kKeyTextMeasureCacheMissCount, last_.text_measure_cache_miss_count);
+    char *json = cJSON_PrintUnformatted(memory_monitor);
+    std::string result = json ? json : "{}";
+    cJSON_free(json);
+    cJSON_Delete(memory_monitor);
+    return result;
+}
@@ -0,0 +1,68 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRMEMORYDATA_H
+#define CORE_RENDER_OHOS_KRMEMORYDATA_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * 一次内存采样，未能获取的项为 -1
+ */
+struct KRMemorySample {
+    int64_t rss_kb = -1;
+    int64_t pss_kb = -1;
+    int64_t image_cache_bytes = -1;  //  KRMemoryCacheModule 图片缓存像素字节数
+    int64_t image_cache_count = -1;
+    int64_t object_cache_count = -1;  //  KRMemoryCacheModule 对象缓存条数
+    int64_t text_measure_cache_count = -1;  //  KRTextMeasureCache 条数及累计命中、未命中次数
+    int64_t text_measure_cache_hit_count = -1;
+    int64_t text_measure_cache_miss_count = -1;
+};
+
+/**
+ * 内存采样统计
+ */
+class KRMemoryData {
+ public:
+    void AddSample(const KRMemorySample &sample);
+    std::string ToJSONString() const;
+
+    int64_t SampleCount() const {
+        return sample_count_;
+    }
+    const KRMemorySample &FirstSample() const {
+        return first_;
+    }
+    const KRMemorySample &LastSample() const {
+        return last_;
+    }
+    const KRMemorySample &PeakSample() const {
+        return peak_;
+    }
+    int64_t AvgRssKb() const {
+        return rss_sample_count_ > 0 ? rss_sum_kb_ / rss_sample_count_ : -1;
+    }
+
+ private:
+    int64_t sample_count_ = 0;
+    int64_t rss_sample_count_ = 0;
+    int64_t rss_sum_kb_ = 0;
+    KRMemorySample first_;
+    KRMemorySample last_;
+    KRMemorySample peak_;  //  各项分别取最大值
+};
+#endif  // CORE_RENDER_OHOS_KRMEMORYDATA_H
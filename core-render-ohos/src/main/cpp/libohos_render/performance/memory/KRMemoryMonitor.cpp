@@ -0,0 +1,133 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KRMemoryMonitor.h"
+
+#include <cstdio>
+#include <cstring>
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+#include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+
+const char KRMemoryMonitor::kMonitorName[] = "MemoryMonitor";
+
+/**
+ * 读取 /proc 下形如 "Key:   1234 kB" 的行，返回 KB 值，读取失败返回 -1
+ */
+static int64_t ReadProcValueKb(const char *path, const char *key) {
+    FILE *file = fopen(path, "r");
+    if (file == nullptr) {
+        return -1;
+    }
+    int64_t value = -1;
+    size_t key_len = strlen(key);
+    char line[256];
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        if (strncmp(line, key, key_len) == 0 && line[key_len] == ':') {
+            long long kb = 0;
+            if (sscanf(line + key_len + 1, "%lld", &kb) == 1) {
+                value = kb;
+            }
+            break;
+        }
+    }
+    fclose(file);
+    return value;
+}
+
+KRMemorySample KRMemoryMonitor::DefaultSampler() {
+    KRMemorySample sample;
+    sample.rss_kb = ReadProcValueKb("/proc/self/status", "VmRSS");
+    sample.pss_kb = ReadProcValueKb("/proc/self/smaps_rollup", "Pss");
+    auto stats = KRMemoryCacheModule::GetAllStats();
+    sample.image_cache_bytes = static_cast<int64_t>(stats.image.cost);
+    sample.image_cache_count = static_cast<int64_t>(stats.image.count);
+    sample.object_cache_count = static_cast<int64_t>(stats.object.count);
+    auto text_stats = KRTextMeasureCache::GetInstance().GetStats();
+    sample.text_measure_cache_count = static_cast<int64_t>(text_stats.size);
+    sample.text_measure_cache_hit_count = static_cast<int64_t>(text_stats.hit_count);
+    sample.text_measure_cache_miss_count = static_cast<int64_t>(text_stats.miss_count);
+    return sample;
+}
+
+KRMemoryMonitor::KRMemoryMonitor(KRMemorySampler sampler, KRMonitorClock clock, int64_t sample_interval_us)
+    : sampler_(std::move(sampler)), clock_(std::move(clock)), sample_interval_us_(sample_interval_us) {}
+
+void KRMemoryMonitor::OnKRRenderViewInit() {
+    RequestSample();
+}
+
+void KRMemoryMonitor::OnFirstFramePaint() {
+    RequestSample();
+}
+
+void KRMemoryMonitor::OnResume() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        paused_ = false;
+    }
+    RequestSample();
+}
+
+void KRMemoryMonitor::OnPause() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_ = true;
+}
+
+void KRMemoryMonitor::OnUITasksDidPerform() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (paused_ || (has_requested_ && clock_() - last_request_us_ < sample_interval_us_)) {
+            return;
+        }
+    }
+    RequestSample();
+}
+
+void KRMemoryMonitor::RequestSample() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (sampling_) {
+            return;
+        }
+        sampling_ = true;
+        has_requested_ = true;
+        last_request_us_ = clock_();
+    }
+    std::weak_ptr<KRMemoryMonitor> weak_self = shared_from_this();
+    KRGCDQueue::GetInstance().DispatchAsync(
+        [weak_self] {
+            if (auto self = weak_self.lock()) {
+                self->Sample();
+            }
+        },
+        KRTaskPriority::kPrefetch);
+}
+
+void KRMemoryMonitor::Sample() {
+    auto sample = sampler_();
+    std::lock_guard<std::mutex> lock(mutex_);
+    memory_data_.AddSample(sample);
+    sampling_ = false;
+}
+
+KRMemoryData KRMemoryMonitor::GetMemoryData() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memory_data_;
+}
+
+std::string KRMemoryMonitor::GetMonitorData() {
+    return GetMemoryData().ToJSONString();
+}
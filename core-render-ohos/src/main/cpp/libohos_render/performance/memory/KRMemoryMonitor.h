@@ -0,0 +1,72 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRMEMORYMONITOR_H
+#define CORE_RENDER_OHOS_KRMEMORYMONITOR_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "libohos_render/performance/KRMonitor.h"
+#include "libohos_render/performance/memory/KRMemoryData.h"
+
+/**
+ * 内存采样源，可注入自定义实现便于测试
+ */
+using KRMemorySampler = std::function<KRMemorySample()>;
+
+/**
+ * 内存监控：在页面初始化、首帧、恢复时以及UI任务执行后（按间隔节流）采样进程 RSS/PSS 和缓存占用
+ * 采样在子线程执行，不阻塞主线程
+ */
+class KRMemoryMonitor : public KRMonitor, public std::enable_shared_from_this<KRMemoryMonitor> {
+ public:
+    static constexpr int64_t kDefaultSampleIntervalUs = 5 * 1000 * 1000;
+
+    explicit KRMemoryMonitor(KRMemorySampler sampler = KRMemoryMonitor::DefaultSampler,
+                             KRMonitorClock clock = KRMonitor::SteadyClockMicros,
+                             int64_t sample_interval_us = kDefaultSampleIntervalUs);
+    void OnKRRenderViewInit() override;
+    void OnFirstFramePaint() override;
+    void OnResume() override;
+    void OnPause() override;
+    void OnUITasksDidPerform() override;
+    std::string GetMonitorData() override;
+    KRMemoryData GetMemoryData();
+    /**
+     * 在当前线程立即采样一次
+     */
+    void Sample();
+    static const char kMonitorName[];
+
+    /**
+     * 默认采样：/proc/self/status 的 VmRSS、/proc/self/smaps_rollup 的 Pss，以及 KRMemoryCacheModule、KRTextMeasureCache 统计
+     */
+    static KRMemorySample DefaultSampler();
+
+ private:
+    void RequestSample();
+
+    std::mutex mutex_;
+    KRMemorySampler sampler_;
+    KRMonitorClock clock_;
+    int64_t sample_interval_us_;
+    int64_t last_request_us_ = 0;
+    bool has_requested_ = false;
+    bool sampling_ = false;  //  已有采样任务在子线程中执行
+    bool paused_ = false;
+    KRMemoryData memory_data_;
+};
+#endif  // CORE_RENDER_OHOS_KRMEMORYMONITOR_H
@@ -20,7 +20,8 @@
 class KRContextSchedulerInternal {
  public:
     virtual ~KRContextSchedulerInternal() = default;
-    virtual void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) = 0;
+    virtual KRTimerId ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) = 0;
+    virtual bool CancelTask(KRTimerId id) = 0;
     virtual void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) = 0;
     virtual void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) = 0;
 
@@ -29,7 +30,8 @@ class KRContextSchedulerInternal {
 
 class KRContextSchedulerMultiThreaded : public KRContextSchedulerInternal {
  public:
-    void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
+    KRTimerId ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
+    bool CancelTask(KRTimerId id) override;
     void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
     void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
     bool IsCurrentOnContextThread() override;
@@ -59,12 +61,16 @@ void KRContextSchedulerMultiThreaded::DirectRunOnMainThread(bool isSync, const K
     }
 }
 
-void KRContextSchedulerMultiThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+KRTimerId KRContextSchedulerMultiThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
     if (sync) {
         GetContextThread()->DispatchSync(task);
-    } else {
-        GetContextThread()->DispatchAsync(task, delayMs);
+        return 0;
     }
+    return GetContextThread()->DispatchAsync(task, delayMs);
+}
+
+bool KRContextSchedulerMultiThreaded::CancelTask(KRTimerId id) {
+    return GetContextThread()->CancelDelayed(id);
 }
 
 void KRContextSchedulerMultiThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
@@ -102,7 +108,8 @@ bool KRContextSchedulerMultiThreaded::IsCurrentOnContextThread() {
 
 class KRContextSchedulerSingleThreaded : public KRContextSchedulerInternal {
  public:
-    void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
+    KRTimerId ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) override;
+    bool CancelTask(KRTimerId id) override;
     void ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) override;
     void DirectRunOnMainThread(bool isSync, const KRSchedulerTask &task) override;
     bool IsCurrentOnContextThread() override;
@@ -118,12 +125,16 @@ void KRContextSchedulerSingleThreaded::DirectRunOnMainThread(bool isSync, const
     }
 }
 
-void KRContextSchedulerSingleThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+KRTimerId KRContextSchedulerSingleThreaded::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
     if (sync) {
         task();
-    } else {
-        KRMainThread::RunOnMainThread(task, delayMs);
+        return 0;
     }
+    return KRMainThread::RunOnMainThread(task, delayMs);
+}
+
+bool KRContextSchedulerSingleThreaded::CancelTask(KRTimerId id) {
+    return KRMainThread::CancelDelayed(id);
 }
 
 void KRContextSchedulerSingleThreaded::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
@@ -158,8 +169,11 @@ std::shared_ptr<KRContextSchedulerInternal> KRContextScheduler::GetInstance() {
     return instance_;
 }
 
-void KRContextScheduler::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
-    GetInstance()->ScheduleTask(sync, delayMs, task);
+KRTimerId KRContextScheduler::ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task) {
+    return GetInstance()->ScheduleTask(sync, delayMs, task);
+}
+bool KRContextScheduler::CancelTask(KRTimerId id) {
+    return GetInstance()->CancelTask(id);
 }
 void KRContextScheduler::ScheduleTaskOnMainThread(bool sync, const KRSchedulerTask &task) {
     GetInstance()->ScheduleTaskOnMainThread(sync, task);
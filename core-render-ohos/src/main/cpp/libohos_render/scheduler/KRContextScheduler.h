@@ -33,8 +33,15 @@ class KRContextScheduler {
      * @param sync 是否同步执行
      * @param delayMs 延时毫秒，0为不延时
      * @param task 任务闭包
+     * @return 延时任务的句柄，可用于 CancelTask；同步或无延时的任务返回 0
      */
-    static void ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task);
+    static KRTimerId ScheduleTask(bool sync, int delayMs, const KRSchedulerTask &task);
+
+    /**
+     * 取消 ScheduleTask 派发的尚未到期的延时任务
+     * @return 任务已到期或已取消时返回 false
+     */
+    static bool CancelTask(KRTimerId id);
 
     /**
      * Context线程调度任务到主线程执行(注：该方法只能在主线程或Context线程被调用)
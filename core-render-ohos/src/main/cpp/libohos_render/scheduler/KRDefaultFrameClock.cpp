@@ -0,0 +1,53 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/scheduler/KRDefaultFrameClock.h"
+
+#include <time.h>
+#include "libohos_render/foundation/thread/KRVSync.h"
+#include "libohos_render/scheduler/KRContextScheduler.h"
+
+KRDefaultFrameClock::KRDefaultFrameClock() {
+    auto &vsync = KRVSync::GetInstance();
+    if (vsync.IsAvailable() && vsync.FramePeriodNanos() == 0) {
+        // 刷新周期在收到首个 vsync 后才能取到，先请求一帧
+        vsync.RequestFrame([](int64_t) {});
+    }
+}
+
+int64_t KRDefaultFrameClock::NowNanos() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+int64_t KRDefaultFrameClock::FrameIntervalNanos() {
+    return KRVSync::GetInstance().FramePeriodNanos();
+}
+
+int64_t KRDefaultFrameClock::FrameOriginNanos() {
+    return KRVSync::GetInstance().LastFrameNanos();
+}
+
+void KRDefaultFrameClock::PostDelayed(int64_t delay_nanos, const std::function<void()> &task) {
+    if (delay_nanos > 0 && KRVSync::GetInstance().RequestFrame([task](int64_t) {
+            KRContextScheduler::ScheduleTask(false, 0, task);
+        })) {
+        return;
+    }
+    // 向上取整到毫秒，保证不早于帧边界
+    int delay_ms = delay_nanos > 0 ? static_cast<int>((delay_nanos + 999999) / 1000000) : 0;
+    KRContextScheduler::ScheduleTask(false, delay_ms, task);
+}
@@ -0,0 +1,36 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRDEFAULTFRAMECLOCK_H
+#define CORE_RENDER_OHOS_KRDEFAULTFRAMECLOCK_H
+
+#include "libohos_render/scheduler/KRFramePacer.h"
+
+/**
+ * 默认帧时钟，帧间隔与帧边界取自 KRVSync（随显示刷新率变化），推迟到下一帧的任务在 vsync 到来后派发到 context 线程
+ * vsync 不可用或尚未取到刷新周期时帧间隔为 0，不做节拍控制
+ */
+class KRDefaultFrameClock : public IKRFrameClock {
+ public:
+    KRDefaultFrameClock();
+
+    // CLOCK_MONOTONIC，与 vsync 时间戳同源
+    int64_t NowNanos() override;
+    int64_t FrameIntervalNanos() override;
+    int64_t FrameOriginNanos() override;
+    void PostDelayed(int64_t delay_nanos, const std::function<void()> &task) override;
+};
+
+#endif  // CORE_RENDER_OHOS_KRDEFAULTFRAMECLOCK_H
@@ -0,0 +1,108 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/scheduler/KRFramePacer.h"
+
+#include <limits>
+
+KRFramePacer::KRFramePacer(std::shared_ptr<IKRFrameClock> clock) : clock_(std::move(clock)) {}
+
+void KRFramePacer::RequestFlush(const std::function<void()> &flush) {
+    int64_t delay = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_flush_ = flush;
+        if (flush_scheduled_) {
+            stats_.coalesced_count++;
+            return;
+        }
+        flush_scheduled_ = true;
+        auto interval = clock_->FrameIntervalNanos();
+        if (interval > 0 && has_flushed_) {
+            auto now = clock_->NowNanos();
+            auto frame_start = FrameStart(now, interval);
+            if (last_flush_nanos_ >= frame_start) {
+                delay = frame_start + interval - now;
+                stats_.deferred_count++;
+            }
+        }
+    }
+    std::weak_ptr<KRFramePacer> weak_self = shared_from_this();
+    clock_->PostDelayed(delay, [weak_self] {
+        auto self = weak_self.lock();
+        if (!self) {
+            return;
+        }
+        std::function<void()> flush;
+        {
+            std::lock_guard<std::mutex> lock(self->mutex_);
+            self->flush_scheduled_ = false;
+            flush = std::move(self->pending_flush_);
+            self->pending_flush_ = nullptr;
+        }
+        if (flush) {
+            flush();
+        }
+    });
+}
+
+void KRFramePacer::DidFlush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    has_flushed_ = true;
+    last_flush_nanos_ = clock_->NowNanos();
+    stats_.flush_count++;
+}
+
+int64_t KRFramePacer::DeadlineFrom(int64_t start_nanos) const {
+    auto interval = clock_->FrameIntervalNanos();
+    if (interval <= 0) {
+        return std::numeric_limits<int64_t>::max();
+    }
+    return start_nanos + static_cast<int64_t>(interval * budget_ratio_.load(std::memory_order_relaxed));
+}
+
+int64_t KRFramePacer::NanosToNextFrame() const {
+    auto interval = clock_->FrameIntervalNanos();
+    if (interval <= 0) {
+        return 0;
+    }
+    auto now = clock_->NowNanos();
+    return FrameStart(now, interval) + interval - now;
+}
+
+void KRFramePacer::SetBudgetRatio(float ratio) {
+    if (ratio > 0) {
+        budget_ratio_.store(ratio, std::memory_order_relaxed);
+    }
+}
+
+void KRFramePacer::RecordSplit() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.split_count++;
+}
+
+KRFramePacer::Stats KRFramePacer::GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+int64_t KRFramePacer::FrameStart(int64_t now_nanos, int64_t interval) const {
+    // 帧原点可能晚于 now（vsync 时间戳先于调用方读到的当前时间更新），按向下取整计算
+    auto offset = (now_nanos - clock_->FrameOriginNanos()) % interval;
+    if (offset < 0) {
+        offset += interval;
+    }
+    return now_nanos - offset;
+}
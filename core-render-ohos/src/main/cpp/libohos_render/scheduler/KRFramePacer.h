@@ -0,0 +1,110 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRFRAMEPACER_H
+#define CORE_RENDER_OHOS_KRFRAMEPACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/**
+ * 帧时钟，默认实现为 KRDefaultFrameClock，测试中可注入假时钟
+ */
+class IKRFrameClock {
+ public:
+    virtual ~IKRFrameClock() = default;
+    // 单调时钟，单位纳秒
+    virtual int64_t NowNanos() = 0;
+    // 帧间隔，单位纳秒；没有帧信号时返回 0，此时不做节拍控制
+    virtual int64_t FrameIntervalNanos() = 0;
+    // 任意一帧的开始时间，帧边界为 FrameOriginNanos() + k * FrameIntervalNanos()
+    virtual int64_t FrameOriginNanos() {
+        return 0;
+    }
+    // 在 context 线程执行 task：delay_nanos 为 0 时在下一个循环执行，否则等到下一帧开始（delay_nanos 为估算的等待时间）
+    virtual void PostDelayed(int64_t delay_nanos, const std::function<void()> &task) = 0;
+};
+
+/**
+ * UI 同步节拍器，保证每帧最多同步一次 UI 任务
+ * - 本帧尚未同步时，请求在下一个 context 线程循环执行（同一循环内的请求合并）；本帧已同步过则推迟到下一帧开始
+ * - 绕过节拍的同步刷新（如 SyncFlushUI、同步事件）通过 DidFlush 记入当前帧
+ * - 主线程按帧预算执行已同步的任务批次，超出截止时间时剩余批次顺延到下一帧
+ * - 时钟没有帧信号时退化为每个 context 线程循环同步一次，主线程不拆分
+ */
+class KRFramePacer : public std::enable_shared_from_this<KRFramePacer> {
+ public:
+    struct Stats {
+        uint64_t flush_count = 0;      // 实际同步次数（包括绕过节拍的同步）
+        uint64_t coalesced_count = 0;  // 被合并到已有请求的次数
+        uint64_t deferred_count = 0;   // 被推迟到下一帧的请求数
+        uint64_t split_count = 0;      // 主线程因超出预算而顺延的次数
+    };
+
+    static constexpr float kDefaultBudgetRatio = 0.5f;
+
+    explicit KRFramePacer(std::shared_ptr<IKRFrameClock> clock);
+
+    /**
+     * 请求一次同步，已有待执行的请求时合并（使用最新的 flush）
+     */
+    void RequestFlush(const std::function<void()> &flush);
+
+    /**
+     * 记录一次同步，同一帧内的后续请求推迟到下一帧
+     */
+    void DidFlush();
+
+    /**
+     * 主线程从 start_nanos 开始执行时的截止时间，不做节拍控制时为 INT64_MAX
+     */
+    int64_t DeadlineFrom(int64_t start_nanos) const;
+
+    /**
+     * 距下一帧开始的时间，不做节拍控制时为 0
+     */
+    int64_t NanosToNextFrame() const;
+
+    int64_t NowNanos() const {
+        return clock_->NowNanos();
+    }
+
+    /**
+     * 主线程每帧执行 UI 任务的预算占帧间隔的比例
+     */
+    void SetBudgetRatio(float ratio);
+
+    void RecordSplit();
+
+    Stats GetStats();
+
+ private:
+    // 包含 now_nanos 的帧的开始时间
+    int64_t FrameStart(int64_t now_nanos, int64_t interval) const;
+
+    std::shared_ptr<IKRFrameClock> clock_;
+    std::atomic<float> budget_ratio_{kDefaultBudgetRatio};
+    std::mutex mutex_;
+    std::function<void()> pending_flush_;
+    bool flush_scheduled_ = false;
+    bool has_flushed_ = false;
+    int64_t last_flush_nanos_ = 0;
+    Stats stats_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRFRAMEPACER_H
@@ -0,0 +1,175 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/scheduler/KRRenderCommandBuffer.h"
+
+void KRRenderCommandBuffer::CreateView(int tag, const std::string &view_name) {
+    BeginCommand(KRRenderCommandType::kCreateView);
+    Write<int32_t>(tag);
+    WriteString(view_name);
+}
+
+void KRRenderCommandBuffer::RemoveView(int tag) {
+    BeginCommand(KRRenderCommandType::kRemoveView);
+    Write<int32_t>(tag);
+}
+
+void KRRenderCommandBuffer::InsertSubView(int parent_tag, int child_tag, int index) {
+    BeginCommand(KRRenderCommandType::kInsertSubView);
+    Write<int32_t>(parent_tag);
+    Write<int32_t>(child_tag);
+    Write<int32_t>(index);
+}
+
+void KRRenderCommandBuffer::SetProp(int tag, int32_t prop_id, const std::string &prop_key,
+                                    const KRAnyValue &prop_value) {
+    BeginCommand(KRRenderCommandType::kSetProp);
+    Write<int32_t>(tag);
+    Write<int32_t>(prop_id);
+    WriteString(prop_key);
+    WriteValue(prop_value);
+}
+
+void KRRenderCommandBuffer::SetFrame(int tag, const KRRect &frame) {
+    BeginCommand(KRRenderCommandType::kSetFrame);
+    Write<int32_t>(tag);
+    Write(frame);
+}
+
+void KRRenderCommandBuffer::CallViewMethod(int tag, const std::string &method, const KRAnyValue &params,
+                                           KRRenderCallback callback) {
+    BeginCommand(KRRenderCommandType::kCallViewMethod);
+    Write<int32_t>(tag);
+    WriteString(method);
+    WriteValue(params);
+    WriteCallback(std::move(callback));
+}
+
+void KRRenderCommandBuffer::CallModuleMethod(const std::string &module_name, const std::string &method,
+                                             const KRAnyValue &params, KRRenderCallback callback,
+                                             bool callback_keep_alive) {
+    BeginCommand(KRRenderCommandType::kCallModuleMethod);
+    WriteString(module_name);
+    WriteString(method);
+    WriteValue(params);
+    WriteCallback(std::move(callback));
+    Write(callback_keep_alive);
+}
+
+void KRRenderCommandBuffer::AddTask(KRSchedulerTask task) {
+    BeginCommand(KRRenderCommandType::kTask);
+    Write(static_cast<uint32_t>(tasks_.size()));
+    tasks_.push_back(std::move(task));
+}
+
+void KRRenderCommandBuffer::Clear() {
+    bytes_.clear();
+    values_.clear();
+    callbacks_.clear();
+    tasks_.clear();
+    command_count_ = 0;
+}
+
+std::unique_ptr<KRRenderCommandBuffer> KRRenderCommandBufferSwapper::TakePending() {
+    if (pending_->IsEmpty()) {
+        return nullptr;
+    }
+    auto buffer = std::move(pending_);
+    pending_ = spare_ ? std::move(spare_) : std::make_unique<KRRenderCommandBuffer>();
+    return buffer;
+}
+
+void KRRenderCommandBufferSwapper::Recycle(std::unique_ptr<KRRenderCommandBuffer> buffer) {
+    if (spare_ || !buffer) {
+        return;
+    }
+    buffer->Clear();
+    spare_ = std::move(buffer);
+}
+
+void KRRenderCommandBuffer::WriteString(const char *data, size_t size) {
+    Write(static_cast<uint32_t>(size));
+    bytes_.insert(bytes_.end(), reinterpret_cast<const uint8_t *>(data), reinterpret_cast<const uint8_t *>(data) + size);
+}
+
+void KRRenderCommandBuffer::WriteValue(const KRAnyValue &value) {
+    if (!value || value->isNull()) {
+        Write<uint8_t>(KRRenderCValue::Type::NULL_VALUE);
+    } else if (value->isString()) {
+        Write<uint8_t>(KRRenderCValue::Type::STRING);
+        WriteString(value->toString());
+    } else if (value->isInt()) {
+        Write<uint8_t>(KRRenderCValue::Type::INT);
+        Write(value->toInt());
+    } else if (value->isLong()) {
+        Write<uint8_t>(KRRenderCValue::Type::LONG);
+        Write(value->toLong());
+    } else if (value->isFloat()) {
+        Write<uint8_t>(KRRenderCValue::Type::FLOAT);
+        Write(value->toFloat());
+    } else if (value->isDouble()) {
+        Write<uint8_t>(KRRenderCValue::Type::DOUBLE);
+        Write(value->toDouble());
+    } else if (value->isBool()) {
+        Write<uint8_t>(KRRenderCValue::Type::BOOL);
+        Write(value->toBool());
+    } else {
+        // Map、Array、二进制等保持引用，按下标读取
+        Write(kValueRef);
+        Write(static_cast<uint32_t>(values_.size()));
+        values_.push_back(value);
+    }
+}
+
+void KRRenderCommandBuffer::WriteCallback(KRRenderCallback callback) {
+    Write(static_cast<uint32_t>(callbacks_.size()));
+    callbacks_.push_back(std::move(callback));
+}
+
+KRAnyValue KRRenderCommandBuffer::Reader::ReadValue() {
+    auto type = Read<uint8_t>();
+    if (type == kValueRef) {
+        return buffer_.values_[Read<uint32_t>()];
+    }
+    if (type == KRRenderCValue::Type::STRING) {
+        auto size = Read<uint32_t>();
+        auto data = reinterpret_cast<const char *>(cursor_);
+        cursor_ += size;
+        return KRRenderValuePool::AcquireString(data, size);
+    }
+    KRRenderCValue c_value;
+    c_value.type = static_cast<KRRenderCValue::Type>(type);
+    switch (c_value.type) {
+    case KRRenderCValue::Type::INT:
+        c_value.value.intValue = Read<int32_t>();
+        break;
+    case KRRenderCValue::Type::LONG:
+        c_value.value.longValue = Read<int64_t>();
+        break;
+    case KRRenderCValue::Type::FLOAT:
+        c_value.value.floatValue = Read<float>();
+        break;
+    case KRRenderCValue::Type::DOUBLE:
+        c_value.value.doubleValue = Read<double>();
+        break;
+    case KRRenderCValue::Type::BOOL:
+        c_value.value.boolValue = Read<bool>() ? 1 : 0;
+        break;
+    default:
+        c_value.type = KRRenderCValue::Type::NULL_VALUE;
+        break;
+    }
+    return KRRenderValuePool::Acquire(c_value);
+}
@@ -0,0 +1,245 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
+#define CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/KRPropKeys.h"
+#include "libohos_render/foundation/KRRect.h"
+#include "libohos_render/foundation/type/KRRenderValuePool.h"
+#include "libohos_render/scheduler/IKRScheduler.h"
+
+enum class KRRenderCommandType : uint8_t {
+    kCreateView = 0,
+    kRemoveView,
+    kInsertSubView,
+    kSetProp,
+    kSetFrame,
+    kCallViewMethod,
+    kCallModuleMethod,
+    kTask,  // 无法编码的操作，按闭包顺序执行
+};
+
+/**
+ * UI 操作命令缓冲区，context 线程追加命令，整体移交主线程后顺序执行
+ * - 命令连续编码在字节缓冲区中，标量与字符串按值写入，录制后即不再引用 KRRenderValue
+ * - Map、Array、二进制等值，以及回调、闭包存放在侧表中，按下标引用
+ * - Clear 保留各缓冲区容量，配合复用可做到稳态无分配
+ */
+class KRRenderCommandBuffer {
+ public:
+    void CreateView(int tag, const std::string &view_name);
+    void RemoveView(int tag);
+    void InsertSubView(int parent_tag, int child_tag, int index);
+    // prop_id 为 KRPropKeys::IdOf(prop_key)，录制时算好，执行时不再查表
+    void SetProp(int tag, int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value);
+    void SetFrame(int tag, const KRRect &frame);
+    void CallViewMethod(int tag, const std::string &method, const KRAnyValue &params, KRRenderCallback callback);
+    void CallModuleMethod(const std::string &module_name, const std::string &method, const KRAnyValue &params,
+                          KRRenderCallback callback, bool callback_keep_alive);
+    void AddTask(KRSchedulerTask task);
+
+    bool IsEmpty() const {
+        return bytes_.empty();
+    }
+
+    size_t GetCommandCount() const {
+        return command_count_;
+    }
+
+    void Clear();
+
+    /**
+     * 按录制顺序执行全部命令，layer 需提供与 IKRRenderLayer 同名的 CreateRenderView、RemoveRenderView、
+     * InsertSubRenderView、SetProp、CallViewMethod、CallModuleMethod 方法；layer 为空时只执行闭包
+     */
+    template <typename Layer> void Execute(Layer *layer);
+
+ private:
+    // 值编码中 KRRenderCValue::Type 之外的标记
+    static constexpr uint8_t kValueRef = 0xFF;
+
+    template <typename T> void Write(const T &value) {
+        auto offset = bytes_.size();
+        bytes_.resize(offset + sizeof(T));
+        memcpy(bytes_.data() + offset, &value, sizeof(T));
+    }
+    void WriteString(const char *data, size_t size);
+    void WriteString(const std::string &value) {
+        WriteString(value.data(), value.size());
+    }
+    void WriteValue(const KRAnyValue &value);
+    void WriteCallback(KRRenderCallback callback);
+    void BeginCommand(KRRenderCommandType type) {
+        Write(type);
+        ++command_count_;
+    }
+
+    class Reader {
+     public:
+        Reader(const KRRenderCommandBuffer &buffer)  // NOLINT
+            : buffer_(buffer), cursor_(buffer.bytes_.data()), end_(cursor_ + buffer.bytes_.size()) {}
+
+        bool AtEnd() const {
+            return cursor_ >= end_;
+        }
+        template <typename T> T Read() {
+            T value;
+            memcpy(&value, cursor_, sizeof(T));
+            cursor_ += sizeof(T);
+            return value;
+        }
+        // 读入可复用的 std::string，避免每条命令构造新字符串
+        const std::string &ReadString(std::string &out) {
+            auto size = Read<uint32_t>();
+            out.assign(reinterpret_cast<const char *>(cursor_), size);
+            cursor_ += size;
+            return out;
+        }
+        KRAnyValue ReadValue();
+        const KRRenderCallback &ReadCallback() {
+            return buffer_.callbacks_[Read<uint32_t>()];
+        }
+
+     private:
+        const KRRenderCommandBuffer &buffer_;
+        const uint8_t *cursor_;
+        const uint8_t *end_;
+    };
+
+    std::vector<uint8_t> bytes_;
+    std::vector<KRAnyValue> values_;
+    std::vector<KRRenderCallback> callbacks_;
+    std::vector<KRSchedulerTask> tasks_;
+    size_t command_count_ = 0;
+    // 执行期复用的字符串
+    std::string scratch_name_;
+    std::string scratch_method_;
+};
+
+/**
+ * 命令缓冲区双缓冲：context 线程向 Pending 追加命令，同步时整批取走并换上备用缓冲区，主线程执行完后交还
+ * 稳态下两块缓冲区交替使用，不再分配；不加锁，由调用方保证互斥
+ */
+class KRRenderCommandBufferSwapper {
+ public:
+    KRRenderCommandBuffer &Pending() {
+        return *pending_;
+    }
+
+    /**
+     * 取走当前批次，Pending 换为备用缓冲区（没有时新建）；当前批次为空时返回 nullptr
+     */
+    std::unique_ptr<KRRenderCommandBuffer> TakePending();
+
+    /**
+     * 交还执行完的缓冲区，清空后留作备用；已有备用时直接释放
+     */
+    void Recycle(std::unique_ptr<KRRenderCommandBuffer> buffer);
+
+ private:
+    std::unique_ptr<KRRenderCommandBuffer> pending_ = std::make_unique<KRRenderCommandBuffer>();
+    std::unique_ptr<KRRenderCommandBuffer> spare_;
+};
+
+template <typename Layer> void KRRenderCommandBuffer::Execute(Layer *layer) {
+    Reader reader(*this);
+    while (!reader.AtEnd()) {
+        auto type = reader.Read<KRRenderCommandType>();
+        switch (type) {
+        case KRRenderCommandType::kCreateView: {
+            auto tag = reader.Read<int32_t>();
+            auto &view_name = reader.ReadString(scratch_name_);
+            if (layer) {
+                layer->CreateRenderView(tag, view_name);
+            }
+            break;
+        }
+        case KRRenderCommandType::kRemoveView: {
+            auto tag = reader.Read<int32_t>();
+            if (layer) {
+                layer->RemoveRenderView(tag);
+            }
+            break;
+        }
+        case KRRenderCommandType::kInsertSubView: {
+            auto parent_tag = reader.Read<int32_t>();
+            auto child_tag = reader.Read<int32_t>();
+            auto index = reader.Read<int32_t>();
+            if (layer) {
+                layer->InsertSubRenderView(parent_tag, child_tag, index);
+            }
+            break;
+        }
+        case KRRenderCommandType::kSetProp: {
+            auto tag = reader.Read<int32_t>();
+            auto prop_id = reader.Read<int32_t>();
+            auto &prop_key = reader.ReadString(scratch_name_);
+            auto prop_value = reader.ReadValue();
+            if (layer) {
+                layer->SetProp(tag, prop_id, prop_key, prop_value);
+            }
+            break;
+        }
+        case KRRenderCommandType::kSetFrame: {
+            static const std::string kFramePropKey = "frame";
+            auto tag = reader.Read<int32_t>();
+            auto frame = reader.Read<KRRect>();
+            if (layer) {
+                layer->SetProp(tag, kPropKeyFrame, kFramePropKey,
+                               KRRenderValuePool::AcquireString(reinterpret_cast<const char *>(&frame), sizeof(KRRect)));
+            }
+            break;
+        }
+        case KRRenderCommandType::kCallViewMethod: {
+            auto tag = reader.Read<int32_t>();
+            auto &method = reader.ReadString(scratch_method_);
+            auto params = reader.ReadValue();
+            auto &callback = reader.ReadCallback();
+            if (layer) {
+                layer->CallViewMethod(tag, method, params, callback);
+            }
+            break;
+        }
+        case KRRenderCommandType::kCallModuleMethod: {
+            auto &module_name = reader.ReadString(scratch_name_);
+            auto &method = reader.ReadString(scratch_method_);
+            auto params = reader.ReadValue();
+            auto &callback = reader.ReadCallback();
+            auto callback_keep_alive = reader.Read<bool>();
+            if (layer) {
+                layer->CallModuleMethod(false, module_name, method, params, callback, callback_keep_alive);
+            }
+            break;
+        }
+        case KRRenderCommandType::kTask: {
+            auto &task = tasks_[reader.Read<uint32_t>()];
+            if (task) {
+                task();
+            }
+            break;
+        }
+        }
+    }
+}
+
+#endif  // CORE_RENDER_OHOS_KRRENDERCOMMANDBUFFER_H
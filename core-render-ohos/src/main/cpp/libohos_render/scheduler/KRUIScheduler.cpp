@@ -15,17 +15,24 @@
 
 #include "libohos_render/scheduler/KRUIScheduler.h"
 
-#include "libohos_render/scheduler/KRContextScheduler.h"
+#include <algorithm>
+#include "libohos_render/layer/IKRRenderLayer.h"
 
 // should call on context线程
 void KRUIScheduler::AddTaskToMainQueueWithTask(const KRSchedulerTask &task) {
     std::lock_guard<std::mutex> lock(m_mutex_);
-    m_main_thread_tasks_on_context_queue_.push_back(task);
+    m_commands_.Pending().AddTask(task);
     SetNeedSyncMainQuequeTasks();
 }
 // should call on context线程
 void KRUIScheduler::PerformSyncMainQueueTasksBlockIfNeed(bool sync) {
+    FlushMainQueueTasks(sync, false);
+}
+
+void KRUIScheduler::FlushMainQueueTasks(bool sync, bool paced) {
     if (m_need_sync_main_queue_tasks_block_) {
+        m_frame_pacer_->DidFlush();
+        m_paced_flush_ = paced && !sync;
         m_need_sync_main_queue_tasks_block_(sync);
         m_need_sync_main_queue_tasks_block_ = nullptr;
     }
@@ -52,7 +59,7 @@ void KRUIScheduler::Destroy() {
     m_is_destroyed_ = true;
     m_delegate_ = nullptr;
     m_need_sync_main_queue_tasks_block_ = nullptr;
-    m_main_thread_tasks_on_context_queue_.clear();
+    m_commands_.Pending().Clear();
 }
 
 void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
@@ -73,38 +80,39 @@ void KRUIScheduler::SetNeedSyncMainQuequeTasks() {
                 scheduler->m_delegate_->WillPerformUITasksWithScheduler();
             }
             
-            std::vector<KRSchedulerTask> performTasks;
+            std::unique_ptr<KRRenderCommandBuffer> commands;
             {
                 std::lock_guard<std::mutex> lock(scheduler->m_mutex_);
-                performTasks = scheduler->m_main_thread_tasks_on_context_queue_;
-                scheduler->m_main_thread_tasks_on_context_queue_ = {};
-                scheduler->m_main_thread_tasks_.insert(scheduler->m_main_thread_tasks_.end(), performTasks.begin(), performTasks.end());
+                commands = scheduler->m_commands_.TakePending();
+            }
+            if (commands) {
+                // 整批命令作为一个任务移交主线程
+                scheduler->m_main_thread_tasks_.Push([weakSelf, commands = std::move(commands)]() mutable {
+                    if (auto strongSelf = weakSelf.lock()) {
+                        std::dynamic_pointer_cast<KRUIScheduler>(strongSelf)->RunCommands(std::move(commands));
+                    }
+                });
             }
             
-            scheduler->PerformOnMainQueueWithTask(sync, [weakSelf] {
+            bool paced = scheduler->m_paced_flush_;
+            scheduler->PerformOnMainQueueWithTask(sync, [weakSelf, paced] {
                 auto strongSelf = weakSelf.lock();
                 if (!strongSelf) {
                     return;
                 }
                 
                 auto scheduler = std::dynamic_pointer_cast<KRUIScheduler>(strongSelf);
-                
-                std::vector<KRSchedulerTask> mainTasks;
-                {
-                    std::lock_guard<std::mutex> lock(scheduler->m_mutex_);
-                    mainTasks = scheduler->m_main_thread_tasks_;
-                    scheduler->m_main_thread_tasks_ = {};
-                }
-                scheduler->RunMainQueueTasks(mainTasks);
+                scheduler->RunMainQueueTasks(paced);
             });
         };
-        KRContextScheduler::ScheduleTask(false, 0, [weakSelf] { 
+        // 每帧最多同步一次，期间产生的任务累积到下一次同步；已被立即同步时为空操作
+        m_frame_pacer_->RequestFlush([weakSelf] {
             auto strongSelf = weakSelf.lock();
             if (!strongSelf) {
                 return;
             }
             auto scheduler = std::dynamic_pointer_cast<KRUIScheduler>(strongSelf);
-            scheduler->PerformSyncMainQueueTasksBlockIfNeed(false); 
+            scheduler->FlushMainQueueTasks(false, true);
         });
     }
 }
@@ -122,13 +130,31 @@ void KRUIScheduler::PerformOnMainQueueWithTask(bool sync, const std::function<vo
     }
 }
 
-void KRUIScheduler::RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks) {
+void KRUIScheduler::RunMainQueueTasks(bool paced) {
     // 主线程
+    // 顺延执行的批次与之前的批次合为一次 Will/Did 回调
+    if (m_delegate_ && !m_main_queue_tasks_unfinished_) {
+        m_delegate_->WillRunMainQueueTasks();
+    }
     m_performing_main_queue_task_ = true;
-    for (size_t i = 0; i < tasks.size(); i++) {
-        tasks[i]();
+    auto deadline = m_frame_pacer_->DeadlineFrom(m_frame_pacer_->NowNanos());
+    bool overrun = false;
+    KRTask task;
+    // 以批次为单位执行，超出帧预算时剩余批次按原顺序顺延，不拆分单个批次
+    while (m_main_thread_tasks_.TryPop(task)) {
+        task();
+        task.Reset();
+        if (paced && m_frame_pacer_->NowNanos() >= deadline && !m_main_thread_tasks_.IsEmpty()) {
+            overrun = true;
+            break;
+        }
     }
     m_performing_main_queue_task_ = false;
+    m_main_queue_tasks_unfinished_ = overrun;
+    if (overrun) {
+        ScheduleDeferredMainQueueTasks();
+        return;
+    }
     if (!m_view_did_load_) {
         m_view_did_load_ = true;
         auto viewDidLoadTasks = m_view_did_load_main_thread_tasks_;
@@ -144,6 +170,44 @@ void KRUIScheduler::RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks)
             tasks[i]();
         }
     }
+    if (m_delegate_) {
+        m_delegate_->DidRunMainQueueTasks();
+    }
+}
+
+void KRUIScheduler::ScheduleDeferredMainQueueTasks() {
+    // 主线程
+    if (m_deferred_main_queue_tasks_) {
+        return;
+    }
+    m_deferred_main_queue_tasks_ = true;
+    m_frame_pacer_->RecordSplit();
+    auto delay_ms = static_cast<int>((m_frame_pacer_->NanosToNextFrame() + 999999) / 1000000);
+    std::weak_ptr<IKRScheduler> weakSelf = shared_from_this();
+    KRMainThread::RunOnMainThread(
+        [weakSelf] {
+            auto strongSelf = weakSelf.lock();
+            if (!strongSelf) {
+                return;
+            }
+            auto scheduler = std::dynamic_pointer_cast<KRUIScheduler>(strongSelf);
+            scheduler->m_deferred_main_queue_tasks_ = false;
+            // 期间已被立即同步执行完时无需再执行
+            if (!scheduler->m_is_destroyed_ && !scheduler->m_main_thread_tasks_.IsEmpty()) {
+                scheduler->RunMainQueueTasks(true);
+            }
+        },
+        std::max(delay_ms, 1));
+}
+
+void KRUIScheduler::RunCommands(std::unique_ptr<KRRenderCommandBuffer> commands) {
+    // 主线程
+    auto layer = m_delegate_ ? m_delegate_->GetRenderLayer() : nullptr;
+    commands->Execute(layer.get());
+    // 在锁外清空，回调、闭包等的析构不占用锁
+    commands->Clear();
+    std::lock_guard<std::mutex> lock(m_mutex_);
+    m_commands_.Recycle(std::move(commands));
 }
 
 void KRUIScheduler::PerformMainThreadTaskWaitToSyncBlockIfNeed() {
@@ -18,11 +18,18 @@
 
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
 #include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/foundation/thread/KRTaskQueue.h"
 #include "libohos_render/scheduler/IKRScheduler.h"
+#include "libohos_render/scheduler/KRDefaultFrameClock.h"
+#include "libohos_render/scheduler/KRFramePacer.h"
+#include "libohos_render/scheduler/KRRenderCommandBuffer.h"
+
+class IKRRenderLayer;
 
 using KRSyncSchedulerTask = std::function<void(bool sync)>;
 
@@ -31,15 +38,40 @@ class KRRenderUISchedulerDelegate {
     ~KRRenderUISchedulerDelegate() = default;
     // UI任务将要执行前回调
     virtual void WillPerformUITasksWithScheduler() = 0;
+    // 主线程执行一批UI任务前后回调，用于帧耗时统计
+    virtual void WillRunMainQueueTasks() {}
+    virtual void DidRunMainQueueTasks() {}
+    // 主线程执行 UI 命令缓冲区时使用的渲染层
+    virtual std::shared_ptr<IKRRenderLayer> GetRenderLayer() {
+        return nullptr;
+    }
 };
 
 class KRUIScheduler : public IKRScheduler {
  public:
-    explicit KRUIScheduler(KRRenderUISchedulerDelegate *delegate) : m_delegate_(delegate) {}
+    /**
+     * @param clock 帧时钟，为空时使用默认时钟
+     */
+    explicit KRUIScheduler(KRRenderUISchedulerDelegate *delegate, std::shared_ptr<IKRFrameClock> clock = nullptr)
+        : m_delegate_(delegate),
+          m_frame_pacer_(
+              std::make_shared<KRFramePacer>(clock ? std::move(clock) : std::make_shared<KRDefaultFrameClock>())) {}
 
     // should call on context线程
     void AddTaskToMainQueueWithTask(const KRSchedulerTask &task);
-    // should call on context线程
+    /**
+     * 向当前批次的 UI 命令缓冲区追加命令，与 AddTaskToMainQueueWithTask 的任务保持先后顺序
+     * should call on context线程
+     */
+    template <typename F> void RecordCommands(F &&record) {
+        std::lock_guard<std::mutex> lock(m_mutex_);
+        record(m_commands_.Pending());
+        SetNeedSyncMainQuequeTasks();
+    }
+    /**
+     * 立即同步当前批次，不经过帧节拍，主线程也不按帧预算拆分（SyncFlushUI、同步事件等）
+     * should call on context线程
+     */
     void PerformSyncMainQueueTasksBlockIfNeed(bool sync);
     // should call on main thread
     void PerformWhenViewDidLoad(const KRSchedulerTask &task);
@@ -56,24 +88,44 @@ class KRUIScheduler : public IKRScheduler {
     void ResetDelegate(){
         m_delegate_ = nullptr;
     }
+
+    const std::shared_ptr<KRFramePacer> &GetFramePacer() const {
+        return m_frame_pacer_;
+    }
  private:
     void SetNeedSyncMainQuequeTasks();
 
     void PerformOnMainQueueWithTask(bool sync, const std::function<void()> &task);
 
-    void RunMainQueueTasks(const std::vector<KRSchedulerTask> &tasks);
+    // paced 为 true 时同步任务受帧节拍控制，主线程按帧预算执行
+    void FlushMainQueueTasks(bool sync, bool paced);
+
+    /**
+     * @param paced 为 true 时超出帧预算后剩余批次顺延到下一帧，至少执行一批；
+     * 全部批次执行完后才执行 view did load、did end 任务并回调 DidRunMainQueueTasks
+     */
+    void RunMainQueueTasks(bool paced);
+
+    void ScheduleDeferredMainQueueTasks();
+
+    void RunCommands(std::unique_ptr<KRRenderCommandBuffer> commands);
 
     bool m_is_destroyed_ = false;
     KRSyncSchedulerTask m_need_sync_main_queue_tasks_block_ = nullptr;
     KRRenderUISchedulerDelegate *m_delegate_ = nullptr;
     bool m_performing_main_queue_task_ = false;
-    std::vector<KRSchedulerTask> m_main_thread_tasks_on_context_queue_;
-    std::vector<KRSchedulerTask> m_main_thread_tasks_;
+    // 当前批次的命令缓冲区，每次同步整体移交主线程；执行完的缓冲区交还后复用其容量，受 m_mutex_ 保护
+    KRRenderCommandBufferSwapper m_commands_;
+    KRTaskQueue m_main_thread_tasks_;  // context 线程提交，主线程消费
     std::vector<KRSchedulerTask> m_view_did_load_main_thread_tasks_;
     std::vector<KRSchedulerTask> m_did_end_main_thread_tasks_;
     std::function<void()> m_main_thread_task_wait_to_sync_block_ = nullptr;
     std::mutex m_mutex_;
     bool m_view_did_load_ = false;
+    std::shared_ptr<KRFramePacer> m_frame_pacer_;
+    bool m_paced_flush_ = false;               // context 线程，当前同步是否受帧节拍控制
+    bool m_deferred_main_queue_tasks_ = false;  // 主线程，是否已有顺延到下一帧的执行
+    bool m_main_queue_tasks_unfinished_ = false;  // 主线程，上一次执行超出预算，已回调 WillRunMainQueueTasks 尚未回调 Did
 };
 
 #endif  // CORE_RENDER_OHOS_KRUISCHEDULER_H
@@ -15,33 +15,10 @@
 
 #include "KRBase64Util.h"
 
-static const char HEX_DIGITS[] = "0123456789abcdef";
-// Maps integer in the range [0,16) to a hex digit.
-
-static const char HEX_DIGITS_URI[] = "0123456789ABCDEF";
-// RFC 3986 section 2.1 says "For consistency, URI producers and normalizers should use uppercase
-// hexadecimal digits for all percent-encodings.
-
-static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                   "abcdefghijklmnopqrstuvwxyz"
-                                   "0123456789+/";
+#include "libohos_render/utils/KRTextCodec.h"
 
 std::string KRBase64Util::Encode(std::string_view in) {
-    std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
-    }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
-    return out;
+    return KRTextCodec::Base64Encode(in);
 }
 
 std::string KRBase64Util::Encode(const std::string &data) {
@@ -49,21 +26,7 @@ std::string KRBase64Util::Encode(const std::string &data) {
 }
 
 std::string KRBase64Util::Decode(std::string_view in) {
-    std::string out;
-    int val = 0, valb = -6;
-    for (unsigned char c : in) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            out.push_back(base64_chars[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
-    }
-    if (valb > -6)
-        out.push_back(base64_chars[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4)
-        out.push_back('=');
-    return out;
+    return KRTextCodec::Base64Decode(in);
 }
 
 std::string KRBase64Util::Decode(const std::string &data) {
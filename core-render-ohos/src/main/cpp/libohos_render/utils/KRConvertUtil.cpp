@@ -15,6 +15,7 @@
 
 #include "libohos_render/utils/KRConvertUtil.h"
 #include "libohos_render/foundation/KRConfig.h"
+#include "libohos_render/utils/KRPropParseCache.h"
 #include <codecvt>
 #include <iostream>
 #include <locale>
@@ -149,14 +150,22 @@ OH_Drawing_FontStyle ConvertToFontStyle(const std::string &fontStyle) {
 }
 
 uint32_t ConvertToHexColor(const std::string &colorStr) {
-    try {
-        auto color_adapter = KRRenderAdapterManager::GetInstance().GetColorAdapter();
-        if (color_adapter) {
-            std::int64_t hex = color_adapter->GetHexColor(colorStr);
-            if (hex != -1) {
-                return hex;
-            }
+    return KRPropParseCache::GetInstance().GetColor(colorStr);
+}
+
+uint32_t ParseHexColor(const std::string &colorStr) {
+    auto color_adapter = KRRenderAdapterManager::GetInstance().GetColorAdapter();
+    if (color_adapter) {
+        std::int64_t hex = color_adapter->GetHexColor(colorStr);
+        if (hex != -1) {
+            return hex;
         }
+    }
+    return ParseColorLiteral(colorStr);
+}
+
+uint32_t ParseColorLiteral(const std::string &colorStr) {
+    try {
         uint32_t hex = std::stol(colorStr);
         return hex;
     } catch (...) {
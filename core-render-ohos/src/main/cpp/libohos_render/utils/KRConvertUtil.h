@@ -46,8 +46,15 @@ OH_Drawing_EllipsisModal ConvertToTextBreakMode(const std::string &breakeMode);
 
 OH_Drawing_FontStyle ConvertToFontStyle(const std::string &fontStyle);
 
+// 结果经 KRPropParseCache 缓存
 uint32_t ConvertToHexColor(const std::string &colorStr);
 
+// 不经过缓存直接解析颜色，注册了颜色适配器时优先交给适配器
+uint32_t ParseHexColor(const std::string &colorStr);
+
+// 只做原生解析（Kotlin 侧传来的十进制颜色值），不经过颜色适配器
+uint32_t ParseColorLiteral(const std::string &colorStr);
+
 ArkUI_BorderStyle ConverToBorderStyle(const std::string &string);
 
 float ConvertToFloat(const std::string &string);
@@ -405,6 +405,13 @@ KRPoint GetArkUIGestureEventWindowPoint(ArkUI_GestureEvent *event) {
     return {x, y};
 }
 
+int64_t GetArkUIGestureEventTime(ArkUI_GestureEvent *event) {
+    if (!event) {
+        return 0;
+    }
+    return GetArkUIInputEventTime(OH_ArkUI_GestureEvent_GetRawInputEvent(event));
+}
+
 ArkUI_GestureEventActionType GetArkUIGestureActionType(ArkUI_GestureEvent *event) {
     if (!event) {
         return GESTURE_EVENT_ACTION_CANCEL;
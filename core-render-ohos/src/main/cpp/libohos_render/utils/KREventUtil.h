@@ -103,6 +103,8 @@ KRPoint GetArkUIGestureEventPoint(ArkUI_GestureEvent *event);
 
 KRPoint GetArkUIGestureEventWindowPoint(ArkUI_GestureEvent *event);
 
+int64_t GetArkUIGestureEventTime(ArkUI_GestureEvent *event);
+
 ArkUI_GestureEventActionType GetArkUIGestureActionType(ArkUI_GestureEvent *event);
 
 std::string GetArkUIGestureActionState(ArkUI_GestureEvent *event);
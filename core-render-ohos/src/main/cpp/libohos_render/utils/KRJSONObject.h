@@ -15,7 +15,9 @@
 
 #ifndef CORE_RENDER_OHOS_KRJSONOBJECT_H
 #define CORE_RENDER_OHOS_KRJSONOBJECT_H
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace kuikly {
 namespace util {
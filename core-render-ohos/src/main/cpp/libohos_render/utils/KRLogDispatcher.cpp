@@ -0,0 +1,203 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRLogDispatcher.h"
+
+#include <algorithm>
+#include <chrono>
+
+constexpr int kDrainIntervalMs = 16;
+
+struct KRLogDispatcher::Ring {
+    explicit Ring(size_t capacity) : slots(new KRLogRecord[capacity]), mask(capacity - 1) {}
+
+    std::unique_ptr<KRLogRecord[]> slots;
+    const size_t mask;
+    alignas(64) std::atomic<size_t> head{0};  // 消费者位置
+    alignas(64) std::atomic<size_t> tail{0};  // 生产者位置
+    std::atomic<bool> retired{false};         // 所属线程已退出
+};
+
+namespace {
+
+struct ThreadRing {
+    uint64_t owner_id = 0;
+    std::shared_ptr<void> ring;
+    std::atomic<bool> *retired = nullptr;
+
+    ~ThreadRing() {
+        if (retired) {
+            retired->store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadRing tls_ring;
+std::atomic<uint64_t> g_dispatcher_id{0};
+}  // namespace
+
+KRLogDispatcher::KRLogDispatcher(Sink sink, size_t ring_capacity)
+    : m_sink(std::move(sink)),
+      m_ring_capacity([ring_capacity] {
+          size_t size = 2;
+          while (size < ring_capacity) {
+              size <<= 1;
+          }
+          return size;
+      }()),
+      m_id(++g_dispatcher_id) {
+    m_thread = std::thread([this] { DrainLoop(); });
+}
+
+KRLogDispatcher::~KRLogDispatcher() {
+    {
+        std::lock_guard<std::mutex> lock(m_park_mutex);
+        m_stopped = true;
+        m_park_cond.notify_all();
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    Flush();
+}
+
+bool KRLogDispatcher::Post(LogLevel level, std::string tag, std::string message, std::string instance_id) {
+    Ring *ring = GetThreadRing();
+    size_t tail = ring->tail.load(std::memory_order_relaxed);
+    size_t used = tail - ring->head.load(std::memory_order_acquire);
+    if (used > ring->mask) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    KRLogRecord &record = ring->slots[tail & ring->mask];
+    record.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+    record.level = level;
+    record.tag = std::move(tag);
+    record.message = std::move(message);
+    record.instance_id = std::move(instance_id);
+    ring->tail.store(tail + 1, std::memory_order_release);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    // 后台线程空闲挂起时唤醒；缓冲区过半时提前唤醒，减少丢弃
+    if ((m_idle.load(std::memory_order_relaxed) && m_idle.exchange(false)) || used + 1 == (ring->mask + 1) / 2) {
+        Wake();
+    }
+    return true;
+}
+
+void KRLogDispatcher::Flush() {
+    while (DrainOnce()) {
+    }
+}
+
+KRLogDispatcher::Ring *KRLogDispatcher::GetThreadRing() {
+    if (tls_ring.owner_id == m_id) {
+        return static_cast<Ring *>(tls_ring.ring.get());
+    }
+    if (tls_ring.retired) {
+        tls_ring.retired->store(true, std::memory_order_release);
+    }
+    auto ring = std::make_shared<Ring>(m_ring_capacity);
+    {
+        std::lock_guard<std::mutex> lock(m_rings_mutex);
+        m_rings.push_back(ring);
+    }
+    tls_ring.owner_id = m_id;
+    tls_ring.retired = &ring->retired;
+    tls_ring.ring = std::move(ring);
+    return static_cast<Ring *>(tls_ring.ring.get());
+}
+
+void KRLogDispatcher::Wake() {
+    std::lock_guard<std::mutex> lock(m_park_mutex);
+    m_park_cond.notify_one();
+}
+
+void KRLogDispatcher::DrainLoop() {
+    while (true) {
+        if (DrainOnce()) {
+            std::unique_lock<std::mutex> lock(m_park_mutex);
+            if (m_stopped) {
+                return;
+            }
+            // 持续有日志时按固定间隔批量输出
+            m_park_cond.wait_for(lock, std::chrono::milliseconds(kDrainIntervalMs));
+            continue;
+        }
+        m_idle.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // 挂起前再检查一次，与 Post 配合避免丢失唤醒
+        if (DrainOnce()) {
+            m_idle.store(false);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_park_mutex);
+        m_park_cond.wait(lock, [this] { return m_stopped || !m_idle.load(); });
+        if (m_stopped) {
+            return;
+        }
+    }
+}
+
+bool KRLogDispatcher::DrainOnce() {
+    std::lock_guard<std::mutex> drain_lock(m_drain_mutex);
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> lock(m_rings_mutex);
+        rings = m_rings;
+    }
+    bool has_retired = false;
+    for (auto &ring : rings) {
+        // 先读 retired 再读 tail，确保线程退出前写入的日志都能取到
+        bool retired = ring->retired.load(std::memory_order_acquire);
+        size_t head = ring->head.load(std::memory_order_relaxed);
+        size_t tail = ring->tail.load(std::memory_order_acquire);
+        for (; head != tail; ++head) {
+            m_batch.push_back(std::move(ring->slots[head & ring->mask]));
+        }
+        ring->head.store(head, std::memory_order_release);
+        has_retired = has_retired || retired;
+    }
+    if (has_retired) {
+        std::lock_guard<std::mutex> lock(m_rings_mutex);
+        m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(),
+                                     [](const std::shared_ptr<Ring> &ring) {
+                                         return ring->retired.load(std::memory_order_acquire) &&
+                                                ring->head.load(std::memory_order_relaxed) ==
+                                                    ring->tail.load(std::memory_order_acquire);
+                                     }),
+                      m_rings.end());
+    }
+
+    uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+    if (m_batch.empty() && dropped == m_reported_dropped) {
+        return false;
+    }
+    // 同一线程内序号递增，按序号归并即可保持各线程内的先后顺序
+    std::sort(m_batch.begin(), m_batch.end(),
+              [](const KRLogRecord &a, const KRLogRecord &b) { return a.sequence < b.sequence; });
+    if (dropped != m_reported_dropped) {
+        KRLogRecord record;
+        record.sequence = m_batch.empty() ? 0 : m_batch.back().sequence;
+        record.level = LOG_ERROR;
+        record.tag = "KRRenderLog";
+        record.message = "log buffer overflow, dropped " + std::to_string(dropped - m_reported_dropped) + " records";
+        m_batch.push_back(std::move(record));
+        m_reported_dropped = dropped;
+    }
+    m_sink(m_batch);
+    m_batch.clear();
+    return true;
+}
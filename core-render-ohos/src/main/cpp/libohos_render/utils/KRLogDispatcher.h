@@ -0,0 +1,111 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRLOGDISPATCHER_H
+#define CORE_RENDER_OHOS_KRLOGDISPATCHER_H
+
+#include <hilog/log.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * 已格式化好的一条日志
+ */
+struct KRLogRecord {
+    uint64_t sequence = 0;  // 全局递增序号，用于跨线程归并
+    LogLevel level = LOG_INFO;
+    std::string tag;
+    std::string message;
+    std::string instance_id;  // 非空时表示需要转发到该实例的 ArkTS 日志模块
+};
+
+/**
+ * 异步日志分发
+ * - 每个写日志的线程拥有一个单生产者单消费者的无锁环形缓冲区，写入不加锁、不做 IO
+ * - 由一个后台线程批量取出，按序号归并后交给 sink；同一线程的日志保持先后顺序
+ * - 缓冲区满时丢弃并计数，下一批输出时补一条丢弃提示
+ */
+class KRLogDispatcher {
+ public:
+    using Sink = std::function<void(std::vector<KRLogRecord> &records)>;
+
+    static constexpr size_t kDefaultRingCapacity = 256;
+
+    /**
+     * 全局实例，输出到 KRRenderAdapterManager 或 ArkTS 日志模块，定义在 KRLogDispatcherDefault.cpp
+     */
+    static KRLogDispatcher &GetInstance();
+
+    explicit KRLogDispatcher(Sink sink, size_t ring_capacity = kDefaultRingCapacity);
+    ~KRLogDispatcher();
+
+    KRLogDispatcher(const KRLogDispatcher &) = delete;
+    KRLogDispatcher &operator=(const KRLogDispatcher &) = delete;
+
+    /**
+     * 投递一条日志，可在任意线程调用
+     * @return 缓冲区已满被丢弃时返回 false
+     */
+    bool Post(LogLevel level, std::string tag, std::string message, std::string instance_id = "");
+
+    /**
+     * 在调用线程同步输出所有已投递的日志，用于崩溃前或测试
+     */
+    void Flush();
+
+    /**
+     * 累计丢弃的日志条数
+     */
+    uint64_t GetDroppedCount() const {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+ private:
+    struct Ring;
+
+    Ring *GetThreadRing();
+    void DrainLoop();
+    bool DrainOnce();
+    void Wake();
+
+    const Sink m_sink;
+    const size_t m_ring_capacity;
+    const uint64_t m_id;
+
+    std::mutex m_rings_mutex;
+    std::vector<std::shared_ptr<Ring>> m_rings;
+
+    std::mutex m_drain_mutex;  // 保证环形缓冲区只有一个消费者
+    std::vector<KRLogRecord> m_batch;
+
+    std::atomic<uint64_t> m_sequence{0};
+    std::atomic<uint64_t> m_dropped{0};
+    uint64_t m_reported_dropped = 0;
+
+    std::mutex m_park_mutex;
+    std::condition_variable m_park_cond;
+    std::atomic<bool> m_idle{false};
+    bool m_stopped = false;
+    std::thread m_thread;
+};
+
+#endif  // CORE_RENDER_OHOS_KRLOGDISPATCHER_H
@@ -0,0 +1,71 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRLogDispatcher.h"
+
+#include <map>
+#include "libohos_render/adapter/KRRenderAdapterManager.h"
+#include "libohos_render/foundation/KRCommon.h"
+#include "libohos_render/foundation/thread/KRMainThread.h"
+#include "libohos_render/manager/KRArkTSManager.h"
+
+// 全局实例依赖适配器与 ArkTS，与分发逻辑分开编译，宿主机测试可替换为自己的实现
+
+constexpr char kArkTSLogModuleName[] = "KRLogModuleArkTS";
+constexpr char kArkTSLogBatchMethod[] = "logBatch";
+
+namespace {
+
+const char *ArkTSMethodForLevel(LogLevel level) {
+    if (level == LOG_ERROR) {
+        return "logError";
+    }
+    if (level == LOG_DEBUG) {
+        return "logDebug";
+    }
+    return "logInfo";
+}
+
+// 原生日志交给适配器，Kotlin 侧日志按实例合并后一次性转发给 ArkTS
+void DefaultSink(std::vector<KRLogRecord> &records) {
+    std::map<std::string, KRRenderValue::Array> arkts_batches;
+    for (auto &record : records) {
+        if (record.instance_id.empty()) {
+            KRRenderAdapterManager::GetInstance().Log(record.level, record.tag, record.message);
+            continue;
+        }
+        auto &batch = arkts_batches[record.instance_id];
+        batch.push_back(NewKRRenderValue(ArkTSMethodForLevel(record.level)));
+        batch.push_back(NewKRRenderValue(std::move(record.message)));
+    }
+    for (auto &item : arkts_batches) {
+        auto instance_id = item.first;
+        auto params = NewKRRenderValue(std::move(item.second));
+        KRMainThread::RunOnMainThread([instance_id, params] {
+            KRArkTSManager::GetInstance().CallArkTSMethod(instance_id, KRNativeCallArkTSMethod::CallModuleMethod,
+                                                          NewKRRenderValue(kArkTSLogModuleName),
+                                                          NewKRRenderValue(kArkTSLogBatchMethod), params, nullptr,
+                                                          nullptr, nullptr);
+        });
+    }
+}
+
+}  // namespace
+
+KRLogDispatcher &KRLogDispatcher::GetInstance() {
+    // 不析构，保证其他静态对象析构时仍可写日志
+    static KRLogDispatcher *instance = new KRLogDispatcher(DefaultSink);
+    return *instance;
+}
@@ -0,0 +1,166 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRPngEncoder.h"
+
+#include <unistd.h>
+#include <zlib.h>
+#include <algorithm>
+#include <cstdio>
+
+static bool WriteFileAtomically(const std::string &path, const std::string &data) {
+    std::string tmpPath = path + ".tmp";
+    FILE *file = fopen(tmpPath.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = (fclose(file) == 0) && ok;
+    if (!ok || rename(tmpPath.c_str(), path.c_str()) != 0) {
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+static void AppendUint32(std::string &out, uint32_t value) {
+    out.push_back(static_cast<char>(value >> 24));
+    out.push_back(static_cast<char>(value >> 16));
+    out.push_back(static_cast<char>(value >> 8));
+    out.push_back(static_cast<char>(value));
+}
+
+// 写入 chunk 头，返回类型字段的位置，数据写完后调用 EndChunk 补齐长度与 crc
+static size_t BeginChunk(std::string &out, const char *type) {
+    AppendUint32(out, 0);
+    auto start = out.size();
+    out.append(type, 4);
+    return start;
+}
+
+static void EndChunk(std::string &out, size_t start) {
+    auto length = static_cast<uint32_t>(out.size() - start - 4);
+    for (int i = 0; i < 4; ++i) {
+        out[start - 4 + i] = static_cast<char>(length >> (24 - i * 8));
+    }
+    auto crc = crc32(0, reinterpret_cast<const Bytef *>(out.data() + start), out.size() - start);
+    AppendUint32(out, static_cast<uint32_t>(crc));
+}
+
+// 转为非预乘的 RGBA
+static void ConvertRow(const KRRawImage &image, const uint8_t *src, uint8_t *dst) {
+    for (uint32_t x = 0; x < image.width; ++x, src += 4, dst += 4) {
+        uint8_t r = image.bgra ? src[2] : src[0];
+        uint8_t g = src[1];
+        uint8_t b = image.bgra ? src[0] : src[2];
+        uint8_t a = src[3];
+        if (image.premultiplied && a != 255) {
+            if (a == 0) {
+                r = g = b = 0;
+            } else {
+                r = static_cast<uint8_t>(std::min(255, (r * 255 + a / 2) / a));
+                g = static_cast<uint8_t>(std::min(255, (g * 255 + a / 2) / a));
+                b = static_cast<uint8_t>(std::min(255, (b * 255 + a / 2) / a));
+            }
+        }
+        dst[0] = r;
+        dst[1] = g;
+        dst[2] = b;
+        dst[3] = a;
+    }
+}
+
+bool KRPngEncoder::Encode(const KRRawImage &image, int level, std::string &out) {
+    size_t row_size = static_cast<size_t>(image.width) * 4;
+    if (image.width == 0 || image.height == 0 || image.row_bytes < row_size ||
+        image.pixels.size() < image.row_bytes * (image.height - 1) + row_size) {
+        return false;
+    }
+    level = std::max(0, std::min(9, level));
+    bool sub_filter = level >= 2;
+
+    z_stream stream = {};
+    if (deflateInit(&stream, level) != Z_OK) {
+        return false;
+    }
+    out.clear();
+    out.reserve(deflateBound(&stream, (row_size + 1) * image.height) + 64);
+    static const char kSignature[] = {'\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n'};
+    out.append(kSignature, sizeof(kSignature));
+
+    auto ihdr = BeginChunk(out, "IHDR");
+    AppendUint32(out, image.width);
+    AppendUint32(out, image.height);
+    out.push_back(8);  // 位深
+    out.push_back(6);  // RGBA
+    out.push_back(0);
+    out.push_back(0);
+    out.push_back(0);
+    EndChunk(out, ihdr);
+
+    auto idat = BeginChunk(out, "IDAT");
+    // 第 0 字节为滤波类型
+    std::vector<uint8_t> row(row_size + 1);
+    std::vector<uint8_t> filtered(sub_filter ? row_size + 1 : 0);
+    std::vector<uint8_t> buffer(64 * 1024);
+    bool ok = true;
+    for (uint32_t y = 0; y < image.height && ok; ++y) {
+        ConvertRow(image, image.pixels.data() + image.row_bytes * y, row.data() + 1);
+        uint8_t *input = row.data();
+        if (sub_filter) {
+            filtered[0] = 1;
+            std::copy(row.begin() + 1, row.begin() + 5, filtered.begin() + 1);
+            for (size_t i = 5; i <= row_size; ++i) {
+                filtered[i] = static_cast<uint8_t>(row[i] - row[i - 4]);
+            }
+            input = filtered.data();
+        }
+        stream.next_in = input;
+        stream.avail_in = static_cast<uInt>(row_size + 1);
+        int flush = y + 1 == image.height ? Z_FINISH : Z_NO_FLUSH;
+        do {
+            stream.next_out = buffer.data();
+            stream.avail_out = static_cast<uInt>(buffer.size());
+            auto ret = deflate(&stream, flush);
+            if (ret == Z_STREAM_ERROR) {
+                ok = false;
+                break;
+            }
+            out.append(reinterpret_cast<const char *>(buffer.data()), buffer.size() - stream.avail_out);
+        } while (stream.avail_out == 0 || (flush == Z_FINISH && stream.avail_in > 0));
+    }
+    deflateEnd(&stream);
+    if (!ok) {
+        out.clear();
+        return false;
+    }
+    EndChunk(out, idat);
+
+    auto iend = BeginChunk(out, "IEND");
+    EndChunk(out, iend);
+    return true;
+}
+
+bool KRPngEncoder::EncodeToFile(const KRRawImage &image, int level, const std::string &path, std::string &out) {
+    if (!Encode(image, level, out)) {
+        out.clear();
+        return false;
+    }
+    if (!path.empty() && !WriteFileAtomically(path, out)) {
+        out.clear();
+        return false;
+    }
+    return true;
+}
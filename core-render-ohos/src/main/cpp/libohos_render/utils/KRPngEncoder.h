@@ -0,0 +1,60 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPNGENCODER_H
+#define CORE_RENDER_OHOS_KRPNGENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * 原始像素，每像素 4 字节
+ */
+struct KRRawImage {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    size_t row_bytes = 0;  // 行跨度，不小于 width * 4
+    std::vector<uint8_t> pixels;
+    bool bgra = false;          // 通道顺序为 BGRA
+    bool premultiplied = true;  // 颜色已预乘 alpha，编码时还原
+};
+
+/**
+ * 基于 zlib 的 PNG 编码（RGBA 8 位），不依赖 ArkUI，可在任意线程调用
+ */
+class KRPngEncoder {
+ public:
+    // 不压缩，编码最快，体积约为像素字节数
+    static constexpr int kLevelStore = 0;
+    // 轻度压缩，适合只在本机使用的缓存文件
+    static constexpr int kLevelFast = 1;
+    static constexpr int kLevelDefault = 6;
+
+    /**
+     * @param level zlib 压缩等级 0~9，等级不低于 2 时对扫描行做 Sub 滤波以提高压缩率
+     * @return 成功时 out 为完整的 PNG 数据
+     */
+    static bool Encode(const KRRawImage &image, int level, std::string &out);
+
+    /**
+     * 编码并在 path 非空时写入文件（先写临时文件再重命名），供后台线程整体执行
+     * @return 编码或写入失败时返回 false，out 为空
+     */
+    static bool EncodeToFile(const KRRawImage &image, int level, const std::string &path, std::string &out);
+};
+
+#endif  // CORE_RENDER_OHOS_KRPNGENCODER_H
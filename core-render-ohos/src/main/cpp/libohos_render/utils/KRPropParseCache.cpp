@@ -0,0 +1,149 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRPropParseCache.h"
+
+#include "libohos_render/utils/KRConvertUtil.h"
+#include "libohos_render/utils/KRLinearGradientParser.h"
+
+namespace kuikly {
+namespace util {
+
+static constexpr size_t kMaxColorCount = 512;
+static constexpr size_t kMaxBorderCount = 128;
+static constexpr size_t kMaxTransformCount = 512;
+static constexpr size_t kMaxGradientCount = 128;
+// 超长的属性字符串通常不会重复出现，直接解析不入缓存
+static constexpr size_t kMaxKeyLength = 512;
+
+static std::shared_ptr<const KRParsedBorder> ParseBorder(const std::string &str) {
+    auto splits = ConvertSplit(str, " ");
+    if (splits.size() < 3) {
+        return nullptr;
+    }
+    auto border = std::make_shared<KRParsedBorder>();
+    border->width = ConvertToFloat(splits[0]);
+    border->style = ConverToBorderStyle(splits[1]);
+    border->color = ConvertToHexColor(splits[2]);
+    return border;
+}
+
+static std::shared_ptr<const KRParsedLinearGradient> ParseLinearGradient(const std::string &str) {
+    KRLinearGradientParser parser;
+    if (!parser.ParseFromCssLinearGradient(str)) {
+        return nullptr;
+    }
+    auto parsed = std::make_shared<KRParsedLinearGradient>();
+    parsed->arkui_direction = parser.GetArkUIDirection();
+    parsed->colors = parser.GetColors();
+    parsed->stops = parser.GetLocations();
+    if (!parsed->stops.empty()) {
+        parsed->stops.back() = 1.0;
+    }
+    return parsed;
+}
+
+KRPropParseCache &KRPropParseCache::GetInstance() {
+    static KRPropParseCache cache;
+    return cache;
+}
+
+KRPropParseCache::KRPropParseCache()
+    : colors_(kMaxColorCount),
+      borders_(kMaxBorderCount),
+      transforms_(kMaxTransformCount),
+      gradients_(kMaxGradientCount) {}
+
+template <typename Value, typename Parser>
+Value KRPropParseCache::Lookup(Table<Value> &table, const std::string &key, Parser &&parse) {
+    if (key.size() > kMaxKeyLength) {
+        return parse(key);
+    }
+    {
+        std::lock_guard<std::mutex> lock(table.mutex);
+        if (auto value = table.lru.Get(key)) {
+            return *value;
+        }
+    }
+    // 解析在锁外进行，并发未命中时可能重复解析，结果相同
+    auto clear_count = clear_count_.load(std::memory_order_acquire);
+    Value value = parse(key);
+    std::lock_guard<std::mutex> lock(table.mutex);
+    // 解析期间缓存被清空（如颜色适配器变更）时，结果可能依赖旧状态，不入缓存
+    if (clear_count_.load(std::memory_order_acquire) == clear_count) {
+        table.lru.Put(key, value, 0);
+    }
+    return value;
+}
+
+uint32_t KRPropParseCache::GetColor(const std::string &color_str) {
+    // 适配器的解析结果可能随业务状态（如深色模式）变化，不缓存
+    if (color_adapter_registered_.load(std::memory_order_acquire)) {
+        return ParseHexColor(color_str);
+    }
+    return Lookup(colors_, color_str, ParseColorLiteral);
+}
+
+std::shared_ptr<const KRParsedBorder> KRPropParseCache::GetBorder(const std::string &css_border) {
+    if (color_adapter_registered_.load(std::memory_order_acquire)) {
+        return ParseBorder(css_border);
+    }
+    return Lookup(borders_, css_border, ParseBorder);
+}
+
+std::shared_ptr<const KRParsedTransform> KRPropParseCache::GetTransform(const std::string &css_transform) {
+    return Lookup(transforms_, css_transform, [](const std::string &str) -> std::shared_ptr<const KRParsedTransform> {
+        auto parsed = std::make_shared<KRParsedTransform>();
+        if (!parsed->transform.ParseFromCssTransform(str)) {
+            return nullptr;
+        }
+        parsed->matrix = parsed->transform.GetMatrixWithNoRotate();
+        return parsed;
+    });
+}
+
+std::shared_ptr<const KRParsedLinearGradient> KRPropParseCache::GetLinearGradient(const std::string &css_gradient) {
+    if (color_adapter_registered_.load(std::memory_order_acquire)) {
+        return ParseLinearGradient(css_gradient);
+    }
+    return Lookup(gradients_, css_gradient, ParseLinearGradient);
+}
+
+void KRPropParseCache::SetColorAdapterRegistered(bool registered) {
+    color_adapter_registered_.store(registered, std::memory_order_release);
+    Clear();
+}
+
+void KRPropParseCache::Clear() {
+    // 先递增计数再清空，保证清空前开始的解析结果不会在清空后写入
+    clear_count_.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::lock_guard<std::mutex> lock(colors_.mutex);
+        colors_.lru.Clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(borders_.mutex);
+        borders_.lru.Clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(transforms_.mutex);
+        transforms_.lru.Clear();
+    }
+    std::lock_guard<std::mutex> lock(gradients_.mutex);
+    gradients_.lru.Clear();
+}
+
+}  // namespace util
+}  // namespace kuikly
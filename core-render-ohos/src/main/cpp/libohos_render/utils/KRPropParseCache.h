@@ -0,0 +1,108 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRPROPPARSECACHE_H
+#define CORE_RENDER_OHOS_KRPROPPARSECACHE_H
+
+#include <arkui/native_type.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "libohos_render/foundation/KRLRUCache.h"
+#include "libohos_render/utils/KRTransformParser.h"
+
+namespace kuikly {
+namespace util {
+
+/**
+ * 解析后的 border 属性，对应 "width style color"
+ */
+struct KRParsedBorder {
+    float width = 0;
+    ArkUI_BorderStyle style = ARKUI_BORDER_STYLE_SOLID;
+    uint32_t color = 0;
+};
+
+/**
+ * 解析后的 transform 属性
+ */
+struct KRParsedTransform {
+    KRTransformParser transform;
+    // 不含旋转的变换矩阵，平移分量为相对尺寸的比例，使用时需乘以宽高
+    std::array<double, 16> matrix;
+};
+
+/**
+ * 解析后的线性渐变属性
+ */
+struct KRParsedLinearGradient {
+    int arkui_direction = 0;
+    std::vector<uint32_t> colors;
+    std::vector<float> stops;  // 最后一个位置固定为 1.0
+};
+
+/**
+ * 属性字符串解析缓存，以原始属性字符串为 key，返回不可变的解析结果
+ * - 各类型分别使用有界 LRU 与独立的锁，可在任意线程调用
+ * - 解析在锁外进行，解析失败的结果（nullptr）同样会被缓存；解析期间发生 Clear 时结果不入缓存
+ * - 只缓存原生解析的颜色；注册了颜色适配器时，颜色及含颜色的 border、渐变每次都交给适配器解析，不入缓存
+ */
+class KRPropParseCache {
+ public:
+    static KRPropParseCache &GetInstance();
+
+    uint32_t GetColor(const std::string &color_str);
+
+    std::shared_ptr<const KRParsedBorder> GetBorder(const std::string &css_border);
+
+    std::shared_ptr<const KRParsedTransform> GetTransform(const std::string &css_transform);
+
+    std::shared_ptr<const KRParsedLinearGradient> GetLinearGradient(const std::string &css_gradient);
+
+    void Clear();
+
+    /**
+     * 颜色适配器注册或移除时调用，同时清空缓存
+     */
+    void SetColorAdapterRegistered(bool registered);
+
+ private:
+    KRPropParseCache();
+
+    template <typename Value> struct Table {
+        explicit Table(size_t max_count) : lru(0, max_count) {}
+        std::mutex mutex;
+        KRLRUCache<std::string, Value> lru;
+    };
+
+    template <typename Value, typename Parser>
+    Value Lookup(Table<Value> &table, const std::string &key, Parser &&parse);
+
+    Table<uint32_t> colors_;
+    Table<std::shared_ptr<const KRParsedBorder>> borders_;
+    Table<std::shared_ptr<const KRParsedTransform>> transforms_;
+    Table<std::shared_ptr<const KRParsedLinearGradient>> gradients_;
+    std::atomic<bool> color_adapter_registered_{false};
+    std::atomic<uint32_t> clear_count_{0};
+};
+
+}  // namespace util
+}  // namespace kuikly
+
+#endif  // CORE_RENDER_OHOS_KRPROPPARSECACHE_H
@@ -18,37 +18,98 @@
 
 #include <arm-linux-ohos/asm/setup.h>
 #include <hilog/log.h>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include "libohos_render/adapter/KRRenderAdapterManager.h"
+#include "libohos_render/utils/KRLogDispatcher.h"
 
+/**
+ * 一条日志，析构时投递到 KRLogDispatcher 异步输出
+ * 通过 KR_LOG_* 宏使用，级别被过滤时不会构造对象，也不会对参数求值
+ */
 class KRRenderLog {
  public:
-    explicit KRRenderLog(LogLevel log_level) : log_level_(log_level), tag_("KRRender") {}
-    KRRenderLog(LogLevel log_level, const std::string &tag) : log_level_(log_level), tag_(tag) {}
+    explicit KRRenderLog(LogLevel log_level) : tag_("KRRender"), log_level_(log_level) {}
+    KRRenderLog(LogLevel log_level, const std::string &tag) : tag_(tag), log_level_(log_level) {}
 
     ~KRRenderLog() {
-        stream_ << std::endl;
-        KRRenderAdapterManager::GetInstance().Log(log_level_, tag_, std::move(stream_.str()));
+        message_.push_back('\n');
+        KRLogDispatcher::GetInstance().Post(log_level_, std::move(tag_), std::move(message_));
+    }
+
+    static bool IsLoggable(LogLevel log_level) {
+        return static_cast<int>(log_level) >= min_level_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 低于该级别的日志直接丢弃，默认全部输出
+     */
+    static void SetMinLevel(LogLevel log_level) {
+        min_level_.store(static_cast<int>(log_level), std::memory_order_relaxed);
     }
 
     template <typename T> KRRenderLog &operator<<(const T &value) {
-        stream_ << value;
+        Append(value);
         return *this;
     }
 
  private:
+    // 常见类型直接追加到字符串，避免每条日志构造 std::stringstream
+    template <typename T> void Append(const T &value) {
+        if constexpr (std::is_convertible<const T &, const char *>::value) {
+            const char *str = value;
+            message_.append(str ? str : "(null)");
+        } else if constexpr (std::is_convertible<const T &, std::string_view>::value) {
+            message_.append(std::string_view(value));
+        } else if constexpr (std::is_same<T, char>::value || std::is_same<T, signed char>::value ||
+                             std::is_same<T, unsigned char>::value) {
+            message_.push_back(static_cast<char>(value));
+        } else if constexpr (std::is_same<T, bool>::value) {
+            message_.push_back(value ? '1' : '0');
+        } else if constexpr (std::is_integral<T>::value) {
+            char buf[24];
+            auto result = std::to_chars(buf, buf + sizeof(buf), value);
+            message_.append(buf, result.ptr);
+        } else if constexpr (std::is_enum<T>::value && std::is_convertible<T, int>::value) {
+            Append(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_floating_point<T>::value) {
+            char buf[32];
+            int len = snprintf(buf, sizeof(buf), "%g", static_cast<double>(value));
+            message_.append(buf, len > 0 ? len : 0);
+        } else if constexpr (std::is_pointer<T>::value) {
+            char buf[24];
+            int len = snprintf(buf, sizeof(buf), "%p", static_cast<const void *>(value));
+            message_.append(buf, len > 0 ? len : 0);
+        } else {
+            std::ostringstream stream;
+            stream << value;
+            message_.append(stream.str());
+        }
+    }
+
     std::string tag_;
     LogLevel log_level_;
-    std::stringstream stream_;
+    std::string message_;
+    inline static std::atomic<int> min_level_{static_cast<int>(LOG_DEBUG)};
 };
 
-#define KR_LOG_INFO KRRenderLog(LOG_INFO)
-#define KR_LOG_DEBUG KRRenderLog(LOG_DEBUG)
-#define KR_LOG_ERROR KRRenderLog(LOG_ERROR)
+// 级别被过滤时跳过整条语句，if/else 写法保证宏可以安全地用在不带花括号的 if 中
+#define KR_LOG_WITH_LEVEL(level, ...) \
+    if (!KRRenderLog::IsLoggable(level)) { \
+    } else \
+        KRRenderLog(level, ##__VA_ARGS__)
+
+#define KR_LOG_INFO KR_LOG_WITH_LEVEL(LOG_INFO)
+#define KR_LOG_DEBUG KR_LOG_WITH_LEVEL(LOG_DEBUG)
+#define KR_LOG_ERROR KR_LOG_WITH_LEVEL(LOG_ERROR)
 
-#define KR_LOG_INFO_WITH_TAG(tag) KRRenderLog(LOG_INFO, tag)
-#define KR_LOG_DEBUG_WITH_TAG(tag) KRRenderLog(LOG_DEBUG, tag)
-#define KR_LOG_ERROR_WITH_TAG(tag) KRRenderLog(LOG_ERROR, tag)
+#define KR_LOG_INFO_WITH_TAG(tag) KR_LOG_WITH_LEVEL(LOG_INFO, tag)
+#define KR_LOG_DEBUG_WITH_TAG(tag) KR_LOG_WITH_LEVEL(LOG_DEBUG, tag)
+#define KR_LOG_ERROR_WITH_TAG(tag) KR_LOG_WITH_LEVEL(LOG_ERROR, tag)
 
 #endif  // CORE_RENDER_OHOS_KRRENDERLOGER_H
@@ -0,0 +1,411 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRTextCodec.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define KR_TEXT_CODEC_NEON 1
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define KR_TEXT_CODEC_SSSE3 1
+#endif
+
+namespace {
+
+constexpr char kBase64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                "abcdefghijklmnopqrstuvwxyz"
+                                "0123456789+/";
+// RFC 3986 section 2.1: URI producers should use uppercase hexadecimal digits for all percent-encodings.
+constexpr char kHexDigitsUpper[] = "0123456789ABCDEF";
+constexpr uint8_t kInvalid = 0xFF;
+
+constexpr std::array<uint8_t, 256> MakeBase64DecodeTable() {
+    std::array<uint8_t, 256> table{};
+    for (size_t i = 0; i < table.size(); ++i) {
+        table[i] = kInvalid;
+    }
+    for (uint8_t i = 0; i < 64; ++i) {
+        table[static_cast<uint8_t>(kBase64Chars[i])] = i;
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> MakeHexTable() {
+    std::array<uint8_t, 256> table{};
+    for (size_t i = 0; i < table.size(); ++i) {
+        table[i] = kInvalid;
+    }
+    for (uint8_t i = 0; i < 10; ++i) {
+        table['0' + i] = i;
+    }
+    for (uint8_t i = 0; i < 6; ++i) {
+        table['A' + i] = 10 + i;
+        table['a' + i] = 10 + i;
+    }
+    return table;
+}
+
+constexpr std::array<bool, 256> MakeURISafeTable() {
+    std::array<bool, 256> table{};
+    for (int c = 0; c < 256; ++c) {
+        table[c] = ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z') || ('0' <= c && c <= '9') || c == '-' ||
+                   c == '_' || c == '.' || c == '!' || c == '~' || c == '*' || c == '\'' || c == '(' || c == ')';
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> kBase64DecodeTable = MakeBase64DecodeTable();
+constexpr std::array<uint8_t, 256> kHexTable = MakeHexTable();
+constexpr std::array<bool, 256> kURISafeTable = MakeURISafeTable();
+
+void Base64EncodeScalar(const uint8_t *src, size_t len, char *dst) {
+    size_t i = 0;
+    for (; i + 3 <= len; i += 3, dst += 4) {
+        uint32_t v = (src[i] << 16) | (src[i + 1] << 8) | src[i + 2];
+        dst[0] = kBase64Chars[(v >> 18) & 0x3F];
+        dst[1] = kBase64Chars[(v >> 12) & 0x3F];
+        dst[2] = kBase64Chars[(v >> 6) & 0x3F];
+        dst[3] = kBase64Chars[v & 0x3F];
+    }
+    size_t rest = len - i;
+    if (rest > 0) {
+        uint32_t v = (src[i] << 16) | (rest == 2 ? (src[i + 1] << 8) : 0);
+        dst[0] = kBase64Chars[(v >> 18) & 0x3F];
+        dst[1] = kBase64Chars[(v >> 12) & 0x3F];
+        dst[2] = rest == 2 ? kBase64Chars[(v >> 6) & 0x3F] : '=';
+        dst[3] = '=';
+    }
+}
+
+#if defined(KR_TEXT_CODEC_NEON)
+
+// 每次 48 字节 -> 64 字符，返回已处理的输入字节数
+size_t Base64EncodeBlocks(const uint8_t *src, size_t len, char *dst) {
+    const uint8_t *chars = reinterpret_cast<const uint8_t *>(kBase64Chars);
+    const uint8x16x4_t table = {{vld1q_u8(chars), vld1q_u8(chars + 16), vld1q_u8(chars + 32), vld1q_u8(chars + 48)}};
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+    size_t i = 0;
+    for (; i + 48 <= len; i += 48) {
+        uint8x16x3_t in = vld3q_u8(src + i);
+        uint8x16x4_t out;
+        out.val[0] = vqtbl4q_u8(table, vshrq_n_u8(in.val[0], 2));
+        out.val[1] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask));
+        out.val[2] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask));
+        out.val[3] = vqtbl4q_u8(table, vandq_u8(in.val[2], mask));
+        vst4q_u8(reinterpret_cast<uint8_t *>(dst) + i / 3 * 4, out);
+    }
+    return i;
+}
+
+inline uint8x16_t InRange(uint8x16_t v, uint8_t lo, uint8_t hi) {
+    return vcleq_u8(vsubq_u8(v, vdupq_n_u8(lo)), vdupq_n_u8(hi - lo));
+}
+
+// 字符映射为 6 位值，非法字符对应的 valid 位清零
+inline uint8x16_t Base64DecodeLane(uint8x16_t v, uint8x16_t &valid) {
+    uint8x16_t upper = InRange(v, 'A', 'Z');
+    uint8x16_t lower = InRange(v, 'a', 'z');
+    uint8x16_t digit = InRange(v, '0', '9');
+    uint8x16_t plus = vceqq_u8(v, vdupq_n_u8('+'));
+    uint8x16_t slash = vceqq_u8(v, vdupq_n_u8('/'));
+    // 'A' -> 0, 'a' -> 26, '0' -> 52, '+' -> 62, '/' -> 63
+    uint8x16_t offset = vandq_u8(upper, vdupq_n_u8(static_cast<uint8_t>(-65)));
+    offset = vorrq_u8(offset, vandq_u8(lower, vdupq_n_u8(static_cast<uint8_t>(-71))));
+    offset = vorrq_u8(offset, vandq_u8(digit, vdupq_n_u8(4)));
+    offset = vorrq_u8(offset, vandq_u8(plus, vdupq_n_u8(19)));
+    offset = vorrq_u8(offset, vandq_u8(slash, vdupq_n_u8(16)));
+    valid = vandq_u8(valid, vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(vorrq_u8(digit, plus), slash)));
+    return vaddq_u8(v, offset);
+}
+
+// 每次 64 字符 -> 48 字节，遇到含非法字符的块即停止，返回已处理的输入字符数
+size_t Base64DecodeBlocks(const uint8_t *src, size_t len, uint8_t *dst) {
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        uint8x16x4_t in = vld4q_u8(src + i);
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        uint8x16_t a = Base64DecodeLane(in.val[0], valid);
+        uint8x16_t b = Base64DecodeLane(in.val[1], valid);
+        uint8x16_t c = Base64DecodeLane(in.val[2], valid);
+        uint8x16_t d = Base64DecodeLane(in.val[3], valid);
+        if (vminvq_u8(valid) == 0) {
+            break;
+        }
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+        vst3q_u8(dst + i / 4 * 3, out);
+    }
+    return i;
+}
+
+inline bool IsURISafe16(const uint8_t *src) {
+    uint8x16_t v = vld1q_u8(src);
+    uint8x16_t safe = vorrq_u8(InRange(v, '\'', '*'), InRange(v, '-', '.'));
+    safe = vorrq_u8(safe, InRange(v, '0', '9'));
+    safe = vorrq_u8(safe, InRange(v, 'A', 'Z'));
+    safe = vorrq_u8(safe, InRange(v, 'a', 'z'));
+    safe = vorrq_u8(safe, vceqq_u8(v, vdupq_n_u8('!')));
+    safe = vorrq_u8(safe, vceqq_u8(v, vdupq_n_u8('_')));
+    safe = vorrq_u8(safe, vceqq_u8(v, vdupq_n_u8('~')));
+    return vminvq_u8(safe) == 0xFF;
+}
+
+inline bool HasPercent16(const uint8_t *src) {
+    return vmaxvq_u8(vceqq_u8(vld1q_u8(src), vdupq_n_u8('%'))) != 0;
+}
+
+#elif defined(KR_TEXT_CODEC_SSSE3)
+
+// 每次读取 16 字节、处理其中 12 字节 -> 16 字符，返回已处理的输入字节数
+size_t Base64EncodeBlocks(const uint8_t *src, size_t len, char *dst) {
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    // 6 位值 -> 字符的偏移：0..25 'A'，26..51 'a' - 26，52..61 '0' - 52，62 '+' - 62，63 '/' - 63
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    size_t i = 0;
+    for (; i + 16 <= len; i += 12) {
+        __m128i in = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)), shuffle);
+        __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(t0, t1);
+        __m128i lut_index = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        __m128i is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        lut_index = _mm_or_si128(lut_index, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+        __m128i out = _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, lut_index));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i / 3 * 4), out);
+    }
+    return i;
+}
+
+inline __m128i InRange(__m128i v, uint8_t lo, uint8_t hi) {
+    __m128i d = _mm_sub_epi8(v, _mm_set1_epi8(static_cast<char>(lo)));
+    return _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(static_cast<char>(hi - lo))), d);
+}
+
+// 每次 16 字符 -> 12 字节，遇到含非法字符的块即停止，返回已处理的输入字符数
+size_t Base64DecodeBlocks(const uint8_t *src, size_t len, uint8_t *dst) {
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i upper = InRange(v, 'A', 'Z');
+        __m128i lower = InRange(v, 'a', 'z');
+        __m128i digit = InRange(v, '0', '9');
+        __m128i plus = _mm_cmpeq_epi8(v, _mm_set1_epi8('+'));
+        __m128i slash = _mm_cmpeq_epi8(v, _mm_set1_epi8('/'));
+        __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(_mm_or_si128(digit, plus), slash));
+        if (_mm_movemask_epi8(valid) != 0xFFFF) {
+            break;
+        }
+        // 'A' -> 0, 'a' -> 26, '0' -> 52, '+' -> 62, '/' -> 63
+        __m128i offset = _mm_and_si128(upper, _mm_set1_epi8(-65));
+        offset = _mm_or_si128(offset, _mm_and_si128(lower, _mm_set1_epi8(-71)));
+        offset = _mm_or_si128(offset, _mm_and_si128(digit, _mm_set1_epi8(4)));
+        offset = _mm_or_si128(offset, _mm_and_si128(plus, _mm_set1_epi8(19)));
+        offset = _mm_or_si128(offset, _mm_and_si128(slash, _mm_set1_epi8(16)));
+        __m128i values = _mm_add_epi8(v, offset);
+        // 每 4 个 6 位值拼成 24 位，再按大端取出 3 字节
+        __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)),
+                                        _mm_set1_epi32(0x00011000));
+        __m128i out =
+            _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        uint8_t *block = dst + i / 4 * 3;
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(block), out);
+        uint32_t tail = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(out, 8)));
+        memcpy(block + 8, &tail, sizeof(tail));
+    }
+    return i;
+}
+
+inline bool IsURISafe16(const uint8_t *src) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    __m128i safe = _mm_or_si128(InRange(v, '\'', '*'), InRange(v, '-', '.'));
+    safe = _mm_or_si128(safe, InRange(v, '0', '9'));
+    safe = _mm_or_si128(safe, InRange(v, 'A', 'Z'));
+    safe = _mm_or_si128(safe, InRange(v, 'a', 'z'));
+    safe = _mm_or_si128(safe, _mm_cmpeq_epi8(v, _mm_set1_epi8('!')));
+    safe = _mm_or_si128(safe, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+    safe = _mm_or_si128(safe, _mm_cmpeq_epi8(v, _mm_set1_epi8('~')));
+    return _mm_movemask_epi8(safe) == 0xFFFF;
+}
+
+inline bool HasPercent16(const uint8_t *src) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('%'))) != 0;
+}
+
+#else
+
+// 无向量指令时不处理整块数据，全部交给逐字节实现
+
+size_t Base64EncodeBlocks(const uint8_t *, size_t, char *) {
+    return 0;
+}
+
+size_t Base64DecodeBlocks(const uint8_t *, size_t, uint8_t *) {
+    return 0;
+}
+
+inline bool IsURISafe16(const uint8_t *) {
+    return false;
+}
+
+inline bool HasPercent16(const uint8_t *) {
+    return true;
+}
+
+#endif
+
+}  // namespace
+
+void KRTextCodec::Base64Encode(std::string_view in, std::string &out) {
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(in.data());
+    size_t base = out.size();
+    out.resize(base + Base64EncodedLength(in.size()));
+    char *dst = &out[base];
+    size_t done = Base64EncodeBlocks(src, in.size(), dst);
+    Base64EncodeScalar(src + done, in.size() - done, dst + done / 3 * 4);
+}
+
+std::string KRTextCodec::Base64Encode(std::string_view in) {
+    std::string out;
+    Base64Encode(in, out);
+    return out;
+}
+
+bool KRTextCodec::Base64Decode(std::string_view in, std::string &out) {
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(in.data());
+    size_t len = in.size();
+    size_t base = out.size();
+    out.resize(base + len / 4 * 3 + 3);
+    uint8_t *begin = reinterpret_cast<uint8_t *>(&out[0]);
+    uint8_t *dst = begin + base;
+
+    size_t i = Base64DecodeBlocks(src, len, dst);
+    dst += i / 4 * 3;
+    for (; i + 4 <= len; i += 4) {
+        uint32_t a = kBase64DecodeTable[src[i]];
+        uint32_t b = kBase64DecodeTable[src[i + 1]];
+        uint32_t c = kBase64DecodeTable[src[i + 2]];
+        uint32_t d = kBase64DecodeTable[src[i + 3]];
+        if ((a | b | c | d) & 0x80) {
+            break;
+        }
+        uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+        dst[0] = static_cast<uint8_t>(v >> 16);
+        dst[1] = static_cast<uint8_t>(v >> 8);
+        dst[2] = static_cast<uint8_t>(v);
+        dst += 3;
+    }
+    // 末尾不足 4 个字符，或所在的组含非法字符：逐字符处理到第一个非法字符
+    uint32_t val = 0;
+    int bits = 0;
+    for (; i < len; ++i) {
+        uint8_t x = kBase64DecodeTable[src[i]];
+        if (x == kInvalid) {
+            break;
+        }
+        val = (val << 6) | x;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            *dst++ = static_cast<uint8_t>(val >> bits);
+        }
+    }
+    out.resize(dst - begin);
+
+    if (i == len) {
+        return len % 4 != 1;
+    }
+    size_t padding = len - i;
+    if (len % 4 != 0 || padding > 2) {
+        return false;
+    }
+    for (; i < len; ++i) {
+        if (src[i] != '=') {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string KRTextCodec::Base64Decode(std::string_view in) {
+    std::string out;
+    Base64Decode(in, out);
+    return out;
+}
+
+std::string KRTextCodec::EncodeURIComponent(std::string_view in) {
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(in.data());
+    size_t len = in.size();
+    std::string out;
+    out.reserve(len + len / 4);
+    size_t i = 0;
+    while (i < len) {
+        size_t block_end = std::min(i + 16, len);
+        if (block_end - i == 16 && IsURISafe16(src + i)) {
+            out.append(in.data() + i, 16);
+            i = block_end;
+            continue;
+        }
+        for (; i < block_end; ++i) {
+            uint8_t b = src[i];
+            if (kURISafeTable[b]) {
+                out.push_back(static_cast<char>(b));
+            } else {
+                char escaped[3] = {'%', kHexDigitsUpper[b >> 4], kHexDigitsUpper[b & 0x0F]};
+                out.append(escaped, sizeof(escaped));
+            }
+        }
+    }
+    return out;
+}
+
+std::string KRTextCodec::DecodeURIComponent(std::string_view in) {
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(in.data());
+    size_t len = in.size();
+    std::string out;
+    out.reserve(len);
+    size_t i = 0;
+    while (i < len) {
+        size_t block_end = std::min(i + 16, len);
+        if (block_end - i == 16 && !HasPercent16(src + i)) {
+            out.append(in.data() + i, 16);
+            i = block_end;
+            continue;
+        }
+        // 百分号序列可能跨过块边界，i 会越过 block_end
+        for (; i < block_end; ++i) {
+            if (src[i] == '%' && i + 2 < len) {
+                uint8_t hi = kHexTable[src[i + 1]];
+                uint8_t lo = kHexTable[src[i + 2]];
+                if (hi != kInvalid && lo != kInvalid) {
+                    out.push_back(static_cast<char>((hi << 4) | lo));
+                    i += 2;
+                    continue;
+                }
+            }
+            out.push_back(static_cast<char>(src[i]));
+        }
+    }
+    return out;
+}
@@ -0,0 +1,57 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRTEXTCODEC_H
+#define CORE_RENDER_OHOS_KRTEXTCODEC_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * base64（RFC 4648 标准字母表）与 URL 百分号编解码
+ * 查表实现，NEON（aarch64）/SSSE3 可用时向量化处理整块数据，各实现结果一致
+ */
+class KRTextCodec {
+ public:
+    static size_t Base64EncodedLength(size_t size) {
+        return (size + 2) / 3 * 4;
+    }
+
+    /**
+     * 编码结果追加到 out，带 '=' 填充
+     */
+    static void Base64Encode(std::string_view in, std::string &out);
+    static std::string Base64Encode(std::string_view in);
+
+    /**
+     * 解码到第一个不属于字母表的字符（包括 '=' 填充）为止，结果追加到 out
+     * @return 输入全部合法（允许末尾的 '=' 填充）时返回 true
+     */
+    static bool Base64Decode(std::string_view in, std::string &out);
+    static std::string Base64Decode(std::string_view in);
+
+    /**
+     * 与 JS encodeURIComponent 一致：A-Z a-z 0-9 - _ . ! ~ * ' ( ) 之外的字节编码为 %XX（大写）
+     */
+    static std::string EncodeURIComponent(std::string_view in);
+
+    /**
+     * %XX 还原为字节，非法的百分号序列原样保留，'+' 不做处理
+     */
+    static std::string DecodeURIComponent(std::string_view in);
+};
+
+#endif  // CORE_RENDER_OHOS_KRTEXTCODEC_H
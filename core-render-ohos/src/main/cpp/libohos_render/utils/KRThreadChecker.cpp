@@ -29,6 +29,7 @@ void KREnsureMainThreadChecker(const char *file, unsigned int line, const char *
         OH_LOG_Print(LOG_APP, LOG_ERROR, 0x7, "ThreadChecker",
                      "Main Thread Check Failed. %{public}s %{public}d %{public}s", file, line, function);
         KR_LOG_ERROR << "Main Thread Check Failed. " << file << ":" << line << ":" << function;
+        KRLogDispatcher::GetInstance().Flush();
 
         __assert_fail("Main Thread Check Failed.", file, line, function);
     }
@@ -16,6 +16,7 @@
 #include "libohos_render/utils/KRViewUtil.h"
 
 #include "libohos_render/export/IKRRenderViewExport.h"
+#include "libohos_render/utils/KRPropParseCache.h"
 #include "libohos_render/utils/KRThreadChecker.h"
 
 namespace kuikly {
@@ -442,20 +443,23 @@ void UpdateNodeAccessibility(ArkUI_NodeHandle node, const std::string &accessibi
 }
 
 void UpdateNodeBorder(ArkUI_NodeHandle node, std::string borderStr) {
+    auto border = KRPropParseCache::GetInstance().GetBorder(borderStr);
+    if (!border) {
+        return;
+    }
     auto nodeAPI = GetNodeApi();
-    auto splits = ConvertSplit(borderStr, " ");
-    auto boderWidth = ConvertToFloat(splits[0]);
+    auto boderWidth = border->width;
     ArkUI_NumberValue value[] = {{.f32 = boderWidth}, {.f32 = boderWidth}, {.f32 = boderWidth}, {.f32 = boderWidth}};
     ArkUI_AttributeItem borderWidthItem = {value, 4};
     nodeAPI->setAttribute(node, NODE_BORDER_WIDTH, &borderWidthItem);
     {
-        auto hexColor = ConvertToHexColor(splits[2]);
+        auto hexColor = border->color;
         ArkUI_NumberValue value[] = {{.u32 = hexColor}, {.u32 = hexColor}, {.u32 = hexColor}, {.u32 = hexColor}};
         ArkUI_AttributeItem borderColorItem = {value, 4};
         nodeAPI->setAttribute(node, NODE_BORDER_COLOR, &borderColorItem);
     }
     {
-        auto style = ConverToBorderStyle(splits[1]);  // style
+        auto style = border->style;  // style
 
         ArkUI_NumberValue value[] = {{.u32 = style}, {.u32 = style}, {.u32 = style}, {.u32 = style}};
         ArkUI_AttributeItem borderStyleItem = {value, 4};
@@ -464,32 +468,14 @@ void UpdateNodeBorder(ArkUI_NodeHandle node, std::string borderStr) {
 }
 
 void UpdateNodeBackgroundImage(ArkUI_NodeHandle nodeHandle, const std::string &cssBackgroundImage) {
-    auto nodeAPI = GetNodeApi();
-    auto linearGradient = std::make_shared<KRLinearGradientParser>();
-    if (linearGradient->ParseFromCssLinearGradient(cssBackgroundImage)) {
-        // 获取 colors 和 locations
-        const std::vector<uint32_t> &colors = linearGradient->GetColors();
-        const std::vector<float> &locations = linearGradient->GetLocations();
-
-        // 创建 C 风格数组
-        unsigned int colorsArray[colors.size()];
-        float stopsArray[locations.size()];
-
-        // 填充数组
-        for (size_t i = 0; i < colors.size(); ++i) {
-            colorsArray[i] = colors[i];
-        }
-        for (size_t i = 0; i < locations.size(); ++i) {
-            if (i == locations.size() - 1) {
-                stopsArray[i] = 1.0;
-            } else {
-                stopsArray[i] = locations[i];
-            }
-        }
-        // 创建 ArkUI_ColorStop 结构
-        ArkUI_ColorStop colorStop = {colorsArray, stopsArray, static_cast<int>(colors.size())};
+    auto linearGradient = KRPropParseCache::GetInstance().GetLinearGradient(cssBackgroundImage);
+    if (linearGradient) {
+        auto nodeAPI = GetNodeApi();
+        // ArkUI 仅读取 colors 和 stops，直接引用缓存中的解析结果
+        ArkUI_ColorStop colorStop = {linearGradient->colors.data(), const_cast<float *>(linearGradient->stops.data()),
+                                     static_cast<int>(linearGradient->colors.size())};
         ArkUI_ColorStop *ptr = &colorStop;
-        ArkUI_NumberValue value[] = {{}, {.i32 = linearGradient->GetArkUIDirection()}, {.i32 = false}};
+        ArkUI_NumberValue value[] = {{}, {.i32 = linearGradient->arkui_direction}, {.i32 = false}};
         ArkUI_AttributeItem item = {
             .value = value, .size = sizeof(value) / sizeof(ArkUI_NumberValue), .object = reinterpret_cast<void *>(ptr)};
         nodeAPI->setAttribute(nodeHandle, NODE_LINEAR_GRADIENT, &item);
@@ -573,12 +559,12 @@ static RotationResult ConvertEulerToAxisAngle(double x_deg, double y_deg, double
 void UpdateNodeTransform(ArkUI_NodeHandle nodeHandle, 
 						 const std::string &cssTransform, 
                          KRSize size) {
-    auto nodeAPI = GetNodeApi();
-    auto transform = std::make_shared<KRTransformParser>();
-    
-    if (!transform->ParseFromCssTransform(cssTransform)) {
+    auto parsed = KRPropParseCache::GetInstance().GetTransform(cssTransform);
+    if (!parsed) {
         return;
     }
+    auto nodeAPI = GetNodeApi();
+    const auto *transform = &parsed->transform;
     // 设置变换中心点
     ArkUI_NumberValue transformCenterValue[] = {
         0, 0, 0, 
@@ -591,7 +577,7 @@ void UpdateNodeTransform(ArkUI_NodeHandle nodeHandle,
     };
     nodeAPI->setAttribute(nodeHandle, NODE_TRANSFORM_CENTER, &transformCenterItem);
     // 处理平移变换（转换为px单位）
-    auto matrix = transform->GetMatrixWithNoRotate();
+    auto matrix = parsed->matrix;
     matrix[12] *= size.width;   // X轴平移
     matrix[13] *= size.height;  // Y轴平移
     // 设置变换矩阵
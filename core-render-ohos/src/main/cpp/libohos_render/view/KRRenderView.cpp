@@ -337,11 +337,12 @@ void KRRenderView::DispatchInitState(KRInitState state) {
         break;
     case KRInitState::kStateFirstFramePaint:
        performance_manager_->OnFirstFramePaint();
+       break;
     case KRInitState::kStateResume:
-        // todo
+        performance_manager_->OnResume();
         break;
     case KRInitState::kStatePause:
-        // todo
+        performance_manager_->OnPause();
         break;
     case KRInitState::kStateDestroy:
         performance_manager_->OnDestroy();
@@ -15,7 +15,10 @@
 #include <ark_runtime/jsvm.h>
 #include <arkui/native_node_napi.h>
 #include <cstdint>
+#include "libohos_render/expand/components/apng/APNGStructs.h"
+#include "libohos_render/expand/components/image/KRImageDecoder.h"
 #include "libohos_render/expand/modules/back_press/KRBackPressModule.h"
+#include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
 #include "libohos_render/foundation/KRCallbackData.h"
 #include "libohos_render/manager/KRArkTSManager.h"
 #include "libohos_render/manager/KRRenderManager.h"
@@ -193,6 +196,21 @@ static napi_value isBackPressConsumed(napi_env env, napi_callback_info info) {
     return result;
 }
 
+// 系统内存等级变化，裁剪 native 侧缓存
+static napi_value OnMemoryLevel(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1] = {nullptr};
+    if (napi_ok != napi_get_cb_info(env, info, &argc, args, nullptr, nullptr)) {
+        napi_throw_error(env, "-1000", "napi_get_cb_info error");
+        return 0;
+    }
+    int32_t level = kuikly::util::getNApiArgsInt(env, args[0]);
+    KRMemoryCacheModule::TrimAllOnMemoryLevel(level);
+    APNGPlayer::TrimAllOnMemoryLevel(level);
+    KRImageDecoder::TrimOnMemoryLevel(level);
+    return 0;
+}
+
 EXTERN_C_START
 static napi_value Init(napi_env env, napi_value exports) {
     napi_property_descriptor desc[] = {
@@ -206,6 +224,7 @@ static napi_value Init(napi_env env, napi_value exports) {
         {"OnLaunchStart", nullptr, OnLaunchStart, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"createNativeRoot", nullptr, CreateNativeRoot, nullptr, nullptr, nullptr, napi_default, nullptr},
         {"isBackPressConsumed", nullptr, isBackPressConsumed, nullptr, nullptr, nullptr, napi_default, nullptr},
+        {"onMemoryLevel", nullptr, OnMemoryLevel, nullptr, nullptr, nullptr, napi_default, nullptr},
     };
     napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
     KRRenderManager::GetInstance().Export(env, exports);  // 尝试注册RenderView
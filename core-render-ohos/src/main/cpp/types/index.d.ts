@@ -71,4 +71,10 @@ export const sendEvent: (
 
 export const createNativeRoot: (content: Object, instanceId: string) => void;
 
-export const isBackPressConsumed: (instanceId: string, sendTime: number) => number;
\ No newline at end of file
+export const isBackPressConsumed: (instanceId: string, sendTime: number) => number;
+
+/**
+ * 系统内存等级变化通知，用于裁剪native侧缓存
+ * @param level AbilityConstant.MemoryLevel
+ */
+export const onMemoryLevel: (level: number) => void;
\ No newline at end of file
@@ -0,0 +1,166 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGBlend.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+uint8_t RoundDiv255(uint32_t x) {
+    return static_cast<uint8_t>(std::lround(x / 255.0));
+}
+
+/**
+ * 按像素比较，失败时输出第一个不一致的位置
+ */
+void ExpectSamePixels(const std::vector<uint8_t> &actual, const std::vector<uint8_t> &expected, const char *what) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        if (actual[i] != expected[i]) {
+            ADD_FAILURE() << what << ": pixel " << i / 4 << " channel " << i % 4 << " got " << int(actual[i])
+                          << " expected " << int(expected[i]);
+            return;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(APNGBlendTest, SourceMatchesScalarAndExactRoundingForAllColorAlphaPairs) {
+    // 每个像素为一组 (color, alpha)，覆盖全部 65536 种组合
+    std::vector<uint8_t> src(65536 * 4);
+    for (uint32_t i = 0; i < 65536; ++i) {
+        uint8_t color = i & 0xFF;
+        src[i * 4 + 0] = color;
+        src[i * 4 + 1] = 255 - color;
+        src[i * 4 + 2] = color ^ 0x5A;
+        src[i * 4 + 3] = i >> 8;
+    }
+    std::vector<uint8_t> simd(src.size());
+    std::vector<uint8_t> scalar(src.size());
+    std::vector<uint8_t> reference(src.size());
+    APNGBlendRowSource(simd.data(), src.data(), 65536);
+    APNGBlendRowSourceScalar(scalar.data(), src.data(), 65536);
+    for (size_t i = 0; i < src.size(); i += 4) {
+        uint32_t a = src[i + 3];
+        for (int c = 0; c < 3; ++c) {
+            reference[i + c] = RoundDiv255(src[i + c] * a);
+        }
+        reference[i + 3] = a;
+    }
+    ExpectSamePixels(scalar, reference, "scalar vs round(x / 255)");
+    ExpectSamePixels(simd, scalar, "vector vs scalar");
+}
+
+TEST(APNGBlendTest, OverMatchesScalarAndExactRoundingForAllInputs) {
+    // 对每个源 alpha，覆盖全部 (源颜色, 目标颜色) 组合
+    std::vector<uint8_t> src(65536 * 4);
+    std::vector<uint8_t> dst(65536 * 4);
+    std::vector<uint8_t> simd(dst.size());
+    std::vector<uint8_t> scalar(dst.size());
+    std::vector<uint8_t> reference(dst.size());
+    for (uint32_t a = 0; a < 256; ++a) {
+        for (uint32_t i = 0; i < 65536; ++i) {
+            uint8_t s = i & 0xFF;
+            uint8_t d = i >> 8;
+            src[i * 4 + 0] = s;
+            src[i * 4 + 1] = d;
+            src[i * 4 + 2] = s ^ d;
+            src[i * 4 + 3] = a;
+            dst[i * 4 + 0] = d;
+            dst[i * 4 + 1] = s;
+            dst[i * 4 + 2] = 255 - d;
+            dst[i * 4 + 3] = d;
+        }
+        simd = dst;
+        scalar = dst;
+        APNGBlendRowOver(simd.data(), src.data(), 65536);
+        APNGBlendRowOverScalar(scalar.data(), src.data(), 65536);
+        for (size_t i = 0; i < dst.size(); i += 4) {
+            for (int c = 0; c < 4; ++c) {
+                uint32_t s = c == 3 ? 255 : src[i + c];
+                reference[i + c] = a == 0 ? dst[i + c] : RoundDiv255(s * a) + RoundDiv255(dst[i + c] * (255 - a));
+            }
+        }
+        SCOPED_TRACE(testing::Message() << "alpha " << a);
+        ExpectSamePixels(scalar, reference, "scalar vs round(x / 255)");
+        ExpectSamePixels(simd, scalar, "vector vs scalar");
+        if (HasFailure()) {
+            return;
+        }
+    }
+}
+
+TEST(APNGBlendTest, UnalignedRowsAndTailsMatchScalar) {
+    std::mt19937 rng(20250101);
+    std::uniform_int_distribution<int> byte(0, 255);
+    for (size_t count = 0; count <= 37; ++count) {
+        for (size_t offset = 0; offset < 4; ++offset) {
+            std::vector<uint8_t> src(offset + count * 4);
+            std::vector<uint8_t> dst(offset + count * 4);
+            for (auto &value : src) {
+                value = static_cast<uint8_t>(byte(rng));
+            }
+            for (auto &value : dst) {
+                value = static_cast<uint8_t>(byte(rng));
+            }
+            std::vector<uint8_t> simd = dst;
+            std::vector<uint8_t> scalar = dst;
+            APNGBlendRowOver(simd.data() + offset, src.data() + offset, count);
+            APNGBlendRowOverScalar(scalar.data() + offset, src.data() + offset, count);
+            ExpectSamePixels(simd, scalar, "over");
+            APNGBlendRowSource(simd.data() + offset, src.data() + offset, count);
+            APNGBlendRowSourceScalar(scalar.data() + offset, src.data() + offset, count);
+            ExpectSamePixels(simd, scalar, "source");
+        }
+    }
+}
+
+TEST(APNGBlendBenchmark, VectorVersusScalar) {
+    constexpr size_t kWidth = 1024;
+    constexpr size_t kRows = 1024;
+    constexpr int kRounds = 4;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<uint8_t> src(kWidth * 4 * kRows);
+    for (auto &value : src) {
+        value = static_cast<uint8_t>(byte(rng));
+    }
+    std::vector<uint8_t> canvas(src.size());
+
+    using RowFunc = void (*)(uint8_t *, const uint8_t *, size_t);
+    auto mpixPerSecond = [&](RowFunc func) {
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < kRounds; ++round) {
+            for (size_t y = 0; y < kRows; ++y) {
+                func(canvas.data() + y * kWidth * 4, src.data() + y * kWidth * 4, kWidth);
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return kWidth * kRows * kRounds / seconds / 1e6;
+    };
+    double overVector = mpixPerSecond(APNGBlendRowOver);
+    double overScalar = mpixPerSecond(APNGBlendRowOverScalar);
+    double sourceVector = mpixPerSecond(APNGBlendRowSource);
+    double sourceScalar = mpixPerSecond(APNGBlendRowSourceScalar);
+    printf("apng blend %zux%zu: over %.0f vs %.0f Mpix/s, source %.0f vs %.0f Mpix/s (vector vs scalar)\n", kWidth,
+           kRows, overVector, overScalar, sourceVector, sourceScalar);
+}
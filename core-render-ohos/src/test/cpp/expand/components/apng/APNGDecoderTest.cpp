@@ -0,0 +1,632 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/apng/APNGDecoder.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <zlib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "libohos_render/expand/components/apng/APNGStructs.h"
+
+namespace {
+
+/**
+ * 测试帧：像素为非预乘 RGBA
+ */
+struct TestFrame {
+    int left = 0;
+    int top = 0;
+    int width = 0;
+    int height = 0;
+    int delayMs = 100;
+    int disposeOp = APNG_DISPOSE_OP_NONE;
+    int blendOp = APNG_BLEND_OP_SOURCE;
+    std::vector<uint8_t> rgba;
+};
+
+void PutUint32(std::vector<uint8_t> &out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 24));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void PutUint16(std::vector<uint8_t> &out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t GetUint32(const uint8_t *bytes) {
+    return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+           (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+}
+
+void PutChunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data) {
+    PutUint32(out, static_cast<uint32_t>(data.size()));
+    size_t crcStart = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    PutUint32(out, static_cast<uint32_t>(::crc32(0, out.data() + crcStart, out.size() - crcStart)));
+}
+
+/**
+ * 8 位 RGBA、不使用行过滤的 zlib 数据
+ */
+std::vector<uint8_t> CompressRows(const TestFrame &frame) {
+    std::vector<uint8_t> raw;
+    size_t stride = static_cast<size_t>(frame.width) * 4;
+    for (int y = 0; y < frame.height; ++y) {
+        raw.push_back(0);
+        raw.insert(raw.end(), frame.rgba.begin() + y * stride, frame.rgba.begin() + (y + 1) * stride);
+    }
+    uLongf size = compressBound(raw.size());
+    std::vector<uint8_t> compressed(size);
+    compress(compressed.data(), &size, raw.data(), raw.size());
+    compressed.resize(size);
+    return compressed;
+}
+
+/**
+ * 生成 APNG：第一帧为默认图像（IDAT），其余为 fdAT
+ */
+std::vector<uint8_t> BuildAPNG(int width, int height, const std::vector<TestFrame> &frames) {
+    std::vector<uint8_t> out = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    std::vector<uint8_t> ihdr;
+    PutUint32(ihdr, width);
+    PutUint32(ihdr, height);
+    ihdr.insert(ihdr.end(), {8, 6, 0, 0, 0});
+    PutChunk(out, "IHDR", ihdr);
+    std::vector<uint8_t> actl;
+    PutUint32(actl, static_cast<uint32_t>(frames.size()));
+    PutUint32(actl, 0);
+    PutChunk(out, "acTL", actl);
+
+    uint32_t sequence = 0;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const TestFrame &frame = frames[i];
+        std::vector<uint8_t> fctl;
+        PutUint32(fctl, sequence++);
+        PutUint32(fctl, frame.width);
+        PutUint32(fctl, frame.height);
+        PutUint32(fctl, frame.left);
+        PutUint32(fctl, frame.top);
+        PutUint16(fctl, static_cast<uint16_t>(frame.delayMs));
+        PutUint16(fctl, 1000);
+        fctl.push_back(static_cast<uint8_t>(frame.disposeOp));
+        fctl.push_back(static_cast<uint8_t>(frame.blendOp));
+        PutChunk(out, "fcTL", fctl);
+
+        std::vector<uint8_t> data = CompressRows(frame);
+        if (i == 0) {
+            PutChunk(out, "IDAT", data);
+        } else {
+            std::vector<uint8_t> fdat;
+            PutUint32(fdat, sequence++);
+            fdat.insert(fdat.end(), data.begin(), data.end());
+            PutChunk(out, "fdAT", fdat);
+        }
+    }
+    PutChunk(out, "IEND", {});
+    return out;
+}
+
+/**
+ * 解码 BuildAPNG 生成的单帧 PNG（APNG::BuildFramePNG 的输出）
+ */
+bool DecodeTestPNG(const uint8_t *png, size_t size, uint32_t &width, uint32_t &height, std::vector<uint8_t> &rgba) {
+    if (size < 8) {
+        return false;
+    }
+    std::vector<uint8_t> idat;
+    width = 0;
+    height = 0;
+    for (size_t off = 8; off + 12 <= size;) {
+        uint32_t length = GetUint32(png + off);
+        std::string type(reinterpret_cast<const char *>(png + off + 4), 4);
+        const uint8_t *data = png + off + 8;
+        if (off + 12 + length > size) {
+            return false;
+        }
+        if (type == "IHDR") {
+            width = GetUint32(data);
+            height = GetUint32(data + 4);
+        } else if (type == "IDAT") {
+            idat.insert(idat.end(), data, data + length);
+        }
+        off += 12 + length;
+    }
+    size_t stride = static_cast<size_t>(width) * 4;
+    std::vector<uint8_t> raw((stride + 1) * height);
+    uLongf rawSize = raw.size();
+    if (width == 0 || uncompress(raw.data(), &rawSize, idat.data(), idat.size()) != Z_OK || rawSize != raw.size()) {
+        return false;
+    }
+    rgba.resize(stride * height);
+    for (uint32_t y = 0; y < height; ++y) {
+        if (raw[y * (stride + 1)] != 0) {
+            return false;
+        }
+        std::copy_n(raw.begin() + y * (stride + 1) + 1, stride, rgba.begin() + y * stride);
+    }
+    return true;
+}
+
+/**
+ * 写入临时文件，析构时删除
+ */
+class TempAPNG {
+ public:
+    explicit TempAPNG(const std::vector<uint8_t> &content) {
+        char path[] = "/tmp/kr_apng_test_XXXXXX";
+        int fd = mkstemp(path);
+        if (fd >= 0) {
+            path_ = path;
+            ok_ = write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size());
+            close(fd);
+        }
+    }
+    ~TempAPNG() {
+        if (!path_.empty()) {
+            unlink(path_.c_str());
+        }
+    }
+
+    bool ok() const {
+        return ok_;
+    }
+    const std::string &path() const {
+        return path_;
+    }
+
+ private:
+    std::string path_;
+    bool ok_ = false;
+};
+
+using Pixels = std::vector<uint8_t>;
+
+/**
+ * 2x2 画布上覆盖 dispose_op/blend_op 各组合的四帧：
+ * A 完整帧 SOURCE；B 右下角 OVER 后 BACKGROUND；C 下方一行 OVER 后 PREVIOUS（按 NONE）；D 左上角 SOURCE 透明
+ */
+std::vector<TestFrame> GoldenFrames() {
+    TestFrame a{0, 0, 2, 2, 100, APNG_DISPOSE_OP_NONE, APNG_BLEND_OP_SOURCE,
+                {255, 0, 0, 255, 0, 255, 0, 128, 0, 0, 255, 0, 255, 255, 255, 255}};
+    TestFrame b{1, 1, 1, 1, 200, APNG_DISPOSE_OP_BACKGROUND, APNG_BLEND_OP_OVER, {0, 0, 255, 128}};
+    TestFrame c{0, 1, 2, 1, 300, APNG_DISPOSE_OP_PREVIOUS, APNG_BLEND_OP_OVER, {255, 255, 0, 255, 10, 20, 30, 0}};
+    TestFrame d{0, 0, 1, 1, 400, APNG_DISPOSE_OP_NONE, APNG_BLEND_OP_SOURCE, {90, 90, 90, 0}};
+    return {a, b, c, d};
+}
+
+// 预期的预乘输出
+const std::vector<Pixels> kGoldenCanvases = {
+    {255, 0, 0, 255, 0, 128, 0, 128, 0, 0, 0, 0, 255, 255, 255, 255},
+    {255, 0, 0, 255, 0, 128, 0, 128, 0, 0, 0, 0, 127, 127, 255, 255},
+    {255, 0, 0, 255, 0, 128, 0, 128, 255, 255, 0, 255, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 128, 0, 128, 255, 255, 0, 255, 0, 0, 0, 0},
+};
+
+APNGFrameStream::DecodeFunc CountingDecoder(int *count) {
+    return [count](const std::vector<uint8_t> &png, const Frame &frame, std::vector<uint8_t> &rgba) {
+        (*count)++;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        return DecodeTestPNG(png.data(), png.size(), width, height, rgba) && static_cast<int>(width) == frame.width &&
+               static_cast<int>(height) == frame.height;
+    };
+}
+
+/**
+ * 每帧为纯色完整帧，颜色由帧序号决定
+ */
+std::vector<TestFrame> SolidFrames(int width, int height, int count) {
+    std::vector<TestFrame> frames;
+    for (int i = 0; i < count; ++i) {
+        TestFrame frame{0, 0, width, height, 20, APNG_DISPOSE_OP_NONE, APNG_BLEND_OP_SOURCE, {}};
+        for (int p = 0; p < width * height; ++p) {
+            frame.rgba.insert(frame.rgba.end(), {static_cast<uint8_t>(i), 0, 0, 255});
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+}  // namespace
+
+TEST(APNGDecoderTest, ParsesControlChunksWithoutLoadingFrameData) {
+    TempAPNG file(BuildAPNG(2, 2, GoldenFrames()));
+    ASSERT_TRUE(file.ok());
+    auto apng = APNG::ParseFromFile(file.path());
+    ASSERT_NE(apng, nullptr);
+    EXPECT_TRUE(apng->isAPNG);
+    EXPECT_EQ(apng->width, 2);
+    EXPECT_EQ(apng->height, 2);
+    EXPECT_EQ(apng->playTime, 1000);
+    int dataFrames = 0;
+    for (auto &frame : apng->frames) {
+        if (!frame->dataChunks.empty()) {
+            dataFrames++;
+        }
+    }
+    EXPECT_EQ(dataFrames, 4);
+}
+
+TEST(APNGDecoderTest, NonAnimatedPNGIsNotAPNG) {
+    std::vector<uint8_t> png = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    std::vector<uint8_t> ihdr;
+    PutUint32(ihdr, 1);
+    PutUint32(ihdr, 1);
+    ihdr.insert(ihdr.end(), {8, 6, 0, 0, 0});
+    PutChunk(png, "IHDR", ihdr);
+    PutChunk(png, "IDAT", CompressRows(TestFrame{0, 0, 1, 1, 0, 0, 0, {1, 2, 3, 4}}));
+    PutChunk(png, "IEND", {});
+    TempAPNG file(png);
+    auto apng = APNG::ParseFromFile(file.path());
+    ASSERT_NE(apng, nullptr);
+    EXPECT_FALSE(apng->isAPNG);
+    EXPECT_EQ(APNG::ParseFromFile("/nonexistent/kr_apng_test.png"), nullptr);
+}
+
+TEST(APNGDecoderTest, StreamMatchesGoldenFramesAcrossLoops) {
+    TempAPNG file(BuildAPNG(2, 2, GoldenFrames()));
+    auto apng = APNG::ParseFromFile(file.path());
+    int decodes = 0;
+    APNGFrameStream stream(apng, CountingDecoder(&decodes));
+    EXPECT_EQ(decodes, 0);
+
+    const int delays[] = {200, 300, 400, 400};
+    for (int loop = 0; loop < 2; ++loop) {
+        for (size_t i = 0; i < kGoldenCanvases.size(); ++i) {
+            APNGFrameStream::Output output;
+            ASSERT_TRUE(stream.Next(output));
+            EXPECT_EQ(*output.canvas, kGoldenCanvases[i]) << "loop " << loop << " frame " << i;
+            EXPECT_EQ(output.isLast, i + 1 == kGoldenCanvases.size());
+            EXPECT_EQ(output.nextFrameDelay, delays[i]);
+        }
+    }
+    // 逐帧按需解码，每个输出帧只解码一次
+    EXPECT_EQ(decodes, 8);
+}
+
+TEST(APNGDecoderTest, SeekToComposesPrecedingFrames) {
+    TempAPNG file(BuildAPNG(2, 2, GoldenFrames()));
+    auto apng = APNG::ParseFromFile(file.path());
+    int decodes = 0;
+    APNGFrameStream stream(apng, CountingDecoder(&decodes));
+
+    APNGFrameStream::Output output;
+    ASSERT_TRUE(stream.Next(output));
+    int third = output.frameIndex + 2;
+    stream.SeekTo(third);
+    ASSERT_TRUE(stream.Next(output));
+    EXPECT_EQ(output.frameIndex, third);
+    EXPECT_EQ(*output.canvas, kGoldenCanvases[2]);
+
+    stream.Rewind();
+    ASSERT_TRUE(stream.Next(output));
+    EXPECT_EQ(*output.canvas, kGoldenCanvases[0]);
+}
+
+TEST(APNGDecoderTest, FailedFrameIsSkippedButStillDisposed) {
+    TempAPNG file(BuildAPNG(2, 2, GoldenFrames()));
+    auto apng = APNG::ParseFromFile(file.path());
+    int decodes = 0;
+    auto decoder = CountingDecoder(&decodes);
+    // 第二帧（B）解码失败
+    APNGFrameStream stream(apng, [&](const std::vector<uint8_t> &png, const Frame &frame, std::vector<uint8_t> &rgba) {
+        return decoder(png, frame, rgba) && decodes != 2;
+    });
+
+    APNGFrameStream::Output output;
+    ASSERT_TRUE(stream.Next(output));
+    EXPECT_EQ(*output.canvas, kGoldenCanvases[0]);
+    ASSERT_TRUE(stream.Next(output));
+    EXPECT_EQ(*output.canvas, kGoldenCanvases[2]);
+}
+
+TEST(APNGDecoderTest, NoOutputWhenFirstFullFrameFails) {
+    TempAPNG file(BuildAPNG(2, 2, GoldenFrames()));
+    auto apng = APNG::ParseFromFile(file.path());
+    APNGFrameStream stream(apng, [](const std::vector<uint8_t> &, const Frame &, std::vector<uint8_t> &) {
+        return false;
+    });
+    APNGFrameStream::Output output;
+    EXPECT_FALSE(stream.Next(output));
+}
+
+// ---- APNGPlayer：宿主机实现被测代码用到的图片 SDK 函数 ----
+
+struct OH_PixelmapNative {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<uint8_t> pixels;
+};
+
+struct OH_Pixelmap_InitializationOptions {
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+struct OH_ImageSourceNative {
+    std::vector<uint8_t> data;
+};
+
+struct OH_DecodingOptions {};
+
+struct ArkUI_DrawableDescriptor {
+    OH_PixelmapNative *pixelmap = nullptr;
+};
+
+namespace {
+
+// 存活的合成帧 drawable 数，用于校验窗口上限
+std::atomic<int> g_liveDrawables{0};
+std::atomic<int> g_peakDrawables{0};
+
+}  // namespace
+
+extern "C" {
+
+Image_ErrorCode OH_ImageSourceNative_CreateFromData(uint8_t *data, size_t dataSize, OH_ImageSourceNative **res) {
+    *res = new OH_ImageSourceNative{std::vector<uint8_t>(data, data + dataSize)};
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_ImageSourceNative_CreatePixelmap(OH_ImageSourceNative *source, OH_DecodingOptions *,
+                                                    OH_PixelmapNative **pixelmap) {
+    auto result = new OH_PixelmapNative();
+    if (!DecodeTestPNG(source->data.data(), source->data.size(), result->width, result->height, result->pixels)) {
+        delete result;
+        return IMAGE_DECODE_FAILED;
+    }
+    *pixelmap = result;
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_ImageSourceNative_Release(OH_ImageSourceNative *source) {
+    delete source;
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_DecodingOptions_Create(OH_DecodingOptions **options) {
+    *options = new OH_DecodingOptions();
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_DecodingOptions_SetPixelFormat(OH_DecodingOptions *, int32_t) {
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_DecodingOptions_Release(OH_DecodingOptions *options) {
+    delete options;
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapInitializationOptions_Create(OH_Pixelmap_InitializationOptions **options) {
+    *options = new OH_Pixelmap_InitializationOptions();
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapInitializationOptions_SetWidth(OH_Pixelmap_InitializationOptions *options, uint32_t width) {
+    options->width = width;
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapInitializationOptions_SetHeight(OH_Pixelmap_InitializationOptions *options,
+                                                           uint32_t height) {
+    options->height = height;
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapInitializationOptions_SetPixelFormat(OH_Pixelmap_InitializationOptions *, int32_t) {
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapInitializationOptions_SetAlphaType(OH_Pixelmap_InitializationOptions *, int32_t) {
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapInitializationOptions_Release(OH_Pixelmap_InitializationOptions *options) {
+    delete options;
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapNative_CreateEmptyPixelmap(OH_Pixelmap_InitializationOptions *options,
+                                                      OH_PixelmapNative **pixelmap) {
+    auto result = new OH_PixelmapNative();
+    result->width = options->width;
+    result->height = options->height;
+    result->pixels.resize(static_cast<size_t>(options->width) * options->height * 4);
+    *pixelmap = result;
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapNative_WritePixels(OH_PixelmapNative *pixelmap, uint8_t *source, size_t bufferSize) {
+    if (bufferSize != pixelmap->pixels.size()) {
+        return IMAGE_BAD_PARAMETER;
+    }
+    std::copy_n(source, bufferSize, pixelmap->pixels.begin());
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapNative_ReadPixels(OH_PixelmapNative *pixelmap, uint8_t *destination, size_t *bufferSize) {
+    if (*bufferSize < pixelmap->pixels.size()) {
+        return IMAGE_BAD_PARAMETER;
+    }
+    std::copy(pixelmap->pixels.begin(), pixelmap->pixels.end(), destination);
+    *bufferSize = pixelmap->pixels.size();
+    return IMAGE_SUCCESS;
+}
+
+Image_ErrorCode OH_PixelmapNative_Release(OH_PixelmapNative *pixelmap) {
+    delete pixelmap;
+    return IMAGE_SUCCESS;
+}
+
+ArkUI_DrawableDescriptor *OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(OH_PixelmapNative *pixelmap) {
+    int live = ++g_liveDrawables;
+    int peak = g_peakDrawables.load();
+    while (live > peak && !g_peakDrawables.compare_exchange_weak(peak, live)) {
+    }
+    return new ArkUI_DrawableDescriptor{pixelmap};
+}
+
+void OH_ArkUI_DrawableDescriptor_Dispose(ArkUI_DrawableDescriptor *drawableDescriptor) {
+    --g_liveDrawables;
+    delete drawableDescriptor;
+}
+
+}  // extern "C"
+
+namespace {
+
+template <typename Predicate> bool WaitFor(Predicate predicate) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+class APNGPlayerTest : public testing::Test {
+ protected:
+    void SetUp() override {
+        file_ = std::make_unique<TempAPNG>(BuildAPNG(4, 4, SolidFrames(4, 4, kFrameCount)));
+        ASSERT_TRUE(file_->ok());
+        player_ = std::make_shared<APNGPlayer>(APNG::ParseFromFile(file_->path()));
+        g_peakDrawables = 0;
+    }
+
+    void TearDown() override {
+        player_.reset();
+        // 已派发的解码任务结束后才会释放窗口中的帧
+        EXPECT_TRUE(WaitFor([] { return g_liveDrawables.load() == 0; }));
+    }
+
+    std::shared_ptr<APNGDrawable> Take() {
+        std::shared_ptr<APNGDrawable> drawable;
+        WaitFor([&] {
+            drawable = player_->TakeNextDrawable();
+            return drawable != nullptr;
+        });
+        return drawable;
+    }
+
+    // 纯色帧的颜色即帧序号
+    static int ColorOf(const APNGDrawable &drawable) {
+        return drawable.pixelmap->pixels[0];
+    }
+
+    static constexpr int kFrameCount = 24;
+    std::unique_ptr<TempAPNG> file_;
+    std::shared_ptr<APNGPlayer> player_;
+};
+
+}  // namespace
+
+TEST_F(APNGPlayerTest, PlaysFramesInOrderWithinBoundedWindow) {
+    for (int i = 0; i < kFrameCount * 2; ++i) {
+        auto drawable = Take();
+        ASSERT_NE(drawable, nullptr);
+        EXPECT_EQ(ColorOf(*drawable), i % kFrameCount);
+        EXPECT_EQ(drawable->isLast, i % kFrameCount == kFrameCount - 1);
+        EXPECT_EQ(drawable->nextFrameDelay, 20);
+    }
+    EXPECT_TRUE(WaitFor([] { return g_liveDrawables.load() == static_cast<int>(APNGPlayer::kDefaultWindowSize); }));
+    // 取出的帧在下一次取之前已释放，窗口外最多只有一帧
+    EXPECT_LE(g_peakDrawables.load(), static_cast<int>(APNGPlayer::kDefaultWindowSize) + 1);
+    EXPECT_FALSE(player_->IsFailed());
+}
+
+TEST_F(APNGPlayerTest, TrimKeepsOneFrameAndResumeRefills) {
+    auto first = Take();
+    ASSERT_NE(first, nullptr);
+    ASSERT_TRUE(WaitFor([] { return g_liveDrawables.load() == 1 + static_cast<int>(APNGPlayer::kDefaultWindowSize); }));
+
+    APNGPlayer::TrimAllOnMemoryLevel(0);
+    EXPECT_EQ(g_liveDrawables.load(), 1 + static_cast<int>(APNGPlayer::kDefaultWindowSize));
+    APNGPlayer::TrimAllOnMemoryLevel(1);
+    EXPECT_TRUE(WaitFor([] { return g_liveDrawables.load() == 2; }));
+
+    // 被丢弃的帧重新解码，顺序不变；窗口保持为一帧
+    for (int i = 1; i < 5; ++i) {
+        auto drawable = Take();
+        ASSERT_NE(drawable, nullptr);
+        EXPECT_EQ(ColorOf(*drawable), i);
+    }
+    first.reset();
+    EXPECT_TRUE(WaitFor([] { return g_liveDrawables.load() == 1; }));
+
+    player_->Resume();
+    EXPECT_TRUE(WaitFor([] { return g_liveDrawables.load() == static_cast<int>(APNGPlayer::kDefaultWindowSize); }));
+    auto next = Take();
+    ASSERT_NE(next, nullptr);
+    EXPECT_EQ(ColorOf(*next), 5);
+}
+
+TEST_F(APNGPlayerTest, ResetRestartsFromFirstFrame) {
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_NE(Take(), nullptr);
+    }
+    player_->Reset();
+    auto drawable = Take();
+    ASSERT_NE(drawable, nullptr);
+    EXPECT_EQ(ColorOf(*drawable), 0);
+}
+
+TEST(APNGDecoderBenchmark, StreamVersusDecodeAllFrames) {
+    constexpr int kSize = 256;
+    constexpr int kFrames = 60;
+    // 首帧完整，其余为 OVER 合成的 64x64 局部更新
+    std::vector<TestFrame> frames = SolidFrames(kSize, kSize, 1);
+    for (int i = 1; i < kFrames; ++i) {
+        TestFrame frame{(i * 16) % (kSize - 64), (i * 8) % (kSize - 64), 64, 64, 16, APNG_DISPOSE_OP_NONE,
+                        APNG_BLEND_OP_OVER, {}};
+        for (int p = 0; p < 64 * 64; ++p) {
+            frame.rgba.insert(frame.rgba.end(), {static_cast<uint8_t>(i * 4), static_cast<uint8_t>(p), 200,
+                                                 static_cast<uint8_t>(p * 7)});
+        }
+        frames.push_back(frame);
+    }
+    TempAPNG file(BuildAPNG(kSize, kSize, frames));
+    auto apng = APNG::ParseFromFile(file.path());
+    int decodes = 0;
+    APNGFrameStream stream(apng, CountingDecoder(&decodes));
+
+    auto start = std::chrono::steady_clock::now();
+    APNGFrameStream::Output output;
+    for (int i = 0; i < kFrames * 5; ++i) {
+        ASSERT_TRUE(stream.Next(output));
+    }
+    double perFrameUs =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / (kFrames * 5);
+
+    // 流式：一块画布 + 一帧解码缓冲 + 播放窗口；全量预解码：每帧一张完整位图
+    size_t canvasBytes = static_cast<size_t>(kSize) * kSize * 4;
+    size_t streamBytes = canvasBytes * (1 + APNGPlayer::kDefaultWindowSize) + 64 * 64 * 4;
+    size_t allFramesBytes = canvasBytes * kFrames;
+    printf("apng %dx%d x %d frames: %.1f us per streamed frame, resident %zu KB vs %zu KB decoded up front\n", kSize,
+           kSize, kFrames, perFrameUs, streamBytes / 1024, allFramesBytes / 1024);
+}
@@ -0,0 +1,398 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/canvas/KRCanvasDisplayList.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 把每次回放调用记录为一行文本，便于断言顺序与参数
+class MockReplayer : public IKRCanvasReplayer {
+ public:
+    std::vector<std::string> calls;
+
+    void SetLineCap(KRCanvasLineCap cap) override {
+        Log("lineCap", static_cast<int>(cap));
+    }
+    void SetLineWidth(float width) override {
+        Log("lineWidth", width);
+    }
+    void SetLineDash(const std::vector<float> &intervals) override {
+        std::ostringstream os;
+        os << "lineDash";
+        for (float v : intervals) {
+            os << " " << v;
+        }
+        calls.push_back(os.str());
+    }
+    void SetStrokeColor(uint32_t color) override {
+        LogHex("strokeColor", color);
+    }
+    void SetFillColor(uint32_t color) override {
+        LogHex("fillColor", color);
+    }
+    void SetStrokeGradient(const KRCanvasGradient &gradient) override {
+        LogGradient("strokeGradient", gradient);
+    }
+    void SetFillGradient(const KRCanvasGradient &gradient) override {
+        LogGradient("fillGradient", gradient);
+    }
+    void BeginPath() override {
+        Log("beginPath");
+    }
+    void MoveTo(float x, float y) override {
+        Log("moveTo", x, y);
+    }
+    void LineTo(float x, float y) override {
+        Log("lineTo", x, y);
+    }
+    void ArcTo(float left, float top, float right, float bottom, float start_angle, float sweep_angle) override {
+        Log("arcTo", left, top, right, bottom, start_angle, sweep_angle);
+    }
+    void QuadTo(float cpx, float cpy, float x, float y) override {
+        Log("quadTo", cpx, cpy, x, y);
+    }
+    void CubicTo(float cp1x, float cp1y, float cp2x, float cp2y, float x, float y) override {
+        Log("cubicTo", cp1x, cp1y, cp2x, cp2y, x, y);
+    }
+    void ClosePath() override {
+        Log("closePath");
+    }
+    void Stroke() override {
+        Log("stroke");
+    }
+    void Fill() override {
+        Log("fill");
+    }
+    void SetTextAlign(KRCanvasTextAlign align) override {
+        Log("textAlign", static_cast<int>(align));
+    }
+    void SetFont(const std::string &family, float size, int weight, KRCanvasFontStyle style) override {
+        Log("font " + family, size, weight, static_cast<int>(style));
+    }
+    void DrawText(const std::string &text, float x, float y, bool fill) override {
+        Log(std::string(fill ? "fillText " : "strokeText ") + text, x, y);
+    }
+    void Save() override {
+        Log("save");
+    }
+    void SaveLayer(float left, float top, float right, float bottom) override {
+        Log("saveLayer", left, top, right, bottom);
+    }
+    void Restore() override {
+        Log("restore");
+    }
+    void Clip(bool intersect) override {
+        Log("clip", intersect);
+    }
+    void Translate(float x, float y) override {
+        Log("translate", x, y);
+    }
+    void Scale(float x, float y) override {
+        Log("scale", x, y);
+    }
+    void Rotate(float degrees) override {
+        Log("rotate", degrees);
+    }
+    void Skew(float x, float y) override {
+        Log("skew", x, y);
+    }
+    void Concat(const std::vector<float> &matrix) override {
+        std::ostringstream os;
+        os << "concat";
+        for (float v : matrix) {
+            os << " " << v;
+        }
+        calls.push_back(os.str());
+    }
+    void DrawImage(const std::string &cache_key, float sx, float sy, float s_width, float s_height, float dx,
+                   float dy, float d_width, float d_height) override {
+        Log("drawImage " + cache_key, sx, sy, s_width, s_height, dx, dy, d_width, d_height);
+    }
+
+ private:
+    template <typename... Args>
+    void Log(const std::string &name, Args... args) {
+        std::ostringstream os;
+        os << name;
+        ((os << " " << args), ...);
+        calls.push_back(os.str());
+    }
+    void LogHex(const std::string &name, uint32_t color) {
+        std::ostringstream os;
+        os << name << " " << std::hex << color;
+        calls.push_back(os.str());
+    }
+    void LogGradient(const std::string &name, const KRCanvasGradient &gradient) {
+        std::ostringstream os;
+        os << name << " " << gradient.x0 << " " << gradient.y0 << " " << gradient.x1 << " " << gradient.y1;
+        for (size_t i = 0; i < gradient.colors.size(); ++i) {
+            os << " " << std::hex << gradient.colors[i] << std::dec << "@" << gradient.locations[i];
+        }
+        calls.push_back(os.str());
+    }
+};
+
+// 只计数的回放目标，用于测量指令分发本身的开销
+class CountingReplayer : public IKRCanvasReplayer {
+ public:
+    int64_t calls = 0;
+
+    void SetLineCap(KRCanvasLineCap) override { ++calls; }
+    void SetLineWidth(float) override { ++calls; }
+    void SetLineDash(const std::vector<float> &) override { ++calls; }
+    void SetStrokeColor(uint32_t) override { ++calls; }
+    void SetFillColor(uint32_t) override { ++calls; }
+    void SetStrokeGradient(const KRCanvasGradient &) override { ++calls; }
+    void SetFillGradient(const KRCanvasGradient &) override { ++calls; }
+    void BeginPath() override { ++calls; }
+    void MoveTo(float, float) override { ++calls; }
+    void LineTo(float, float) override { ++calls; }
+    void ArcTo(float, float, float, float, float, float) override { ++calls; }
+    void QuadTo(float, float, float, float) override { ++calls; }
+    void CubicTo(float, float, float, float, float, float) override { ++calls; }
+    void ClosePath() override { ++calls; }
+    void Stroke() override { ++calls; }
+    void Fill() override { ++calls; }
+    void SetTextAlign(KRCanvasTextAlign) override { ++calls; }
+    void SetFont(const std::string &, float, int, KRCanvasFontStyle) override { ++calls; }
+    void DrawText(const std::string &, float, float, bool) override { ++calls; }
+    void Save() override { ++calls; }
+    void SaveLayer(float, float, float, float) override { ++calls; }
+    void Restore() override { ++calls; }
+    void Clip(bool) override { ++calls; }
+    void Translate(float, float) override { ++calls; }
+    void Scale(float, float) override { ++calls; }
+    void Rotate(float) override { ++calls; }
+    void Skew(float, float) override { ++calls; }
+    void Concat(const std::vector<float> &) override { ++calls; }
+    void DrawImage(const std::string &, float, float, float, float, float, float, float, float) override { ++calls; }
+};
+
+void Append(KRCanvasDisplayList &list, const std::string &method, const std::string &params) {
+    KRCanvasOpCode code;
+    ASSERT_TRUE(KRCanvasDisplayList::OpCodeOf(method, code)) << method;
+    list.Append(code, params);
+}
+
+std::vector<std::string> Replay(const KRCanvasDisplayList &list) {
+    MockReplayer replayer;
+    list.Replay(replayer);
+    return replayer.calls;
+}
+
+}  // namespace
+
+TEST(KRCanvasDisplayListTest, UnknownMethodHasNoOpCode) {
+    KRCanvasOpCode code;
+    EXPECT_FALSE(KRCanvasDisplayList::OpCodeOf("reset", code));
+    EXPECT_FALSE(KRCanvasDisplayList::OpCodeOf("", code));
+}
+
+TEST(KRCanvasDisplayListTest, ReplaysPathInRecordedOrder) {
+    KRCanvasDisplayList list;
+    Append(list, "beginPath", "");
+    Append(list, "moveTo", R"({"x":1,"y":2})");
+    Append(list, "lineTo", R"({"x":3,"y":4})");
+    Append(list, "quadraticCurveTo", R"({"cpx":5,"cpy":6,"x":7,"y":8})");
+    Append(list, "bezierCurveTo", R"({"cp1x":1,"cp1y":2,"cp2x":3,"cp2y":4,"x":5,"y":6})");
+    Append(list, "closePath", "");
+    Append(list, "lineWidth", R"({"width":2.5})");
+    Append(list, "stroke", "");
+    Append(list, "fill", "");
+
+    std::vector<std::string> expected = {
+        "beginPath", "moveTo 1 2", "lineTo 3 4", "quadTo 5 6 7 8", "cubicTo 1 2 3 4 5 6",
+        "closePath", "lineWidth 2.5", "stroke", "fill",
+    };
+    EXPECT_EQ(Replay(list), expected);
+    // 回放不消耗指令，可重复绘制
+    EXPECT_EQ(Replay(list), expected);
+}
+
+TEST(KRCanvasDisplayListTest, DropsInvalidAndNoOpCommands) {
+    KRCanvasDisplayList list;
+    Append(list, "moveTo", "not json");
+    Append(list, "createLinearGradient", R"({"x0":0})");
+    Append(list, "textAlign", "justify");
+    Append(list, "transform", R"({"values":[1,0,0]})");
+    EXPECT_TRUE(list.Ops().empty());
+    EXPECT_TRUE(Replay(list).empty());
+}
+
+TEST(KRCanvasDisplayListTest, CompilesEnumsWithoutDrawingTypes) {
+    KRCanvasDisplayList list;
+    Append(list, "lineCap", R"({"style":"round"})");
+    Append(list, "lineCap", R"({"style":"square"})");
+    Append(list, "lineCap", R"({"style":"butt"})");
+    Append(list, "textAlign", "center");
+    Append(list, "textAlign", "right");
+    Append(list, "font", R"({"family":"serif","size":12,"weight":"700","style":"italic"})");
+    Append(list, "fillText", R"({"text":"hi","x":1,"y":2})");
+    Append(list, "strokeText", R"({"text":"yo","x":3,"y":4})");
+
+    std::vector<std::string> expected = {
+        "lineCap 1", "lineCap 2", "lineCap 0", "textAlign 1", "textAlign 2",
+        "font serif 12 700 1", "fillText hi 1 2", "strokeText yo 3 4",
+    };
+    EXPECT_EQ(Replay(list), expected);
+}
+
+TEST(KRCanvasDisplayListTest, ParsesColorsOnceAtAppend) {
+    static int parse_count = 0;
+    parse_count = 0;
+    KRCanvasDisplayList list([](const std::string &color) -> uint32_t {
+        ++parse_count;
+        return color == "red" ? 0xFFFF0000 : 0;
+    });
+    Append(list, "strokeStyle", R"({"style":"red"})");
+    // fillStyle 不经过 color_parser
+    Append(list, "fillStyle", R"json({"style":"rgba(0,255,0,1)"})json");
+    Append(list, "fillStyle", R"({"style":"#80112233"})");
+    EXPECT_EQ(parse_count, 1);
+
+    std::vector<std::string> expected = {"strokeColor ffff0000", "fillColor ff00ff00", "fillColor 80112233"};
+    EXPECT_EQ(Replay(list), expected);
+    EXPECT_EQ(Replay(list), expected);
+    EXPECT_EQ(parse_count, 1);
+}
+
+TEST(KRCanvasDisplayListTest, CompilesLinearGradient) {
+    KRCanvasDisplayList list;
+    Append(list, "fillStyle",
+           R"({"style":"linear-gradient{\"x0\":0,\"y0\":1,\"x1\":10,\"y1\":11,\"colorStops\":\"#FF0000 0,#0000FF 1\"}"})");
+    Append(list, "strokeStyle", R"({"style":"linear-gradient{broken"})");
+
+    std::vector<std::string> expected = {"fillGradient 0 1 10 11 ffff0000@0 ff0000ff@1", "strokeGradient 0 0 0 0"};
+    EXPECT_EQ(Replay(list), expected);
+}
+
+TEST(KRCanvasDisplayListTest, NormalizesArcSweep) {
+    KRCanvasDisplayList list;
+    // 顺时针从 π 到 0：扫过角度应归一化为正值
+    Append(list, "arc", R"({"x":10,"y":10,"r":5,"sAngle":3.141592653589793,"eAngle":0,"counterclockwise":0})");
+    // 逆时针从 0 到 π/2：扫过角度应为负值
+    Append(list, "arc", R"({"x":0,"y":0,"r":1,"sAngle":0,"eAngle":1.5707963267948966,"counterclockwise":1})");
+
+    auto &ops = list.Ops();
+    ASSERT_EQ(ops.size(), 2u);
+    EXPECT_FLOAT_EQ(ops[0].args[0], 5);
+    EXPECT_FLOAT_EQ(ops[0].args[3], 15);
+    EXPECT_FLOAT_EQ(ops[0].args[4], 180);
+    EXPECT_FLOAT_EQ(ops[0].args[5], 180);
+    EXPECT_FLOAT_EQ(ops[1].args[4], 0);
+    EXPECT_FLOAT_EQ(ops[1].args[5], -270);
+}
+
+TEST(KRCanvasDisplayListTest, ReplaysTransformsAndImages) {
+    KRCanvasDisplayList list;
+    Append(list, "save", "");
+    Append(list, "saveLayer", R"({"x":1,"y":2,"width":3,"height":4})");
+    Append(list, "translate", R"({"x":1,"y":2})");
+    Append(list, "scale", R"({"x":2,"y":3})");
+    Append(list, "rotate", R"({"angle":3.141592653589793})");
+    Append(list, "skew", R"({"x":0.5,"y":0})");
+    Append(list, "transform", R"({"values":[1,2,3,4,5,6,7,8,9,10]})");
+    Append(list, "clip", R"({"intersect":0})");
+    Append(list, "lineDash", R"({"intervals":[4,2]})");
+    Append(list, "drawImage", R"({"cacheKey":"img","sx":1,"sy":2,"dx":3,"dy":4})");
+    Append(list, "restore", "");
+
+    auto calls = Replay(list);
+    std::vector<std::string> expected = {
+        "save", "saveLayer 1 2 4 6", "translate 1 2", "scale 2 3", "rotate 180", "skew 0.5 0",
+        "concat 1 2 3 4 5 6 7 8 9", "clip 0", "lineDash 4 2", "drawImage img 1 2 -1 -1 3 4 nan nan", "restore",
+    };
+    EXPECT_EQ(calls, expected);
+}
+
+TEST(KRCanvasDisplayListTest, ClearDropsCommandsAndSideTables) {
+    KRCanvasDisplayList list;
+    Append(list, "fillText", R"({"text":"a","x":0,"y":0})");
+    list.Clear();
+    EXPECT_TRUE(list.Ops().empty());
+    Append(list, "fillText", R"({"text":"b","x":0,"y":0})");
+    ASSERT_EQ(list.Ops().size(), 1u);
+    EXPECT_EQ(list.Ops()[0].index, 0u);
+    EXPECT_EQ(list.StringAt(0), "b");
+}
+
+TEST(KRCanvasDisplayListBenchmark, ReplayVersusParsePerFrame) {
+    constexpr int kFrames = 500;
+    // 一帧折线图：折线、数据点与坐标标签
+    std::vector<std::pair<std::string, std::string>> commands = {
+        {"strokeStyle", R"json({"style":"rgba(30,144,255,1)"})json"},
+        {"lineWidth", R"({"width":2})"},
+        {"beginPath", ""},
+        {"moveTo", R"({"x":0,"y":100})"},
+    };
+    for (int i = 1; i <= 300; ++i) {
+        commands.push_back({"lineTo", "{\"x\":" + std::to_string(i * 2) + ",\"y\":" + std::to_string(100 + i % 37) + "}"});
+    }
+    commands.push_back({"stroke", ""});
+    commands.push_back({"fillStyle", R"({"style":"#FF1E90FF"})"});
+    for (int i = 0; i < 20; ++i) {
+        commands.push_back({"beginPath", ""});
+        commands.push_back({"arc", "{\"x\":" + std::to_string(i * 30) + R"(,"y":100,"r":3,"sAngle":0,"eAngle":6.283185307179586,"counterclockwise":0})"});
+        commands.push_back({"fill", ""});
+    }
+    commands.push_back({"font", R"({"family":"sans-serif","size":12,"weight":"400","style":"normal"})"});
+    for (int i = 0; i < 10; ++i) {
+        commands.push_back({"fillText", "{\"text\":\"" + std::to_string(i * 10) + "\",\"x\":" + std::to_string(i * 60) + ",\"y\":200}"});
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto per_frame_us = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / kFrames;
+    };
+
+    // 原路径：每次绘制都按 method 名分发并重新解析 json 参数
+    CountingReplayer parse_replayer;
+    auto start = Clock::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        KRCanvasDisplayList scratch;
+        for (auto &command : commands) {
+            KRCanvasOpCode code;
+            if (KRCanvasDisplayList::OpCodeOf(command.first, code)) {
+                scratch.Append(code, command.second);
+            }
+        }
+        scratch.Replay(parse_replayer);
+    }
+    double parse_us = per_frame_us(start);
+
+    // 现路径：CallMethod 时编译一次，每帧只回放
+    KRCanvasDisplayList list;
+    for (auto &command : commands) {
+        Append(list, command.first, command.second);
+    }
+    CountingReplayer replay_replayer;
+    start = Clock::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        list.Replay(replay_replayer);
+    }
+    double replay_us = per_frame_us(start);
+
+    EXPECT_EQ(parse_replayer.calls, replay_replayer.calls);
+    printf("canvas frame (%zu commands): parse per frame %.1f us, compiled replay %.1f us\n", commands.size(),
+           parse_us, replay_us);
+}
@@ -0,0 +1,152 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/components/richtext/KRTextMeasureCache.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<int> g_live_typography{0};
+
+std::shared_ptr<KRTextMeasureResult> MakeResult(float width) {
+    auto result = std::make_shared<KRTextMeasureResult>();
+    result->size = KRSize(width, 10);
+    g_live_typography++;
+    result->typography = std::shared_ptr<OH_Drawing_Typography>(
+        reinterpret_cast<OH_Drawing_Typography *>(new int(0)), [](OH_Drawing_Typography *typography) {
+            delete reinterpret_cast<int *>(typography);
+            g_live_typography--;
+        });
+    return result;
+}
+
+}  // namespace
+
+TEST(KRTextMeasureCacheTest, KeysNeverShareAnEntry) {
+    KRTextMeasureCache cache(16);
+    cache.Put("a", MakeResult(1));
+    cache.Put("b", MakeResult(2));
+    ASSERT_NE(cache.Get("a"), nullptr);
+    ASSERT_NE(cache.Get("b"), nullptr);
+    EXPECT_EQ(cache.Get("a")->size.width, 1);
+    EXPECT_EQ(cache.Get("b")->size.width, 2);
+
+    cache.Put("a", MakeResult(3));
+    EXPECT_EQ(cache.Get("a")->size.width, 3);
+    EXPECT_EQ(cache.Get("b")->size.width, 2);
+    EXPECT_EQ(cache.GetStats().size, 2u);
+}
+
+TEST(KRTextMeasureCacheTest, EvictsLeastRecentlyUsed) {
+    KRTextMeasureCache cache(2);
+    cache.Put("a", MakeResult(1));
+    cache.Put("b", MakeResult(2));
+    cache.Get("a");
+    cache.Put("c", MakeResult(3));
+    EXPECT_NE(cache.Get("a"), nullptr);
+    EXPECT_EQ(cache.Get("b"), nullptr);
+    EXPECT_NE(cache.Get("c"), nullptr);
+    EXPECT_EQ(cache.GetStats().eviction_count, 1u);
+}
+
+TEST(KRTextMeasureCacheTest, CountsHitsAndMisses) {
+    KRTextMeasureCache cache(4);
+    cache.Get("missing");
+    cache.Put("a", MakeResult(1));
+    cache.Get("a");
+    cache.Get("a");
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hit_count, 2u);
+    EXPECT_EQ(stats.miss_count, 1u);
+    EXPECT_EQ(stats.size, 1u);
+}
+
+TEST(KRTextMeasureCacheTest, TypographyIsLeasedToOneHolderAtATime) {
+    KRTextMeasureCache cache(4);
+    auto result = MakeResult(1);
+    auto writer_lease = cache.Put("a", result);
+    ASSERT_NE(writer_lease, nullptr);
+    EXPECT_EQ(writer_lease.get(), result->typography.get());
+
+    // 写入方以及它交给主线程的副本都释放后，才能租给其他 shadow
+    auto main_thread_copy = writer_lease;
+    EXPECT_EQ(cache.AcquireTypography(result), nullptr);
+    writer_lease.reset();
+    EXPECT_EQ(cache.AcquireTypography(result), nullptr);
+    main_thread_copy.reset();
+
+    auto reader_lease = cache.AcquireTypography(result);
+    ASSERT_NE(reader_lease, nullptr);
+    EXPECT_EQ(cache.AcquireTypography(result), nullptr);
+    reader_lease.reset();
+    EXPECT_NE(cache.AcquireTypography(result), nullptr);
+    EXPECT_EQ(cache.GetStats().typography_reuse_count, 2u);
+}
+
+TEST(KRTextMeasureCacheTest, LeaseOutlivesEvictedEntry) {
+    int live_before = g_live_typography.load();
+    {
+        KRTextMeasureCache cache(1);
+        auto lease = cache.Put("a", MakeResult(1));
+        cache.Put("b", MakeResult(2));
+        EXPECT_EQ(cache.Get("a"), nullptr);
+        // 被淘汰后租约仍然有效
+        EXPECT_EQ(g_live_typography.load(), live_before + 2);
+        lease.reset();
+        EXPECT_EQ(g_live_typography.load(), live_before + 1);
+    }
+    EXPECT_EQ(g_live_typography.load(), live_before);
+}
+
+TEST(KRTextMeasureCacheTest, ZeroCapacityKeepsWriterTypography) {
+    KRTextMeasureCache cache(0);
+    auto result = MakeResult(1);
+    EXPECT_EQ(cache.Put("a", result), result->typography);
+    EXPECT_EQ(cache.Get("a"), nullptr);
+}
+
+TEST(KRTextMeasureCacheTest, ConcurrentAcquireNeverSharesTypography) {
+    KRTextMeasureCache cache(4);
+    auto result = MakeResult(1);
+    cache.Put("a", result).reset();
+
+    std::atomic<int> holders{0};
+    std::atomic<bool> shared{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 20000; ++i) {
+                if (auto lease = cache.AcquireTypography(result)) {
+                    if (holders.fetch_add(1) != 0) {
+                        shared = true;
+                    }
+                    // 模拟把副本交给另一个线程后再释放
+                    auto copy = lease;
+                    std::thread([copy = std::move(copy)]() mutable { copy.reset(); }).join();
+                    holders.fetch_sub(1);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(shared.load());
+    EXPECT_NE(cache.AcquireTypography(result), nullptr);
+}
@@ -0,0 +1,360 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/events/KREventCoalescer.h"
+
+#include <gtest/gtest.h>
+#include <native_vsync/native_vsync.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "libohos_render/foundation/thread/KRMainThread.h"
+
+struct OH_NativeVSync {
+    OH_NativeVSync_FrameCallback callback = nullptr;
+    void *data = nullptr;
+};
+
+namespace {
+
+constexpr int64_t kNanosPerMilli = 1000000;
+
+OH_NativeVSync g_vsync;
+std::vector<std::function<void()>> g_main_tasks;
+
+/**
+ * 触发一次 vsync，返回是否有等待中的请求
+ */
+bool FireVSync(long long timestamp) {
+    auto callback = g_vsync.callback;
+    if (!callback) {
+        return false;
+    }
+    g_vsync.callback = nullptr;
+    callback(timestamp, g_vsync.data);
+    return true;
+}
+
+/**
+ * 执行抛到主线程的任务，返回执行数量
+ */
+size_t RunMainTasks() {
+    std::vector<std::function<void()>> tasks;
+    tasks.swap(g_main_tasks);
+    for (auto &task : tasks) {
+        task();
+    }
+    return tasks.size();
+}
+
+}  // namespace
+
+// 宿主机上的 vsync 与主线程由测试驱动：RequestFrame 只记录回调，RunOnMainThread 只入队
+OH_NativeVSync *OH_NativeVSync_Create(const char *, unsigned int) {
+    return &g_vsync;
+}
+
+int OH_NativeVSync_RequestFrame(OH_NativeVSync *nativeVsync, OH_NativeVSync_FrameCallback callback, void *data) {
+    nativeVsync->callback = callback;
+    nativeVsync->data = data;
+    return 0;
+}
+
+int OH_NativeVSync_GetPeriod(OH_NativeVSync *, long long *period) {
+    *period = 16666667;
+    return 0;
+}
+
+KRTimerId KRMainThread::RunOnMainThread(const std::function<void()> &task, int) {
+    g_main_tasks.push_back(task);
+    return 0;
+}
+
+namespace {
+
+/**
+ * 手动驱动的显示帧，NextFrame 模拟一次 vsync
+ */
+class ManualFrames {
+ public:
+    KREventCoalescer::FrameScheduler Scheduler() {
+        return [this](const std::function<void()> &task) { tasks_.push_back(task); };
+    }
+
+    size_t NextFrame() {
+        std::vector<std::function<void()>> tasks;
+        tasks.swap(tasks_);
+        for (auto &task : tasks) {
+            task();
+        }
+        return tasks.size();
+    }
+
+    size_t Pending() const {
+        return tasks_.size();
+    }
+
+ private:
+    std::vector<std::function<void()>> tasks_;
+};
+
+KRMotionSample Sample(float x, float y, int64_t time_ms) {
+    KRMotionSample sample;
+    sample.point = KRPoint(x, y);
+    sample.window_point = KRPoint(x + 100, y + 200);
+    sample.timestamp_ns = time_ms * kNanosPerMilli;
+    return sample;
+}
+
+class KREventCoalescerTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        coalescer_ = KREventCoalescer::Create(frames_.Scheduler());
+    }
+
+    void Move(float x, float y, int64_t time_ms) {
+        coalescer_->PostMotion(Sample(x, y, time_ms), [this](const KRCoalescedMotion &motion) {
+            delivered_.push_back(motion);
+            order_.push_back("move");
+        });
+    }
+
+    void Discrete(const std::string &name, float x, float y, int64_t time_ms) {
+        coalescer_->PostDiscrete(Sample(x, y, time_ms), [this, name] { order_.push_back(name); });
+    }
+
+    ManualFrames frames_;
+    std::shared_ptr<KREventCoalescer> coalescer_;
+    std::vector<KRCoalescedMotion> delivered_;
+    std::vector<std::string> order_;
+};
+
+}  // namespace
+
+TEST_F(KREventCoalescerTest, MergesMovesWithinOneFrame) {
+    Discrete("begin", 0, 0, 0);
+    for (int i = 1; i <= 10; i++) {
+        Move(i, i * 2, i);
+    }
+    EXPECT_TRUE(delivered_.empty());
+    EXPECT_EQ(frames_.Pending(), 1u);  // 一帧内只请求一次派发
+
+    frames_.NextFrame();
+    ASSERT_EQ(delivered_.size(), 1u);
+    EXPECT_EQ(delivered_[0].merged_count, 10);
+    EXPECT_FLOAT_EQ(delivered_[0].latest.point.x, 10);
+    EXPECT_FLOAT_EQ(delivered_[0].latest.point.y, 20);
+    EXPECT_FLOAT_EQ(delivered_[0].latest.window_point.x, 110);
+    EXPECT_EQ(coalescer_->GetReceivedCount(), 11u);
+    EXPECT_EQ(coalescer_->GetDeliveredCount(), 2u);
+}
+
+TEST_F(KREventCoalescerTest, AccumulatesDeltaAndVelocityFromDiscreteAnchor) {
+    Discrete("begin", 0, 0, 0);
+    Move(2, 1, 4);
+    Move(5, 3, 8);
+    Move(9, -4, 12);
+    frames_.NextFrame();
+
+    ASSERT_EQ(delivered_.size(), 1u);
+    EXPECT_FLOAT_EQ(delivered_[0].delta.x, 9);
+    EXPECT_FLOAT_EQ(delivered_[0].delta.y, -4);
+    // 时间跨度从 begin（0ms）到最后一次 move（12ms）
+    EXPECT_NEAR(delivered_[0].velocity.x, 750, 0.01);
+    EXPECT_NEAR(delivered_[0].velocity.y, -333.333, 0.01);
+}
+
+TEST_F(KREventCoalescerTest, DeltaRestartsAfterEachDelivery) {
+    Discrete("begin", 0, 0, 0);
+    Move(4, 0, 8);
+    Move(8, 0, 16);
+    frames_.NextFrame();
+    Move(10, 3, 20);
+    Move(11, 6, 24);
+    frames_.NextFrame();
+
+    ASSERT_EQ(delivered_.size(), 2u);
+    EXPECT_FLOAT_EQ(delivered_[0].delta.x, 8);
+    EXPECT_NEAR(delivered_[0].velocity.x, 500, 0.01);
+    // 第二帧从上一帧最后一次采样（16ms，(8, 0)）算起
+    EXPECT_FLOAT_EQ(delivered_[1].delta.x, 3);
+    EXPECT_FLOAT_EQ(delivered_[1].delta.y, 6);
+    EXPECT_NEAR(delivered_[1].velocity.x, 375, 0.01);
+    EXPECT_NEAR(delivered_[1].velocity.y, 750, 0.01);
+    EXPECT_EQ(delivered_[1].merged_count, 2);
+}
+
+TEST_F(KREventCoalescerTest, FirstMoveWithoutAnchorHasNoDelta) {
+    Move(5, 5, 10);
+    frames_.NextFrame();
+    Move(7, 5, 20);
+    frames_.NextFrame();
+
+    ASSERT_EQ(delivered_.size(), 2u);
+    EXPECT_FLOAT_EQ(delivered_[0].delta.x, 0);
+    EXPECT_FLOAT_EQ(delivered_[0].velocity.x, 0);
+    EXPECT_FLOAT_EQ(delivered_[1].delta.x, 2);
+    EXPECT_NEAR(delivered_[1].velocity.x, 200, 0.01);
+}
+
+TEST_F(KREventCoalescerTest, DiscreteFlushesPendingMoveFirst) {
+    Discrete("begin", 0, 0, 0);
+    Move(3, 0, 4);
+    Move(6, 0, 8);
+    Discrete("end", 6, 0, 9);
+
+    std::vector<std::string> expected = {"begin", "move", "end"};
+    EXPECT_EQ(order_, expected);
+    ASSERT_EQ(delivered_.size(), 1u);
+    EXPECT_FLOAT_EQ(delivered_[0].delta.x, 6);
+
+    // 已提前派发，帧到来时没有可派发的内容
+    frames_.NextFrame();
+    EXPECT_EQ(delivered_.size(), 1u);
+    EXPECT_EQ(coalescer_->GetDeliveredCount(), 3u);
+}
+
+TEST_F(KREventCoalescerTest, DiscreteWithoutSampleClearsAnchor) {
+    Discrete("begin", 0, 0, 0);
+    Move(5, 0, 5);
+    coalescer_->PostDiscrete([this] { order_.push_back("cancel"); });
+    Move(50, 0, 100);
+    frames_.NextFrame();
+
+    ASSERT_EQ(delivered_.size(), 2u);
+    EXPECT_FLOAT_EQ(delivered_[0].delta.x, 5);
+    EXPECT_FLOAT_EQ(delivered_[1].delta.x, 0);  // 不与 cancel 之前的位置相减
+}
+
+TEST_F(KREventCoalescerTest, LatestCallbackWins) {
+    int first = 0;
+    int second = 0;
+    coalescer_->PostMotion(Sample(1, 0, 1), [&first](const KRCoalescedMotion &) { first++; });
+    coalescer_->PostMotion(Sample(2, 0, 2), [&second](const KRCoalescedMotion &) { second++; });
+    frames_.NextFrame();
+
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(second, 1);
+}
+
+TEST_F(KREventCoalescerTest, ResetDropsPendingMotionAndAnchor) {
+    Discrete("begin", 0, 0, 0);
+    Move(5, 0, 5);
+    coalescer_->Reset();
+    frames_.NextFrame();
+    EXPECT_TRUE(delivered_.empty());
+
+    Move(8, 0, 10);
+    frames_.NextFrame();
+    ASSERT_EQ(delivered_.size(), 1u);
+    EXPECT_FLOAT_EQ(delivered_[0].delta.x, 0);
+}
+
+TEST_F(KREventCoalescerTest, FrameAfterDestroyIsIgnored) {
+    Move(1, 0, 1);
+    coalescer_.reset();
+    EXPECT_EQ(frames_.NextFrame(), 1u);
+    EXPECT_TRUE(delivered_.empty());
+}
+
+TEST(KREventCoalescerVSyncTest, DefaultSchedulerDeliversOnMainThreadAfterVSync) {
+    auto coalescer = KREventCoalescer::Create();
+    int delivered = 0;
+    KRCoalescedMotion last;
+    for (int i = 1; i <= 4; i++) {
+        coalescer->PostMotion(Sample(i, 0, i), [&](const KRCoalescedMotion &motion) {
+            delivered++;
+            last = motion;
+        });
+    }
+    EXPECT_EQ(RunMainTasks(), 0u);
+
+    ASSERT_TRUE(FireVSync(16 * kNanosPerMilli));
+    EXPECT_EQ(delivered, 0);  // vsync 线程上只抛任务，不直接派发
+    EXPECT_EQ(RunMainTasks(), 1u);
+    EXPECT_EQ(delivered, 1);
+    EXPECT_EQ(last.merged_count, 4);
+    EXPECT_FLOAT_EQ(last.delta.x, 3);
+    EXPECT_FALSE(FireVSync(32 * kNanosPerMilli));
+}
+
+/**
+ * 合成的手势流：begin、duration_ms 内按 input_hz 匀速移动、end，显示帧为 60Hz
+ * 各帧派发的位移之和应等于手指的总位移，bridge 调用次数为派发次数
+ */
+struct StreamResult {
+    uint64_t received = 0;
+    uint64_t delivered = 0;
+    float total_delta_x = 0;
+    float max_velocity_error = 0;
+};
+
+StreamResult RunSyntheticPan(int input_hz, int duration_ms, float speed_px_per_s) {
+    ManualFrames frames;
+    auto coalescer = KREventCoalescer::Create(frames.Scheduler());
+    StreamResult result;
+    auto on_motion = [&result, speed_px_per_s](const KRCoalescedMotion &motion) {
+        result.total_delta_x += motion.delta.x;
+        result.max_velocity_error = std::max(result.max_velocity_error, std::abs(motion.velocity.x - speed_px_per_s));
+    };
+
+    const int64_t input_period_ns = 1000000000LL / input_hz;
+    const int64_t frame_period_ns = 1000000000LL / 60;
+    const int64_t end_ns = duration_ms * kNanosPerMilli;
+    auto position_at = [speed_px_per_s](int64_t t_ns) { return speed_px_per_s * t_ns / 1e9f; };
+
+    KRMotionSample begin;
+    coalescer->PostDiscrete(begin, nullptr);
+    int64_t next_frame_ns = frame_period_ns;
+    float last_x = 0;
+    for (int64_t t = input_period_ns; t <= end_ns; t += input_period_ns) {
+        while (next_frame_ns <= t) {
+            frames.NextFrame();
+            next_frame_ns += frame_period_ns;
+        }
+        KRMotionSample sample;
+        last_x = position_at(t);
+        sample.point = KRPoint(last_x, 0);
+        sample.timestamp_ns = t;
+        coalescer->PostMotion(sample, on_motion);
+    }
+    KRMotionSample end;
+    end.point = KRPoint(last_x, 0);
+    coalescer->PostDiscrete(end, nullptr);
+    frames.NextFrame();
+
+    result.received = coalescer->GetReceivedCount();
+    result.delivered = coalescer->GetDeliveredCount();
+    EXPECT_NEAR(result.total_delta_x, last_x, 0.01f);
+    return result;
+}
+
+TEST(KREventCoalescerStreamTest, SyntheticPanCrossesBridgeOncePerFrame) {
+    for (int input_hz : {60, 120, 240}) {
+        auto result = RunSyntheticPan(input_hz, 1000, 600);
+        // begin + end + 每个显示帧至多一次 move，最后不足一帧的 move 由 end 提前派发
+        EXPECT_LE(result.delivered, 2u + 60u + 1u) << input_hz;
+        EXPECT_EQ(result.received, 2u + input_hz) << input_hz;
+        // 匀速移动时每帧的速度与实际速度一致（float 累加误差）
+        EXPECT_LT(result.max_velocity_error, 0.5f) << input_hz;
+        printf("pan %dHz for 1s at 60fps: received=%llu bridge crossings=%llu saved=%llu\n", input_hz,
+               static_cast<unsigned long long>(result.received), static_cast<unsigned long long>(result.delivered),
+               static_cast<unsigned long long>(result.received - result.delivered));
+    }
+}
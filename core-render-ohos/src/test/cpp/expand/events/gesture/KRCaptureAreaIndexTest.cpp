@@ -0,0 +1,179 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/events/gesture/KRCaptureAreaIndex.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Area = KRCaptureAreaIndex::Area;
+
+std::vector<size_t> BruteForce(const std::vector<Area> &areas, float x, float y) {
+    std::vector<size_t> result;
+    for (size_t i = 0; i < areas.size(); ++i) {
+        // NaN 坐标不被任何边界排除，与索引的语义一致
+        if (!(x < areas[i].left || x > areas[i].right || y < areas[i].top || y > areas[i].bottom)) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+std::vector<size_t> Query(const KRCaptureAreaIndex &index, float x, float y) {
+    std::vector<size_t> result;
+    index.AnyContains(x, y, [&result](size_t i) {
+        result.push_back(i);
+        return false;
+    });
+    return result;
+}
+
+}  // namespace
+
+TEST(KRCaptureAreaIndexTest, EmptyIndexMatchesNothing) {
+    KRCaptureAreaIndex index;
+    index.Build({});
+    EXPECT_TRUE(Query(index, 0, 0).empty());
+}
+
+TEST(KRCaptureAreaIndexTest, VisitorStopsAtFirstAccept) {
+    std::vector<Area> areas(KRCaptureAreaIndex::kMinGridAreaCount * 2);
+    for (size_t i = 0; i < areas.size(); ++i) {
+        areas[i].left = static_cast<float>(i);
+        areas[i].right = areas[i].left + 100;
+        areas[i].top = 0;
+        areas[i].bottom = 100;
+    }
+    KRCaptureAreaIndex index;
+    index.Build(areas);
+    std::vector<size_t> visited;
+    EXPECT_TRUE(index.AnyContains(50, 50, [&visited](size_t i) {
+        visited.push_back(i);
+        return i == 3;
+    }));
+    EXPECT_EQ(visited, (std::vector<size_t>{0, 1, 2, 3}));
+}
+
+TEST(KRCaptureAreaIndexTest, EdgesAreInclusive) {
+    std::vector<Area> areas(KRCaptureAreaIndex::kMinGridAreaCount);
+    for (size_t i = 0; i < areas.size(); ++i) {
+        areas[i].left = i * 10.0f;
+        areas[i].right = areas[i].left + 10;
+        areas[i].top = 0;
+        areas[i].bottom = 10;
+    }
+    KRCaptureAreaIndex index;
+    index.Build(areas);
+    EXPECT_EQ(Query(index, 10, 10), (std::vector<size_t>{0, 1}));
+    EXPECT_EQ(Query(index, 80, 0), (std::vector<size_t>{7}));
+    EXPECT_TRUE(Query(index, 80.5f, 0).empty());
+}
+
+TEST(KRCaptureAreaIndexTest, RandomAreasMatchBruteForce) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-50, 1000);
+    std::uniform_real_distribution<float> size(-5, 300);  // 负尺寸即空区域
+    std::uniform_int_distribution<int> coin(0, 9);
+    for (int round = 0; round < 2000; ++round) {
+        size_t count = rng() % 64;
+        std::vector<Area> areas;
+        for (size_t i = 0; i < count; ++i) {
+            Area area;
+            // 约 1/10 的边保持无界
+            if (coin(rng)) {
+                area.left = position(rng);
+                area.right = area.left + size(rng);
+            }
+            if (coin(rng)) {
+                area.top = position(rng);
+                area.bottom = area.top + size(rng);
+            }
+            if (coin(rng) == 0 && !areas.empty()) {
+                area = areas[rng() % areas.size()];
+            }
+            areas.push_back(area);
+        }
+        KRCaptureAreaIndex index;
+        index.Build(areas);
+        ASSERT_EQ(index.Size(), count);
+        for (int q = 0; q < 200; ++q) {
+            float x = position(rng) * 1.2f - 100;
+            float y = position(rng) * 1.2f - 100;
+            // 有意落在区域边界上
+            if (count > 0 && q % 10 == 0) {
+                x = areas[rng() % count].right;
+            }
+            if (count > 0 && q % 7 == 0) {
+                y = areas[rng() % count].top;
+            }
+            if (q == 199) {
+                x = NAN;
+            }
+            ASSERT_EQ(Query(index, x, y), BruteForce(areas, x, y))
+                << "round " << round << " query (" << x << ", " << y << ")";
+        }
+    }
+}
+
+TEST(KRCaptureAreaIndexBenchmark, GridVersusLinearScan) {
+    constexpr int kQueryCount = 1000000;
+    std::vector<Area> areas;
+    for (int i = 0; i < 256; ++i) {
+        Area area;
+        area.left = (i % 16) * 60.0f;
+        area.right = area.left + 50;
+        area.top = (i / 16) * 60.0f;
+        area.bottom = area.top + 50;
+        areas.push_back(area);
+    }
+    KRCaptureAreaIndex index;
+    index.Build(areas);
+    using Clock = std::chrono::steady_clock;
+    auto per_query_ns = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kQueryCount;
+    };
+
+    int64_t grid_hits = 0;
+    auto start = Clock::now();
+    for (int i = 0; i < kQueryCount; ++i) {
+        float x = (i * 37) % 960;
+        float y = (i * 91) % 960;
+        grid_hits += index.AnyContains(x, y, [](size_t) { return true; });
+    }
+    double grid_ns = per_query_ns(start);
+
+    int64_t linear_hits = 0;
+    start = Clock::now();
+    for (int i = 0; i < kQueryCount; ++i) {
+        float x = (i * 37) % 960;
+        float y = (i * 91) % 960;
+        for (const auto &area : areas) {
+            if (area.Contains(x, y)) {
+                ++linear_hits;
+                break;
+            }
+        }
+    }
+    double linear_ns = per_query_ns(start);
+
+    EXPECT_EQ(grid_hits, linear_hits);
+    printf("capture area lookup: grid %.1f ns, linear %.1f ns per query (%zu areas)\n", grid_ns, linear_ns,
+           areas.size());
+}
@@ -0,0 +1,165 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/modules/codec/KRCodec.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+using kuikly::KRHashAlgorithm;
+using kuikly::KRHasher;
+
+namespace {
+
+const KRHashAlgorithm kAlgorithms[] = {KRHashAlgorithm::kMd5, KRHashAlgorithm::kSha1, KRHashAlgorithm::kSha256,
+                                       KRHashAlgorithm::kCrc32};
+
+std::string HashOf(KRHashAlgorithm algorithm, const std::string &data) {
+    KRHasher hasher(algorithm);
+    hasher.Update(data.data(), data.size());
+    return hasher.FinalHex();
+}
+
+/**
+ * 写入随机内容的临时文件，析构时删除
+ */
+class TempFile {
+ public:
+    explicit TempFile(const std::string &content) {
+        char path[] = "/tmp/kr_codec_test_XXXXXX";
+        int fd = mkstemp(path);
+        if (fd >= 0) {
+            path_ = path;
+            ok_ = write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size());
+            close(fd);
+        }
+    }
+    ~TempFile() {
+        if (!path_.empty()) {
+            unlink(path_.c_str());
+        }
+    }
+
+    bool ok() const {
+        return ok_;
+    }
+    const std::string &path() const {
+        return path_;
+    }
+
+ private:
+    std::string path_;
+    bool ok_ = false;
+};
+
+std::string RandomBytes(size_t size, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::string data(size, 0);
+    for (auto &c : data) {
+        c = static_cast<char>(rng());
+    }
+    return data;
+}
+
+}  // namespace
+
+// RFC 1321、FIPS 180 与 zlib crc32 的已知结果
+TEST(KRCodecTest, HashKnownAnswers) {
+    struct {
+        KRHashAlgorithm algorithm;
+        const char *input;
+        const char *hex;
+    } answers[] = {
+        {KRHashAlgorithm::kMd5, "", "d41d8cd98f00b204e9800998ecf8427e"},
+        {KRHashAlgorithm::kMd5, "abc", "900150983cd24fb0d6963f7d28e17f72"},
+        {KRHashAlgorithm::kMd5, "message digest", "f96b697d7cb7938d525a2f31aaf161d0"},
+        {KRHashAlgorithm::kSha1, "", "da39a3ee5e6b4b0d3255bfef95601890afd80709"},
+        {KRHashAlgorithm::kSha1, "abc", "a9993e364706816aba3e25717850c26c9cd0d89d"},
+        {KRHashAlgorithm::kSha1, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+         "84983e441c3bd26ebaae4aa1f95129e5e54670f1"},
+        {KRHashAlgorithm::kSha256, "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+        {KRHashAlgorithm::kSha256, "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+        {KRHashAlgorithm::kSha256, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+         "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+        {KRHashAlgorithm::kCrc32, "", "00000000"},
+        {KRHashAlgorithm::kCrc32, "123456789", "cbf43926"},
+    };
+    for (auto &answer : answers) {
+        EXPECT_EQ(HashOf(answer.algorithm, answer.input), answer.hex) << answer.input;
+    }
+    std::string million_a(1000000, 'a');
+    EXPECT_EQ(kuikly::KRSha1(million_a), "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+    EXPECT_EQ(kuikly::KRSha256(million_a), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+    EXPECT_EQ(kuikly::KRCrc32("123456789"), "cbf43926");
+}
+
+TEST(KRCodecTest, ParseHashAlgorithm) {
+    KRHashAlgorithm algorithm;
+    EXPECT_TRUE(kuikly::KRParseHashAlgorithm("sha256", algorithm));
+    EXPECT_EQ(algorithm, KRHashAlgorithm::kSha256);
+    EXPECT_FALSE(kuikly::KRParseHashAlgorithm("sha512", algorithm));
+}
+
+TEST(KRCodecTest, IncrementalUpdatesMatchOneShot) {
+    std::mt19937 rng(7);
+    for (int iteration = 0; iteration < 500; ++iteration) {
+        std::string data = RandomBytes(rng() % 5000, rng());
+        for (auto algorithm : kAlgorithms) {
+            KRHasher hasher(algorithm);
+            size_t offset = 0;
+            while (offset < data.size()) {
+                size_t size = std::min<size_t>(rng() % 200, data.size() - offset);
+                hasher.Update(data.data() + offset, size);
+                offset += size;
+            }
+            ASSERT_EQ(hasher.FinalHex(), HashOf(algorithm, data));
+        }
+    }
+}
+
+TEST(KRCodecTest, HashFileMatchesInMemoryDigest) {
+    // 跨越多个读取块且不对齐
+    std::string data = RandomBytes(3 * 1024 * 1024 + 17, 1);
+    TempFile file(data);
+    ASSERT_TRUE(file.ok());
+    for (auto algorithm : kAlgorithms) {
+        std::string digest;
+        ASSERT_TRUE(kuikly::KRHashFile(file.path(), algorithm, digest));
+        EXPECT_EQ(digest, HashOf(algorithm, data));
+    }
+    std::string digest;
+    EXPECT_FALSE(kuikly::KRHashFile(file.path() + ".missing", KRHashAlgorithm::kMd5, digest));
+}
+
+TEST(KRCodecBenchmark, HashFileThroughput) {
+    constexpr size_t kFileSize = 32 * 1024 * 1024;
+    TempFile file(RandomBytes(kFileSize, 2));
+    ASSERT_TRUE(file.ok());
+    const char *names[] = {"md5", "sha1", "sha256", "crc32"};
+    for (size_t i = 0; i < sizeof(kAlgorithms) / sizeof(kAlgorithms[0]); ++i) {
+        std::string digest;
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(kuikly::KRHashFile(file.path(), kAlgorithms[i], digest));
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printf("hash file %-6s %.0f MB/s (%zu MB)\n", names[i], kFileSize / seconds / (1024 * 1024),
+               kFileSize / (1024 * 1024));
+    }
+}
@@ -0,0 +1,253 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/modules/preferences/KRPreferencesLog.h"
+
+#include <gtest/gtest.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+using kuikly::util::PreferencesLog;
+using Entries = std::unordered_map<std::string, std::string>;
+
+namespace {
+
+class KRPreferencesLogTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        char dir[] = "/tmp/kr_prefs_XXXXXX";
+        ASSERT_NE(mkdtemp(dir), nullptr);
+        dir_ = dir;
+        path_ = dir_ + "/prefs.kv";
+    }
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(dir_, ec);
+    }
+
+    Entries Reopen() {
+        Entries entries;
+        PreferencesLog log;
+        EXPECT_TRUE(log.Open(path_, &entries));
+        return entries;
+    }
+
+    std::string dir_;
+    std::string path_;
+};
+
+std::string KeyOf(int i) {
+    return "k" + std::to_string(i);
+}
+
+std::string ValueOf(int i) {
+    // 长度不一，让记录跨越页边界
+    return std::string(1 + i % 97, static_cast<char>('a' + i % 26));
+}
+
+// 子进程中按序写入 k0..kN，每 64 条压缩一次，直到被杀死
+[[noreturn]] void WriteForever(const std::string &path) {
+    PreferencesLog log;
+    Entries entries;
+    if (!log.Open(path, &entries)) {
+        _exit(1);
+    }
+    for (int i = 0;; ++i) {
+        PreferencesLog::ScopedFileLock lock(log);
+        entries[KeyOf(i)] = ValueOf(i);
+        if (i % 64 == 63) {
+            log.Rewrite(entries);
+        } else {
+            log.Append(KeyOf(i), ValueOf(i));
+        }
+    }
+}
+
+}  // namespace
+
+TEST_F(KRPreferencesLogTest, ReopenReplaysLastValuePerKey) {
+    {
+        PreferencesLog log;
+        Entries entries;
+        ASSERT_TRUE(log.Open(path_, &entries));
+        EXPECT_TRUE(entries.empty());
+        PreferencesLog::ScopedFileLock lock(log);
+        ASSERT_TRUE(log.Append("a", "1"));
+        ASSERT_TRUE(log.Append("b", "2"));
+        ASSERT_TRUE(log.Append("a", "3"));
+    }
+    Entries expected = {{"a", "3"}, {"b", "2"}};
+    EXPECT_EQ(Reopen(), expected);
+}
+
+TEST_F(KRPreferencesLogTest, GrowsAndRewritesWithoutLosingData) {
+    Entries entries;
+    {
+        PreferencesLog log;
+        ASSERT_TRUE(log.Open(path_, &entries));
+        PreferencesLog::ScopedFileLock lock(log);
+        for (int i = 0; i < 2000; ++i) {
+            entries[KeyOf(i % 300)] = ValueOf(i);
+            ASSERT_TRUE(log.Append(KeyOf(i % 300), ValueOf(i)));
+        }
+        size_t used = log.UsedBytes();
+        ASSERT_TRUE(log.Rewrite(entries));
+        EXPECT_LT(log.UsedBytes(), used);
+        ASSERT_TRUE(log.Append("after", "rewrite"));
+        entries["after"] = "rewrite";
+    }
+    EXPECT_EQ(Reopen(), entries);
+    EXPECT_FALSE(std::filesystem::exists(path_ + ".tmp"));
+}
+
+TEST_F(KRPreferencesLogTest, CorruptRecordIsDroppedAndLaterAppendsSurvive) {
+    {
+        PreferencesLog log;
+        Entries entries;
+        ASSERT_TRUE(log.Open(path_, &entries));
+        PreferencesLog::ScopedFileLock lock(log);
+        ASSERT_TRUE(log.Append("good", "1"));
+        ASSERT_TRUE(log.Append("bad", "2"));
+    }
+    // 篡改第二条记录的 value
+    size_t bad_value_offset = PreferencesLog::kHeaderSize + PreferencesLog::RecordSize("good", "1") +
+                              PreferencesLog::kRecordHeaderSize + 3;
+    FILE *file = fopen(path_.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    fseek(file, static_cast<long>(bad_value_offset), SEEK_SET);
+    fputc('X', file);
+    fclose(file);
+
+    {
+        PreferencesLog log;
+        Entries entries;
+        ASSERT_TRUE(log.Open(path_, &entries));
+        EXPECT_EQ(entries, (Entries{{"good", "1"}}));
+        PreferencesLog::ScopedFileLock lock(log);
+        ASSERT_TRUE(log.Append("next", "3"));
+    }
+    EXPECT_EQ(Reopen(), (Entries{{"good", "1"}, {"next", "3"}}));
+}
+
+TEST_F(KRPreferencesLogTest, RecoversConsistentPrefixAfterSigkill) {
+    std::mt19937 rng(20251017);
+    int max_seen = 0;
+    for (int round = 0; round < 20; ++round) {
+        pid_t pid = fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            WriteForever(path_);
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(2000 + rng() % 20000));
+        kill(pid, SIGKILL);
+        int status = 0;
+        waitpid(pid, &status, 0);
+        ASSERT_TRUE(WIFSIGNALED(status));
+
+        // 每一轮都从 k0 重新写，恢复出的数据必须是某个前缀
+        Entries entries = Reopen();
+        int count = static_cast<int>(entries.size());
+        for (int i = 0; i < count; ++i) {
+            auto it = entries.find(KeyOf(i));
+            ASSERT_NE(it, entries.end()) << "round " << round << " missing " << KeyOf(i);
+            ASSERT_EQ(it->second, ValueOf(i));
+        }
+        max_seen = std::max(max_seen, count);
+    }
+    EXPECT_GT(max_seen, 0);
+}
+
+TEST_F(KRPreferencesLogTest, ProcessesSharingTheFileDoNotLoseWrites) {
+    constexpr int kProcesses = 3;
+    constexpr int kWritesPerProcess = 300;
+    std::vector<pid_t> children;
+    for (int p = 0; p < kProcesses; ++p) {
+        pid_t pid = fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            PreferencesLog log;
+            Entries entries;
+            if (!log.Open(path_, &entries)) {
+                _exit(1);
+            }
+            for (int i = 0; i < kWritesPerProcess; ++i) {
+                PreferencesLog::ScopedFileLock lock(log);
+                log.Refresh(&entries);
+                auto key = "p" + std::to_string(p) + "_" + std::to_string(i);
+                entries[key] = ValueOf(i);
+                // 压缩会替换文件，其他进程需在 Refresh 时重新打开
+                bool ok = i % 50 == 49 ? log.Rewrite(entries) : log.Append(key, ValueOf(i));
+                if (!ok) {
+                    _exit(2);
+                }
+            }
+            _exit(0);
+        }
+        children.push_back(pid);
+    }
+    for (auto pid : children) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        ASSERT_TRUE(WIFEXITED(status));
+        ASSERT_EQ(WEXITSTATUS(status), 0);
+    }
+
+    Entries entries = Reopen();
+    EXPECT_EQ(entries.size(), static_cast<size_t>(kProcesses * kWritesPerProcess));
+    for (int p = 0; p < kProcesses; ++p) {
+        for (int i = 0; i < kWritesPerProcess; ++i) {
+            auto it = entries.find("p" + std::to_string(p) + "_" + std::to_string(i));
+            ASSERT_NE(it, entries.end());
+            EXPECT_EQ(it->second, ValueOf(i));
+        }
+    }
+}
+
+TEST_F(KRPreferencesLogTest, RefreshPicksUpAppendsAndRewritesFromAnotherWriter) {
+    PreferencesLog reader;
+    Entries reader_entries;
+    ASSERT_TRUE(reader.Open(path_, &reader_entries));
+
+    PreferencesLog writer;
+    Entries writer_entries;
+    ASSERT_TRUE(writer.Open(path_, &writer_entries));
+    ASSERT_TRUE(writer.Append("a", "1"));
+    EXPECT_TRUE(reader.Refresh(&reader_entries));
+    EXPECT_EQ(reader_entries, (Entries{{"a", "1"}}));
+    EXPECT_FALSE(reader.Refresh(&reader_entries));
+
+    // 写入方扩容后 reader 需要重新映射
+    std::string big(64 * 1024, 'x');
+    ASSERT_TRUE(writer.Append("big", big));
+    EXPECT_TRUE(reader.Refresh(&reader_entries));
+    EXPECT_EQ(reader_entries["big"], big);
+
+    writer_entries = {{"only", "this"}};
+    ASSERT_TRUE(writer.Rewrite(writer_entries));
+    EXPECT_TRUE(reader.Refresh(&reader_entries));
+    EXPECT_EQ(reader_entries, writer_entries);
+    ASSERT_TRUE(reader.Append("from", "reader"));
+    EXPECT_TRUE(writer.Refresh(&writer_entries));
+    EXPECT_EQ(writer_entries["from"], "reader");
+}
@@ -0,0 +1,211 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/expand/modules/preferences/KRPreferences.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "thirdparty/tinyXml/tinyxml2.h"
+
+using kuikly::util::DataPreferences;
+
+namespace {
+
+/**
+ * 改造前的 DataPreferences：内存 map + 每次 Flush 用 tinyxml2 重写整个 xml 文件
+ */
+class LegacyXmlPreferences {
+ public:
+    explicit LegacyXmlPreferences(const std::string &path) : path_(path) {
+        tinyxml2::XMLDocument doc;
+        if (doc.LoadFile(path.c_str()) != tinyxml2::XML_SUCCESS) {
+            return;
+        }
+        tinyxml2::XMLElement *root = doc.FirstChildElement("preferences");
+        for (auto element = root ? root->FirstChildElement("string") : nullptr; element;
+             element = element->NextSiblingElement("string")) {
+            const char *key = element->Attribute("key");
+            const char *value = element->GetText();
+            if (key && value) {
+                map_[key] = value;
+            }
+        }
+    }
+
+    void SetSync(const std::string &key, const std::string &value) {
+        map_[key] = value;
+    }
+
+    std::string GetSync(const std::string &key, const std::string &defaultValue) {
+        auto it = map_.find(key);
+        return it != map_.end() ? it->second : defaultValue;
+    }
+
+    void FlushSync() {
+        tinyxml2::XMLDocument doc;
+        doc.InsertFirstChild(doc.NewDeclaration());
+        tinyxml2::XMLElement *root = doc.NewElement("preferences");
+        root->SetAttribute("version", "1.0");
+        doc.InsertEndChild(root);
+        for (const auto &pair : map_) {
+            tinyxml2::XMLElement *element = doc.NewElement("string");
+            element->SetAttribute("key", pair.first.c_str());
+            element->SetText(pair.second.c_str());
+            root->InsertEndChild(element);
+        }
+        doc.SaveFile(path_.c_str());
+    }
+
+ private:
+    std::string path_;
+    std::unordered_map<std::string, std::string> map_;
+};
+
+class KRPreferencesTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        char dir[] = "/tmp/kr_prefs_XXXXXX";
+        ASSERT_NE(mkdtemp(dir), nullptr);
+        dir_ = dir;
+    }
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove_all(dir_, ec);
+    }
+
+    std::string dir_;
+};
+
+using KRPreferencesBenchmark = KRPreferencesTest;
+
+std::string KeyOf(int i) {
+    return "key_" + std::to_string(i);
+}
+
+std::string ValueOf(int i) {
+    return "value_" + std::to_string(i) + std::string(48, 'v');
+}
+
+}  // namespace
+
+TEST_F(KRPreferencesTest, MigratesLegacyXmlOnce) {
+    {
+        LegacyXmlPreferences legacy(dir_ + "/prefs");
+        legacy.SetSync("name", "kuikly");
+        legacy.SetSync("escaped", "<a & \"b\">");
+        legacy.FlushSync();
+    }
+    {
+        auto prefs = std::make_shared<DataPreferences>(dir_, "prefs");
+        ASSERT_TRUE(prefs->IsOpen());
+        EXPECT_EQ(prefs->GetSync("name", ""), "kuikly");
+        EXPECT_EQ(prefs->GetSync("escaped", ""), "<a & \"b\">");
+        EXPECT_TRUE(prefs->SetSync("name", "render"));
+    }
+    EXPECT_FALSE(std::filesystem::exists(dir_ + "/prefs"));
+    EXPECT_TRUE(std::filesystem::exists(dir_ + "/prefs.kv"));
+
+    auto reopened = std::make_shared<DataPreferences>(dir_, "prefs");
+    EXPECT_EQ(reopened->GetSync("name", ""), "render");
+    EXPECT_EQ(reopened->GetSync("escaped", ""), "<a & \"b\">");
+    EXPECT_EQ(reopened->GetSync("missing", "default"), "default");
+}
+
+TEST_F(KRPreferencesTest, WritesSurviveWithoutFlush) {
+    {
+        auto prefs = std::make_shared<DataPreferences>(dir_, "prefs");
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_TRUE(prefs->SetSync(KeyOf(i % 10), ValueOf(i)));
+        }
+        prefs->Flush();
+    }
+    auto reopened = std::make_shared<DataPreferences>(dir_, "prefs");
+    for (int i = 90; i < 100; ++i) {
+        EXPECT_EQ(reopened->GetSync(KeyOf(i % 10), ""), ValueOf(i));
+    }
+}
+
+TEST_F(KRPreferencesBenchmark, VersusLegacyXml) {
+    constexpr int kKeys = 1000;
+    constexpr int kPuts = 2000;
+    using Clock = std::chrono::steady_clock;
+    auto usSince = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    };
+
+    // 已有 kKeys 条数据的文件
+    LegacyXmlPreferences legacy(dir_ + "/legacy");
+    auto prefs = std::make_shared<DataPreferences>(dir_, "prefs");
+    for (int i = 0; i < kKeys; ++i) {
+        legacy.SetSync(KeyOf(i), ValueOf(i));
+        prefs->SetSync(KeyOf(i), ValueOf(i));
+    }
+    legacy.FlushSync();
+    prefs->FlushSync();
+
+    // 打开：xml 解析 vs 日志回放
+    auto start = Clock::now();
+    LegacyXmlPreferences legacyLoaded(dir_ + "/legacy");
+    double legacyOpenUs = usSince(start);
+    prefs.reset();
+    start = Clock::now();
+    prefs = std::make_shared<DataPreferences>(dir_, "prefs");
+    double openUs = usSince(start);
+    ASSERT_EQ(prefs->GetSync(KeyOf(kKeys - 1), ""), ValueOf(kKeys - 1));
+
+    // 进程崩溃不丢数据的写入：旧实现需 SetSync + 重写整个 xml，新实现 SetSync 追加到 mmap 日志即可
+    start = Clock::now();
+    for (int i = 0; i < kPuts / 10; ++i) {
+        legacy.SetSync(KeyOf(i % kKeys), ValueOf(i + 1));
+        legacy.FlushSync();
+    }
+    double legacyPutUs = usSince(start) / (kPuts / 10);
+    start = Clock::now();
+    for (int i = 0; i < kPuts; ++i) {
+        prefs->SetSync(KeyOf(i % kKeys), ValueOf(i + 1));
+    }
+    double putUs = usSince(start) / kPuts;
+
+    start = Clock::now();
+    size_t hits = 0;
+    for (int i = 0; i < kPuts; ++i) {
+        hits += !legacy.GetSync(KeyOf(i % kKeys), "").empty();
+    }
+    double legacyGetUs = usSince(start) / kPuts;
+    start = Clock::now();
+    for (int i = 0; i < kPuts; ++i) {
+        hits += !prefs->GetSync(KeyOf(i % kKeys), "").empty();
+    }
+    double getUs = usSince(start) / kPuts;
+    EXPECT_EQ(hits, 2u * kPuts);
+
+    // 落盘：旧实现重写 xml（不 fsync），新实现按需压缩后 fdatasync
+    start = Clock::now();
+    legacy.FlushSync();
+    double legacyFlushUs = usSince(start);
+    start = Clock::now();
+    prefs->FlushSync();
+    double flushUs = usSince(start);
+
+    printf("preferences %d keys (log vs legacy xml): open %.0f vs %.0f us, durable put %.2f vs %.1f us, "
+           "get %.2f vs %.2f us, flush %.0f vs %.0f us\n",
+           kKeys, openUs, legacyOpenUs, putUs, legacyPutUs, getUs, legacyGetUs, flushUs, legacyFlushUs);
+}
@@ -0,0 +1,235 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/KRDecodePipeline.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct StubImage {
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+using StubPipeline = KRDecodePipeline<StubImage>;
+using StubImagePtr = std::shared_ptr<StubImage>;
+
+/**
+ * 桩解码器与手动派发：解码任务留在队列中，由测试调用 RunPending 执行，结果确定
+ */
+class KRDecodePipelineTest : public testing::Test {
+ protected:
+    void SetUp() override {
+        pipeline = std::make_shared<StubPipeline>(
+            [this](const StubPipeline::Request &request, const KRCancelToken &) -> StubImagePtr {
+                decode_count++;
+                if (request.src == "bad") {
+                    return nullptr;
+                }
+                return std::make_shared<StubImage>(StubImage{request.width, request.height});
+            },
+            [](const StubImage &image) { return static_cast<size_t>(image.width) * image.height * 4; }, 1 << 20,
+            [this](KRTask task, const KRCancelToken &token) { pending.emplace_back(std::move(task), token); });
+        callback = [this](const StubImagePtr &image) {
+            callback_count++;
+            last_image = image;
+        };
+    }
+
+    void RunPending() {
+        auto tasks = std::move(pending);
+        pending.clear();
+        for (auto &entry : tasks) {
+            if (!entry.second.IsCancelled()) {
+                entry.first();
+            }
+        }
+    }
+
+    static StubPipeline::Request MakeRequest(const std::string &src, uint32_t width = 0, uint32_t height = 0) {
+        StubPipeline::Request request;
+        request.src = src;
+        request.width = width;
+        request.height = height;
+        return request;
+    }
+
+    std::shared_ptr<StubPipeline> pipeline;
+    std::vector<std::pair<KRTask, KRCancelToken>> pending;
+    StubPipeline::Callback callback;
+    int decode_count = 0;
+    int callback_count = 0;
+    StubImagePtr last_image;
+};
+
+}  // namespace
+
+TEST_F(KRDecodePipelineTest, MergesRequestsWithQuantizedSize) {
+    auto first = pipeline->Load(MakeRequest("a", 100, 50), callback);
+    auto second = pipeline->Load(MakeRequest("a", 120, 60), callback);
+    EXPECT_NE(first, 0u);
+    EXPECT_NE(second, 0u);
+    ASSERT_EQ(pending.size(), 1u);
+
+    RunPending();
+    EXPECT_EQ(decode_count, 1);
+    EXPECT_EQ(callback_count, 2);
+    ASSERT_NE(last_image, nullptr);
+    EXPECT_EQ(last_image->width, 128u);
+    EXPECT_EQ(last_image->height, 64u);
+    EXPECT_EQ(pipeline->GetStats().dedup_count, 1u);
+}
+
+TEST_F(KRDecodePipelineTest, CacheHitCallsBackSynchronously) {
+    pipeline->Load(MakeRequest("a", 128, 64), callback);
+    RunPending();
+    callback_count = 0;
+
+    EXPECT_EQ(pipeline->Load(MakeRequest("a", 128, 64), callback), 0u);
+    EXPECT_EQ(callback_count, 1);
+    EXPECT_TRUE(pending.empty());
+    EXPECT_NE(pipeline->GetCached(MakeRequest("a", 100, 60)), nullptr);
+}
+
+TEST_F(KRDecodePipelineTest, CancelOneWaiterKeepsDecode) {
+    auto first = pipeline->Load(MakeRequest("b", 10, 10), callback);
+    pipeline->Load(MakeRequest("b", 10, 10), callback);
+    EXPECT_TRUE(pipeline->Cancel(first));
+    EXPECT_FALSE(pipeline->Cancel(first));
+    RunPending();
+    EXPECT_EQ(decode_count, 1);
+    EXPECT_EQ(callback_count, 1);
+}
+
+TEST_F(KRDecodePipelineTest, CancelAllWaitersDropsDecode) {
+    auto id = pipeline->Load(MakeRequest("c", 10, 10), callback);
+    EXPECT_TRUE(pipeline->Cancel(id));
+    RunPending();
+    EXPECT_EQ(decode_count, 0);
+    EXPECT_EQ(callback_count, 0);
+    EXPECT_EQ(pipeline->GetStats().cancel_count, 1u);
+}
+
+TEST_F(KRDecodePipelineTest, StaleDecodeDoesNotAnswerNewRequest) {
+    auto id = pipeline->Load(MakeRequest("d", 10, 10), callback);
+    auto stale = std::move(pending);
+    pending.clear();
+    pipeline->Cancel(id);
+    pipeline->Load(MakeRequest("d", 10, 10), callback);
+    // 已取消的旧解码即使执行完，也不会回调新请求
+    for (auto &entry : stale) {
+        entry.first();
+    }
+    EXPECT_EQ(callback_count, 0);
+    RunPending();
+    EXPECT_EQ(callback_count, 1);
+    EXPECT_EQ(pipeline->GetStats().in_flight_count, 0u);
+}
+
+TEST_F(KRDecodePipelineTest, FailureIsNotCached) {
+    pipeline->Load(MakeRequest("bad"), callback);
+    RunPending();
+    EXPECT_EQ(callback_count, 1);
+    EXPECT_EQ(last_image, nullptr);
+
+    pipeline->Load(MakeRequest("bad"), callback);
+    EXPECT_EQ(pending.size(), 1u);
+    RunPending();
+    EXPECT_EQ(decode_count, 2);
+    EXPECT_EQ(pipeline->GetStats().failure_count, 2u);
+}
+
+TEST_F(KRDecodePipelineTest, TrimAndClearCache) {
+    // 每张 32x32 的开销为 4096
+    for (int i = 0; i < 4; ++i) {
+        pipeline->Load(MakeRequest("img" + std::to_string(i), 32, 32), callback);
+    }
+    RunPending();
+    EXPECT_EQ(pipeline->GetStats().cache.count, 4u);
+
+    pipeline->TrimCache(4096 * 2);
+    EXPECT_EQ(pipeline->GetStats().cache.count, 2u);
+    EXPECT_NE(pipeline->GetCached(MakeRequest("img3", 32, 32)), nullptr);
+    EXPECT_EQ(pipeline->GetCached(MakeRequest("img0", 32, 32)), nullptr);
+
+    pipeline->TrimCache(0);
+    EXPECT_EQ(pipeline->GetStats().cache.count, 2u);
+    pipeline->ClearCache();
+    EXPECT_EQ(pipeline->GetStats().cache.count, 0u);
+}
+
+// 首帧耗时：64 个 view 共 16 张不同的图，每次解码耗时 2ms；对比在调用线程逐个同步解码与经由管线并发、去重解码
+TEST(KRDecodePipelineBenchmark, TimeToFirstPixel) {
+    constexpr int kViewCount = 64;
+    constexpr int kSourceCount = 16;
+    auto slow_decode = [](const StubPipeline::Request &request, const KRCancelToken &) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return std::make_shared<StubImage>(StubImage{request.width, request.height});
+    };
+    using Clock = std::chrono::steady_clock;
+    auto elapsed_ms = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+
+    double sync_total = 0;
+    auto start = Clock::now();
+    for (int i = 0; i < kViewCount; ++i) {
+        StubPipeline::Request request;
+        request.src = "src" + std::to_string(i % kSourceCount);
+        slow_decode(request, KRCancelToken());
+        sync_total += elapsed_ms(start);
+    }
+
+    auto pipeline = std::make_shared<StubPipeline>(slow_decode, [](const StubImage &) { return size_t(1); }, 1 << 20);
+    std::mutex mutex;
+    std::condition_variable cond;
+    int done = 0;
+    double pipeline_total = 0;
+    start = Clock::now();
+    for (int i = 0; i < kViewCount; ++i) {
+        StubPipeline::Request request;
+        request.src = "src" + std::to_string(i % kSourceCount);
+        request.width = 64;
+        request.height = 64;
+        pipeline->Load(request, [&](const StubImagePtr &) {
+            std::lock_guard<std::mutex> lock(mutex);
+            pipeline_total += elapsed_ms(start);
+            if (++done == kViewCount) {
+                cond.notify_all();
+            }
+        });
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&] { return done == kViewCount; });
+    }
+
+    auto stats = pipeline->GetStats();
+    EXPECT_EQ(stats.decode_count + stats.dedup_count + stats.cache.hit_count, static_cast<uint64_t>(kViewCount));
+    EXPECT_LE(stats.decode_count, static_cast<uint64_t>(kViewCount));
+    printf("time to first pixel: sync %.2f ms, pipeline %.2f ms (%llu decodes, %zu workers)\n",
+           sync_total / kViewCount, pipeline_total / kViewCount, static_cast<unsigned long long>(stats.decode_count),
+           KRGCDQueue::GetInstance().GetWorkerCount());
+}
@@ -0,0 +1,191 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/KRPropKeys.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// 改造前 KRBasePropsHandler::SetPropWithoutAnimation 与事件处理器的 strcmp 顺序
+const char *const kLegacyBaseKeys[] = {"backgroundColor", "borderRadius", "border",      "frame",
+                                       "backgroundImage", "transform",    "opacity",     "visibility",
+                                       "overflow",        "zIndex",       "touchEnable", "accessibility",
+                                       "boxShadow",       "animation",    "animationCompletion", "clipPath"};
+const char *const kLegacyEventKeys[] = {"click", "doubleClick", "longPress", "pan", "pinch", "capture"};
+
+/**
+ * 返回命中的分支序号，未命中（交给具体 View 处理）返回 -1
+ */
+int LegacyDispatch(const std::string &key) {
+    int branch = 0;
+    for (const char *candidate : kLegacyBaseKeys) {
+        if (strcmp(key.c_str(), candidate) == 0) {
+            return branch;
+        }
+        branch++;
+    }
+    for (const char *candidate : kLegacyEventKeys) {
+        if (strcmp(key.c_str(), candidate) == 0) {
+            return branch;
+        }
+        branch++;
+    }
+    return -1;
+}
+
+int IdDispatch(int32_t id) {
+    switch (id) {
+        case kPropKeyUnknown:
+            return -1;
+        case kPropKeyBackgroundColor:
+        case kPropKeyFrame:
+        case kPropKeyBorderRadius:
+        case kPropKeyBorder:
+        case kPropKeyBackgroundImage:
+        case kPropKeyTransform:
+        case kPropKeyOpacity:
+        case kPropKeyVisibility:
+        case kPropKeyOverflow:
+        case kPropKeyZIndex:
+        case kPropKeyTouchEnable:
+        case kPropKeyAccessibility:
+        case kPropKeyBoxShadow:
+        case kPropKeyAnimation:
+        case kPropKeyAnimationCompletion:
+        case kPropKeyClipPath:
+        case kPropKeyClick:
+        case kPropKeyDoubleClick:
+        case kPropKeyLongPress:
+        case kPropKeyPan:
+        case kPropKeyPinch:
+        case kPropKeyCapture:
+            return id;
+        default:
+            return -1;
+    }
+}
+
+}  // namespace
+
+TEST(KRPropKeysTest, BuiltinKeysMapToTheirIds) {
+    for (int32_t id = 1; id < kPropKeyBuiltinCount; ++id) {
+        std::string key(kr_prop_keys_detail::kBuiltinKeys[id]);
+        EXPECT_EQ(KRPropKeys::IdOf(key), id) << key;
+        EXPECT_EQ(KRPropKeys::Register(key), id) << key;
+    }
+    static_assert(KRPropKeys::BuiltinIdOf("frame", 5) == kPropKeyFrame, "builtin lookup is constexpr");
+}
+
+TEST(KRPropKeysTest, NearMissesAreUnknown) {
+    // 长度及首、中、尾字符与内置 key 相同，哈希槽相同但比较失败
+    EXPECT_EQ(KRPropKeys::IdOf("fxaxe"), kPropKeyUnknown);
+    EXPECT_EQ(KRPropKeys::IdOf("opaciXy"), kPropKeyUnknown);
+    EXPECT_EQ(KRPropKeys::IdOf(""), kPropKeyUnknown);
+    EXPECT_EQ(KRPropKeys::IdOf("Frame"), kPropKeyUnknown);
+    EXPECT_EQ(KRPropKeys::IdOf("frame "), kPropKeyUnknown);
+}
+
+TEST(KRPropKeysTest, CustomKeysGetStableIdsAfterBuiltins) {
+    // 注册表是进程级的，每次运行使用新的键名，保证乱序与重复执行时结果一致
+    static int run = 0;
+    const std::string suffix = std::to_string(run++);
+    const std::string text_key = "propKeysTestText" + suffix;
+    const std::string color_key = "propKeysTestColor" + suffix;
+    EXPECT_EQ(KRPropKeys::IdOf(text_key), kPropKeyUnknown);
+    int32_t text = KRPropKeys::Register(text_key);
+    int32_t color = KRPropKeys::Register(color_key);
+    EXPECT_GE(text, kPropKeyBuiltinCount);
+    EXPECT_GE(color, kPropKeyBuiltinCount);
+    EXPECT_NE(text, color);
+    EXPECT_EQ(KRPropKeys::Register(text_key), text);
+    EXPECT_EQ(KRPropKeys::IdOf(text_key), text);
+    EXPECT_EQ(KRPropKeys::IdOf(color_key), color);
+}
+
+TEST(KRPropKeysTest, ConcurrentRegisterAgreesOnId) {
+    constexpr int kThreads = 4;
+    std::vector<int32_t> ids(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&ids, t] {
+            for (int i = 0; i < 100; ++i) {
+                int32_t id = KRPropKeys::Register("propKeysTestConcurrent" + std::to_string(i));
+                if (i == 99) {
+                    ids[t] = id;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int t = 1; t < kThreads; ++t) {
+        EXPECT_EQ(ids[t], ids[0]);
+    }
+    EXPECT_EQ(KRPropKeys::IdOf("propKeysTestConcurrent99"), ids[0]);
+}
+
+TEST(KRPropKeysBenchmark, RecordedPropStream) {
+    // 一屏列表的属性流：每个 cell 的基础属性、事件以及文本 View 自己的属性
+    const std::vector<std::string> cellProps = {"frame", "backgroundColor", "borderRadius", "opacity", "click",
+                                                "text",  "color",           "fontSize",     "transform", "zIndex"};
+    std::vector<std::string> stream;
+    for (int cell = 0; cell < 500; ++cell) {
+        stream.insert(stream.end(), cellProps.begin(), cellProps.end());
+    }
+    for (auto &key : {"text", "color", "fontSize"}) {
+        KRPropKeys::Register(key);
+    }
+    constexpr int kRounds = 20;
+    using Clock = std::chrono::steady_clock;
+    auto nsPerProp = [&](Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (stream.size() * kRounds);
+    };
+
+    long legacySum = 0;
+    auto start = Clock::now();
+    for (int round = 0; round < kRounds; ++round) {
+        for (const auto &key : stream) {
+            legacySum += LegacyDispatch(key);
+        }
+    }
+    double legacyNs = nsPerProp(start);
+
+    // 桥接处每个属性 IdOf 一次，之后按 ID 分发
+    long idSum = 0;
+    start = Clock::now();
+    for (int round = 0; round < kRounds; ++round) {
+        for (const auto &key : stream) {
+            idSum += IdDispatch(KRPropKeys::IdOf(key)) >= 0 ? 1 : 0;
+        }
+    }
+    double idNs = nsPerProp(start);
+
+    long legacyHits = 0;
+    for (const auto &key : stream) {
+        legacyHits += LegacyDispatch(key) >= 0 ? 1 : 0;
+    }
+    EXPECT_EQ(idSum, legacyHits * kRounds);
+    EXPECT_NE(legacySum, 0);
+    printf("prop dispatch over %zu recorded props: strcmp chain %.1f ns, interned id %.1f ns per prop\n",
+           stream.size(), legacyNs, idNs);
+}
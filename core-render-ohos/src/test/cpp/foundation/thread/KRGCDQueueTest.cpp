@@ -0,0 +1,217 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRGCDQueue.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace {
+
+/**
+ * 占满线程池的所有工作线程，直到 Release，用于让后续任务停留在队列中
+ */
+class WorkerBlocker {
+ public:
+    void BlockAll() {
+        size_t count = KRGCDQueue::GetInstance().GetWorkerCount();
+        for (size_t i = 0; i < count; ++i) {
+            // 任务持有共享状态，阻塞任务可能在 Release 返回后才真正退出
+            KRGCDQueue::GetInstance().DispatchAsync([state = state_] {
+                std::unique_lock<std::mutex> lock(state->mutex);
+                state->started++;
+                state->cond.notify_all();
+                state->cond.wait(lock, [&state] { return state->released; });
+            });
+        }
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->cond.wait(lock, [this, count] { return state_->started == count; });
+    }
+
+    void Release() {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->released = true;
+        state_->cond.notify_all();
+    }
+
+ private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable cond;
+        size_t started = 0;
+        bool released = false;
+    };
+    std::shared_ptr<State> state_ = std::make_shared<State>();
+};
+
+void WaitUntil(const std::function<bool()> &predicate) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+}  // namespace
+
+TEST(KRGCDQueueTest, RunsEveryDispatchedTask) {
+    constexpr int kCount = 10000;
+    std::atomic<int> done{0};
+    for (int i = 0; i < kCount; ++i) {
+        KRGCDQueue::GetInstance().DispatchAsync([&done] { done.fetch_add(1); });
+    }
+    WaitUntil([&] { return done.load() == kCount; });
+    EXPECT_EQ(done.load(), kCount);
+}
+
+TEST(KRGCDQueueTest, SpreadsWorkAcrossWorkers) {
+    auto &queue = KRGCDQueue::GetInstance();
+    ASSERT_GE(queue.GetWorkerCount(), 2u);
+    // 所有工作线程同时阻塞说明任务确实分发到了不同线程
+    WorkerBlocker blocker;
+    blocker.BlockAll();
+    blocker.Release();
+}
+
+TEST(KRGCDQueueTest, NestedDispatchFromWorkerRuns) {
+    std::atomic<int> done{0};
+    for (int i = 0; i < 64; ++i) {
+        KRGCDQueue::GetInstance().DispatchAsync([&done] {
+            KRGCDQueue::GetInstance().DispatchAsync([&done] { done.fetch_add(1); });
+        });
+    }
+    WaitUntil([&] { return done.load() == 64; });
+    EXPECT_EQ(done.load(), 64);
+}
+
+TEST(KRGCDQueueTest, DefaultTokenIsNotCancellable) {
+    KRCancelToken token;
+    token.Cancel();
+    EXPECT_FALSE(token.IsCancelled());
+}
+
+TEST(KRGCDQueueTest, CancelledTaskIsDroppedAndReleased) {
+    WorkerBlocker blocker;
+    blocker.BlockAll();
+
+    auto token = KRCancelToken::Create();
+    auto captured = std::make_shared<int>(0);
+    std::weak_ptr<int> weak = captured;
+    std::atomic<bool> ran{false};
+    KRGCDQueue::GetInstance().DispatchAsync([&ran, captured] { ran = true; }, KRTaskPriority::kUserVisible, token);
+    captured.reset();
+    token.Cancel();
+    EXPECT_TRUE(token.IsCancelled());
+
+    std::atomic<bool> after{false};
+    KRGCDQueue::GetInstance().DispatchAsync([&after] { after = true; });
+    blocker.Release();
+    WaitUntil([&] { return after.load() && weak.expired(); });
+
+    EXPECT_FALSE(ran.load());
+    // 被丢弃的任务同样要释放捕获的对象
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST(KRGCDQueueTest, UserVisibleRunsBeforePrefetch) {
+    WorkerBlocker blocker;
+    blocker.BlockAll();
+
+    std::mutex mutex;
+    int visible_left = 32;
+    bool prefetch_before_visible = false;
+    std::atomic<int> done{0};
+    for (int i = 0; i < 32; ++i) {
+        KRGCDQueue::GetInstance().DispatchAsync(
+            [&] {
+                std::lock_guard<std::mutex> lock(mutex);
+                // 取出 kPrefetch 任务时所有 kUserVisible 任务都应已被取走，但可能尚未执行到这里
+                prefetch_before_visible |= visible_left == 32;
+                done++;
+            },
+            KRTaskPriority::kPrefetch);
+    }
+    for (int i = 0; i < 32; ++i) {
+        KRGCDQueue::GetInstance().DispatchAsync([&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            visible_left--;
+            done++;
+        });
+    }
+    blocker.Release();
+    WaitUntil([&] { return done.load() == 64; });
+    EXPECT_EQ(done.load(), 64);
+    EXPECT_FALSE(prefetch_before_visible);
+}
+
+TEST(KRTaskGroupTest, WaitReturnsAfterAllTasks) {
+    KRTaskGroup group;
+    std::atomic<int> done{0};
+    for (int i = 0; i < 1000; ++i) {
+        group.DispatchAsync([&done] {
+            std::this_thread::yield();
+            done.fetch_add(1);
+        });
+    }
+    group.Wait();
+    EXPECT_EQ(done.load(), 1000);
+}
+
+TEST(KRTaskGroupTest, WaitOnEmptyGroupReturns) {
+    KRTaskGroup group;
+    group.Wait();
+    group.DispatchAsync(nullptr);
+    group.Wait();
+}
+
+TEST(KRTaskGroupTest, CancelDropsTasksNotYetStarted) {
+    WorkerBlocker blocker;
+    blocker.BlockAll();
+
+    KRTaskGroup group;
+    std::atomic<int> ran{0};
+    for (int i = 0; i < 100; ++i) {
+        group.DispatchAsync([&ran] { ran.fetch_add(1); });
+    }
+    group.Cancel();
+    EXPECT_TRUE(group.IsCancelled());
+    blocker.Release();
+    // 取消的任务也要计入完成，否则 Wait 永远不返回
+    group.Wait();
+    EXPECT_EQ(ran.load(), 0);
+}
+
+TEST(KRTaskGroupTest, WaitInsideWorkerDoesNotDeadlock) {
+    // 外层任务数多于工作线程数，每个外层任务都在工作线程里等待内层任务组
+    size_t outer_count = KRGCDQueue::GetInstance().GetWorkerCount() * 4;
+    KRTaskGroup outer;
+    std::atomic<int> inner_done{0};
+    for (size_t i = 0; i < outer_count; ++i) {
+        outer.DispatchAsync([&inner_done] {
+            KRTaskGroup inner;
+            for (int j = 0; j < 8; ++j) {
+                inner.DispatchAsync([&inner_done] { inner_done.fetch_add(1); });
+            }
+            inner.Wait();
+        });
+    }
+    outer.Wait();
+    EXPECT_EQ(inner_done.load(), static_cast<int>(outer_count * 8));
+}
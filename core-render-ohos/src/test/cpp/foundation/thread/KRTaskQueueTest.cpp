@@ -0,0 +1,267 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRTaskQueue.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * 改造前 KRThread 的任务队列：std::queue<std::function> + 互斥锁，消费者整批换出后执行
+ */
+class MutexFunctionQueue {
+ public:
+    void Push(const std::function<void()> &task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.emplace(task);
+        }
+        cond_.notify_one();
+    }
+
+    bool WaitPopAll(std::queue<std::function<void()>> &tasks) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return closed_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+            return false;
+        }
+        std::swap(tasks, tasks_);
+        return true;
+    }
+
+    void Close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        cond_.notify_all();
+    }
+
+ private:
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool closed_ = false;
+};
+
+/**
+ * 多个生产者并发入队，消费者记录执行顺序；返回每个生产者按执行顺序排列的序号
+ */
+std::vector<std::vector<int>> RunProducers(KRTaskQueue &queue, int producers, int tasksPerProducer) {
+    std::vector<std::vector<int>> executed(producers);
+    std::thread consumer([&] {
+        KRTask task;
+        while (queue.WaitPop(task)) {
+            task();
+            task.Reset();
+        }
+    });
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, &executed, p, tasksPerProducer] {
+            for (int i = 0; i < tasksPerProducer; ++i) {
+                // executed 只在消费者线程中写入
+                queue.Push([&executed, p, i] { executed[p].push_back(i); });
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    queue.Close();
+    consumer.join();
+    return executed;
+}
+
+}  // namespace
+
+TEST(KRTaskTest, SmallClosuresAreStoredInline) {
+    auto counter = std::make_shared<int>(0);
+    KRTask task([counter] { (*counter)++; });
+    EXPECT_EQ(counter.use_count(), 2);
+    KRTask moved = std::move(task);
+    EXPECT_FALSE(task);
+    EXPECT_EQ(counter.use_count(), 2);
+    moved();
+    EXPECT_EQ(*counter, 1);
+    moved.Reset();
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(KRTaskTest, LargeClosuresMoveToHeapAndReleaseOnDestroy) {
+    auto counter = std::make_shared<int>(0);
+    char padding[KRTask::kInlineSize] = {1};
+    {
+        KRTask task([counter, padding] { (*counter) += padding[0]; });
+        KRTask moved;
+        moved = std::move(task);
+        moved();
+        EXPECT_EQ(counter.use_count(), 2);
+    }
+    EXPECT_EQ(*counter, 1);
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(KRTaskTest, EmptyCallablesProduceEmptyTask) {
+    std::function<void()> empty;
+    void (*nullFunc)() = nullptr;
+    EXPECT_FALSE(KRTask(empty));
+    EXPECT_FALSE(KRTask(nullFunc));
+    EXPECT_FALSE(KRTask(nullptr));
+    EXPECT_TRUE(KRTask(std::function<void()>([] {})));
+}
+
+TEST(KRTaskQueueTest, KeepsOrderThroughOverflow) {
+    KRTaskQueue queue(2);
+    std::vector<int> executed;
+    for (int i = 0; i < 10; ++i) {
+        queue.Push([&executed, i] { executed.push_back(i); });
+    }
+    queue.Push(KRTask());  // 空任务被忽略
+    KRTask task;
+    while (queue.TryPop(task)) {
+        task();
+    }
+    EXPECT_EQ(executed, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_FALSE(queue.TryPop(task));
+}
+
+TEST(KRTaskQueueTest, CloseDrainsQueuedTasksThenStops) {
+    KRTaskQueue queue(4);
+    int executed = 0;
+    for (int i = 0; i < 6; ++i) {
+        queue.Push([&executed] { executed++; });
+    }
+    queue.Close();
+    KRTask task;
+    while (queue.WaitPop(task)) {
+        task();
+    }
+    EXPECT_EQ(executed, 6);
+}
+
+TEST(KRTaskQueueTest, ParkedConsumerWakesOnPush) {
+    KRTaskQueue queue;
+    std::atomic<bool> ran{false};
+    std::thread consumer([&] {
+        KRTask task;
+        while (queue.WaitPop(task)) {
+            task();
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.Push([&ran] { ran = true; });
+    queue.Close();
+    consumer.join();
+    EXPECT_TRUE(ran.load());
+}
+
+// 在 TSan 构建下运行可检查环形缓冲区与溢出链表的同步
+TEST(KRTaskQueueTest, MultiProducerStressKeepsPerProducerOrder) {
+    constexpr int kProducers = 4;
+    constexpr int kTasksPerProducer = 20000;
+    for (size_t capacity : {2, 8, 1024}) {
+        KRTaskQueue queue(capacity);
+        auto executed = RunProducers(queue, kProducers, kTasksPerProducer);
+        for (int p = 0; p < kProducers; ++p) {
+            ASSERT_EQ(executed[p].size(), static_cast<size_t>(kTasksPerProducer))
+                << "capacity " << capacity << " producer " << p;
+            for (int i = 0; i < kTasksPerProducer; ++i) {
+                ASSERT_EQ(executed[p][i], i) << "capacity " << capacity << " producer " << p;
+            }
+        }
+    }
+}
+
+TEST(KRTaskQueueBenchmark, ThroughputVersusMutexFunctionQueue) {
+    constexpr int kProducers = 4;
+    constexpr int kTasksPerProducer = 100000;
+    constexpr int kTotal = kProducers * kTasksPerProducer;
+    using Clock = std::chrono::steady_clock;
+    auto nsPerTask = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kTotal;
+    };
+
+    // 闭包捕获一个指针与一个 shared_ptr，与 KRThread 上的典型任务相当
+    auto sink = std::make_shared<long>(0);
+
+    KRTaskQueue taskQueue;
+    auto start = Clock::now();
+    {
+        std::thread consumer([&] {
+            KRTask task;
+            while (taskQueue.WaitPop(task)) {
+                task();
+                task.Reset();
+            }
+        });
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&taskQueue, sink] {
+                for (int i = 0; i < kTasksPerProducer; ++i) {
+                    taskQueue.Push([sink, i] { *sink += i; });
+                }
+            });
+        }
+        for (auto &producer : producers) {
+            producer.join();
+        }
+        taskQueue.Close();
+        consumer.join();
+    }
+    double taskQueueNs = nsPerTask(start);
+
+    MutexFunctionQueue functionQueue;
+    start = Clock::now();
+    {
+        std::thread consumer([&] {
+            std::queue<std::function<void()>> tasks;
+            while (functionQueue.WaitPopAll(tasks)) {
+                while (!tasks.empty()) {
+                    tasks.front()();
+                    tasks.pop();
+                }
+            }
+        });
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&functionQueue, sink] {
+                for (int i = 0; i < kTasksPerProducer; ++i) {
+                    functionQueue.Push([sink, i] { *sink += i; });
+                }
+            });
+        }
+        for (auto &producer : producers) {
+            producer.join();
+        }
+        functionQueue.Close();
+        consumer.join();
+    }
+    double functionQueueNs = nsPerTask(start);
+
+    EXPECT_EQ(*sink, 2L * kProducers * (static_cast<long>(kTasksPerProducer) * (kTasksPerProducer - 1) / 2));
+    printf("task queue %d producers x %d: KRTaskQueue %.1f ns, mutex std::function queue %.1f ns per task (%u cores)\n",
+           kProducers, kTasksPerProducer, taskQueueNs, functionQueueNs, std::thread::hardware_concurrency());
+}
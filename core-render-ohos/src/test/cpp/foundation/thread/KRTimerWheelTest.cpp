@@ -0,0 +1,336 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/thread/KRTimerWheel.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace {
+
+/**
+ * 用假时钟驱动时间轮，按 NextWakeup 逐次推进，与 KRDelayThread 的调度循环一致：
+ * Advance 取出到期任务后再执行，任务中可以再次 Schedule/Cancel
+ */
+class FakeClockDriver {
+ public:
+    explicit FakeClockDriver(int64_t now_ms = 0) : wheel_(now_ms) {}
+
+    KRTimerId After(int64_t delay_ms, int tag) {
+        return At(wheel_.Now() + delay_ms, tag);
+    }
+
+    KRTimerId At(int64_t expire_ms, int tag) {
+        return wheel_.Schedule(expire_ms, [this, tag] { fired_.push_back({tag, wheel_.Now()}); });
+    }
+
+    void RunUntil(int64_t now_ms) {
+        std::vector<KRTask> batch;
+        int64_t wakeup;
+        while ((wakeup = wheel_.NextWakeup()) >= 0 && wakeup <= now_ms) {
+            wheel_.Advance(wakeup, batch);
+            wakeups_++;
+            for (auto &task : batch) {
+                task();
+            }
+            batch.clear();
+        }
+        wheel_.Advance(now_ms, batch);
+        EXPECT_TRUE(batch.empty());
+    }
+
+    struct Fired {
+        int tag;
+        int64_t at;
+    };
+
+    KRTimerWheel wheel_;
+    std::vector<Fired> fired_;
+    int wakeups_ = 0;
+};
+
+// 各层的跨度：第 0 层 2^8，之后每层放大 2^6，最高层之上为 2^32
+const int64_t kLevelSpans[] = {int64_t(1) << 8, int64_t(1) << 14, int64_t(1) << 20, int64_t(1) << 26,
+                               int64_t(1) << 32};
+
+}  // namespace
+
+TEST(KRTimerWheelTest, EmptyWheelHasNoWakeup) {
+    KRTimerWheel wheel(100);
+    EXPECT_EQ(wheel.NextWakeup(), -1);
+    EXPECT_EQ(wheel.Size(), 0u);
+    std::vector<KRTask> expired;
+    wheel.Advance(1000, expired);
+    EXPECT_TRUE(expired.empty());
+    EXPECT_EQ(wheel.Now(), 1000);
+}
+
+TEST(KRTimerWheelTest, FiresExactlyAtCascadeBoundaries) {
+    // 起点覆盖槽位对齐与不对齐的情况
+    for (int64_t start : {int64_t(0), int64_t(1), int64_t(255), int64_t(256), int64_t(12345), int64_t(1) << 26}) {
+        FakeClockDriver driver(start);
+        std::vector<int64_t> expires;
+        for (int64_t span : kLevelSpans) {
+            for (int64_t delay : {span - 1, span, span + 1}) {
+                expires.push_back(start + delay);
+            }
+            // 绝对时间落在槽边界上
+            int64_t aligned = (start / span + 1) * span;
+            expires.push_back(aligned);
+            if (aligned - 1 > start) {
+                expires.push_back(aligned - 1);
+            }
+        }
+        expires.push_back(start + 1);
+        expires.push_back(start + (int64_t(1) << 33) + 7);  // 超出覆盖范围
+        for (size_t i = 0; i < expires.size(); i++) {
+            driver.At(expires[i], static_cast<int>(i));
+        }
+        EXPECT_EQ(driver.wheel_.Size(), expires.size());
+
+        driver.RunUntil(start + (int64_t(1) << 34));
+        ASSERT_EQ(driver.fired_.size(), expires.size()) << start;
+        for (auto &fired : driver.fired_) {
+            EXPECT_EQ(fired.at, expires[fired.tag]) << "start=" << start << " tag=" << fired.tag;
+        }
+        EXPECT_EQ(driver.wheel_.Size(), 0u);
+        EXPECT_EQ(driver.wheel_.NextWakeup(), -1);
+    }
+}
+
+TEST(KRTimerWheelTest, SingleAdvanceReturnsTasksInExpiryOrder) {
+    KRTimerWheel wheel;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int64_t> delay(1, 100000);
+    std::vector<int64_t> order;
+    for (int i = 0; i < 2000; i++) {
+        int64_t expire = delay(rng);
+        wheel.Schedule(expire, [&order, expire] { order.push_back(expire); });
+    }
+    std::vector<KRTask> expired;
+    wheel.Advance(100000, expired);
+    ASSERT_EQ(expired.size(), 2000u);
+    for (auto &task : expired) {
+        task();
+    }
+    EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+}
+
+TEST(KRTimerWheelTest, PastExpiryFiresOnNextMillisecond) {
+    KRTimerWheel wheel(500);
+    wheel.Schedule(100, [] {});
+    wheel.Schedule(500, [] {});
+    EXPECT_EQ(wheel.NextWakeup(), 501);
+    std::vector<KRTask> expired;
+    wheel.Advance(500, expired);
+    EXPECT_TRUE(expired.empty());
+    wheel.Advance(501, expired);
+    EXPECT_EQ(expired.size(), 2u);
+}
+
+TEST(KRTimerWheelTest, NextWakeupStopsAtCascadeBeforeExpiry) {
+    KRTimerWheel wheel;
+    wheel.Schedule(1000, [] {});
+    // 1000 位于第 1 层，先在 768（所在槽的起点）下沉
+    EXPECT_EQ(wheel.NextWakeup(), 768);
+    std::vector<KRTask> expired;
+    wheel.Advance(768, expired);
+    EXPECT_TRUE(expired.empty());
+    EXPECT_EQ(wheel.NextWakeup(), 1000);
+}
+
+TEST(KRTimerWheelTest, CancelAtEveryLevel) {
+    for (int64_t span : kLevelSpans) {
+        FakeClockDriver driver;
+        auto keep = driver.After(span + 3, 1);
+        auto drop = driver.After(span + 3, 2);
+        EXPECT_TRUE(driver.wheel_.Cancel(drop));
+        EXPECT_FALSE(driver.wheel_.Cancel(drop));
+        EXPECT_EQ(driver.wheel_.Size(), 1u);
+        driver.RunUntil(span + 3);
+        ASSERT_EQ(driver.fired_.size(), 1u);
+        EXPECT_EQ(driver.fired_[0].tag, 1);
+        EXPECT_FALSE(driver.wheel_.Cancel(keep));  // 已到期
+    }
+}
+
+TEST(KRTimerWheelTest, CancelAfterCascade) {
+    FakeClockDriver driver;
+    auto id = driver.After(1000, 1);
+    driver.RunUntil(768);  // 已下沉到第 0 层
+    EXPECT_TRUE(driver.fired_.empty());
+    EXPECT_TRUE(driver.wheel_.Cancel(id));
+    driver.RunUntil(2000);
+    EXPECT_TRUE(driver.fired_.empty());
+    EXPECT_EQ(driver.wheel_.NextWakeup(), -1);
+}
+
+TEST(KRTimerWheelTest, StaleIdDoesNotCancelReusedSlot) {
+    FakeClockDriver driver;
+    auto first = driver.After(10, 1);
+    EXPECT_TRUE(driver.wheel_.Cancel(first));
+    auto second = driver.After(10, 2);  // 复用同一个节点
+    EXPECT_NE(first, second);
+    EXPECT_FALSE(driver.wheel_.Cancel(first));
+    EXPECT_FALSE(driver.wheel_.Cancel(0));
+    EXPECT_FALSE(driver.wheel_.Cancel(12345));
+    driver.RunUntil(10);
+    ASSERT_EQ(driver.fired_.size(), 1u);
+    EXPECT_EQ(driver.fired_[0].tag, 2);
+}
+
+TEST(KRTimerWheelTest, RearmFromInsideCallback) {
+    FakeClockDriver driver;
+    std::vector<int64_t> ticks;
+    std::function<void()> tick = [&] {
+        ticks.push_back(driver.wheel_.Now());
+        if (ticks.size() < 20) {
+            driver.wheel_.Schedule(driver.wheel_.Now() + 100, tick);  // 跨过第 0 层边界
+        }
+    };
+    driver.wheel_.Schedule(100, tick);
+    driver.RunUntil(10000);
+    ASSERT_EQ(ticks.size(), 20u);
+    for (size_t i = 0; i < ticks.size(); i++) {
+        EXPECT_EQ(ticks[i], static_cast<int64_t>(i + 1) * 100);
+    }
+}
+
+TEST(KRTimerWheelTest, ZeroDelayRearmDoesNotSpinWithinOneAdvance) {
+    KRTimerWheel wheel;
+    int runs = 0;
+    std::function<void()> again = [&] {
+        runs++;
+        wheel.Schedule(wheel.Now(), again);
+    };
+    wheel.Schedule(1, again);
+    std::vector<KRTask> expired;
+    for (int64_t now = 1; now <= 5; now++) {
+        wheel.Advance(now, expired);
+        for (auto &task : expired) {
+            task();
+        }
+        expired.clear();
+    }
+    EXPECT_EQ(runs, 5);
+    EXPECT_EQ(wheel.Size(), 1u);
+}
+
+TEST(KRTimerWheelTest, CancelSiblingFromInsideCallback) {
+    FakeClockDriver driver;
+    KRTimerId later = 0;
+    KRTimerId same_tick = 0;
+    bool cancel_later = false;
+    bool cancel_same_tick = true;
+    driver.wheel_.Schedule(50, [&] {
+        cancel_later = driver.wheel_.Cancel(later);
+        // 同一毫秒的任务已一并取出，不能再取消
+        cancel_same_tick = driver.wheel_.Cancel(same_tick);
+    });
+    same_tick = driver.At(50, 1);
+    later = driver.At(60, 2);
+    driver.RunUntil(100);
+    EXPECT_TRUE(cancel_later);
+    EXPECT_FALSE(cancel_same_tick);
+    ASSERT_EQ(driver.fired_.size(), 1u);
+    EXPECT_EQ(driver.fired_[0].tag, 1);
+}
+
+namespace {
+
+// 改造前 KRDelayThread 的实现：std::priority_queue + std::function，不支持取消
+struct HeapTask {
+    int64_t expire;
+    std::function<void()> func;
+    bool operator<(const HeapTask &other) const {
+        return expire > other.expire;
+    }
+};
+
+double ElapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+TEST(KRTimerWheelBenchmark, HundredThousandTimers) {
+    constexpr int kTimers = 100000;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int64_t> delay(1, 60000);
+    std::vector<int64_t> expires(kTimers);
+    for (auto &expire : expires) {
+        expire = delay(rng);
+    }
+    int64_t sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    std::priority_queue<HeapTask> heap;
+    for (int i = 0; i < kTimers; i++) {
+        heap.push(HeapTask{expires[i], [&sum, i] { sum += i; }});
+    }
+    double heap_schedule_ms = ElapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    // 与 KRDelayThread 一样每毫秒醒来一次取出到期任务
+    for (int64_t now = 1; now <= 60000; now++) {
+        while (!heap.empty() && heap.top().expire <= now) {
+            auto task = std::move(const_cast<HeapTask &>(heap.top()));
+            heap.pop();
+            task.func();
+        }
+    }
+    double heap_run_ms = ElapsedMs(start);
+    int64_t heap_sum = sum;
+
+    sum = 0;
+    start = std::chrono::steady_clock::now();
+    KRTimerWheel wheel;
+    std::vector<KRTimerId> ids(kTimers);
+    for (int i = 0; i < kTimers; i++) {
+        ids[i] = wheel.Schedule(expires[i], [&sum, i] { sum += i; });
+    }
+    double wheel_schedule_ms = ElapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    std::vector<KRTask> expired;
+    int64_t wakeup;
+    while ((wakeup = wheel.NextWakeup()) >= 0) {
+        wheel.Advance(wakeup, expired);
+        for (auto &task : expired) {
+            task();
+        }
+        expired.clear();
+    }
+    double wheel_run_ms = ElapsedMs(start);
+    EXPECT_EQ(sum, heap_sum);
+
+    // 取消一半：堆需要重建，时间轮 O(1)
+    for (int i = 0; i < kTimers; i++) {
+        ids[i] = wheel.Schedule(expires[i], [&sum, i] { sum += i; });
+    }
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kTimers; i += 2) {
+        EXPECT_TRUE(wheel.Cancel(ids[i]));
+    }
+    double wheel_cancel_ms = ElapsedMs(start);
+    EXPECT_EQ(wheel.Size(), static_cast<size_t>(kTimers / 2));
+
+    printf("100k timers over 60s: priority_queue schedule %.2f ms run %.2f ms, "
+           "timer wheel schedule %.2f ms run %.2f ms, cancel 50k %.2f ms\n",
+           heap_schedule_ms, heap_run_ms, wheel_schedule_ms, wheel_run_ms, wheel_cancel_ms);
+}
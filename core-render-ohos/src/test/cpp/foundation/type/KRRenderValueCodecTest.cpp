@@ -0,0 +1,311 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/type/KRRenderValueCodec.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "libohos_render/api/include/Kuikly/KRAnyData.h"
+#include "libohos_render/api/src/KRAnyDataInternal.h"
+#include "libohos_render/foundation/type/KRRenderValue.h"
+
+namespace {
+
+using Map = KRRenderValue::Map;
+using Array = KRRenderValue::Array;
+
+std::vector<uint8_t> EncodeValue(const KRRenderValue &value) {
+    std::vector<uint8_t> out;
+    KRRenderValueCodec::Encode(value, out);
+    return out;
+}
+
+std::shared_ptr<KRRenderValue> Bytes(std::vector<uint8_t> bytes) {
+    return std::make_shared<KRRenderValue>(std::make_shared<std::vector<uint8_t>>(std::move(bytes)));
+}
+
+/**
+ * 与 kotlin 侧 BinaryValueCodecTest 共用的编码结果，两端需保持一致
+ * [null, true, -1, 300L, 1.5f, 2.25, "hé", bytes(1, 2), {"k": []}]
+ */
+const std::vector<uint8_t> kGoldenArray = {
+    0x4B, 0x52, 0x42, 0x01, 0x09, 0x09, 0x00, 0x02, 0x03, 0x01, 0x04, 0xD8, 0x04, 0x05, 0x00, 0x00,
+    0xC0, 0x3F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x07, 0x03, 0x68, 0xC3, 0xA9,
+    0x08, 0x02, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x6B, 0x09, 0x00,
+};
+
+Array GoldenArray() {
+    Map inner;
+    inner["k"] = std::make_shared<KRRenderValue>(Array());
+    return {
+        std::make_shared<KRRenderValue>(),
+        std::make_shared<KRRenderValue>(true),
+        std::make_shared<KRRenderValue>(int32_t(-1)),
+        std::make_shared<KRRenderValue>(int64_t(300)),
+        std::make_shared<KRRenderValue>(1.5f),
+        std::make_shared<KRRenderValue>(2.25),
+        std::make_shared<KRRenderValue>("h\xC3\xA9"),
+        Bytes({1, 2}),
+        std::make_shared<KRRenderValue>(inner),
+    };
+}
+
+KRRenderCValue EncodedCValue(std::vector<uint8_t> &encoded) {
+    KRRenderCValue c_value;
+    c_value.type = KRRenderCValue::Type::ENCODED;
+    c_value.size = static_cast<int32_t>(encoded.size());
+    c_value.value.bytesValue = reinterpret_cast<char *>(encoded.data());
+    return c_value;
+}
+
+class KRRenderValueCodecTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        KRRenderValueCodec::SetEnabled(true);
+    }
+    void TearDown() override {
+        KRRenderValueCodec::SetEnabled(false);
+    }
+};
+
+}  // namespace
+
+TEST_F(KRRenderValueCodecTest, EncodesGoldenVector) {
+    EXPECT_EQ(EncodeValue(KRRenderValue(GoldenArray())), kGoldenArray);
+}
+
+TEST_F(KRRenderValueCodecTest, DecodesGoldenVector) {
+    auto value = KRRenderValueCodec::Decode(kGoldenArray.data(), kGoldenArray.size());
+    ASSERT_TRUE(value && value->isArray());
+    auto &array = value->toArray();
+    ASSERT_EQ(array.size(), 9u);
+    EXPECT_TRUE(array[0]->isNull());
+    EXPECT_TRUE(array[1]->toBool());
+    EXPECT_TRUE(array[2]->isInt());
+    EXPECT_EQ(array[2]->toInt(), -1);
+    EXPECT_TRUE(array[3]->isLong());
+    EXPECT_EQ(array[3]->toLong(), 300);
+    EXPECT_TRUE(array[4]->isFloat());
+    EXPECT_EQ(array[4]->toFloat(), 1.5f);
+    EXPECT_EQ(array[5]->toDouble(), 2.25);
+    EXPECT_EQ(array[6]->toString(), "h\xC3\xA9");
+    EXPECT_EQ(*array[7]->toByteArray(), (std::vector<uint8_t>{1, 2}));
+    ASSERT_TRUE(array[8]->isMap());
+    EXPECT_TRUE(array[8]->toMap().at("k")->isArray());
+}
+
+TEST_F(KRRenderValueCodecTest, MapRoundTripsThroughCValue) {
+    Map nested;
+    nested["min"] = std::make_shared<KRRenderValue>(int64_t(INT64_MIN));
+    nested["max"] = std::make_shared<KRRenderValue>(int32_t(INT32_MAX));
+    Map map;
+    map["nested"] = std::make_shared<KRRenderValue>(nested);
+    map["list"] = std::make_shared<KRRenderValue>(Array{std::make_shared<KRRenderValue>("a"), Bytes({})});
+    map[""] = std::make_shared<KRRenderValue>(std::string(1000, 'x'));
+    auto origin = std::make_shared<KRRenderValue>(map);
+
+    auto &c_value = origin->toCValue();
+    ASSERT_EQ(c_value.type, KRRenderCValue::Type::ENCODED);
+
+    KRRenderValue received(c_value);
+    auto &decoded = received.toMap();
+    ASSERT_EQ(decoded.size(), 3u);
+    EXPECT_EQ(decoded.at("nested")->toMap().at("min")->toLong(), INT64_MIN);
+    EXPECT_EQ(decoded.at("nested")->toMap().at("max")->toInt(), INT32_MAX);
+    EXPECT_EQ(decoded.at("list")->toArray().at(0)->toString(), "a");
+    EXPECT_TRUE(decoded.at("list")->toArray().at(1)->isByteArray());
+    EXPECT_EQ(decoded.at("")->toString().size(), 1000u);
+
+    // 原样回传时保持 ENCODED 类型
+    EXPECT_EQ(received.toCValue().type, KRRenderCValue::Type::ENCODED);
+}
+
+TEST_F(KRRenderValueCodecTest, ByteArrayWithHeaderStaysBytes) {
+    // 以 header 开头的普通二进制数据不能被当作编码后的 map 解析
+    std::vector<uint8_t> payload(kGoldenArray);
+    KRRenderCValue c_value;
+    c_value.type = KRRenderCValue::Type::BYTES;
+    c_value.size = static_cast<int32_t>(payload.size());
+    c_value.value.bytesValue = reinterpret_cast<char *>(payload.data());
+
+    KRRenderValue received(c_value);
+    EXPECT_TRUE(received.isByteArray());
+    EXPECT_EQ(*received.toByteArray(), payload);
+    EXPECT_TRUE(received.toArray().empty());
+    EXPECT_TRUE(received.toMap().empty());
+    EXPECT_EQ(received.toCValue().type, KRRenderCValue::Type::BYTES);
+}
+
+TEST_F(KRRenderValueCodecTest, ResetClearsEncodedFlag) {
+    auto encoded = EncodeValue(KRRenderValue(GoldenArray()));
+    auto c_value = EncodedCValue(encoded);
+    KRRenderValue value(c_value);
+    EXPECT_EQ(value.toArray().size(), 9u);
+
+    // 对象池复用时改为普通二进制数据
+    c_value.type = KRRenderCValue::Type::BYTES;
+    value.resetFromCValue(c_value);
+    EXPECT_TRUE(value.toArray().empty());
+    EXPECT_EQ(value.toCValue().type, KRRenderCValue::Type::BYTES);
+}
+
+TEST_F(KRRenderValueCodecTest, DisabledCodecKeepsJson) {
+    KRRenderValueCodec::SetEnabled(false);
+    Map map;
+    map["a"] = std::make_shared<KRRenderValue>(int32_t(1));
+    auto value = std::make_shared<KRRenderValue>(map);
+    auto &c_value = value->toCValue();
+    ASSERT_EQ(c_value.type, KRRenderCValue::Type::STRING);
+    EXPECT_STREQ(c_value.value.stringValue, "{\"a\":1}");
+}
+
+TEST_F(KRRenderValueCodecTest, RejectsMalformedData) {
+    auto truncated = kGoldenArray;
+    truncated.pop_back();
+    EXPECT_EQ(KRRenderValueCodec::Decode(truncated.data(), truncated.size()), nullptr);
+
+    auto trailing = kGoldenArray;
+    trailing.push_back(0);
+    EXPECT_EQ(KRRenderValueCodec::Decode(trailing.data(), trailing.size()), nullptr);
+
+    auto bad_version = kGoldenArray;
+    bad_version[3] = KRRenderValueCodec::kVersion + 1;
+    EXPECT_EQ(KRRenderValueCodec::Decode(bad_version.data(), bad_version.size()), nullptr);
+
+    std::vector<uint8_t> bad_tag = {0x4B, 0x52, 0x42, 0x01, 0x7F};
+    EXPECT_EQ(KRRenderValueCodec::Decode(bad_tag.data(), bad_tag.size()), nullptr);
+
+    // 声明的元素个数超过剩余字节数
+    std::vector<uint8_t> huge_count = {0x4B, 0x52, 0x42, 0x01, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F};
+    EXPECT_EQ(KRRenderValueCodec::Decode(huge_count.data(), huge_count.size()), nullptr);
+
+    // 嵌套过深
+    std::vector<uint8_t> deep = {0x4B, 0x52, 0x42, 0x01};
+    for (int i = 0; i < 100; ++i) {
+        deep.push_back(0x09);
+        deep.push_back(0x01);
+    }
+    deep.push_back(0x00);
+    EXPECT_EQ(KRRenderValueCodec::Decode(deep.data(), deep.size()), nullptr);
+}
+
+TEST_F(KRRenderValueCodecTest, EncodedValueReportsMapOrArray) {
+    Map map;
+    map["a"] = std::make_shared<KRRenderValue>(int32_t(1));
+    auto encoded_map = EncodeValue(KRRenderValue(map));
+    auto map_value = std::make_shared<KRRenderValue>(EncodedCValue(encoded_map));
+    EXPECT_TRUE(map_value->isMap());
+    EXPECT_FALSE(map_value->isArray());
+    EXPECT_FALSE(map_value->isByteArray());
+    EXPECT_TRUE(map_value->toByteArray()->empty());
+    EXPECT_EQ(map_value->toString(), "{\n\t\"a\":\t1\n}");
+
+    auto encoded_array = EncodeValue(KRRenderValue(GoldenArray()));
+    auto array_value = std::make_shared<KRRenderValue>(EncodedCValue(encoded_array));
+    EXPECT_TRUE(array_value->isArray());
+    EXPECT_FALSE(array_value->isMap());
+    EXPECT_FALSE(array_value->isByteArray());
+    EXPECT_EQ(array_value->toArray().size(), 9u);
+
+    // 作为 map 的值再次编码时按 map or array 展开，而不是二进制数据
+    Map outer;
+    outer["inner"] = map_value;
+    auto encoded_outer = EncodeValue(KRRenderValue(outer));
+    auto decoded = KRRenderValueCodec::Decode(encoded_outer.data(), encoded_outer.size());
+    ASSERT_TRUE(decoded && decoded->isMap());
+    EXPECT_EQ(decoded->toMap().at("inner")->toMap().at("a")->toInt(), 1);
+}
+
+TEST_F(KRRenderValueCodecTest, AnyDataTreatsEncodedValueAsMapOrArray) {
+    Map map;
+    map["a"] = std::make_shared<KRRenderValue>(int32_t(1));
+    auto encoded_map = EncodeValue(KRRenderValue(map));
+    KRAnyDataInternal map_data;
+    map_data.anyValue = std::make_shared<KRRenderValue>(EncodedCValue(encoded_map));
+    EXPECT_FALSE(KRAnyDataIsBytes(&map_data));
+    EXPECT_FALSE(KRAnyDataIsArray(&map_data));
+    const char *str = nullptr;
+    ASSERT_EQ(KRAnyDataGetStr(&map_data, &str), KRANYDATA_SUCCESS);
+    EXPECT_STREQ(str, "{\n\t\"a\":\t1\n}");
+    const char *bytes = nullptr;
+    int size = 0;
+    EXPECT_EQ(KRAnyDataGetBytes(&map_data, &bytes, &size), KRANYDATA_TYPE_MISMATCH);
+
+    auto encoded_array = EncodeValue(KRRenderValue(GoldenArray()));
+    KRAnyDataInternal array_data;
+    array_data.anyValue = std::make_shared<KRRenderValue>(EncodedCValue(encoded_array));
+    EXPECT_TRUE(KRAnyDataIsArray(&array_data));
+    EXPECT_FALSE(KRAnyDataIsBytes(&array_data));
+    int array_size = 0;
+    ASSERT_EQ(KRAnyDataGetArraySize(&array_data, &array_size), KRANYDATA_SUCCESS);
+    EXPECT_EQ(array_size, 9);
+}
+
+TEST(KRRenderValueCodecBenchmark, BinaryVersusJson) {
+    constexpr int kRounds = 2000;
+    // 接近一次事件回调的负载：若干标量字段加一个对象列表
+    Array items;
+    for (int i = 0; i < 50; ++i) {
+        Map item;
+        item["id"] = std::make_shared<KRRenderValue>(int32_t(i));
+        item["x"] = std::make_shared<KRRenderValue>(i * 1.25);
+        item["title"] = std::make_shared<KRRenderValue>("item title " + std::to_string(i));
+        item["selected"] = std::make_shared<KRRenderValue>(i % 2 == 0);
+        items.push_back(std::make_shared<KRRenderValue>(item));
+    }
+    Map root;
+    root["items"] = std::make_shared<KRRenderValue>(items);
+    root["offsetX"] = std::make_shared<KRRenderValue>(12.5);
+    root["offsetY"] = std::make_shared<KRRenderValue>(480.0);
+    root["state"] = std::make_shared<KRRenderValue>("dragging");
+
+    using Clock = std::chrono::steady_clock;
+    auto per_round_us = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / kRounds;
+    };
+
+    size_t json_size = 0;
+    size_t json_items = 0;
+    auto start = Clock::now();
+    for (int i = 0; i < kRounds; ++i) {
+        KRRenderValueCodec::SetEnabled(false);
+        auto sender = std::make_shared<KRRenderValue>(root);
+        auto &c_value = sender->toCValue();
+        json_size = strlen(c_value.value.stringValue);
+        KRRenderValue receiver(c_value);
+        json_items += receiver.toMap().at("items")->toArray().size();
+    }
+    double json_us = per_round_us(start);
+
+    size_t binary_size = 0;
+    size_t binary_items = 0;
+    start = Clock::now();
+    for (int i = 0; i < kRounds; ++i) {
+        KRRenderValueCodec::SetEnabled(true);
+        auto sender = std::make_shared<KRRenderValue>(root);
+        auto &c_value = sender->toCValue();
+        binary_size = c_value.size;
+        KRRenderValue receiver(c_value);
+        binary_items += receiver.toMap().at("items")->toArray().size();
+    }
+    double binary_us = per_round_us(start);
+    KRRenderValueCodec::SetEnabled(false);
+
+    EXPECT_EQ(json_items, binary_items);
+    printf("render value map round trip: cJSON %.1f us (%zu bytes), binary %.1f us (%zu bytes)\n", json_us, json_size,
+           binary_us, binary_size);
+}
@@ -0,0 +1,294 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/foundation/type/KRRenderValuePool.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+#include "utils/KRAllocationCounter.h"
+
+namespace {
+
+std::shared_ptr<KRRenderValue> AcquireString(const std::string &str) {
+    return KRRenderValuePool::AcquireString(str.data(), str.size());
+}
+
+}  // namespace
+
+TEST(KRRenderValuePoolTest, ReusesReleasedValues) {
+    std::vector<std::shared_ptr<KRRenderValue>> held;
+    std::set<KRRenderValue *> released;
+    for (size_t i = 0; i < KRRenderValuePool::kCapacity; ++i) {
+        held.push_back(AcquireString(std::to_string(i)));
+        released.insert(held.back().get());
+    }
+    held.clear();
+
+    auto value = AcquireString("reused");
+    EXPECT_EQ(released.count(value.get()), 1u);
+    EXPECT_EQ(value->toString(), "reused");
+}
+
+TEST(KRRenderValuePoolTest, HeldValueIsNotReused) {
+    auto held = AcquireString("held");
+    for (size_t i = 0; i < KRRenderValuePool::kCapacity * 2; ++i) {
+        auto value = AcquireString("other");
+        EXPECT_NE(value.get(), held.get());
+    }
+    EXPECT_EQ(held->toString(), "held");
+}
+
+TEST(KRRenderValuePoolTest, MarkedSharedValueIsNotReused) {
+    auto value = AcquireString("keep");
+    auto *raw = value.get();
+    value->MarkShared();
+    std::weak_ptr<KRRenderValue> weak = value;
+    value.reset();
+
+    for (size_t i = 0; i < KRRenderValuePool::kCapacity * 2; ++i) {
+        auto other = AcquireString("other");
+        EXPECT_NE(other.get(), raw);
+        if (auto locked = weak.lock()) {
+            EXPECT_EQ(locked->toString(), "keep");
+        }
+    }
+    // 空闲后被移出池
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST(KRRenderValuePoolTest, SerializationDoesNotMarkShared) {
+    KRRenderValue::Map map;
+    map["k"] = std::make_shared<KRRenderValue>(1);
+    auto value = std::make_shared<KRRenderValue>(map);
+    EXPECT_FALSE(value->toString().empty());
+    value->shared_from_this();
+    EXPECT_FALSE(value->IsMarkedShared());
+    value->MarkShared();
+    EXPECT_TRUE(value->IsMarkedShared());
+}
+
+namespace {
+
+/**
+ * 录制的 callNative 调用：methodId 与 6 个参数，字符串参数的内存由 strings 持有
+ */
+struct RecordedCall {
+    int method_id = 0;
+    KRRenderCValue args[6];
+};
+
+class RecordedCallStream {
+ public:
+    /**
+     * 模拟列表首屏：每个 item 创建 View、设置属性与 frame、插入父节点，穿插模块调用
+     */
+    explicit RecordedCallStream(int item_count) {
+        strings_.reserve(item_count * 8);
+        for (int tag = 1; tag <= item_count; ++tag) {
+            Add(1, {Int(tag), String(tag % 3 ? "KRView" : "KRRichTextView")});                  // createRenderView
+            Add(4, {Int(tag), String("backgroundColor"), String("rgba(255,255,255,1.0)")});      // setViewProp
+            Add(4, {Int(tag), String("borderRadius"), String("8.0,8.0,8.0,8.0")});
+            Add(4, {Int(tag), String("click"), Int(1)});
+            Add(5, {Int(tag), Float(0), Float(tag * 88.0f), Float(375), Float(88)});             // setRenderViewFrame
+            Add(3, {Int(0), Int(tag), Int(tag - 1)});                                            // insertSubRenderView
+            if (tag % 10 == 0) {
+                Add(8, {String("KRNetworkModule"), String("httpRequest"),                        // callModuleMethod
+                        String("{\"url\":\"https://example.com/list?page=" + std::to_string(tag / 10) +
+                               "\",\"method\":\"GET\",\"headers\":{\"Accept\":\"application/json\"}}"),
+                        Int(tag)});
+            }
+        }
+    }
+
+    const std::vector<RecordedCall> &Calls() const {
+        return calls_;
+    }
+
+ private:
+    static KRRenderCValue Int(int32_t value) {
+        KRRenderCValue cvalue;
+        cvalue.type = KRRenderCValue::INT;
+        cvalue.value.intValue = value;
+        return cvalue;
+    }
+
+    static KRRenderCValue Float(float value) {
+        KRRenderCValue cvalue;
+        cvalue.type = KRRenderCValue::FLOAT;
+        cvalue.value.floatValue = value;
+        return cvalue;
+    }
+
+    KRRenderCValue String(const std::string &value) {
+        strings_.push_back(value);
+        KRRenderCValue cvalue;
+        cvalue.type = KRRenderCValue::STRING;
+        cvalue.value.stringValue = const_cast<char *>(strings_.back().c_str());
+        cvalue.size = static_cast<int32_t>(strings_.back().size());
+        return cvalue;
+    }
+
+    void Add(int method_id, std::initializer_list<KRRenderCValue> args) {
+        RecordedCall call;
+        call.method_id = method_id;
+        for (auto &arg : call.args) {
+            arg.type = KRRenderCValue::NULL_VALUE;
+        }
+        size_t i = 0;
+        for (auto &arg : args) {
+            call.args[i++] = arg;
+        }
+        calls_.push_back(call);
+    }
+
+    std::vector<std::string> strings_;
+    std::vector<RecordedCall> calls_;
+};
+
+/**
+ * 模拟 OnCallNative 读取参数
+ */
+size_t Consume(const std::shared_ptr<KRRenderValue> *values) {
+    size_t checksum = 0;
+    for (int i = 0; i < 6; ++i) {
+        auto &value = values[i];
+        if (value->isString()) {
+            checksum += value->toString().size();
+        } else if (value->isInt()) {
+            checksum += value->toInt();
+        } else if (value->isFloat()) {
+            checksum += static_cast<size_t>(value->toFloat());
+        }
+    }
+    return checksum;
+}
+
+/**
+ * 按 DispatchCallNative 的方式回放：从池中取 6 个参数，调用结束即释放
+ */
+size_t ReplayPooled(const RecordedCallStream &stream) {
+    size_t checksum = 0;
+    for (auto &call : stream.Calls()) {
+        std::shared_ptr<KRRenderValue> values[6] = {
+            KRRenderValuePool::Acquire(call.args[0]), KRRenderValuePool::Acquire(call.args[1]),
+            KRRenderValuePool::Acquire(call.args[2]), KRRenderValuePool::Acquire(call.args[3]),
+            KRRenderValuePool::Acquire(call.args[4]), KRRenderValuePool::Acquire(call.args[5])};
+        checksum += Consume(values);
+    }
+    return checksum;
+}
+
+/**
+ * 改造前的方式：每个参数 make_shared
+ */
+size_t ReplayMakeShared(const RecordedCallStream &stream) {
+    size_t checksum = 0;
+    for (auto &call : stream.Calls()) {
+        std::shared_ptr<KRRenderValue> values[6] = {
+            std::make_shared<KRRenderValue>(call.args[0]), std::make_shared<KRRenderValue>(call.args[1]),
+            std::make_shared<KRRenderValue>(call.args[2]), std::make_shared<KRRenderValue>(call.args[3]),
+            std::make_shared<KRRenderValue>(call.args[4]), std::make_shared<KRRenderValue>(call.args[5])};
+        checksum += Consume(values);
+    }
+    return checksum;
+}
+
+/**
+ * 回放直到稳定，返回最后一次产生分配的轮数
+ * 每轮取用次数不是池容量的整数倍，池中对象逐轮错位承接不同参数，字符串容量随所见的最长参数增长；
+ * 连续 kCapacity 轮无分配即覆盖了所有错位，之后不会再分配
+ */
+int WarmUp(const RecordedCallStream &stream) {
+    constexpr int kMaxRounds = 256;
+    int last_allocating_round = 0;
+    for (int round = 1; round <= kMaxRounds; ++round) {
+        KRAllocationCounter counter;
+        ReplayPooled(stream);
+        if (counter.Count() != 0) {
+            last_allocating_round = round;
+        } else if (round - last_allocating_round >= static_cast<int>(KRRenderValuePool::kCapacity)) {
+            break;
+        }
+    }
+    return last_allocating_round;
+}
+
+}  // namespace
+
+TEST(KRRenderValuePoolTest, SteadyStateReplayDoesNotAllocate) {
+    RecordedCallStream stream(100);
+    auto expected = ReplayMakeShared(stream);
+    EXPECT_LT(WarmUp(stream), 64);
+
+    KRAllocationCounter counter;
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(ReplayPooled(stream), expected);
+    }
+    EXPECT_EQ(counter.Count(), 0u);
+}
+
+TEST(KRRenderValuePoolTest, HeldArgumentFallsBackToNewAllocation) {
+    RecordedCallStream stream(10);
+    ReplayPooled(stream);
+
+    // 业务持有的参数不会被复用，其余参数仍从池中获取
+    std::vector<std::shared_ptr<KRRenderValue>> held;
+    KRAllocationCounter counter;
+    for (auto &call : stream.Calls()) {
+        held.push_back(KRRenderValuePool::Acquire(call.args[1]));
+    }
+    EXPECT_GE(counter.Count(), held.size() - KRRenderValuePool::kCapacity);
+    std::set<KRRenderValue *> distinct;
+    for (auto &value : held) {
+        distinct.insert(value.get());
+    }
+    EXPECT_EQ(distinct.size(), held.size());
+}
+
+TEST(KRRenderValuePoolBenchmark, ReplayRecordedCallStream) {
+    RecordedCallStream stream(100);
+    constexpr int kRounds = 200;
+    int warmup_rounds = WarmUp(stream);
+    size_t calls = stream.Calls().size() * kRounds;
+
+    KRAllocationCounter shared_counter;
+    auto start = std::chrono::steady_clock::now();
+    size_t shared_checksum = 0;
+    for (int i = 0; i < kRounds; ++i) {
+        shared_checksum += ReplayMakeShared(stream);
+    }
+    auto shared_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    size_t shared_allocations = shared_counter.Count();
+
+    KRAllocationCounter pooled_counter;
+    start = std::chrono::steady_clock::now();
+    size_t pooled_checksum = 0;
+    for (int i = 0; i < kRounds; ++i) {
+        pooled_checksum += ReplayPooled(stream);
+    }
+    auto pooled_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    size_t pooled_allocations = pooled_counter.Count();
+
+    EXPECT_EQ(pooled_checksum, shared_checksum);
+    EXPECT_EQ(pooled_allocations, 0u);
+    printf("replay %zu calls: make_shared %.1f ns/call %.2f allocs/call, pool %.1f ns/call %.2f allocs/call "
+           "(last allocation in warm-up round %d)\n",
+           calls, shared_ns / calls, static_cast<double>(shared_allocations) / calls, pooled_ns / calls,
+           static_cast<double>(pooled_allocations) / calls, warmup_rounds);
+}
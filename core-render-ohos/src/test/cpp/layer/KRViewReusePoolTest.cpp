@@ -0,0 +1,218 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/layer/KRViewReusePool.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using Node = KRViewReusePool::Node;
+using Subtree = KRViewReusePool::Subtree;
+
+// 复用池只记账，不访问 view，用互不相同的占位指针标识 view
+std::shared_ptr<IKRRenderViewExport> MakeView() {
+    auto owner = std::make_shared<int>(0);
+    return std::shared_ptr<IKRRenderViewExport>(owner, reinterpret_cast<IKRRenderViewExport *>(owner.get()));
+}
+
+Subtree MakeLeaf(const std::string &view_name) {
+    Subtree subtree;
+    subtree.nodes.push_back({MakeView(), view_name, 0});
+    return subtree;
+}
+
+// 前序排列的 (深度, view 名)
+Subtree MakeTree(const std::vector<std::pair<int, std::string>> &shape) {
+    Subtree subtree;
+    for (const auto &node : shape) {
+        subtree.nodes.push_back({MakeView(), node.second, node.first});
+    }
+    return subtree;
+}
+
+}  // namespace
+
+TEST(KRViewReusePoolTest, ReuseKeyEncodesPreorderStructure) {
+    auto cell = MakeTree({{0, "KRView"}, {1, "KRImageView"}, {1, "KRRichTextView"}});
+    auto same = MakeTree({{0, "KRView"}, {1, "KRImageView"}, {1, "KRRichTextView"}});
+    auto reordered = MakeTree({{0, "KRView"}, {1, "KRRichTextView"}, {1, "KRImageView"}});
+    auto nested = MakeTree({{0, "KRView"}, {1, "KRImageView"}, {2, "KRRichTextView"}});
+    auto leaf = MakeLeaf("KRView");
+
+    auto key = KRViewReusePool::MakeReuseKey(cell.nodes);
+    EXPECT_EQ(key, KRViewReusePool::MakeReuseKey(same.nodes));
+    EXPECT_NE(key, KRViewReusePool::MakeReuseKey(reordered.nodes));
+    EXPECT_NE(key, KRViewReusePool::MakeReuseKey(nested.nodes));
+    EXPECT_NE(key, KRViewReusePool::MakeReuseKey(leaf.nodes));
+}
+
+TEST(KRViewReusePoolTest, PutGeneratesKeyAndPopMatchesRootName) {
+    KRViewReusePool pool;
+    auto cell = MakeTree({{0, "KRView"}, {1, "KRImageView"}});
+    auto root = cell.nodes[0].view;
+    pool.Put(cell, nullptr);
+
+    Subtree out;
+    EXPECT_FALSE(pool.Pop("KRImageView", &out));
+    EXPECT_FALSE(pool.Pop("KRRichTextView", &out));
+    ASSERT_TRUE(pool.Pop("KRView", &out));
+    EXPECT_EQ(out.nodes[0].view, root);
+    EXPECT_EQ(out.nodes.size(), 2u);
+    EXPECT_EQ(out.key, KRViewReusePool::MakeReuseKey(out.nodes));
+    EXPECT_FALSE(pool.Pop("KRView", &out));
+}
+
+TEST(KRViewReusePoolTest, PopsMostRecentByDefault) {
+    KRViewReusePool pool;
+    auto first = MakeLeaf("KRView");
+    auto second = MakeLeaf("KRView");
+    auto second_view = second.nodes[0].view;
+    pool.Put(first, nullptr);
+    pool.Put(second, nullptr);
+
+    Subtree out;
+    ASSERT_TRUE(pool.Pop("KRView", &out));
+    EXPECT_EQ(out.nodes[0].view, second_view);
+}
+
+TEST(KRViewReusePoolTest, PrefersStructureOfLastFullMatch) {
+    KRViewReusePool pool;
+    auto image_cell = MakeTree({{0, "KRView"}, {1, "KRImageView"}});
+    auto text_cell = MakeTree({{0, "KRView"}, {1, "KRRichTextView"}});
+    auto image_key = KRViewReusePool::MakeReuseKey(image_cell.nodes);
+    auto image_root = image_cell.nodes[0].view;
+    pool.Put(image_cell, nullptr);
+    pool.Put(text_cell, nullptr);
+    pool.Put(MakeLeaf("KRView"), nullptr);
+
+    pool.DidFullyMatch("KRView", image_key);
+    Subtree out;
+    ASSERT_TRUE(pool.Pop("KRView", &out));
+    EXPECT_EQ(out.nodes[0].view, image_root);
+    EXPECT_EQ(out.key, image_key);
+
+    // 没有相同结构时退回最近放入的
+    ASSERT_TRUE(pool.Pop("KRView", &out));
+    EXPECT_EQ(out.nodes.size(), 1u);
+}
+
+TEST(KRViewReusePoolTest, TrimsOldestOfTypeBeyondTypeCapacity) {
+    KRViewReusePool pool(512, 2);
+    std::vector<Subtree> evicted;
+    auto oldest = MakeTree({{0, "KRView"}, {1, "KRImageView"}});
+    auto oldest_root = oldest.nodes[0].view;
+    pool.Put(oldest, &evicted);
+    pool.Put(MakeLeaf("KRView"), &evicted);
+    pool.Put(MakeLeaf("KRImageView"), &evicted);
+    EXPECT_TRUE(evicted.empty());
+
+    pool.Put(MakeLeaf("KRView"), &evicted);
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(evicted[0].nodes[0].view, oldest_root);
+    EXPECT_EQ(pool.CountOf("KRView"), 2u);
+    EXPECT_EQ(pool.CountOf("KRImageView"), 1u);
+
+    auto stats = pool.GetStats();
+    EXPECT_EQ(stats.eviction_count, 2u);  // 按 view 数计
+    EXPECT_EQ(stats.subtree_count, 3u);
+    EXPECT_EQ(stats.view_count, 3u);
+}
+
+TEST(KRViewReusePoolTest, TrimsLeastRecentlyPutAcrossTypesBeyondViewCount) {
+    KRViewReusePool pool(4, 32);
+    std::vector<Subtree> evicted;
+    auto image = MakeLeaf("KRImageView");
+    auto image_view = image.nodes[0].view;
+    pool.Put(image, &evicted);
+    pool.Put(MakeLeaf("KRRichTextView"), &evicted);
+    pool.Put(MakeTree({{0, "KRView"}, {1, "KRImageView"}}), &evicted);
+    EXPECT_TRUE(evicted.empty());
+
+    // 放入 2 个 view 后共 6 个，淘汰最久的两棵单节点子树
+    pool.Put(MakeTree({{0, "KRView"}, {1, "KRRichTextView"}}), &evicted);
+    ASSERT_EQ(evicted.size(), 2u);
+    EXPECT_EQ(evicted[0].nodes[0].view, image_view);
+    EXPECT_EQ(evicted[1].nodes[0].view_name, "KRRichTextView");
+    EXPECT_EQ(pool.CountOf("KRImageView"), 0u);
+    EXPECT_EQ(pool.CountOf("KRView"), 2u);
+    EXPECT_EQ(pool.GetStats().view_count, 4u);
+
+    evicted.clear();
+    pool.TrimTo(1, &evicted);
+    EXPECT_EQ(evicted.size(), 2u);
+    EXPECT_EQ(pool.GetStats().view_count, 0u);
+}
+
+TEST(KRViewReusePoolTest, TypeCapacityOverridesDefault) {
+    KRViewReusePool pool(512, 4);
+    EXPECT_EQ(pool.TypeCapacity("KRView"), 4u);
+    std::vector<Subtree> evicted;
+    for (int i = 0; i < 4; i++) {
+        pool.Put(MakeLeaf("KRView"), &evicted);
+    }
+
+    // 调小上限时立即淘汰多出的子树
+    pool.SetTypeCapacity("KRView", 1, &evicted);
+    EXPECT_EQ(pool.TypeCapacity("KRView"), 1u);
+    EXPECT_EQ(evicted.size(), 3u);
+    EXPECT_EQ(pool.CountOf("KRView"), 1u);
+    EXPECT_EQ(pool.TypeCapacity("KRImageView"), 4u);
+
+    // 上限为 0 的类型不入池
+    evicted.clear();
+    pool.SetTypeCapacity("KRImageView", 0, &evicted);
+    auto image = MakeLeaf("KRImageView");
+    auto image_view = image.nodes[0].view;
+    pool.Put(image, &evicted);
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(evicted[0].nodes[0].view, image_view);
+    EXPECT_EQ(pool.CountOf("KRImageView"), 0u);
+}
+
+TEST(KRViewReusePoolTest, StatsTrackHitsAndSubtrees) {
+    KRViewReusePool pool;
+    pool.Put(MakeTree({{0, "KRView"}, {1, "KRImageView"}}), nullptr);
+    pool.RecordMiss();
+    pool.RecordPrewarm();
+
+    Subtree out;
+    ASSERT_TRUE(pool.Pop("KRView", &out));
+    pool.RecordHit(2);
+    pool.DidFullyMatch("KRView", out.key);
+
+    auto stats = pool.GetStats();
+    EXPECT_EQ(stats.hit_count, 2u);
+    EXPECT_EQ(stats.miss_count, 1u);
+    EXPECT_EQ(stats.subtree_hit_count, 1u);
+    EXPECT_EQ(stats.full_match_count, 1u);
+    EXPECT_EQ(stats.prewarm_count, 1u);
+    EXPECT_DOUBLE_EQ(stats.HitRate(), 2.0 / 3);
+    EXPECT_DOUBLE_EQ(KRViewReusePool::Stats().HitRate(), 0);
+}
+
+TEST(KRViewReusePoolTest, ClearHandsBackEverySubtree) {
+    KRViewReusePool pool;
+    pool.Put(MakeTree({{0, "KRView"}, {1, "KRImageView"}}), nullptr);
+    pool.Put(MakeLeaf("KRRichTextView"), nullptr);
+
+    std::vector<Subtree> removed;
+    pool.Clear(&removed);
+    EXPECT_EQ(removed.size(), 2u);
+    EXPECT_EQ(pool.GetStats().view_count, 0u);
+    EXPECT_EQ(pool.CountOf("KRView"), 0u);
+    Subtree out;
+    EXPECT_FALSE(pool.Pop("KRView", &out));
+}
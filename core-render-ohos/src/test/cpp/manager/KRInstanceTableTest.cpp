@@ -0,0 +1,229 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/manager/KRInstanceTable.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t kIndexMask = 0xFFFFFFFFull;
+
+}  // namespace
+
+TEST(KRInstanceTableTest, AcquireReturnsSameHandleUntilReleased) {
+    auto &table = KRInstanceTable::GetInstance();
+    auto handle = table.Acquire("same");
+    ASSERT_NE(handle, kInvalidInstanceHandle);
+    EXPECT_EQ(table.Acquire("same"), handle);
+    EXPECT_EQ(table.Find("same"), handle);
+    EXPECT_EQ(table.Resolve("same"), handle);
+    table.Release("same");
+    EXPECT_EQ(table.Find("same"), kInvalidInstanceHandle);
+    EXPECT_FALSE(table.IsAlive(handle));
+}
+
+TEST(KRInstanceTableTest, ReusedSlotBumpsGeneration) {
+    auto &table = KRInstanceTable::GetInstance();
+    auto old_handle = table.Acquire("old");
+    ASSERT_NE(old_handle, kInvalidInstanceHandle);
+    EXPECT_EQ(table.Resolve("old"), old_handle);
+    table.Release("old");
+
+    auto new_handle = table.Acquire("new");
+    ASSERT_NE(new_handle, kInvalidInstanceHandle);
+    // 后进先出复用同一槽位，仅代数不同
+    EXPECT_EQ(new_handle & kIndexMask, old_handle & kIndexMask);
+    EXPECT_NE(new_handle, old_handle);
+    EXPECT_FALSE(table.IsAlive(old_handle));
+    EXPECT_TRUE(table.IsAlive(new_handle));
+    EXPECT_EQ(table.GetRenderView(old_handle), nullptr);
+    EXPECT_EQ(table.GetContextHandler(old_handle), nullptr);
+    EXPECT_FALSE(table.HasRenderView(old_handle));
+    // 线程内缓存中的旧句柄已失效，不会返回
+    EXPECT_EQ(table.Resolve("old"), kInvalidInstanceHandle);
+    EXPECT_EQ(table.Resolve("new"), new_handle);
+
+    // 同名实例重新登记得到新句柄
+    table.Release("new");
+    auto again = table.Acquire("old");
+    EXPECT_NE(again, old_handle);
+    EXPECT_EQ(table.Resolve("old"), again);
+    table.Release("old");
+}
+
+TEST(KRInstanceTableTest, AcquireFailsPastCapacity) {
+    auto &table = KRInstanceTable::GetInstance();
+    std::vector<std::string> ids;
+    for (size_t i = 0; i < KRInstanceTable::kCapacity; ++i) {
+        ids.push_back("instance_" + std::to_string(i));
+        ASSERT_NE(table.Acquire(ids.back()), kInvalidInstanceHandle) << i;
+    }
+
+    EXPECT_EQ(table.Acquire("overflow"), kInvalidInstanceHandle);
+    EXPECT_EQ(table.Find("overflow"), kInvalidInstanceHandle);
+    EXPECT_EQ(table.Resolve("overflow"), kInvalidInstanceHandle);
+    // 无效句柄上的登记与查找均为空操作
+    table.SetRenderView(kInvalidInstanceHandle, nullptr);
+    EXPECT_EQ(table.GetRenderView(kInvalidInstanceHandle), nullptr);
+    EXPECT_FALSE(table.IsAlive(kInvalidInstanceHandle));
+    // 已登记的实例不受影响
+    EXPECT_NE(table.Acquire(ids.front()), kInvalidInstanceHandle);
+
+    table.Release(ids.back());
+    auto handle = table.Acquire("overflow");
+    EXPECT_NE(handle, kInvalidInstanceHandle);
+    EXPECT_EQ(table.Resolve("overflow"), handle);
+
+    table.Release("overflow");
+    for (size_t i = 0; i + 1 < ids.size(); ++i) {
+        table.Release(ids[i]);
+    }
+    EXPECT_EQ(table.Find(ids.front()), kInvalidInstanceHandle);
+}
+
+namespace {
+
+/**
+ * 改造前的查找路径：按 arg0 构造 std::string，查 context_handler_map_（无锁），
+ * 再由 KRRenderManager::GetRenderView 加自旋锁查 render_view_map_（find + operator[]）
+ */
+class LegacyLookup {
+ public:
+    void Register(const std::string &instance_id, const std::shared_ptr<IKRRenderNativeContextHandler> &handler,
+                  const std::shared_ptr<KRRenderView> &view) {
+        context_handler_map_[instance_id] = handler;
+        render_view_map_[instance_id] = view;
+    }
+
+    bool Lookup(const char *arg0) {
+        std::string instance_id(arg0);
+        auto handler = context_handler_map_[instance_id];
+        return handler && GetRenderView(instance_id) != nullptr;
+    }
+
+ private:
+    std::shared_ptr<KRRenderView> GetRenderView(const std::string &instance_id) {
+        KRScopedSpinLock lock(&render_view_map_lock_);
+        if (render_view_map_.find(instance_id) == render_view_map_.end()) {
+            return nullptr;
+        }
+        return render_view_map_[instance_id];
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<IKRRenderNativeContextHandler>> context_handler_map_;
+    KRSpinLock render_view_map_lock_;
+    std::unordered_map<std::string, std::shared_ptr<KRRenderView>> render_view_map_;
+};
+
+/**
+ * 当前 DispatchCallNative 的查找路径
+ */
+bool HandleLookup(const char *arg0) {
+    auto &table = KRInstanceTable::GetInstance();
+    auto handle = table.Resolve(arg0);
+    auto handler = table.GetContextHandler(handle);
+    return handler && table.HasRenderView(handle);
+}
+
+/**
+ * 宿主机上不构造真实的 view 与 handler，以别名 shared_ptr 代替，保留引用计数开销
+ */
+template <typename T> std::shared_ptr<T> FakeObject(const std::shared_ptr<int> &owner) {
+    return std::shared_ptr<T>(owner, reinterpret_cast<T *>(owner.get()));
+}
+
+/**
+ * 按 pattern 生成调用序列：burst 为同一实例连续调用的次数
+ */
+std::vector<const char *> MakeCallStream(const std::vector<std::string> &ids, size_t calls, size_t burst) {
+    std::vector<const char *> stream;
+    stream.reserve(calls);
+    for (size_t i = 0; i < calls; ++i) {
+        stream.push_back(ids[(i / burst) % ids.size()].c_str());
+    }
+    return stream;
+}
+
+/**
+ * 各线程同时回放整个调用序列，返回墙钟时间均摊到每次调用的耗时
+ */
+template <typename F> double RunNsPerCall(const std::vector<const char *> &stream, int threads, F &&lookup) {
+    std::atomic<size_t> hits{0};
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            size_t local = 0;
+            for (auto *arg0 : stream) {
+                local += lookup(arg0) ? 1 : 0;
+            }
+            hits += local;
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(hits.load(), stream.size() * threads);
+    return ns / (stream.size() * threads);
+}
+
+}  // namespace
+
+TEST(KRInstanceTableBenchmark, MultiInstanceLookup) {
+    auto &table = KRInstanceTable::GetInstance();
+    constexpr size_t kCalls = 1000000;
+
+    for (size_t instance_count : {1u, 16u, 256u}) {
+        std::vector<std::string> ids;
+        LegacyLookup legacy;
+        for (size_t i = 0; i < instance_count; ++i) {
+            ids.push_back("page_" + std::to_string(1718000000000ull + i) + "_" + std::to_string(i));
+            auto handle = table.Acquire(ids.back());
+            ASSERT_NE(handle, kInvalidInstanceHandle);
+            auto handler = FakeObject<IKRRenderNativeContextHandler>(std::make_shared<int>(0));
+            auto view = FakeObject<KRRenderView>(std::make_shared<int>(0));
+            table.SetContextHandler(handle, handler);
+            table.SetRenderView(handle, view);
+            legacy.Register(ids.back(), handler, view);
+        }
+
+        // burst 64：一次批量刷新内的调用来自同一实例；burst 1：多个实例交错调用
+        for (size_t burst : {64u, 1u}) {
+            auto stream = MakeCallStream(ids, kCalls, burst);
+            for (int threads : {1, 4}) {
+                double legacy_ns = RunNsPerCall(stream, threads, [&legacy](const char *arg0) {
+                    return legacy.Lookup(arg0);
+                });
+                double handle_ns = RunNsPerCall(stream, threads, HandleLookup);
+                printf("%zu instances, burst %zu, %d threads: string maps %.1f ns/call, handle table %.1f ns/call\n",
+                       instance_count, burst, threads, legacy_ns, handle_ns);
+            }
+        }
+
+        for (auto &id : ids) {
+            table.Release(id);
+        }
+    }
+}
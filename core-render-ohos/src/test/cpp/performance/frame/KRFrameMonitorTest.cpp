@@ -0,0 +1,125 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/performance/frame/KRFrameMonitor.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include "thirdparty/cJSON/cJSON.h"
+
+namespace {
+
+/**
+ * 手动推进的时钟，单位微秒
+ */
+class KRFrameMonitorTest : public testing::Test {
+ protected:
+    KRFrameMonitor monitor_{[this] { return now_us_; }};
+    int64_t now_us_ = 1000000;
+
+    void RunFrame(int64_t cost_us) {
+        monitor_.OnUITasksWillPerform();
+        now_us_ += cost_us;
+        monitor_.OnUITasksDidPerform();
+        now_us_ += 1000;
+    }
+};
+
+}  // namespace
+
+TEST_F(KRFrameMonitorTest, RecordsCostOfEachBatch) {
+    RunFrame(2000);
+    RunFrame(10000);
+    RunFrame(6000);
+    auto data = monitor_.GetFrameData();
+    EXPECT_EQ(data.FrameCount(), 3);
+    EXPECT_EQ(data.TotalCostUs(), 18000);
+    EXPECT_EQ(data.MaxCostUs(), 10000);
+    EXPECT_EQ(data.JankyFrameCount(), 0);
+    EXPECT_EQ(data.DroppedFrameCount(), 0);
+}
+
+TEST_F(KRFrameMonitorTest, CountsJankyAndDroppedFrames) {
+    RunFrame(KRFrameMonitor::kDefaultFrameIntervalUs);  // 恰好一个刷新间隔，不算卡顿
+    RunFrame(KRFrameMonitor::kDefaultFrameIntervalUs + 1);
+    RunFrame(40000);
+    auto data = monitor_.GetFrameData();
+    EXPECT_EQ(data.JankyFrameCount(), 2);
+    // 16668us 错过 1 次刷新，40000us 错过 2 次
+    EXPECT_EQ(data.DroppedFrameCount(), 3);
+}
+
+TEST_F(KRFrameMonitorTest, HistogramBucketsAreInclusiveUpperBounds) {
+    RunFrame(0);
+    RunFrame(4000);
+    RunFrame(4001);
+    RunFrame(16000);
+    RunFrame(100000);
+    RunFrame(100001);
+    auto data = monitor_.GetFrameData();
+    EXPECT_EQ(data.HistogramCount(0), 2);  // <= 4ms
+    EXPECT_EQ(data.HistogramCount(1), 1);  // <= 8ms
+    EXPECT_EQ(data.HistogramCount(2), 1);  // <= 16ms
+    EXPECT_EQ(data.HistogramCount(5), 1);  // <= 100ms
+    EXPECT_EQ(data.HistogramCount(KRFrameData::kHistogramBucketCount - 1), 1);
+}
+
+TEST_F(KRFrameMonitorTest, NestedBatchesCountOnce) {
+    monitor_.OnUITasksWillPerform();
+    now_us_ += 1000;
+    monitor_.OnUITasksWillPerform();
+    now_us_ += 2000;
+    monitor_.OnUITasksDidPerform();
+    now_us_ += 3000;
+    monitor_.OnUITasksDidPerform();
+    // 多余的结束回调被忽略
+    monitor_.OnUITasksDidPerform();
+    auto data = monitor_.GetFrameData();
+    EXPECT_EQ(data.FrameCount(), 1);
+    EXPECT_EQ(data.TotalCostUs(), 6000);
+}
+
+TEST_F(KRFrameMonitorTest, IgnoresFramesWhilePaused) {
+    RunFrame(1000);
+    monitor_.OnPause();
+    RunFrame(50000);
+    monitor_.OnResume();
+    RunFrame(3000);
+    auto data = monitor_.GetFrameData();
+    EXPECT_EQ(data.FrameCount(), 2);
+    EXPECT_EQ(data.MaxCostUs(), 3000);
+}
+
+TEST_F(KRFrameMonitorTest, ReportsJSONInMilliseconds) {
+    RunFrame(2000);
+    RunFrame(40000);
+    cJSON *json = cJSON_Parse(monitor_.GetMonitorData().c_str());
+    ASSERT_NE(json, nullptr);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "frameCount")->valuedouble, 2);
+    EXPECT_DOUBLE_EQ(cJSON_GetObjectItem(json, "totalCost")->valuedouble, 42);
+    EXPECT_DOUBLE_EQ(cJSON_GetObjectItem(json, "avgCost")->valuedouble, 21);
+    EXPECT_DOUBLE_EQ(cJSON_GetObjectItem(json, "maxCost")->valuedouble, 40);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "jankyFrameCount")->valuedouble, 1);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "droppedFrameCount")->valuedouble, 2);
+    cJSON *histogram = cJSON_GetObjectItem(json, "histogram");
+    ASSERT_EQ(cJSON_GetArraySize(histogram), KRFrameData::kHistogramBucketCount);
+    EXPECT_EQ(cJSON_GetObjectItem(cJSON_GetArrayItem(histogram, 0), "le")->valuedouble, 4);
+    EXPECT_EQ(cJSON_GetObjectItem(cJSON_GetArrayItem(histogram, 0), "count")->valuedouble, 1);
+    EXPECT_EQ(cJSON_GetObjectItem(cJSON_GetArrayItem(histogram, 4), "count")->valuedouble, 1);
+    EXPECT_EQ(cJSON_GetObjectItem(cJSON_GetArrayItem(histogram, KRFrameData::kHistogramBucketCount - 1), "le")
+                  ->valuedouble,
+              -1);
+    cJSON_Delete(json);
+}
@@ -0,0 +1,205 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/performance/memory/KRMemoryMonitor.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "libohos_render/expand/modules/cache/KRMemoryCacheModule.h"
+#include "thirdparty/cJSON/cJSON.h"
+
+namespace {
+
+KRMemoryCacheModule::Stats g_cache_stats;
+
+}  // namespace
+
+// KRMemoryCacheModule 依赖图片解码等平台实现，宿主机上只提供内存监控用到的统计
+KRMemoryCacheModule::Stats KRMemoryCacheModule::GetAllStats() {
+    return g_cache_stats;
+}
+
+namespace {
+
+template <typename Predicate> bool WaitFor(Predicate predicate) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/**
+ * 注入的采样源与时钟：每次采样 rss 递增，可阻塞采样以模拟子线程中尚未完成的采样
+ */
+class KRMemoryMonitorTest : public testing::Test {
+ protected:
+    void SetUp() override {
+        monitor_ = std::make_shared<KRMemoryMonitor>(
+            [this] {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cond_.wait(lock, [this] { return !blocked_; });
+                KRMemorySample sample;
+                sample.rss_kb = 1000 + 100 * samples_++;
+                sample.image_cache_bytes = 4096;
+                return sample;
+            },
+            [this] { return now_us_.load(); }, kIntervalUs);
+    }
+
+    void TearDown() override {
+        SetBlocked(false);
+        WaitIdle();
+    }
+
+    void SetBlocked(bool blocked) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocked_ = blocked;
+        cond_.notify_all();
+    }
+
+    int64_t SampleCount() {
+        return monitor_->GetMemoryData().SampleCount();
+    }
+
+    // 等待子线程中的采样全部完成，先给已派发的采样任务留出开始执行的时间
+    void WaitIdle() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        WaitFor([this] {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return SampleCount() == samples_;
+        });
+    }
+
+    static constexpr int64_t kIntervalUs = 5000000;
+    std::shared_ptr<KRMemoryMonitor> monitor_;
+    std::atomic<int64_t> now_us_{1000000};
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool blocked_ = false;
+    int samples_ = 0;
+};
+
+}  // namespace
+
+TEST_F(KRMemoryMonitorTest, SampleAggregatesFirstLastPeakAndAverage) {
+    monitor_->Sample();
+    monitor_->Sample();
+    monitor_->Sample();
+    auto data = monitor_->GetMemoryData();
+    EXPECT_EQ(data.SampleCount(), 3);
+    EXPECT_EQ(data.FirstSample().rss_kb, 1000);
+    EXPECT_EQ(data.LastSample().rss_kb, 1200);
+    EXPECT_EQ(data.PeakSample().rss_kb, 1200);
+    EXPECT_EQ(data.AvgRssKb(), 1100);
+    EXPECT_EQ(data.PeakSample().image_cache_bytes, 4096);
+    // 未采到的项保持 -1
+    EXPECT_EQ(data.PeakSample().pss_kb, -1);
+}
+
+TEST_F(KRMemoryMonitorTest, MissingRssIsExcludedFromAverage) {
+    KRMemoryData data;
+    KRMemorySample sample;
+    sample.rss_kb = 200;
+    data.AddSample(sample);
+    data.AddSample(KRMemorySample());
+    EXPECT_EQ(data.SampleCount(), 2);
+    EXPECT_EQ(data.AvgRssKb(), 200);
+    EXPECT_EQ(data.PeakSample().rss_kb, 200);
+    EXPECT_EQ(KRMemoryData().AvgRssKb(), -1);
+}
+
+TEST_F(KRMemoryMonitorTest, LifecycleEventsSampleOnWorkerThread) {
+    monitor_->OnKRRenderViewInit();
+    ASSERT_TRUE(WaitFor([this] { return SampleCount() == 1; }));
+    monitor_->OnFirstFramePaint();
+    ASSERT_TRUE(WaitFor([this] { return SampleCount() == 2; }));
+    monitor_->OnResume();
+    ASSERT_TRUE(WaitFor([this] { return SampleCount() == 3; }));
+}
+
+TEST_F(KRMemoryMonitorTest, UITaskSamplingIsThrottledByInterval) {
+    monitor_->OnUITasksDidPerform();
+    ASSERT_TRUE(WaitFor([this] { return SampleCount() == 1; }));
+
+    now_us_ += kIntervalUs - 1;
+    monitor_->OnUITasksDidPerform();
+    now_us_ += 1;
+    WaitIdle();
+    EXPECT_EQ(SampleCount(), 1);
+
+    monitor_->OnUITasksDidPerform();
+    EXPECT_TRUE(WaitFor([this] { return SampleCount() == 2; }));
+}
+
+TEST_F(KRMemoryMonitorTest, NoUITaskSamplingWhilePaused) {
+    monitor_->OnPause();
+    now_us_ += kIntervalUs * 2;
+    monitor_->OnUITasksDidPerform();
+    WaitIdle();
+    EXPECT_EQ(SampleCount(), 0);
+    monitor_->OnResume();
+    EXPECT_TRUE(WaitFor([this] { return SampleCount() == 1; }));
+}
+
+TEST_F(KRMemoryMonitorTest, RequestsWhileSamplingAreCoalesced) {
+    SetBlocked(true);
+    monitor_->OnKRRenderViewInit();
+    monitor_->OnFirstFramePaint();
+    monitor_->OnResume();
+    SetBlocked(false);
+    ASSERT_TRUE(WaitFor([this] { return SampleCount() == 1; }));
+    WaitIdle();
+    EXPECT_EQ(SampleCount(), 1);
+}
+
+TEST_F(KRMemoryMonitorTest, ReportsJSON) {
+    monitor_->Sample();
+    monitor_->Sample();
+    cJSON *json = cJSON_Parse(monitor_->GetMonitorData().c_str());
+    ASSERT_NE(json, nullptr);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "sampleCount")->valuedouble, 2);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "rssInit")->valuedouble, 1000);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "rssLast")->valuedouble, 1100);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "rssPeak")->valuedouble, 1100);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "rssAvg")->valuedouble, 1050);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "pssLast")->valuedouble, -1);
+    EXPECT_EQ(cJSON_GetObjectItem(json, "imageCacheBytes")->valuedouble, 4096);
+    cJSON_Delete(json);
+}
+
+TEST(KRMemoryMonitorDefaultSamplerTest, ReadsProcAndCacheStats) {
+    g_cache_stats = KRMemoryCacheModule::Stats();
+    g_cache_stats.image.cost = 1 << 20;
+    g_cache_stats.image.count = 3;
+    g_cache_stats.object.count = 7;
+    auto sample = KRMemoryMonitor::DefaultSampler();
+    g_cache_stats = KRMemoryCacheModule::Stats();
+    EXPECT_GT(sample.rss_kb, 0);
+    EXPECT_EQ(sample.image_cache_bytes, 1 << 20);
+    EXPECT_EQ(sample.image_cache_count, 3);
+    EXPECT_EQ(sample.object_cache_count, 7);
+    EXPECT_GE(sample.text_measure_cache_count, 0);
+    EXPECT_GE(sample.text_measure_cache_hit_count, 0);
+    EXPECT_GE(sample.text_measure_cache_miss_count, 0);
+}
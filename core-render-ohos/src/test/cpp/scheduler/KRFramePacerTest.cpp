@@ -0,0 +1,163 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/scheduler/KRFramePacer.h"
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace {
+
+constexpr int64_t kInterval = 16000000;
+
+/**
+ * 手动推进的假时钟，PostDelayed 的任务在推进到对应时间时执行
+ */
+class FakeFrameClock : public IKRFrameClock {
+ public:
+    int64_t NowNanos() override {
+        return now;
+    }
+    int64_t FrameIntervalNanos() override {
+        return interval;
+    }
+    int64_t FrameOriginNanos() override {
+        return origin;
+    }
+    void PostDelayed(int64_t delay_nanos, const std::function<void()> &task) override {
+        delays.push_back(delay_nanos);
+        tasks.emplace(now + delay_nanos, task);
+    }
+
+    void AdvanceTo(int64_t time) {
+        while (!tasks.empty() && tasks.begin()->first <= time) {
+            auto it = tasks.begin();
+            now = std::max(now, it->first);
+            auto task = it->second;
+            tasks.erase(it);
+            task();
+        }
+        now = time;
+    }
+
+    int64_t now = 0;
+    int64_t interval = kInterval;
+    int64_t origin = 0;
+    std::multimap<int64_t, std::function<void()>> tasks;
+    std::vector<int64_t> delays;
+};
+
+class KRFramePacerTest : public testing::Test {
+ protected:
+    void SetUp() override {
+        clock = std::make_shared<FakeFrameClock>();
+        pacer = std::make_shared<KRFramePacer>(clock);
+        flush = [this] {
+            pacer->DidFlush();
+            flush_times.push_back(clock->now);
+        };
+    }
+
+    std::shared_ptr<FakeFrameClock> clock;
+    std::shared_ptr<KRFramePacer> pacer;
+    std::function<void()> flush;
+    std::vector<int64_t> flush_times;
+};
+
+}  // namespace
+
+TEST_F(KRFramePacerTest, FirstRequestInFrameRunsOnNextLoop) {
+    clock->now = 1000;
+    pacer->RequestFlush(flush);
+    pacer->RequestFlush(flush);
+    clock->AdvanceTo(1000);
+    EXPECT_EQ(flush_times, std::vector<int64_t>{1000});
+    EXPECT_EQ(clock->delays, std::vector<int64_t>{0});
+    EXPECT_EQ(pacer->GetStats().coalesced_count, 1u);
+}
+
+TEST_F(KRFramePacerTest, SecondRequestInFrameWaitsForNextFrame) {
+    clock->now = 1000;
+    pacer->RequestFlush(flush);
+    clock->AdvanceTo(2000000);
+    pacer->RequestFlush(flush);
+    pacer->RequestFlush(flush);
+    clock->AdvanceTo(kInterval - 1);
+    EXPECT_EQ(flush_times.size(), 1u);
+    clock->AdvanceTo(kInterval);
+    EXPECT_EQ(flush_times, (std::vector<int64_t>{1000, kInterval}));
+
+    auto stats = pacer->GetStats();
+    EXPECT_EQ(stats.flush_count, 2u);
+    EXPECT_EQ(stats.coalesced_count, 1u);
+    EXPECT_EQ(stats.deferred_count, 1u);
+}
+
+TEST_F(KRFramePacerTest, ImmediateFlushCountsTowardCurrentFrame) {
+    clock->now = 33000000;
+    flush();  // 绕过节拍的同步刷新
+    pacer->RequestFlush(flush);
+    clock->AdvanceTo(3 * kInterval - 1);
+    EXPECT_EQ(flush_times.size(), 1u);
+    clock->AdvanceTo(3 * kInterval);
+    EXPECT_EQ(flush_times.size(), 2u);
+}
+
+TEST_F(KRFramePacerTest, FrameGridFollowsClockOrigin) {
+    // vsync 时间戳不在 0 的整数倍上时，帧边界随之平移
+    clock->origin = 5000000;
+    clock->now = 6000000;
+    flush();
+    pacer->RequestFlush(flush);
+    EXPECT_EQ(clock->delays.back(), 5000000 + kInterval - 6000000);
+    EXPECT_EQ(pacer->NanosToNextFrame(), 5000000 + kInterval - 6000000);
+
+    // 原点晚于当前时间时同样向下取整
+    clock->origin = 5000000 + kInterval * 10;
+    EXPECT_EQ(pacer->NanosToNextFrame(), 5000000 + kInterval - 6000000);
+}
+
+TEST_F(KRFramePacerTest, DeadlineUsesBudgetRatio) {
+    EXPECT_EQ(pacer->DeadlineFrom(100), 100 + kInterval / 2);
+    pacer->SetBudgetRatio(0.25f);
+    EXPECT_EQ(pacer->DeadlineFrom(100), 100 + kInterval / 4);
+    clock->now = 50000000;
+    EXPECT_EQ(pacer->NanosToNextFrame(), 4 * kInterval - 50000000);
+}
+
+TEST_F(KRFramePacerTest, NoFrameSourceDisablesPacing) {
+    clock->interval = 0;
+    clock->now = 1000;
+    pacer->RequestFlush(flush);
+    clock->AdvanceTo(1000);
+    pacer->RequestFlush(flush);
+    clock->AdvanceTo(1000);
+    // 同一时刻的第二次请求也不推迟，主线程不设截止时间
+    EXPECT_EQ(flush_times, (std::vector<int64_t>{1000, 1000}));
+    EXPECT_EQ(clock->delays, (std::vector<int64_t>{0, 0}));
+    EXPECT_EQ(pacer->GetStats().deferred_count, 0u);
+    EXPECT_EQ(pacer->DeadlineFrom(1000), std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(pacer->NanosToNextFrame(), 0);
+}
+
+TEST_F(KRFramePacerTest, DestroyedPacerDropsPendingFlush) {
+    clock->now = 1000;
+    pacer->RequestFlush(flush);
+    pacer.reset();
+    clock->AdvanceTo(kInterval * 2);
+    EXPECT_TRUE(flush_times.empty());
+}
@@ -0,0 +1,394 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/scheduler/KRRenderCommandBuffer.h"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "utils/KRAllocationCounter.h"
+
+namespace {
+
+/**
+ * 记录 Execute 回放的命令，以字符串形式便于比较
+ */
+class RecordingLayer {
+ public:
+    void CreateRenderView(int tag, const std::string &view_name) {
+        log.push_back("create " + std::to_string(tag) + " " + view_name);
+    }
+    void RemoveRenderView(int tag) {
+        log.push_back("remove " + std::to_string(tag));
+    }
+    void InsertSubRenderView(int parent_tag, int child_tag, int index) {
+        log.push_back("insert " + std::to_string(parent_tag) + " " + std::to_string(child_tag) + " " +
+                      std::to_string(index));
+    }
+    void SetProp(int tag, int32_t prop_id, const std::string &prop_key, const KRAnyValue &) {
+        log.push_back("prop " + std::to_string(tag) + " " + std::to_string(prop_id) + " " + prop_key);
+    }
+    void CallViewMethod(int tag, const std::string &method, const KRAnyValue &, const KRRenderCallback &) {
+        log.push_back("view " + std::to_string(tag) + " " + method);
+    }
+    void CallModuleMethod(bool, const std::string &module_name, const std::string &method, const KRAnyValue &,
+                          const KRRenderCallback &, bool) {
+        log.push_back("module " + module_name + " " + method);
+    }
+
+    std::vector<std::string> log;
+};
+
+}  // namespace
+
+TEST(KRRenderCommandBufferTest, SetPropCarriesRecordedPropId) {
+    auto custom_id = KRPropKeys::Register("commandBufferTestProp");
+    KRRenderCommandBuffer buffer;
+    buffer.SetProp(1, KRPropKeys::IdOf("opacity"), "opacity", std::make_shared<KRRenderValue>(0.5));
+    buffer.SetProp(1, custom_id, "commandBufferTestProp", std::make_shared<KRRenderValue>(1));
+    buffer.SetFrame(1, KRRect(0, 0, 10, 10));
+
+    RecordingLayer layer;
+    buffer.Execute(&layer);
+    std::vector<std::string> expected = {
+        "prop 1 " + std::to_string(kPropKeyOpacity) + " opacity",
+        "prop 1 " + std::to_string(custom_id) + " commandBufferTestProp",
+        "prop 1 " + std::to_string(kPropKeyFrame) + " frame",
+    };
+    EXPECT_EQ(layer.log, expected);
+}
+
+TEST(KRRenderCommandBufferTest, ExecuteMatchesPerTaskOrder) {
+    // 改为命令缓冲区前，每个 UI 操作都是一个直接调用渲染层的闭包，按提交顺序执行
+    RecordingLayer expected_layer;
+    auto *expected = &expected_layer;
+    std::vector<KRSchedulerTask> per_task = {
+        [expected] { expected->CreateRenderView(1, "KRView"); },
+        [expected] { expected->CreateRenderView(2, "KRTextView"); },
+        [expected] { expected->log.push_back("task a"); },
+        [expected] { expected->InsertSubRenderView(1, 2, 0); },
+        [expected] { expected->SetProp(2, kPropKeyOpacity, "opacity", nullptr); },
+        [expected] { expected->SetProp(2, kPropKeyFrame, "frame", nullptr); },
+        [expected] { expected->CallViewMethod(2, "focus", nullptr, nullptr); },
+        [expected] { expected->log.push_back("task b"); },
+        [expected] { expected->CallModuleMethod(false, "KRMemoryCacheModule", "setObject", nullptr, nullptr, false); },
+        [expected] { expected->RemoveRenderView(2); },
+    };
+    for (auto &task : per_task) {
+        task();
+    }
+
+    RecordingLayer layer;
+    KRRenderCommandBuffer buffer;
+    buffer.CreateView(1, "KRView");
+    buffer.CreateView(2, "KRTextView");
+    buffer.AddTask([&layer] { layer.log.push_back("task a"); });
+    buffer.InsertSubView(1, 2, 0);
+    buffer.SetProp(2, kPropKeyOpacity, "opacity", std::make_shared<KRRenderValue>(1.0));
+    buffer.SetFrame(2, KRRect(0, 0, 10, 10));
+    buffer.CallViewMethod(2, "focus", nullptr, nullptr);
+    buffer.AddTask([&layer] { layer.log.push_back("task b"); });
+    buffer.CallModuleMethod("KRMemoryCacheModule", "setObject", nullptr, nullptr, false);
+    buffer.RemoveView(2);
+    EXPECT_EQ(buffer.GetCommandCount(), per_task.size());
+
+    buffer.Execute(&layer);
+    EXPECT_EQ(layer.log, expected_layer.log);
+}
+
+TEST(KRRenderCommandBufferTest, ExecuteWithoutLayerRunsOnlyTasks) {
+    std::vector<std::string> log;
+    KRRenderCommandBuffer buffer;
+    buffer.CreateView(1, "KRView");
+    buffer.AddTask([&log] { log.push_back("task"); });
+    buffer.RemoveView(1);
+    buffer.Execute<RecordingLayer>(nullptr);
+    EXPECT_EQ(log, std::vector<std::string>{"task"});
+}
+
+TEST(KRRenderCommandBufferTest, SwapperRecyclesExecutedBuffer) {
+    KRRenderCommandBufferSwapper swapper;
+    EXPECT_EQ(swapper.TakePending(), nullptr);
+
+    swapper.Pending().CreateView(1, "KRView");
+    auto first = swapper.TakePending();
+    ASSERT_NE(first, nullptr);
+    auto *first_ptr = first.get();
+    // 上一批尚未交还时换上新缓冲区，两批互不影响
+    EXPECT_NE(&swapper.Pending(), first_ptr);
+    EXPECT_TRUE(swapper.Pending().IsEmpty());
+
+    swapper.Pending().CreateView(2, "KRView");
+    auto second = swapper.TakePending();
+    ASSERT_NE(second, nullptr);
+
+    RecordingLayer layer;
+    first->Execute(&layer);
+    second->Execute(&layer);
+    std::vector<std::string> expected = {"create 1 KRView", "create 2 KRView"};
+    EXPECT_EQ(layer.log, expected);
+    swapper.Recycle(std::move(first));
+    swapper.Recycle(std::move(second));  // 已有备用，直接释放
+
+    swapper.Pending().RemoveView(2);
+    auto third = swapper.TakePending();
+    // 备用缓冲区在下一次取走时换入
+    EXPECT_EQ(&swapper.Pending(), first_ptr);
+    EXPECT_TRUE(swapper.Pending().IsEmpty());
+
+    swapper.Pending().RemoveView(1);
+    auto fourth = swapper.TakePending();
+    ASSERT_EQ(fourth.get(), first_ptr);
+    // 复用的缓冲区只回放新录制的命令
+    layer.log.clear();
+    third->Execute(&layer);
+    fourth->Execute(&layer);
+    expected = {"remove 2", "remove 1"};
+    EXPECT_EQ(layer.log, expected);
+}
+
+namespace {
+
+/**
+ * 只累加参数的渲染层，避免回放耗时被渲染层自身淹没
+ */
+class CountingLayer {
+ public:
+    void CreateRenderView(int tag, const std::string &view_name) {
+        checksum += tag + view_name.size();
+    }
+    void RemoveRenderView(int tag) {
+        checksum += tag;
+    }
+    void InsertSubRenderView(int parent_tag, int child_tag, int index) {
+        checksum += parent_tag + child_tag + index;
+    }
+    void SetProp(int tag, int32_t prop_id, const std::string &prop_key, const KRAnyValue &prop_value) {
+        checksum += tag + prop_id + prop_key.size();
+        if (prop_id == kPropKeyFrame) {
+            // 命令缓冲区把 frame 按 KRRect 的字节下发
+            KRRect frame;
+            memcpy(&frame, prop_value->toString().data(), sizeof(KRRect));
+            checksum += static_cast<size_t>(frame.y + frame.width);
+        } else if (prop_value && prop_value->isString()) {
+            checksum += prop_value->toString().size();
+        }
+    }
+    // 改造前 setRenderViewFrame 单独调用
+    void SetRenderViewFrame(int tag, const KRRect &frame) {
+        checksum += tag + kPropKeyFrame + strlen("frame") + static_cast<size_t>(frame.y + frame.width);
+    }
+    void CallViewMethod(int tag, const std::string &method, const KRAnyValue &, const KRRenderCallback &) {
+        checksum += tag + method.size();
+    }
+    void CallModuleMethod(bool, const std::string &module_name, const std::string &method, const KRAnyValue &,
+                          const KRRenderCallback &, bool) {
+        checksum += module_name.size() + method.size();
+    }
+
+    size_t checksum = 0;
+};
+
+/**
+ * 录制的 callNative 流（Kotlin 侧已解码为 KRRenderValue）：列表首屏创建 item 并设置属性与 frame
+ */
+// KuiklyRenderNativeMethod 中首屏用到的异步方法，取值相同
+enum class NativeMethod {
+    kCreateRenderView = 1,
+    kInsertSubRenderView = 3,
+    kSetViewProp = 4,
+    kSetRenderViewFrame = 5,
+};
+
+struct RecordedNativeCall {
+    NativeMethod method;
+    KRAnyValue args[5];
+};
+
+std::vector<RecordedNativeCall> RecordFirstScreen(int item_count) {
+    using Method = NativeMethod;
+    auto value = [](auto v) { return std::make_shared<KRRenderValue>(v); };
+    auto null_value = std::make_shared<KRRenderValue>();
+    std::vector<RecordedNativeCall> calls;
+    for (int tag = 1; tag <= item_count; ++tag) {
+        calls.push_back({Method::kCreateRenderView,
+                         {value(tag), value(tag % 3 ? "KRView" : "KRRichTextView"), null_value, null_value,
+                          null_value}});
+        calls.push_back({Method::kSetViewProp,
+                         {value(tag), value("backgroundColor"), value("rgba(255,255,255,1.0)"), value(0), null_value}});
+        calls.push_back({Method::kSetViewProp,
+                         {value(tag), value("borderRadius"), value("8.0,8.0,8.0,8.0"), value(0), null_value}});
+        calls.push_back({Method::kSetViewProp,
+                         {value(tag), value("opacity"), value(1.0f), value(0), null_value}});
+        calls.push_back({Method::kSetRenderViewFrame,
+                         {value(tag), value(0.0f), value(tag * 88.0f), value(375.0f), value(88.0f)}});
+        calls.push_back({Method::kInsertSubRenderView,
+                         {value(0), value(tag), value(tag - 1), null_value, null_value}});
+    }
+    return calls;
+}
+
+/**
+ * 改造前 KRRenderCore::PerformNativeCallback 中异步方法的分发
+ */
+void PerformNativeCallback(CountingLayer *layer, NativeMethod method, const KRAnyValue &arg1,
+                           const KRAnyValue &arg2, const KRAnyValue &arg3, const KRAnyValue &arg4,
+                           const KRAnyValue &arg5) {
+    switch (method) {
+    case NativeMethod::kCreateRenderView:
+        layer->CreateRenderView(arg1->toInt(), arg2->toString());
+        break;
+    case NativeMethod::kInsertSubRenderView:
+        layer->InsertSubRenderView(arg1->toInt(), arg2->toInt(), arg3->toInt());
+        break;
+    case NativeMethod::kSetViewProp:
+        layer->SetProp(arg1->toInt(), KRPropKeys::IdOf(arg2->toString()), arg2->toString(), arg3);
+        break;
+    case NativeMethod::kSetRenderViewFrame:
+        layer->SetRenderViewFrame(arg1->toInt(), KRRect(arg2->toFloat(), arg3->toFloat(), arg4->toFloat(),
+                                                        arg5->toFloat()));
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * 当前 KRRenderCore 的录制方式
+ */
+void RecordCommand(KRRenderCommandBuffer &buffer, const RecordedNativeCall &call) {
+    auto &args = call.args;
+    switch (call.method) {
+    case NativeMethod::kCreateRenderView:
+        buffer.CreateView(args[0]->toInt(), args[1]->toString());
+        break;
+    case NativeMethod::kInsertSubRenderView:
+        buffer.InsertSubView(args[0]->toInt(), args[1]->toInt(), args[2]->toInt());
+        break;
+    case NativeMethod::kSetViewProp:
+        buffer.SetProp(args[0]->toInt(), KRPropKeys::IdOf(args[1]->toString()), args[1]->toString(), args[2]);
+        break;
+    case NativeMethod::kSetRenderViewFrame:
+        buffer.SetFrame(args[0]->toInt(),
+                        KRRect(args[1]->toFloat(), args[2]->toFloat(), args[3]->toFloat(), args[4]->toFloat()));
+        break;
+    default:
+        break;
+    }
+}
+
+double NsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+TEST(KRRenderCommandBufferTest, ReplayMatchesPerTaskDispatch) {
+    auto calls = RecordFirstScreen(20);
+    CountingLayer expected;
+    for (auto &call : calls) {
+        PerformNativeCallback(&expected, call.method, call.args[0], call.args[1], call.args[2], call.args[3],
+                              call.args[4]);
+    }
+
+    KRRenderCommandBuffer buffer;
+    for (auto &call : calls) {
+        RecordCommand(buffer, call);
+    }
+    EXPECT_EQ(buffer.GetCommandCount(), calls.size());
+    CountingLayer layer;
+    buffer.Execute(&layer);
+    EXPECT_EQ(layer.checksum, expected.checksum);
+}
+
+TEST(KRRenderCommandBufferBenchmark, ReplayVersusPerTaskClosures) {
+    auto calls = RecordFirstScreen(100);
+    constexpr int kBatches = 500;
+    size_t commands = calls.size() * kBatches;
+    auto owner = std::make_shared<int>(0);
+
+    // 改造前：每个调用包成一个闭包进主线程队列，主线程逐个执行
+    double closure_record_ns = 0;
+    double closure_execute_ns = 0;
+    size_t closure_allocations = 0;
+    size_t closure_checksum = 0;
+    std::vector<std::function<void()>> queue;
+    for (int batch = 0; batch < kBatches; ++batch) {
+        CountingLayer layer;
+        KRAllocationCounter counter;
+        auto start = std::chrono::steady_clock::now();
+        std::weak_ptr<int> weak_self = owner;
+        for (auto &call : calls) {
+            auto method = call.method;
+            auto arg1 = call.args[0];
+            auto arg2 = call.args[1];
+            auto arg3 = call.args[2];
+            auto arg4 = call.args[3];
+            auto arg5 = call.args[4];
+            queue.emplace_back([weak_self, method, arg1, arg2, arg3, arg4, arg5, &layer] {
+                if (auto locked = weak_self.lock()) {
+                    PerformNativeCallback(&layer, method, arg1, arg2, arg3, arg4, arg5);
+                }
+            });
+        }
+        auto batch_queue = std::move(queue);
+        closure_record_ns += NsSince(start);
+        start = std::chrono::steady_clock::now();
+        for (auto &task : batch_queue) {
+            task();
+        }
+        batch_queue.clear();
+        closure_execute_ns += NsSince(start);
+        closure_allocations += counter.Count();
+        closure_checksum += layer.checksum;
+    }
+
+    // 命令缓冲区：context 线程录制，整批移交主线程执行后交还
+    double buffer_record_ns = 0;
+    double buffer_execute_ns = 0;
+    size_t buffer_allocations = 0;
+    size_t buffer_checksum = 0;
+    KRRenderCommandBufferSwapper swapper;
+    for (int batch = 0; batch < kBatches; ++batch) {
+        CountingLayer layer;
+        KRAllocationCounter counter;
+        auto start = std::chrono::steady_clock::now();
+        for (auto &call : calls) {
+            RecordCommand(swapper.Pending(), call);
+        }
+        auto buffer = swapper.TakePending();
+        buffer_record_ns += NsSince(start);
+        start = std::chrono::steady_clock::now();
+        buffer->Execute(&layer);
+        swapper.Recycle(std::move(buffer));
+        buffer_execute_ns += NsSince(start);
+        if (batch >= 2) {  // 前两批为两块缓冲区扩容
+            buffer_allocations += counter.Count();
+        }
+        buffer_checksum += layer.checksum;
+    }
+
+    EXPECT_EQ(buffer_checksum, closure_checksum);
+    printf("replay %zu commands in batches of %zu: closures record %.1f + execute %.1f ns/cmd %.2f allocs/cmd, "
+           "command buffer record %.1f + execute %.1f ns/cmd %.2f allocs/cmd\n",
+           commands, calls.size(), closure_record_ns / commands, closure_execute_ns / commands,
+           static_cast<double>(closure_allocations) / commands, buffer_record_ns / commands,
+           buffer_execute_ns / commands, static_cast<double>(buffer_allocations) / (commands - 2 * calls.size()));
+}
@@ -0,0 +1,31 @@
+#ifndef KR_HOST_SHIM_JSVM_H
+#define KR_HOST_SHIM_JSVM_H
+
+#include "jsvm_types.h"
+
+extern "C" {
+JSVM_Status OH_JSVM_Typeof(JSVM_Env env, JSVM_Value value, JSVM_ValueType *result);
+JSVM_Status OH_JSVM_GetNull(JSVM_Env env, JSVM_Value *result);
+JSVM_Status OH_JSVM_GetBoolean(JSVM_Env env, bool value, JSVM_Value *result);
+JSVM_Status OH_JSVM_GetValueBool(JSVM_Env env, JSVM_Value value, bool *result);
+JSVM_Status OH_JSVM_GetValueDouble(JSVM_Env env, JSVM_Value value, double *result);
+JSVM_Status OH_JSVM_CreateInt32(JSVM_Env env, int32_t value, JSVM_Value *result);
+JSVM_Status OH_JSVM_CreateInt64(JSVM_Env env, int64_t value, JSVM_Value *result);
+JSVM_Status OH_JSVM_CreateDouble(JSVM_Env env, double value, JSVM_Value *result);
+JSVM_Status OH_JSVM_CreateStringUtf8(JSVM_Env env, const char *str, size_t length, JSVM_Value *result);
+JSVM_Status OH_JSVM_CreateArrayWithLength(JSVM_Env env, size_t length, JSVM_Value *result);
+JSVM_Status OH_JSVM_CreateArraybuffer(JSVM_Env env, size_t byteLength, void **data, JSVM_Value *result);
+JSVM_Status OH_JSVM_CreateTypedarray(JSVM_Env env, JSVM_TypedarrayType type, size_t length, JSVM_Value arraybuffer,
+                                     size_t byteOffset, JSVM_Value *result);
+JSVM_Status OH_JSVM_IsArray(JSVM_Env env, JSVM_Value value, bool *result);
+JSVM_Status OH_JSVM_IsArraybuffer(JSVM_Env env, JSVM_Value value, bool *result);
+JSVM_Status OH_JSVM_IsTypedarray(JSVM_Env env, JSVM_Value value, bool *result);
+JSVM_Status OH_JSVM_GetArrayLength(JSVM_Env env, JSVM_Value arr, uint32_t *result);
+JSVM_Status OH_JSVM_GetElement(JSVM_Env env, JSVM_Value object, uint32_t index, JSVM_Value *result);
+JSVM_Status OH_JSVM_SetElement(JSVM_Env env, JSVM_Value object, uint32_t index, JSVM_Value value);
+JSVM_Status OH_JSVM_GetArraybufferInfo(JSVM_Env env, JSVM_Value arraybuffer, void **data, size_t *byteLength);
+JSVM_Status OH_JSVM_GetTypedarrayInfo(JSVM_Env env, JSVM_Value typedarray, JSVM_TypedarrayType *type, size_t *length,
+                                      void **data, JSVM_Value *arraybuffer, size_t *byteOffset);
+}
+
+#endif  // KR_HOST_SHIM_JSVM_H
@@ -0,0 +1,37 @@
+#ifndef KR_HOST_SHIM_JSVM_TYPES_H
+#define KR_HOST_SHIM_JSVM_TYPES_H
+
+#include <cstddef>
+#include <cstdint>
+
+typedef struct JSVM_Env__ *JSVM_Env;
+typedef struct JSVM_Value__ *JSVM_Value;
+
+typedef enum { JSVM_OK, JSVM_INVALID_ARG, JSVM_GENERIC_FAILURE } JSVM_Status;
+
+typedef enum {
+    JSVM_UNDEFINED,
+    JSVM_NULL,
+    JSVM_BOOLEAN,
+    JSVM_NUMBER,
+    JSVM_STRING,
+    JSVM_SYMBOL,
+    JSVM_OBJECT,
+    JSVM_FUNCTION,
+    JSVM_EXTERNAL,
+    JSVM_BIGINT,
+} JSVM_ValueType;
+
+typedef enum {
+    JSVM_INT8_ARRAY,
+    JSVM_UINT8_ARRAY,
+    JSVM_UINT8_CLAMPED_ARRAY,
+    JSVM_INT16_ARRAY,
+    JSVM_UINT16_ARRAY,
+    JSVM_INT32_ARRAY,
+    JSVM_UINT32_ARRAY,
+    JSVM_FLOAT32_ARRAY,
+    JSVM_FLOAT64_ARRAY,
+} JSVM_TypedarrayType;
+
+#endif  // KR_HOST_SHIM_JSVM_TYPES_H
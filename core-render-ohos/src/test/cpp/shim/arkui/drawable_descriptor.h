@@ -0,0 +1,12 @@
+#ifndef KR_HOST_SHIM_ARKUI_DRAWABLE_DESCRIPTOR_H
+#define KR_HOST_SHIM_ARKUI_DRAWABLE_DESCRIPTOR_H
+
+typedef struct ArkUI_DrawableDescriptor ArkUI_DrawableDescriptor;
+struct OH_PixelmapNative;
+
+extern "C" {
+ArkUI_DrawableDescriptor *OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(struct OH_PixelmapNative *pixelMap);
+void OH_ArkUI_DrawableDescriptor_Dispose(ArkUI_DrawableDescriptor *drawableDescriptor);
+}
+
+#endif  // KR_HOST_SHIM_ARKUI_DRAWABLE_DESCRIPTOR_H
@@ -0,0 +1,57 @@
+#ifndef KR_HOST_SHIM_ARKUI_NATIVE_TYPE_H
+#define KR_HOST_SHIM_ARKUI_NATIVE_TYPE_H
+
+typedef struct ArkUI_Node *ArkUI_NodeHandle;
+typedef struct ArkUI_NodeContent *ArkUI_NodeContentHandle;
+typedef struct ArkUI_Context *ArkUI_ContextHandle;
+
+typedef enum {
+    ARKUI_ENTER_KEY_TYPE_GO = 2,
+    ARKUI_ENTER_KEY_TYPE_SEARCH = 3,
+    ARKUI_ENTER_KEY_TYPE_SEND,
+    ARKUI_ENTER_KEY_TYPE_NEXT,
+    ARKUI_ENTER_KEY_TYPE_DONE,
+    ARKUI_ENTER_KEY_TYPE_PREVIOUS,
+    ARKUI_ENTER_KEY_TYPE_NEW_LINE,
+} ArkUI_EnterKeyType;
+
+typedef enum {
+    ARKUI_TEXTINPUT_TYPE_NORMAL = 0,
+    ARKUI_TEXTINPUT_TYPE_NUMBER = 2,
+    ARKUI_TEXTINPUT_TYPE_PHONE_NUMBER = 3,
+    ARKUI_TEXTINPUT_TYPE_EMAIL = 5,
+    ARKUI_TEXTINPUT_TYPE_PASSWORD = 7,
+} ArkUI_TextInputType;
+
+typedef enum {
+    ARKUI_TEXT_ALIGNMENT_START = 0,
+    ARKUI_TEXT_ALIGNMENT_CENTER,
+    ARKUI_TEXT_ALIGNMENT_END,
+    ARKUI_TEXT_ALIGNMENT_JUSTIFY,
+} ArkUI_TextAlignment;
+
+typedef enum {
+    ARKUI_BORDER_STYLE_SOLID = 0,
+    ARKUI_BORDER_STYLE_DASHED,
+    ARKUI_BORDER_STYLE_DOTTED,
+} ArkUI_BorderStyle;
+
+typedef enum {
+    ARKUI_FONT_WEIGHT_W100 = 0,
+    ARKUI_FONT_WEIGHT_W200,
+    ARKUI_FONT_WEIGHT_W300,
+    ARKUI_FONT_WEIGHT_W400,
+    ARKUI_FONT_WEIGHT_W500,
+    ARKUI_FONT_WEIGHT_W600,
+    ARKUI_FONT_WEIGHT_W700,
+    ARKUI_FONT_WEIGHT_W800,
+    ARKUI_FONT_WEIGHT_W900,
+    ARKUI_FONT_WEIGHT_BOLD,
+    ARKUI_FONT_WEIGHT_NORMAL,
+    ARKUI_FONT_WEIGHT_BOLDER,
+    ARKUI_FONT_WEIGHT_LIGHTER,
+    ARKUI_FONT_WEIGHT_MEDIUM,
+    ARKUI_FONT_WEIGHT_REGULAR,
+} ArkUI_FontWeight;
+
+#endif  // KR_HOST_SHIM_ARKUI_NATIVE_TYPE_H
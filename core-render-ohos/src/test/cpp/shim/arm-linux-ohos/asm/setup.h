@@ -0,0 +1,3 @@
+#ifndef KR_HOST_SHIM_ASM_SETUP_H
+#define KR_HOST_SHIM_ASM_SETUP_H
+#endif  // KR_HOST_SHIM_ASM_SETUP_H
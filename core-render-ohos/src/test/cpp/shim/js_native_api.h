@@ -0,0 +1,32 @@
+#ifndef KR_HOST_SHIM_JS_NATIVE_API_H
+#define KR_HOST_SHIM_JS_NATIVE_API_H
+
+#include "js_native_api_types.h"
+
+extern "C" {
+napi_status napi_call_function(napi_env env, napi_value recv, napi_value func, size_t argc, const napi_value *argv,
+                               napi_value *result);
+napi_status napi_typeof(napi_env env, napi_value value, napi_valuetype *result);
+napi_status napi_get_null(napi_env env, napi_value *result);
+napi_status napi_get_boolean(napi_env env, bool value, napi_value *result);
+napi_status napi_get_value_bool(napi_env env, napi_value value, bool *result);
+napi_status napi_get_value_double(napi_env env, napi_value value, double *result);
+napi_status napi_create_int32(napi_env env, int32_t value, napi_value *result);
+napi_status napi_create_int64(napi_env env, int64_t value, napi_value *result);
+napi_status napi_create_double(napi_env env, double value, napi_value *result);
+napi_status napi_create_string_utf8(napi_env env, const char *str, size_t length, napi_value *result);
+napi_status napi_create_array_with_length(napi_env env, size_t length, napi_value *result);
+napi_status napi_create_arraybuffer(napi_env env, size_t byte_length, void **data, napi_value *result);
+napi_status napi_create_typedarray(napi_env env, napi_typedarray_type type, size_t length, napi_value arraybuffer,
+                                   size_t byte_offset, napi_value *result);
+napi_status napi_is_array(napi_env env, napi_value value, bool *result);
+napi_status napi_is_arraybuffer(napi_env env, napi_value value, bool *result);
+napi_status napi_get_array_length(napi_env env, napi_value value, uint32_t *result);
+napi_status napi_get_element(napi_env env, napi_value object, uint32_t index, napi_value *result);
+napi_status napi_set_element(napi_env env, napi_value object, uint32_t index, napi_value value);
+napi_status napi_get_arraybuffer_info(napi_env env, napi_value arraybuffer, void **data, size_t *byte_length);
+napi_status napi_get_typedarray_info(napi_env env, napi_value typedarray, napi_typedarray_type *type, size_t *length,
+                                     void **data, napi_value *arraybuffer, size_t *byte_offset);
+}
+
+#endif  // KR_HOST_SHIM_JS_NATIVE_API_H
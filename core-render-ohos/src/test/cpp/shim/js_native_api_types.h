@@ -0,0 +1,39 @@
+#ifndef KR_HOST_SHIM_JS_NATIVE_API_TYPES_H
+#define KR_HOST_SHIM_JS_NATIVE_API_TYPES_H
+
+#include <cstddef>
+#include <cstdint>
+
+typedef struct napi_env__ *napi_env;
+typedef struct napi_value__ *napi_value;
+typedef struct napi_ref__ *napi_ref;
+typedef struct napi_callback_info__ *napi_callback_info;
+
+typedef enum { napi_ok, napi_invalid_arg, napi_object_expected, napi_string_expected, napi_generic_failure } napi_status;
+
+typedef enum {
+    napi_undefined,
+    napi_null,
+    napi_boolean,
+    napi_number,
+    napi_string,
+    napi_symbol,
+    napi_object,
+    napi_function,
+    napi_external,
+    napi_bigint,
+} napi_valuetype;
+
+typedef enum {
+    napi_int8_array,
+    napi_uint8_array,
+    napi_uint8_clamped_array,
+    napi_int16_array,
+    napi_uint16_array,
+    napi_int32_array,
+    napi_uint32_array,
+    napi_float32_array,
+    napi_float64_array,
+} napi_typedarray_type;
+
+#endif  // KR_HOST_SHIM_JS_NATIVE_API_TYPES_H
@@ -0,0 +1,12 @@
+#ifndef KR_HOST_SHIM_IMAGE_COMMON_H
+#define KR_HOST_SHIM_IMAGE_COMMON_H
+
+typedef enum {
+    IMAGE_SUCCESS = 0,
+    IMAGE_BAD_PARAMETER = 401,
+    IMAGE_UNSUPPORTED_MIME_TYPE = 7600101,
+    IMAGE_TOO_LARGE = 7600104,
+    IMAGE_DECODE_FAILED = 7700301,
+} Image_ErrorCode;
+
+#endif  // KR_HOST_SHIM_IMAGE_COMMON_H
@@ -0,0 +1,6 @@
+#ifndef KR_HOST_SHIM_IMAGE_RECEIVER_NATIVE_H
+#define KR_HOST_SHIM_IMAGE_RECEIVER_NATIVE_H
+
+#include <multimedia/image_framework/image/image_common.h>
+
+#endif  // KR_HOST_SHIM_IMAGE_RECEIVER_NATIVE_H
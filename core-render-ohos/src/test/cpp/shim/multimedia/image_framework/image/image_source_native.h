@@ -0,0 +1,22 @@
+#ifndef KR_HOST_SHIM_IMAGE_SOURCE_NATIVE_H
+#define KR_HOST_SHIM_IMAGE_SOURCE_NATIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <multimedia/image_framework/image/image_common.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
+
+typedef struct OH_ImageSourceNative OH_ImageSourceNative;
+typedef struct OH_DecodingOptions OH_DecodingOptions;
+
+extern "C" {
+Image_ErrorCode OH_ImageSourceNative_CreateFromData(uint8_t *data, size_t dataSize, OH_ImageSourceNative **res);
+Image_ErrorCode OH_ImageSourceNative_CreatePixelmap(OH_ImageSourceNative *source, OH_DecodingOptions *options,
+                                                    OH_PixelmapNative **pixelmap);
+Image_ErrorCode OH_ImageSourceNative_Release(OH_ImageSourceNative *source);
+Image_ErrorCode OH_DecodingOptions_Create(OH_DecodingOptions **options);
+Image_ErrorCode OH_DecodingOptions_SetPixelFormat(OH_DecodingOptions *options, int32_t pixelFormat);
+Image_ErrorCode OH_DecodingOptions_Release(OH_DecodingOptions *options);
+}
+
+#endif  // KR_HOST_SHIM_IMAGE_SOURCE_NATIVE_H
@@ -0,0 +1,42 @@
+#ifndef KR_HOST_SHIM_PIXELMAP_NATIVE_H
+#define KR_HOST_SHIM_PIXELMAP_NATIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <multimedia/image_framework/image/image_common.h>
+
+typedef struct OH_PixelmapNative OH_PixelmapNative;
+typedef struct OH_Pixelmap_InitializationOptions OH_Pixelmap_InitializationOptions;
+
+typedef enum {
+    PIXEL_FORMAT_UNKNOWN = 0,
+    PIXEL_FORMAT_RGB_565 = 2,
+    PIXEL_FORMAT_RGBA_8888 = 3,
+    PIXEL_FORMAT_BGRA_8888 = 4,
+} PIXEL_FORMAT;
+
+typedef enum {
+    PIXELMAP_ALPHA_TYPE_UNKNOWN = 0,
+    PIXELMAP_ALPHA_TYPE_OPAQUE = 1,
+    PIXELMAP_ALPHA_TYPE_PREMULTIPLIED = 2,
+    PIXELMAP_ALPHA_TYPE_UNPREMULTIPLIED = 3,
+} PIXELMAP_ALPHA_TYPE;
+
+extern "C" {
+Image_ErrorCode OH_PixelmapInitializationOptions_Create(OH_Pixelmap_InitializationOptions **options);
+Image_ErrorCode OH_PixelmapInitializationOptions_SetWidth(OH_Pixelmap_InitializationOptions *options, uint32_t width);
+Image_ErrorCode OH_PixelmapInitializationOptions_SetHeight(OH_Pixelmap_InitializationOptions *options,
+                                                           uint32_t height);
+Image_ErrorCode OH_PixelmapInitializationOptions_SetPixelFormat(OH_Pixelmap_InitializationOptions *options,
+                                                                int32_t pixelFormat);
+Image_ErrorCode OH_PixelmapInitializationOptions_SetAlphaType(OH_Pixelmap_InitializationOptions *options,
+                                                              int32_t alphaType);
+Image_ErrorCode OH_PixelmapInitializationOptions_Release(OH_Pixelmap_InitializationOptions *options);
+Image_ErrorCode OH_PixelmapNative_CreateEmptyPixelmap(OH_Pixelmap_InitializationOptions *options,
+                                                      OH_PixelmapNative **pixelmap);
+Image_ErrorCode OH_PixelmapNative_WritePixels(OH_PixelmapNative *pixelmap, uint8_t *source, size_t bufferSize);
+Image_ErrorCode OH_PixelmapNative_ReadPixels(OH_PixelmapNative *pixelmap, uint8_t *destination, size_t *bufferSize);
+Image_ErrorCode OH_PixelmapNative_Release(OH_PixelmapNative *pixelmap);
+}
+
+#endif  // KR_HOST_SHIM_PIXELMAP_NATIVE_H
@@ -0,0 +1,4 @@
+#ifndef KR_HOST_SHIM_IMAGE_PIXEL_MAP_MDK_H
+#define KR_HOST_SHIM_IMAGE_PIXEL_MAP_MDK_H
+
+#endif  // KR_HOST_SHIM_IMAGE_PIXEL_MAP_MDK_H
@@ -0,0 +1,6 @@
+#ifndef KR_HOST_SHIM_NAPI_NATIVE_API_H
+#define KR_HOST_SHIM_NAPI_NATIVE_API_H
+
+#include "../js_native_api.h"
+
+#endif  // KR_HOST_SHIM_NAPI_NATIVE_API_H
@@ -0,0 +1,6 @@
+#ifndef KR_HOST_SHIM_DRAWING_CANVAS_H
+#define KR_HOST_SHIM_DRAWING_CANVAS_H
+
+typedef struct OH_Drawing_Canvas OH_Drawing_Canvas;
+
+#endif  // KR_HOST_SHIM_DRAWING_CANVAS_H
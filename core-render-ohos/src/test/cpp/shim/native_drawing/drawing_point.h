@@ -0,0 +1,10 @@
+#ifndef KR_HOST_SHIM_DRAWING_POINT_H
+#define KR_HOST_SHIM_DRAWING_POINT_H
+
+#include "drawing_types.h"
+
+extern "C" {
+OH_Drawing_Point *OH_Drawing_PointCreate(float x, float y);
+}
+
+#endif  // KR_HOST_SHIM_DRAWING_POINT_H
@@ -0,0 +1,6 @@
+#ifndef KR_HOST_SHIM_DRAWING_TEXT_DECLARATION_H
+#define KR_HOST_SHIM_DRAWING_TEXT_DECLARATION_H
+
+typedef struct OH_Drawing_Typography OH_Drawing_Typography;
+
+#endif  // KR_HOST_SHIM_DRAWING_TEXT_DECLARATION_H
@@ -0,0 +1,47 @@
+#ifndef KR_HOST_SHIM_DRAWING_TEXT_TYPOGRAPHY_H
+#define KR_HOST_SHIM_DRAWING_TEXT_TYPOGRAPHY_H
+
+#include "drawing_text_declaration.h"
+#include "drawing_types.h"
+
+enum OH_Drawing_TextAlign {
+    TEXT_ALIGN_LEFT,
+    TEXT_ALIGN_RIGHT,
+    TEXT_ALIGN_CENTER,
+    TEXT_ALIGN_JUSTIFY,
+    TEXT_ALIGN_START,
+    TEXT_ALIGN_END,
+};
+
+enum OH_Drawing_TextDecoration {
+    TEXT_DECORATION_NONE = 0x0,
+    TEXT_DECORATION_UNDERLINE = 0x1,
+    TEXT_DECORATION_OVERLINE = 0x2,
+    TEXT_DECORATION_LINE_THROUGH = 0x4,
+};
+
+enum OH_Drawing_FontWeight {
+    FONT_WEIGHT_100,
+    FONT_WEIGHT_200,
+    FONT_WEIGHT_300,
+    FONT_WEIGHT_400,
+    FONT_WEIGHT_500,
+    FONT_WEIGHT_600,
+    FONT_WEIGHT_700,
+    FONT_WEIGHT_800,
+    FONT_WEIGHT_900,
+};
+
+enum OH_Drawing_FontStyle {
+    FONT_STYLE_NORMAL,
+    FONT_STYLE_ITALIC,
+    FONT_STYLE_OBLIQUE,
+};
+
+typedef enum {
+    ELLIPSIS_MODAL_HEAD = 0,
+    ELLIPSIS_MODAL_MIDDLE = 1,
+    ELLIPSIS_MODAL_TAIL = 2,
+} OH_Drawing_EllipsisModal;
+
+#endif  // KR_HOST_SHIM_DRAWING_TEXT_TYPOGRAPHY_H
@@ -0,0 +1,6 @@
+#ifndef KR_HOST_SHIM_DRAWING_TYPES_H
+#define KR_HOST_SHIM_DRAWING_TYPES_H
+
+typedef struct OH_Drawing_Point OH_Drawing_Point;
+
+#endif  // KR_HOST_SHIM_DRAWING_TYPES_H
@@ -0,0 +1,13 @@
+#ifndef KR_HOST_SHIM_NATIVE_VSYNC_NATIVE_VSYNC_H
+#define KR_HOST_SHIM_NATIVE_VSYNC_NATIVE_VSYNC_H
+
+typedef struct OH_NativeVSync OH_NativeVSync;
+typedef void (*OH_NativeVSync_FrameCallback)(long long timestamp, void *data);
+
+extern "C" {
+OH_NativeVSync *OH_NativeVSync_Create(const char *name, unsigned int length);
+int OH_NativeVSync_RequestFrame(OH_NativeVSync *nativeVsync, OH_NativeVSync_FrameCallback callback, void *data);
+int OH_NativeVSync_GetPeriod(OH_NativeVSync *nativeVsync, long long *period);
+}
+
+#endif  // KR_HOST_SHIM_NATIVE_VSYNC_NATIVE_VSYNC_H
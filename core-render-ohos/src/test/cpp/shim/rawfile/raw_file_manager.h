@@ -0,0 +1,6 @@
+#ifndef KR_HOST_SHIM_RAW_FILE_MANAGER_H
+#define KR_HOST_SHIM_RAW_FILE_MANAGER_H
+
+typedef struct NativeResourceManager NativeResourceManager;
+
+#endif  // KR_HOST_SHIM_RAW_FILE_MANAGER_H
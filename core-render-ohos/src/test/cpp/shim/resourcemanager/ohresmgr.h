@@ -0,0 +1,12 @@
+#ifndef KR_HOST_SHIM_OHRESMGR_H
+#define KR_HOST_SHIM_OHRESMGR_H
+
+#include <cstdint>
+#include <arkui/drawable_descriptor.h>
+#include <rawfile/raw_file_manager.h>
+
+extern "C" int OH_ResourceManager_GetDrawableDescriptorByName(const NativeResourceManager *mgr, const char *name,
+                                                              ArkUI_DrawableDescriptor **descriptor,
+                                                              uint32_t density, uint32_t type);
+
+#endif  // KR_HOST_SHIM_OHRESMGR_H
@@ -0,0 +1,42 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_RENDER_OHOS_KRALLOCATIONCOUNTER_H
+#define CORE_RENDER_OHOS_KRALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+/**
+ * 统计当前线程自构造以来经全局 operator new 产生的堆分配次数
+ * 宿主机测试替换了全局 operator new，只计数，不改变分配行为
+ */
+class KRAllocationCounter {
+ public:
+    KRAllocationCounter() : start_(Total()) {}
+
+    size_t Count() const {
+        return Total() - start_;
+    }
+
+    /**
+     * 当前线程累计的分配次数
+     */
+    static size_t Total();
+
+ private:
+    size_t start_;
+};
+
+#endif  // CORE_RENDER_OHOS_KRALLOCATIONCOUNTER_H
@@ -0,0 +1,29 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRLogDispatcher.h"
+
+#include <cstdio>
+
+// 宿主机测试中的全局实例，替代 KRLogDispatcherDefault.cpp，日志直接输出到 stderr
+
+KRLogDispatcher &KRLogDispatcher::GetInstance() {
+    static KRLogDispatcher *instance = new KRLogDispatcher([](std::vector<KRLogRecord> &records) {
+        for (auto &record : records) {
+            fprintf(stderr, "[%s] %s", record.tag.c_str(), record.message.c_str());
+        }
+    });
+    return *instance;
+}
@@ -0,0 +1,202 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRLogDispatcher.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * 收集 sink 收到的日志；打开闸门前阻塞在第一次输出中，用于模拟后台线程忙
+ */
+class RecordingSink {
+ public:
+    explicit RecordingSink(bool gated = false) : gate_open_(!gated) {}
+
+    KRLogDispatcher::Sink AsSink() {
+        return [this](std::vector<KRLogRecord> &records) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            in_sink_ = true;
+            cond_.notify_all();
+            cond_.wait(lock, [this] { return gate_open_; });
+            for (auto &record : records) {
+                records_.push_back(std::move(record));
+            }
+            cond_.notify_all();
+        };
+    }
+
+    void WaitInSink() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this] { return in_sink_; });
+    }
+
+    void OpenGate() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        gate_open_ = true;
+        cond_.notify_all();
+    }
+
+    bool WaitForCount(size_t count) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cond_.wait_for(lock, std::chrono::seconds(5), [this, count] { return records_.size() >= count; });
+    }
+
+    std::vector<KRLogRecord> Records() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return records_;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool gate_open_;
+    bool in_sink_ = false;
+    std::vector<KRLogRecord> records_;
+};
+
+}  // namespace
+
+TEST(KRLogDispatcherTest, KeepsPerThreadOrder) {
+    constexpr int kThreadCount = 4;
+    constexpr int kRecordCount = 20000;
+    RecordingSink sink;
+    KRLogDispatcher dispatcher(sink.AsSink(), 4096);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&dispatcher, t] {
+            for (int i = 0; i < kRecordCount; ++i) {
+                while (!dispatcher.Post(LOG_INFO, "t" + std::to_string(t), std::to_string(i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    dispatcher.Flush();
+
+    std::map<std::string, int> next;
+    size_t delivered = 0;
+    for (auto &record : sink.Records()) {
+        if (record.tag == "KRRenderLog") {
+            continue;  // 丢弃提示
+        }
+        ASSERT_EQ(std::stoi(record.message), next[record.tag]++) << record.tag;
+        ++delivered;
+    }
+    EXPECT_EQ(delivered, static_cast<size_t>(kThreadCount * kRecordCount));
+}
+
+TEST(KRLogDispatcherTest, OverflowDropsAndReportsOnce) {
+    RecordingSink sink(true);
+    KRLogDispatcher dispatcher(sink.AsSink(), 8);
+    dispatcher.Post(LOG_INFO, "a", "warm");
+    sink.WaitInSink();
+
+    int accepted = 0;
+    for (int i = 0; i < 20; ++i) {
+        accepted += dispatcher.Post(LOG_INFO, "a", std::to_string(i));
+    }
+    EXPECT_EQ(accepted, 8);
+    EXPECT_EQ(dispatcher.GetDroppedCount(), 12u);
+
+    sink.OpenGate();
+    dispatcher.Flush();
+    auto records = sink.Records();
+    ASSERT_EQ(records.size(), 1u + 8u + 1u);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(records[1 + i].message, std::to_string(i));
+    }
+    EXPECT_EQ(records.back().level, LOG_ERROR);
+    EXPECT_NE(records.back().message.find("dropped 12"), std::string::npos);
+
+    // 已报告的丢弃不再重复提示
+    dispatcher.Post(LOG_INFO, "a", "after");
+    dispatcher.Flush();
+    records = sink.Records();
+    EXPECT_EQ(records.back().message, "after");
+}
+
+TEST(KRLogDispatcherTest, DeliversRecordsOfExitedThread) {
+    RecordingSink sink;
+    KRLogDispatcher dispatcher(sink.AsSink());
+    std::thread([&dispatcher] {
+        for (int i = 0; i < 100; ++i) {
+            dispatcher.Post(LOG_INFO, "x", std::to_string(i));
+        }
+    }).join();
+    // 不调用 Flush，由后台线程输出
+    EXPECT_TRUE(sink.WaitForCount(100));
+}
+
+/**
+ * 调用线程的开销：同步写入（原有做法）与投递到后台线程
+ */
+TEST(KRLogDispatcherBenchmark, ContextThreadCost) {
+    constexpr int kRecordCount = 100000;
+    constexpr int kBurst = 128;
+    FILE *null_file = fopen("/dev/null", "w");
+    ASSERT_NE(null_file, nullptr);
+    auto write_records = [null_file](std::vector<KRLogRecord> &records) {
+        for (auto &record : records) {
+            fprintf(null_file, "[%s] %s", record.tag.c_str(), record.message.c_str());
+            fflush(null_file);
+        }
+    };
+    using Clock = std::chrono::steady_clock;
+    auto elapsed_ns = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    };
+    auto message = [](int i) { return "view reuse hit: " + std::to_string(i) + "\n"; };
+
+    double sync_ns = 0;
+    std::vector<KRLogRecord> single(1);
+    for (int i = 0; i < kRecordCount; ++i) {
+        auto start = Clock::now();
+        single[0].tag = "KRRender";
+        single[0].message = message(i);
+        write_records(single);
+        sync_ns += elapsed_ns(start);
+    }
+
+    KRLogDispatcher dispatcher(write_records, 1024);
+    double async_ns = 0;
+    for (int i = 0; i < kRecordCount; i += kBurst) {
+        auto start = Clock::now();
+        for (int j = i; j < i + kBurst; ++j) {
+            dispatcher.Post(LOG_INFO, "KRRender", message(j));
+        }
+        async_ns += elapsed_ns(start);
+        // 按帧间的空闲节奏投递，给后台线程输出的时间
+        std::this_thread::sleep_for(std::chrono::microseconds(300));
+    }
+    dispatcher.Flush();
+    fclose(null_file);
+    printf("log cost on calling thread: sync %.1f ns, dispatcher %.1f ns per record (dropped %llu)\n",
+           sync_ns / kRecordCount, async_ns / kRecordCount,
+           static_cast<unsigned long long>(dispatcher.GetDroppedCount()));
+}
@@ -0,0 +1,367 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRPngEncoder.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <zlib.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+namespace {
+
+uint32_t GetUint32(const uint8_t *bytes) {
+    return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+           (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+}
+
+uint8_t Paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = std::abs(p - a);
+    int pb = std::abs(p - b);
+    int pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return static_cast<uint8_t>(a);
+    }
+    return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+/**
+ * 独立于编码器的 PNG 解码：校验签名、chunk 顺序与 crc，支持 8 位 RGBA 与全部 5 种行过滤
+ */
+bool DecodePNG(const std::string &png, uint32_t &width, uint32_t &height, std::vector<uint8_t> &rgba) {
+    static const uint8_t kSignature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    auto bytes = reinterpret_cast<const uint8_t *>(png.data());
+    if (png.size() < 8 || memcmp(bytes, kSignature, 8) != 0) {
+        return false;
+    }
+    std::vector<uint8_t> compressed;
+    std::vector<std::string> types;
+    size_t pos = 8;
+    while (pos + 12 <= png.size()) {
+        uint32_t length = GetUint32(bytes + pos);
+        if (pos + 12 + length > png.size()) {
+            return false;
+        }
+        std::string type(png.data() + pos + 4, 4);
+        auto crc = ::crc32(0, bytes + pos + 4, length + 4);
+        if (crc != GetUint32(bytes + pos + 8 + length)) {
+            return false;
+        }
+        const uint8_t *data = bytes + pos + 8;
+        if (type == "IHDR") {
+            if (length != 13 || data[8] != 8 || data[9] != 6 || data[10] != 0 || data[11] != 0 || data[12] != 0) {
+                return false;
+            }
+            width = GetUint32(data);
+            height = GetUint32(data + 4);
+        } else if (type == "IDAT") {
+            compressed.insert(compressed.end(), data, data + length);
+        }
+        types.push_back(type);
+        pos += 12 + length;
+    }
+    if (pos != png.size() || types.size() < 3 || types.front() != "IHDR" || types.back() != "IEND") {
+        return false;
+    }
+
+    size_t stride = static_cast<size_t>(width) * 4;
+    std::vector<uint8_t> raw((stride + 1) * height);
+    uLongf raw_size = raw.size();
+    if (uncompress(raw.data(), &raw_size, compressed.data(), compressed.size()) != Z_OK || raw_size != raw.size()) {
+        return false;
+    }
+    rgba.assign(stride * height, 0);
+    for (uint32_t y = 0; y < height; ++y) {
+        uint8_t filter = raw[y * (stride + 1)];
+        const uint8_t *in = &raw[y * (stride + 1) + 1];
+        uint8_t *out = &rgba[y * stride];
+        const uint8_t *prev = y > 0 ? &rgba[(y - 1) * stride] : nullptr;
+        for (size_t i = 0; i < stride; ++i) {
+            int a = i >= 4 ? out[i - 4] : 0;
+            int b = prev ? prev[i] : 0;
+            int c = prev && i >= 4 ? prev[i - 4] : 0;
+            switch (filter) {
+                case 0: out[i] = in[i]; break;
+                case 1: out[i] = static_cast<uint8_t>(in[i] + a); break;
+                case 2: out[i] = static_cast<uint8_t>(in[i] + b); break;
+                case 3: out[i] = static_cast<uint8_t>(in[i] + (a + b) / 2); break;
+                case 4: out[i] = static_cast<uint8_t>(in[i] + Paeth(a, b, c)); break;
+                default: return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * 非预乘 RGBA 随机像素，alpha 覆盖 0、255 与中间值
+ */
+std::vector<uint8_t> RandomRGBA(uint32_t width, uint32_t height, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+    for (size_t i = 0; i < rgba.size(); i += 4) {
+        rgba[i] = rng() % 256;
+        rgba[i + 1] = rng() % 256;
+        rgba[i + 2] = rng() % 256;
+        auto kind = rng() % 4;
+        rgba[i + 3] = kind == 0 ? 0 : (kind == 1 ? 255 : rng() % 256);
+    }
+    return rgba;
+}
+
+/**
+ * 按 KRRawImage 的描述排列像素：补齐行跨度，可选预乘与 BGRA
+ */
+KRRawImage MakeRawImage(const std::vector<uint8_t> &rgba, uint32_t width, uint32_t height, size_t padding,
+                        bool premultiplied, bool bgra) {
+    KRRawImage image;
+    image.width = width;
+    image.height = height;
+    image.row_bytes = width * 4 + padding;
+    image.premultiplied = premultiplied;
+    image.bgra = bgra;
+    image.pixels.assign(image.row_bytes * height, 0xcd);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            const uint8_t *src = &rgba[(y * width + x) * 4];
+            uint8_t *dst = &image.pixels[y * image.row_bytes + x * 4];
+            uint8_t r = src[0];
+            uint8_t g = src[1];
+            uint8_t b = src[2];
+            uint8_t a = src[3];
+            if (premultiplied) {
+                r = static_cast<uint8_t>((r * a + 127) / 255);
+                g = static_cast<uint8_t>((g * a + 127) / 255);
+                b = static_cast<uint8_t>((b * a + 127) / 255);
+            }
+            dst[0] = bgra ? b : r;
+            dst[1] = g;
+            dst[2] = bgra ? r : b;
+            dst[3] = a;
+        }
+    }
+    return image;
+}
+
+std::string TempPath(const std::string &name) {
+    return testing::TempDir() + "kr_png_encoder_" + std::to_string(getpid()) + "_" + name;
+}
+
+std::string ReadFile(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+bool FileExists(const std::string &path) {
+    return access(path.c_str(), F_OK) == 0;
+}
+
+}  // namespace
+
+TEST(KRPngEncoderTest, UnpremultipliedRGBARoundTripsAtEveryLevel) {
+    const uint32_t width = 37;
+    const uint32_t height = 23;
+    auto rgba = RandomRGBA(width, height, 1);
+    auto image = MakeRawImage(rgba, width, height, 0, false, false);
+    for (int level = 0; level <= 9; ++level) {
+        std::string png;
+        ASSERT_TRUE(KRPngEncoder::Encode(image, level, png)) << level;
+        uint32_t decoded_width = 0;
+        uint32_t decoded_height = 0;
+        std::vector<uint8_t> decoded;
+        ASSERT_TRUE(DecodePNG(png, decoded_width, decoded_height, decoded)) << level;
+        EXPECT_EQ(decoded_width, width);
+        EXPECT_EQ(decoded_height, height);
+        EXPECT_EQ(decoded, rgba) << level;
+    }
+}
+
+TEST(KRPngEncoderTest, RowPaddingAndChannelOrderAreHonored) {
+    const uint32_t width = 19;
+    const uint32_t height = 7;
+    auto rgba = RandomRGBA(width, height, 2);
+    for (bool bgra : {false, true}) {
+        auto image = MakeRawImage(rgba, width, height, 12, false, bgra);
+        std::string png;
+        ASSERT_TRUE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelDefault, png));
+        uint32_t decoded_width = 0;
+        uint32_t decoded_height = 0;
+        std::vector<uint8_t> decoded;
+        ASSERT_TRUE(DecodePNG(png, decoded_width, decoded_height, decoded));
+        EXPECT_EQ(decoded, rgba) << "bgra=" << bgra;
+    }
+}
+
+TEST(KRPngEncoderTest, PremultipliedPixelsAreRestored) {
+    const uint32_t width = 64;
+    const uint32_t height = 16;
+    auto rgba = RandomRGBA(width, height, 3);
+    auto image = MakeRawImage(rgba, width, height, 0, true, true);
+    std::string png;
+    ASSERT_TRUE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelFast, png));
+    uint32_t decoded_width = 0;
+    uint32_t decoded_height = 0;
+    std::vector<uint8_t> decoded;
+    ASSERT_TRUE(DecodePNG(png, decoded_width, decoded_height, decoded));
+    ASSERT_EQ(decoded.size(), rgba.size());
+    for (size_t i = 0; i < rgba.size(); i += 4) {
+        uint8_t a = rgba[i + 3];
+        ASSERT_EQ(decoded[i + 3], a);
+        for (int c = 0; c < 3; ++c) {
+            if (a == 0) {
+                // 全透明像素无法还原颜色，统一输出 0
+                ASSERT_EQ(decoded[i + c], 0) << i;
+            } else {
+                // 预乘损失的精度约为 255 / a
+                ASSERT_LE(std::abs(decoded[i + c] - rgba[i + c]), 255 / a + 1) << i;
+            }
+        }
+    }
+}
+
+TEST(KRPngEncoderTest, StoreLevelIsUncompressedAndFilteredLevelsAreSmaller) {
+    const uint32_t width = 256;
+    const uint32_t height = 64;
+    std::vector<uint8_t> gradient(width * height * 4);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t *p = &gradient[(y * width + x) * 4];
+            p[0] = static_cast<uint8_t>(x);
+            p[1] = static_cast<uint8_t>(y * 4);
+            p[2] = static_cast<uint8_t>(x + y);
+            p[3] = 255;
+        }
+    }
+    auto image = MakeRawImage(gradient, width, height, 0, false, false);
+    std::string stored;
+    std::string fast;
+    std::string filtered;
+    ASSERT_TRUE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelStore, stored));
+    ASSERT_TRUE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelFast, fast));
+    ASSERT_TRUE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelDefault, filtered));
+    EXPECT_GE(stored.size(), (width * 4 + 1) * height);
+    EXPECT_LT(fast.size(), stored.size());
+    // 渐变经 Sub 过滤后接近常量，压缩率明显更高
+    EXPECT_LT(filtered.size() * 4, fast.size());
+}
+
+TEST(KRPngEncoderTest, RejectsInvalidImages) {
+    std::string png = "stale";
+    KRRawImage empty;
+    EXPECT_FALSE(KRPngEncoder::Encode(empty, KRPngEncoder::kLevelFast, png));
+
+    auto image = MakeRawImage(RandomRGBA(4, 4, 4), 4, 4, 0, false, false);
+    image.row_bytes = 15;
+    EXPECT_FALSE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelFast, png));
+    image.row_bytes = 16;
+    image.pixels.resize(16 * 3 + 15);
+    EXPECT_FALSE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelFast, png));
+    // 最后一行不要求包含行尾的填充
+    image.row_bytes = 20;
+    image.pixels.resize(20 * 3 + 16);
+    EXPECT_TRUE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelFast, png));
+}
+
+TEST(KRPngEncoderTest, OutOfRangeLevelIsClamped) {
+    auto rgba = RandomRGBA(8, 8, 5);
+    auto image = MakeRawImage(rgba, 8, 8, 0, false, false);
+    std::string low;
+    std::string high;
+    ASSERT_TRUE(KRPngEncoder::Encode(image, -3, low));
+    ASSERT_TRUE(KRPngEncoder::Encode(image, 42, high));
+    std::string expected_low;
+    std::string expected_high;
+    KRPngEncoder::Encode(image, 0, expected_low);
+    KRPngEncoder::Encode(image, 9, expected_high);
+    EXPECT_EQ(low, expected_low);
+    EXPECT_EQ(high, expected_high);
+}
+
+TEST(KRPngEncoderTest, EncodeToFileWritesAtomically) {
+    auto rgba = RandomRGBA(16, 16, 6);
+    auto image = MakeRawImage(rgba, 16, 16, 0, true, false);
+    auto path = TempPath("snapshot.png");
+    std::string png;
+    ASSERT_TRUE(KRPngEncoder::EncodeToFile(image, KRPngEncoder::kLevelFast, path, png));
+    EXPECT_FALSE(png.empty());
+    EXPECT_EQ(ReadFile(path), png);
+    EXPECT_FALSE(FileExists(path + ".tmp"));
+
+    // 覆盖已有文件
+    auto other = MakeRawImage(RandomRGBA(8, 8, 7), 8, 8, 0, false, false);
+    std::string other_png;
+    ASSERT_TRUE(KRPngEncoder::EncodeToFile(other, KRPngEncoder::kLevelFast, path, other_png));
+    EXPECT_EQ(ReadFile(path), other_png);
+    unlink(path.c_str());
+}
+
+TEST(KRPngEncoderTest, EncodeToFileWithoutPathOnlyEncodes) {
+    auto image = MakeRawImage(RandomRGBA(8, 8, 8), 8, 8, 0, false, false);
+    std::string png;
+    std::string expected;
+    ASSERT_TRUE(KRPngEncoder::EncodeToFile(image, KRPngEncoder::kLevelDefault, "", png));
+    ASSERT_TRUE(KRPngEncoder::Encode(image, KRPngEncoder::kLevelDefault, expected));
+    EXPECT_EQ(png, expected);
+}
+
+TEST(KRPngEncoderTest, EncodeToFileFailureLeavesNothingBehind) {
+    auto image = MakeRawImage(RandomRGBA(8, 8, 9), 8, 8, 0, false, false);
+    auto path = TempPath("missing_dir/snapshot.png");
+    std::string png;
+    EXPECT_FALSE(KRPngEncoder::EncodeToFile(image, KRPngEncoder::kLevelFast, path, png));
+    EXPECT_TRUE(png.empty());
+    EXPECT_FALSE(FileExists(path));
+
+    KRRawImage empty;
+    auto valid_path = TempPath("empty.png");
+    EXPECT_FALSE(KRPngEncoder::EncodeToFile(empty, KRPngEncoder::kLevelFast, valid_path, png));
+    EXPECT_TRUE(png.empty());
+    EXPECT_FALSE(FileExists(valid_path));
+}
+
+TEST(KRPngEncoderBenchmark, ScreenSizedSnapshot) {
+    // 1080x2400 的页面截图：大面积纯色块、渐变与细条纹，预乘 RGBA
+    const uint32_t width = 1080;
+    const uint32_t height = 2400;
+    KRRawImage image;
+    image.width = width;
+    image.height = height;
+    image.row_bytes = width * 4;
+    image.pixels.resize(image.row_bytes * height);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t *p = &image.pixels[y * image.row_bytes + x * 4];
+            p[0] = static_cast<uint8_t>((y / 40) * 7);
+            p[1] = static_cast<uint8_t>((x / 60) * 13);
+            p[2] = ((x ^ y) & 0x10) ? 200 : 90;
+            p[3] = 255;
+        }
+    }
+    for (int level : {KRPngEncoder::kLevelStore, KRPngEncoder::kLevelFast, KRPngEncoder::kLevelDefault}) {
+        std::string png;
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(KRPngEncoder::Encode(image, level, png));
+        auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        printf("[KRPngEncoderBenchmark] %ux%u level %d: %.1f ms, %zu KB (raw %zu KB)\n", width, height, level, ms,
+               png.size() / 1024, image.pixels.size() / 1024);
+    }
+}
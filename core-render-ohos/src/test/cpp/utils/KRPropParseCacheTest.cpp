@@ -0,0 +1,433 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRPropParseCache.h"
+
+#include <gtest/gtest.h>
+#include <native_drawing/drawing_point.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "libohos_render/adapter/KRRenderAdapterManager.h"
+#include "libohos_render/utils/KRConvertUtil.h"
+#include "libohos_render/utils/KRLinearGradientParser.h"
+
+using kuikly::util::KRLinearGradientParser;
+using kuikly::util::KRParsedBorder;
+using kuikly::util::KRPropParseCache;
+using kuikly::util::KRTransformParser;
+
+// KRRenderAdapterManager 依赖 ArkTS 调用与日志，宿主机上只提供颜色适配器的注册与查询
+KRRenderAdapterManager &KRRenderAdapterManager::GetInstance() {
+    static KRRenderAdapterManager adapter_manager;
+    return adapter_manager;
+}
+
+void KRRenderAdapterManager::RegisterColorAdapter(std::shared_ptr<IKRColorParseAdapter> color_adapter) {
+    color_adapter_ = color_adapter;
+    kuikly::util::KRPropParseCache::GetInstance().SetColorAdapterRegistered(color_adapter != nullptr);
+}
+
+std::shared_ptr<IKRColorParseAdapter> KRRenderAdapterManager::GetColorAdapter() {
+    return color_adapter_;
+}
+
+// 只在绘制渐变时调用，解析缓存不会用到
+OH_Drawing_Point *OH_Drawing_PointCreate(float, float) {
+    return nullptr;
+}
+
+namespace {
+
+class FakeColorAdapter : public IKRColorParseAdapter {
+ public:
+    std::int64_t GetHexColor(const std::string &colorStr) override {
+        if (colorStr == "primary") {
+            return primary;
+        }
+        return -1;
+    }
+
+    std::int64_t primary = 0xff112233;
+};
+
+class KRPropParseCacheTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        KRRenderAdapterManager::GetInstance().RegisterColorAdapter(nullptr);
+    }
+
+    void TearDown() override {
+        KRRenderAdapterManager::GetInstance().RegisterColorAdapter(nullptr);
+    }
+
+    KRPropParseCache &cache = KRPropParseCache::GetInstance();
+};
+
+std::array<double, 16> DirectMatrix(const std::string &css_transform) {
+    KRTransformParser parser;
+    EXPECT_TRUE(parser.ParseFromCssTransform(css_transform));
+    return parser.GetMatrixWithNoRotate();
+}
+
+}  // namespace
+
+TEST_F(KRPropParseCacheTest, ParsesDecimalColorLiterals) {
+    EXPECT_EQ(cache.GetColor("4294967295"), 0xffffffffu);
+    EXPECT_EQ(cache.GetColor("4278190080"), 0xff000000u);
+    EXPECT_EQ(cache.GetColor("16711680"), 0x00ff0000u);
+    EXPECT_EQ(cache.GetColor("0"), 0u);
+    // 再次读取命中缓存，结果不变
+    EXPECT_EQ(cache.GetColor("4294967295"), 0xffffffffu);
+}
+
+TEST_F(KRPropParseCacheTest, InvalidColorParsesToZero) {
+    EXPECT_EQ(cache.GetColor(""), 0u);
+    EXPECT_EQ(cache.GetColor("red"), 0u);
+    EXPECT_EQ(cache.GetColor("red"), 0u);
+}
+
+TEST_F(KRPropParseCacheTest, ColorAdapterBypassesCache) {
+    EXPECT_EQ(cache.GetColor("primary"), 0u);
+
+    auto adapter = std::make_shared<FakeColorAdapter>();
+    KRRenderAdapterManager::GetInstance().RegisterColorAdapter(adapter);
+    EXPECT_EQ(cache.GetColor("primary"), 0xff112233u);
+    // 适配器结果随业务状态变化时立即生效
+    adapter->primary = 0xff445566;
+    EXPECT_EQ(cache.GetColor("primary"), 0xff445566u);
+    // 适配器不处理的颜色仍按原生解析
+    EXPECT_EQ(cache.GetColor("4278190080"), 0xff000000u);
+
+    auto border = cache.GetBorder("1 solid primary");
+    ASSERT_NE(border, nullptr);
+    EXPECT_EQ(border->color, 0xff445566u);
+    EXPECT_NE(cache.GetBorder("1 solid primary"), border);
+
+    auto gradient = cache.GetLinearGradient("linear-gradient(0,primary 0,4278190080 1)");
+    ASSERT_NE(gradient, nullptr);
+    EXPECT_EQ(gradient->colors[0], 0xff445566u);
+
+    // 移除适配器后不会读到适配期间的结果
+    KRRenderAdapterManager::GetInstance().RegisterColorAdapter(nullptr);
+    EXPECT_EQ(cache.GetColor("primary"), 0u);
+    EXPECT_EQ(cache.GetBorder("1 solid primary")->color, 0u);
+}
+
+TEST_F(KRPropParseCacheTest, ParsesBorder) {
+    auto border = cache.GetBorder("1.5 dashed 4278190335");
+    ASSERT_NE(border, nullptr);
+    EXPECT_FLOAT_EQ(border->width, 1.5f);
+    EXPECT_EQ(border->style, ARKUI_BORDER_STYLE_DASHED);
+    EXPECT_EQ(border->color, 0xff0000ffu);
+
+    EXPECT_EQ(cache.GetBorder("2 dotted 0")->style, ARKUI_BORDER_STYLE_DOTTED);
+    EXPECT_EQ(cache.GetBorder("2 solid 0")->style, ARKUI_BORDER_STYLE_SOLID);
+    EXPECT_EQ(cache.GetBorder("2 groove 0")->style, ARKUI_BORDER_STYLE_SOLID);
+    EXPECT_EQ(cache.GetBorder("0 solid 0")->width, 0);
+
+    auto invalid = cache.GetBorder("abc solid red");
+    ASSERT_NE(invalid, nullptr);
+    EXPECT_EQ(invalid->width, 0);
+    EXPECT_EQ(invalid->color, 0u);
+}
+
+TEST_F(KRPropParseCacheTest, MalformedBorderIsCachedAsNull) {
+    EXPECT_EQ(cache.GetBorder(""), nullptr);
+    EXPECT_EQ(cache.GetBorder("1 solid"), nullptr);
+    EXPECT_EQ(cache.GetBorder("1 solid"), nullptr);
+}
+
+TEST_F(KRPropParseCacheTest, HitReturnsSharedImmutableValue) {
+    auto border = cache.GetBorder("1 solid 4278190080");
+    EXPECT_EQ(cache.GetBorder("1 solid 4278190080"), border);
+    auto transform = cache.GetTransform("0|1 1|0 0|0.5 0.5|0 0");
+    EXPECT_EQ(cache.GetTransform("0|1 1|0 0|0.5 0.5|0 0"), transform);
+    auto gradient = cache.GetLinearGradient("linear-gradient(2,4294901760 0,4278190335 1)");
+    EXPECT_EQ(cache.GetLinearGradient("linear-gradient(2,4294901760 0,4278190335 1)"), gradient);
+}
+
+TEST_F(KRPropParseCacheTest, ParsesTransformFields) {
+    auto parsed = cache.GetTransform("30|2 0.5|0.1 -0.2|0 1|10 -20|45 60");
+    ASSERT_NE(parsed, nullptr);
+    const auto &transform = parsed->transform;
+    EXPECT_DOUBLE_EQ(transform.rotate_angle_, 30);
+    EXPECT_DOUBLE_EQ(transform.scale_x_, 2);
+    EXPECT_DOUBLE_EQ(transform.scale_y_, 0.5);
+    EXPECT_FLOAT_EQ(transform.translation_x_, 0.1f);
+    EXPECT_FLOAT_EQ(transform.translation_y_, -0.2f);
+    EXPECT_DOUBLE_EQ(transform.anchor_x_, 0);
+    EXPECT_DOUBLE_EQ(transform.anchor_y_, 1);
+    EXPECT_DOUBLE_EQ(transform.skew_x_, 10);
+    EXPECT_DOUBLE_EQ(transform.skew_y_, -20);
+    EXPECT_DOUBLE_EQ(transform.rotate_x_angle_, 45);
+    EXPECT_DOUBLE_EQ(transform.rotate_y_angle_, 60);
+
+    auto without_rotate_xy = cache.GetTransform("0|1 1|0 0|0.5 0.5|0 0");
+    ASSERT_NE(without_rotate_xy, nullptr);
+    EXPECT_DOUBLE_EQ(without_rotate_xy->transform.rotate_x_angle_, 0);
+    EXPECT_DOUBLE_EQ(without_rotate_xy->transform.rotate_y_angle_, 0);
+}
+
+TEST_F(KRPropParseCacheTest, TransformMatrixExcludesRotation) {
+    auto identity = cache.GetTransform("90|1 1|0 0|0.5 0.5|0 0");
+    ASSERT_NE(identity, nullptr);
+    const std::array<double, 16> expected_identity = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    EXPECT_EQ(identity->matrix, expected_identity);
+
+    auto scaled = cache.GetTransform("0|2 3|0.25 0.5|0.5 0.5|0 0");
+    ASSERT_NE(scaled, nullptr);
+    EXPECT_DOUBLE_EQ(scaled->matrix[0], 2);
+    EXPECT_DOUBLE_EQ(scaled->matrix[5], 3);
+    EXPECT_DOUBLE_EQ(scaled->matrix[12], 0.25);
+    EXPECT_DOUBLE_EQ(scaled->matrix[13], 0.5);
+    EXPECT_DOUBLE_EQ(scaled->matrix[15], 1);
+
+    auto skewed = cache.GetTransform("0|1 1|0 0|0.5 0.5|45 0");
+    ASSERT_NE(skewed, nullptr);
+    EXPECT_NEAR(skewed->matrix[4], -1, 1e-9);
+
+    for (const auto &css : {"15|1.2 0.8|0.1 0.3|0.5 0.5|10 5", "-45|1 1|-1 2|0 0|0 30|10 10"}) {
+        auto parsed = cache.GetTransform(css);
+        ASSERT_NE(parsed, nullptr);
+        EXPECT_EQ(parsed->matrix, DirectMatrix(css)) << css;
+    }
+}
+
+TEST_F(KRPropParseCacheTest, MalformedTransformIsCachedAsNull) {
+    EXPECT_EQ(cache.GetTransform(""), nullptr);
+    EXPECT_EQ(cache.GetTransform("0|1 1|0 0|0.5 0.5"), nullptr);
+    EXPECT_EQ(cache.GetTransform("0|1|0 0|0.5 0.5|0 0"), nullptr);
+    EXPECT_EQ(cache.GetTransform("0|1 1|0|0.5 0.5|0 0"), nullptr);
+    EXPECT_EQ(cache.GetTransform("0|1 1|0 0|0.5|0 0"), nullptr);
+    EXPECT_EQ(cache.GetTransform("0|1 1|0 0|0.5 0.5|0"), nullptr);
+}
+
+TEST_F(KRPropParseCacheTest, ParsesLinearGradient) {
+    auto gradient = cache.GetLinearGradient("linear-gradient(2,4294901760 0,4278255360 0.4,4278190335 0.8)");
+    ASSERT_NE(gradient, nullptr);
+    EXPECT_EQ(gradient->arkui_direction, 0);
+    EXPECT_EQ(gradient->colors, (std::vector<uint32_t>{0xffff0000u, 0xff00ff00u, 0xff0000ffu}));
+    ASSERT_EQ(gradient->stops.size(), 3u);
+    EXPECT_FLOAT_EQ(gradient->stops[0], 0);
+    EXPECT_FLOAT_EQ(gradient->stops[1], 0.4f);
+    // 最后一个位置固定为 1.0
+    EXPECT_FLOAT_EQ(gradient->stops[2], 1.0f);
+}
+
+TEST_F(KRPropParseCacheTest, MapsGradientDirections) {
+    const int expected[] = {1, 3, 0, 2, 4, 6, 5, 7, 8};
+    for (int direction = 0; direction < 9; direction++) {
+        auto css = "linear-gradient(" + std::to_string(direction) + ",0 0,4294967295 1)";
+        auto gradient = cache.GetLinearGradient(css);
+        ASSERT_NE(gradient, nullptr) << css;
+        EXPECT_EQ(gradient->arkui_direction, expected[direction]) << css;
+    }
+}
+
+TEST_F(KRPropParseCacheTest, GradientSkipsIncompleteStops) {
+    auto gradient = cache.GetLinearGradient("linear-gradient(0,4294901760,4278190335 0.5)");
+    ASSERT_NE(gradient, nullptr);
+    EXPECT_EQ(gradient->colors, (std::vector<uint32_t>{0xff0000ffu}));
+    EXPECT_EQ(gradient->stops, (std::vector<float>{1.0f}));
+
+    auto empty = cache.GetLinearGradient("linear-gradient(0)");
+    ASSERT_NE(empty, nullptr);
+    EXPECT_TRUE(empty->colors.empty());
+    EXPECT_TRUE(empty->stops.empty());
+}
+
+TEST_F(KRPropParseCacheTest, NonLinearGradientIsCachedAsNull) {
+    EXPECT_EQ(cache.GetLinearGradient(""), nullptr);
+    EXPECT_EQ(cache.GetLinearGradient("radial-gradient(0,0 0,4294967295 1)"), nullptr);
+    EXPECT_EQ(cache.GetLinearGradient("url(a.png)"), nullptr);
+}
+
+TEST_F(KRPropParseCacheTest, EvictsBeyondBound) {
+    auto first = cache.GetBorder("1 solid 0");
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(cache.GetBorder("1 solid 0"), first);
+    // border 缓存上限为 128 条，写满后最久未使用的条目被淘汰
+    for (int i = 0; i < 128; i++) {
+        cache.GetBorder(std::to_string(i + 2) + " solid 0");
+    }
+    auto reparsed = cache.GetBorder("1 solid 0");
+    ASSERT_NE(reparsed, nullptr);
+    EXPECT_NE(reparsed, first);
+    EXPECT_FLOAT_EQ(reparsed->width, 1);
+}
+
+TEST_F(KRPropParseCacheTest, RecentlyUsedEntrySurvivesEviction) {
+    auto kept = cache.GetBorder("1 solid 0");
+    for (int i = 0; i < 256; i++) {
+        cache.GetBorder(std::to_string(i + 2) + " solid 0");
+        EXPECT_EQ(cache.GetBorder("1 solid 0"), kept);
+    }
+}
+
+TEST_F(KRPropParseCacheTest, OverlongKeyIsNotCached) {
+    std::string css = "linear-gradient(0";
+    while (css.size() <= 512) {
+        css += ",4294967295 0.5";
+    }
+    css += ")";
+    auto first = cache.GetLinearGradient(css);
+    ASSERT_NE(first, nullptr);
+    auto second = cache.GetLinearGradient(css);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(second->colors, first->colors);
+}
+
+TEST_F(KRPropParseCacheTest, ClearDropsEntries) {
+    auto border = cache.GetBorder("1 solid 0");
+    auto transform = cache.GetTransform("0|1 1|0 0|0.5 0.5|0 0");
+    cache.Clear();
+    EXPECT_NE(cache.GetBorder("1 solid 0"), border);
+    EXPECT_NE(cache.GetTransform("0|1 1|0 0|0.5 0.5|0 0"), transform);
+    // 清空前取到的结果仍然有效
+    EXPECT_FLOAT_EQ(border->width, 1);
+}
+
+TEST_F(KRPropParseCacheTest, ConcurrentLookupsAgreeWithDirectParse) {
+    const int kKeyCount = 600;  // 超过颜色与 transform 的上限，并发读写同时触发淘汰
+    std::vector<std::string> transforms;
+    for (int i = 0; i < kKeyCount; i++) {
+        transforms.push_back(std::to_string(i % 360) + "|1 1|" + std::to_string(i) + " 0|0.5 0.5|0 0");
+    }
+    std::vector<std::thread> threads;
+    std::atomic<int> mismatches{0};
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t] {
+            for (int round = 0; round < 5; round++) {
+                for (int i = 0; i < kKeyCount; i++) {
+                    int key = (i * 7 + t * 131) % kKeyCount;
+                    if (cache.GetColor(std::to_string(key)) != static_cast<uint32_t>(key)) {
+                        mismatches++;
+                    }
+                    auto transform = cache.GetTransform(transforms[key]);
+                    if (!transform || transform->transform.translation_x_ != key) {
+                        mismatches++;
+                    }
+                    if (t == 0 && i % 100 == 0) {
+                        cache.Clear();
+                    }
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+namespace {
+
+// 首屏常见的属性字符串：少量颜色/边框/渐变反复出现，transform 随动画变化较多
+struct RealisticProps {
+    std::vector<std::string> colors;
+    std::vector<std::string> borders;
+    std::vector<std::string> transforms;
+    std::vector<std::string> gradients;
+
+    RealisticProps() {
+        const uint32_t palette[] = {0xffffffff, 0xff000000, 0xff333333, 0xff999999, 0xffeeeeee, 0xff1e90ff,
+                                    0xffff4500, 0x80000000, 0x00000000, 0xfff5f5f5, 0xff07c160, 0xffffd700};
+        for (auto color : palette) {
+            colors.push_back(std::to_string(color));
+        }
+        for (int i = 0; i < 16; i++) {
+            borders.push_back(std::to_string(0.5 * (i % 4 + 1)) + (i % 3 == 0 ? " dashed " : " solid ") +
+                              colors[i % colors.size()]);
+        }
+        for (int i = 0; i < 64; i++) {
+            transforms.push_back(std::to_string(i * 5 % 360) + "|" + std::to_string(1 + i % 8 * 0.05) + " " +
+                                 std::to_string(1 + i % 8 * 0.05) + "|0 " + std::to_string(i * 0.01) +
+                                 "|0.5 0.5|0 0");
+        }
+        for (int i = 0; i < 8; i++) {
+            gradients.push_back("linear-gradient(" + std::to_string(i) + "," + colors[i] + " 0," + colors[i + 1] +
+                                " 0.5," + colors[i + 2] + " 1)");
+        }
+    }
+};
+
+// 与接入缓存前各调用点的解析方式一致
+uint32_t DirectColor(const std::string &str) {
+    return kuikly::util::ParseHexColor(str);
+}
+
+float DirectBorder(const std::string &str) {
+    auto splits = kuikly::util::ConvertSplit(str, " ");
+    auto width = kuikly::util::ConvertToFloat(splits[0]);
+    auto style = kuikly::util::ConverToBorderStyle(splits[1]);
+    auto color = kuikly::util::ParseHexColor(splits[2]);
+    return width + style + (color & 1);
+}
+
+double DirectTransform(const std::string &str) {
+    auto parser = std::make_shared<KRTransformParser>();
+    parser->ParseFromCssTransform(str);
+    return parser->GetMatrixWithNoRotate()[0];
+}
+
+size_t DirectGradient(const std::string &str) {
+    auto parser = std::make_shared<KRLinearGradientParser>();
+    parser->ParseFromCssLinearGradient(str);
+    return parser->GetColors().size();
+}
+
+template <typename Body> double MeasureNsPerOp(int ops, Body &&body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / ops;
+}
+
+}  // namespace
+
+TEST(KRPropParseCacheBenchmark, RealisticProps) {
+    auto &cache = KRPropParseCache::GetInstance();
+    cache.Clear();
+    RealisticProps props;
+    const int kRounds = 20000;
+    volatile double sink = 0;
+
+    auto run = [&](const char *name, const std::vector<std::string> &keys, auto &&direct, auto &&cached) {
+        int ops = kRounds * 4;
+        double direct_ns = MeasureNsPerOp(ops, [&] {
+            for (int i = 0; i < ops; i++) {
+                sink = sink + direct(keys[i % keys.size()]);
+            }
+        });
+        double cached_ns = MeasureNsPerOp(ops, [&] {
+            for (int i = 0; i < ops; i++) {
+                sink = sink + cached(keys[i % keys.size()]);
+            }
+        });
+        printf("[KRPropParseCacheBenchmark] %-9s keys=%-3zu direct=%7.1f ns/op cached=%6.1f ns/op\n", name,
+               keys.size(), direct_ns, cached_ns);
+    };
+
+    run("color", props.colors, DirectColor, [&](const std::string &str) { return cache.GetColor(str); });
+    run("border", props.borders, DirectBorder, [&](const std::string &str) { return cache.GetBorder(str)->width; });
+    run("transform", props.transforms, DirectTransform,
+        [&](const std::string &str) { return cache.GetTransform(str)->matrix[0]; });
+    run("gradient", props.gradients, DirectGradient,
+        [&](const std::string &str) { return cache.GetLinearGradient(str)->colors.size(); });
+    (void)sink;
+}
@@ -0,0 +1,172 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libohos_render/utils/KRTextCodec.h"
+
+#include <gtest/gtest.h>
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 逐字节的参考实现，用于与查表/向量化实现对比
+
+const char kBase64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string ReferenceBase64Encode(const std::string &in) {
+    std::string out;
+    int value = 0;
+    int bits = -6;
+    for (unsigned char c : in) {
+        value = (value << 8) + c;
+        bits += 8;
+        while (bits >= 0) {
+            out.push_back(kBase64Chars[(value >> bits) & 0x3F]);
+            bits -= 6;
+        }
+    }
+    if (bits > -6) {
+        out.push_back(kBase64Chars[((value << 8) >> (bits + 8)) & 0x3F]);
+    }
+    while (out.size() % 4) {
+        out.push_back('=');
+    }
+    return out;
+}
+
+std::string ReferenceBase64Decode(const std::string &in) {
+    std::vector<int> table(256, -1);
+    for (int i = 0; i < 64; ++i) {
+        table[static_cast<unsigned char>(kBase64Chars[i])] = i;
+    }
+    std::string out;
+    int value = 0;
+    int bits = -8;
+    for (unsigned char c : in) {
+        if (table[c] == -1) {
+            break;
+        }
+        value = (value << 6) + table[c];
+        bits += 6;
+        if (bits >= 0) {
+            out.push_back(static_cast<char>((value >> bits) & 0xFF));
+            bits -= 8;
+        }
+    }
+    return out;
+}
+
+std::string ReferenceEncodeURIComponent(const std::string &in) {
+    static const char kHex[] = "0123456789ABCDEF";
+    std::string out;
+    for (unsigned char c : in) {
+        if ((c < 128 && isalnum(c)) || c == '-' || c == '_' || c == '.' || c == '!' || c == '~' || c == '*' ||
+            c == '\'' || c == '(' || c == ')') {
+            out.push_back(static_cast<char>(c));
+        } else {
+            out.push_back('%');
+            out.push_back(kHex[c >> 4]);
+            out.push_back(kHex[c & 0xF]);
+        }
+    }
+    return out;
+}
+
+int HexValue(char c) {
+    return isdigit(static_cast<unsigned char>(c)) ? c - '0' : toupper(static_cast<unsigned char>(c)) - 'A' + 10;
+}
+
+std::string ReferenceDecodeURIComponent(const std::string &in) {
+    std::string out;
+    for (size_t i = 0; i < in.size(); ++i) {
+        if (in[i] == '%' && i + 2 < in.size() && isxdigit(static_cast<unsigned char>(in[i + 1])) &&
+            isxdigit(static_cast<unsigned char>(in[i + 2]))) {
+            out.push_back(static_cast<char>(HexValue(in[i + 1]) << 4 | HexValue(in[i + 2])));
+            i += 2;
+        } else {
+            out.push_back(in[i]);
+        }
+    }
+    return out;
+}
+
+}  // namespace
+
+// RFC 4648 第 10 节的测试向量
+TEST(KRTextCodecTest, Base64MatchesRFC4648Vectors) {
+    const char *vectors[][2] = {{"", ""},         {"f", "Zg=="},         {"fo", "Zm8="},     {"foo", "Zm9v"},
+                                {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"}};
+    for (auto &vector : vectors) {
+        EXPECT_EQ(KRTextCodec::Base64Encode(vector[0]), vector[1]);
+        std::string decoded;
+        EXPECT_TRUE(KRTextCodec::Base64Decode(vector[1], decoded)) << vector[1];
+        EXPECT_EQ(decoded, vector[0]);
+        EXPECT_EQ(KRTextCodec::Base64EncodedLength(strlen(vector[0])), strlen(vector[1]));
+    }
+}
+
+TEST(KRTextCodecTest, Base64DecodeStopsAtInvalidCharacter) {
+    std::string decoded;
+    EXPECT_FALSE(KRTextCodec::Base64Decode("Zm9v!mFy", decoded));
+    EXPECT_EQ(decoded, "foo");
+    // 解码结果追加到已有内容之后
+    std::string out = "x";
+    EXPECT_TRUE(KRTextCodec::Base64Decode("Zm8=", out));
+    EXPECT_EQ(out, "xfo");
+}
+
+TEST(KRTextCodecTest, URIComponentMatchesJavaScript) {
+    EXPECT_EQ(KRTextCodec::EncodeURIComponent("a b&c=d/é"), "a%20b%26c%3Dd%2F%C3%A9");
+    EXPECT_EQ(KRTextCodec::EncodeURIComponent("-_.!~*'()"), "-_.!~*'()");
+    EXPECT_EQ(KRTextCodec::DecodeURIComponent("a%20b%2fc"), "a b/c");
+    // 非法的百分号序列与 '+' 原样保留
+    EXPECT_EQ(KRTextCodec::DecodeURIComponent("100%+%zz%4"), "100%+%zz%4");
+}
+
+// 随机输入与参考实现对比，长输入覆盖向量化的整块处理，短输入覆盖尾部
+TEST(KRTextCodecTest, FuzzAgainstReference) {
+    std::mt19937 rng(42);
+    const char text_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/=%-_.!~*'() \n";
+    const size_t text_char_count = sizeof(text_chars) - 1;
+    for (int iteration = 0; iteration < 20000; ++iteration) {
+        size_t size = rng() % (iteration % 50 == 0 ? 2000 : 200);
+        std::string raw(size, 0);
+        for (auto &c : raw) {
+            c = static_cast<char>(rng());
+        }
+        std::string text(size, 0);
+        for (auto &c : text) {
+            c = rng() % 8 == 0 ? static_cast<char>(rng()) : text_chars[rng() % text_char_count];
+        }
+
+        std::string encoded = KRTextCodec::Base64Encode(raw);
+        ASSERT_EQ(encoded, ReferenceBase64Encode(raw));
+        ASSERT_EQ(KRTextCodec::Base64Decode(encoded), raw);
+        // 合法编码中替换一个字符，可能落在字母表之外
+        if (!encoded.empty()) {
+            encoded[rng() % encoded.size()] = text_chars[62 + rng() % (text_char_count - 62)];
+        }
+        ASSERT_EQ(KRTextCodec::Base64Decode(encoded), ReferenceBase64Decode(encoded));
+        ASSERT_EQ(KRTextCodec::Base64Decode(text), ReferenceBase64Decode(text));
+
+        std::string uri_encoded = KRTextCodec::EncodeURIComponent(raw);
+        ASSERT_EQ(uri_encoded, ReferenceEncodeURIComponent(raw));
+        ASSERT_EQ(KRTextCodec::EncodeURIComponent(text), ReferenceEncodeURIComponent(text));
+        ASSERT_EQ(KRTextCodec::DecodeURIComponent(uri_encoded), raw);
+        ASSERT_EQ(KRTextCodec::DecodeURIComponent(text), ReferenceDecodeURIComponent(text));
+    }
+}
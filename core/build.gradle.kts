@@ -58,6 +58,13 @@ kotlin {
     // sourceSets
     val commonMain by sourceSets.getting
 
+    // Kotlin/JS 中整数与浮点数无法区分，BinaryValueCodec 的编码结果只在 jvm 上校验
+    val jvmTest by sourceSets.getting {
+        dependencies {
+            implementation(kotlin("test"))
+        }
+    }
+
     val iosMain by sourceSets.getting {
         dependsOn(commonMain)
     }
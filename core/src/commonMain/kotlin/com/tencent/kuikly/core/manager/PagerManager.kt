@@ -52,7 +52,7 @@ object PagerManager {
     fun createPager(
         pagerId: String,
         url: String,
-        pagerData: String
+        pagerData: Any?
     ) {
         val pageTrace = PageCreateTrace()
         val pagerName = pageNameFromUrl(url)
@@ -66,15 +66,15 @@ object PagerManager {
             pagerMap[pagerId] = pager
             pager.pageName = pagerName
             pager.setPageTrace(pageTrace)
-            pager.onCreatePager(pagerId, JSONObject(pagerData))
+            pager.onCreatePager(pagerId, toJSONObject(pagerData) ?: JSONObject())
         } else {
             reactiveObserverMap.remove(pagerId)
             throw PagerNotFoundException("[createPager]: pager 未注册. pagerName: $pagerName")
         }
     }
 
-    fun firePagerEvent(pagerId: String, event: String, data: String) {
-        pagerMap[pagerId]?.onReceivePagerEvent(event, JSONObject(data))
+    fun firePagerEvent(pagerId: String, event: String, data: Any?) {
+        pagerMap[pagerId]?.onReceivePagerEvent(event, toJSONObject(data) ?: JSONObject())
     }
 
     fun destroyPager(pagerId: String) {
@@ -84,12 +84,8 @@ object PagerManager {
         reactiveObserverMap.remove(pagerId)
     }
 
-    fun fireViewEvent(pagerId: String, viewRef: Int, event: String, data: String?) {
-        var dataObject: JSONObject? = null
-        data?.also {
-            dataObject = JSONObject(it)
-        }
-        pagerMap[pagerId]?.onViewEvent(viewRef, event, dataObject)
+    fun fireViewEvent(pagerId: String, viewRef: Int, event: String, data: Any?) {
+        pagerMap[pagerId]?.onViewEvent(viewRef, event, toJSONObject(data))
     }
 
     fun fireCallBack(pagerId: String, functionRef: GlobalFunctionRef, data: Any? = null) {
@@ -105,6 +101,17 @@ object PagerManager {
         pagerNameMap[pageName.lowercase()] = creator
     }
 
+    /**
+     * 端侧数据为 json 字符串，开启二进制编码的平台（如鸿蒙）直接传入解码后的 JSONObject
+     */
+    private fun toJSONObject(data: Any?): JSONObject? {
+        return when (data) {
+            is JSONObject -> data
+            is String -> JSONObject(data)
+            else -> null
+        }
+    }
+
     private fun pagerCreator(pageName: String): (() -> IPager)? {
         // need support forward compatible, so use toLowerCase
         return pagerNameMap[pageName.lowercase()]
@@ -0,0 +1,282 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.tencent.kuikly.core.nvi.serialization.binary
+
+import com.tencent.kuikly.core.nvi.serialization.json.JSONArray
+import com.tencent.kuikly.core.nvi.serialization.json.JSONObject
+
+/**
+ * 与 render 侧 KRRenderValueCodec 对应的 map/array 二进制编码，用于替代跨桥时的 json 字符串
+ * 格式：'K' 'R' 'B' version(1 byte) + value，value 为 tag(1 byte) + payload
+ *   - 整数使用 zigzag varint，float/double 使用小端定长
+ *   - string/bytes 使用 varint 长度前缀 + 原始字节(UTF-8)
+ *   - array 为 varint 元素个数 + 逐个 value，map 为 varint 键值对个数 + (string key, value)
+ * 解码时 map/array 分别还原为 JSONObject/JSONArray，与原 json 字符串的使用方式保持一致
+ */
+object BinaryValueCodec {
+
+    const val VERSION: Byte = 1
+    private const val HEADER_SIZE = 4
+    private val MAGIC = byteArrayOf(0x4B, 0x52, 0x42)  // "KRB"
+    private const val MAX_DEPTH = 64
+
+    private const val TAG_NULL = 0
+    private const val TAG_FALSE = 1
+    private const val TAG_TRUE = 2
+    private const val TAG_INT = 3
+    private const val TAG_LONG = 4
+    private const val TAG_FLOAT = 5
+    private const val TAG_DOUBLE = 6
+    private const val TAG_STRING = 7
+    private const val TAG_BYTES = 8
+    private const val TAG_ARRAY = 9
+    private const val TAG_MAP = 10
+
+    fun encode(value: Any?): ByteArray {
+        val writer = Writer()
+        MAGIC.forEach { writer.writeByte(it.toInt()) }
+        writer.writeByte(VERSION.toInt())
+        writer.writeValue(value)
+        return writer.toByteArray()
+    }
+
+    /**
+     * 数据非法时返回 null
+     */
+    fun decode(bytes: ByteArray): Any? {
+        if (bytes.size <= HEADER_SIZE || bytes[0] != MAGIC[0] || bytes[1] != MAGIC[1] ||
+            bytes[2] != MAGIC[2] || bytes[3] != VERSION
+        ) {
+            return null
+        }
+        val reader = Reader(bytes, HEADER_SIZE)
+        val value = reader.readValue(0) ?: return null
+        return if (reader.atEnd()) value.value else null
+    }
+
+    private class Writer {
+        private var buffer = ByteArray(64)
+        private var size = 0
+
+        fun toByteArray(): ByteArray = buffer.copyOf(size)
+
+        fun writeByte(value: Int) {
+            ensureCapacity(1)
+            buffer[size++] = value.toByte()
+        }
+
+        fun writeVarint(value: Long) {
+            var v = value
+            while (v and 0x7FL.inv() != 0L) {
+                writeByte(((v and 0x7F) or 0x80).toInt())
+                v = v ushr 7
+            }
+            writeByte(v.toInt())
+        }
+
+        fun writeFixed(bits: Long, byteCount: Int) {
+            ensureCapacity(byteCount)
+            for (i in 0 until byteCount) {
+                buffer[size++] = (bits ushr (i * 8)).toByte()
+            }
+        }
+
+        fun writeBytes(bytes: ByteArray) {
+            writeVarint(bytes.size.toLong())
+            ensureCapacity(bytes.size)
+            bytes.copyInto(buffer, size)
+            size += bytes.size
+        }
+
+        fun writeValue(value: Any?) {
+            when (value) {
+                null -> writeByte(TAG_NULL)
+                is Boolean -> writeByte(if (value) TAG_TRUE else TAG_FALSE)
+                is Int -> {
+                    writeByte(TAG_INT)
+                    writeVarint(zigZag(value.toLong()))
+                }
+                is Long -> {
+                    writeByte(TAG_LONG)
+                    writeVarint(zigZag(value))
+                }
+                is Float -> {
+                    writeByte(TAG_FLOAT)
+                    writeFixed(value.toRawBits().toLong(), 4)
+                }
+                is Double -> {
+                    writeByte(TAG_DOUBLE)
+                    writeFixed(value.toRawBits(), 8)
+                }
+                is String -> {
+                    writeByte(TAG_STRING)
+                    writeBytes(value.encodeToByteArray())
+                }
+                is ByteArray -> {
+                    writeByte(TAG_BYTES)
+                    writeBytes(value)
+                }
+                is JSONArray -> {
+                    writeByte(TAG_ARRAY)
+                    val length = value.length()
+                    writeVarint(length.toLong())
+                    for (i in 0 until length) {
+                        writeValue(value.opt(i))
+                    }
+                }
+                is List<*> -> {
+                    writeByte(TAG_ARRAY)
+                    writeVarint(value.size.toLong())
+                    value.forEach { writeValue(it) }
+                }
+                is Array<*> -> {
+                    writeByte(TAG_ARRAY)
+                    writeVarint(value.size.toLong())
+                    value.forEach { writeValue(it) }
+                }
+                is JSONObject -> {
+                    writeByte(TAG_MAP)
+                    writeVarint(value.length().toLong())
+                    for (key in value.keys()) {
+                        writeBytes(key.encodeToByteArray())
+                        writeValue(value.opt(key))
+                    }
+                }
+                is Map<*, *> -> {
+                    writeByte(TAG_MAP)
+                    writeVarint(value.size.toLong())
+                    for ((key, item) in value) {
+                        writeBytes(key.toString().encodeToByteArray())
+                        writeValue(item)
+                    }
+                }
+                // 其余数值类型（Short、Byte 等）按 Int 处理
+                is Number -> {
+                    writeByte(TAG_INT)
+                    writeVarint(zigZag(value.toInt().toLong()))
+                }
+                else -> writeByte(TAG_NULL)
+            }
+        }
+
+        private fun ensureCapacity(extra: Int) {
+            if (size + extra > buffer.size) {
+                buffer = buffer.copyOf(maxOf(buffer.size * 2, size + extra))
+            }
+        }
+    }
+
+    /**
+     * 解码结果的包装，用于区分合法的 null 值与解码失败
+     */
+    private class Decoded(val value: Any?)
+
+    private class Reader(private val bytes: ByteArray, private var pos: Int) {
+
+        fun atEnd(): Boolean = pos == bytes.size
+
+        fun readValue(depth: Int): Decoded? {
+            if (depth > MAX_DEPTH || pos >= bytes.size) {
+                return null
+            }
+            return when (bytes[pos++].toInt()) {
+                TAG_NULL -> Decoded(null)
+                TAG_FALSE -> Decoded(false)
+                TAG_TRUE -> Decoded(true)
+                TAG_INT -> readVarint()?.let { Decoded(unZigZag(it).toInt()) }
+                TAG_LONG -> readVarint()?.let { Decoded(unZigZag(it)) }
+                TAG_FLOAT -> readFixed(4)?.let { Decoded(Float.fromBits(it.toInt())) }
+                TAG_DOUBLE -> readFixed(8)?.let { Decoded(Double.fromBits(it)) }
+                TAG_STRING -> readBytes()?.let { Decoded(it.decodeToString()) }
+                TAG_BYTES -> readBytes()?.let { Decoded(it) }
+                TAG_ARRAY -> readArray(depth)
+                TAG_MAP -> readMap(depth)
+                else -> null
+            }
+        }
+
+        private fun readArray(depth: Int): Decoded? {
+            val count = readCount() ?: return null
+            val array = JSONArray()
+            for (i in 0 until count) {
+                val item = readValue(depth + 1) ?: return null
+                array.put(item.value)
+            }
+            return Decoded(array)
+        }
+
+        private fun readMap(depth: Int): Decoded? {
+            val count = readCount() ?: return null
+            val map = JSONObject()
+            for (i in 0 until count) {
+                val key = readBytes()?.decodeToString() ?: return null
+                val item = readValue(depth + 1) ?: return null
+                map.put(key, item.value)
+            }
+            return Decoded(map)
+        }
+
+        /**
+         * 每个元素至少占 1 字节，提前拦截非法长度
+         */
+        private fun readCount(): Int? {
+            val count = readVarint() ?: return null
+            if (count < 0 || count > bytes.size - pos) {
+                return null
+            }
+            return count.toInt()
+        }
+
+        private fun readVarint(): Long? {
+            var value = 0L
+            var shift = 0
+            while (shift < 64 && pos < bytes.size) {
+                val byte = bytes[pos++].toInt()
+                value = value or ((byte and 0x7F).toLong() shl shift)
+                if (byte and 0x80 == 0) {
+                    return value
+                }
+                shift += 7
+            }
+            return null
+        }
+
+        private fun readFixed(byteCount: Int): Long? {
+            if (bytes.size - pos < byteCount) {
+                return null
+            }
+            var bits = 0L
+            for (i in 0 until byteCount) {
+                bits = bits or ((bytes[pos++].toLong() and 0xFF) shl (i * 8))
+            }
+            return bits
+        }
+
+        private fun readBytes(): ByteArray? {
+            val length = readVarint() ?: return null
+            if (length < 0 || length > bytes.size - pos) {
+                return null
+            }
+            val result = bytes.copyOfRange(pos, pos + length.toInt())
+            pos += length.toInt()
+            return result
+        }
+    }
+
+    private fun zigZag(value: Long): Long = (value shl 1) xor (value shr 63)
+
+    private fun unZigZag(value: Long): Long = (value ushr 1) xor -(value and 1)
+}
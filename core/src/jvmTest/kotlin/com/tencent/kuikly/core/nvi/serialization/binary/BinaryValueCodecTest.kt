@@ -0,0 +1,109 @@
+/*
+ * Tencent is pleased to support the open source community by making KuiklyUI
+ * available.
+ * Copyright (C) 2025 Tencent. All rights reserved.
+ * Licensed under the License of KuiklyUI;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * https://github.com/Tencent-TDS/KuiklyUI/blob/main/LICENSE
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.tencent.kuikly.core.nvi.serialization.binary
+
+import com.tencent.kuikly.core.nvi.serialization.json.JSONArray
+import com.tencent.kuikly.core.nvi.serialization.json.JSONObject
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class BinaryValueCodecTest {
+
+    /**
+     * 与 render 侧 KRRenderValueCodecTest 共用的编码结果，两端需保持一致
+     * [null, true, -1, 300L, 1.5f, 2.25, "hé", bytes(1, 2), {"k": []}]
+     */
+    private val goldenArray = intArrayOf(
+        0x4B, 0x52, 0x42, 0x01, 0x09, 0x09, 0x00, 0x02, 0x03, 0x01, 0x04, 0xD8, 0x04, 0x05, 0x00, 0x00,
+        0xC0, 0x3F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x07, 0x03, 0x68, 0xC3, 0xA9,
+        0x08, 0x02, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x6B, 0x09, 0x00
+    ).let { ints -> ByteArray(ints.size) { ints[it].toByte() } }
+
+    private fun goldenValue(): JSONArray {
+        return JSONArray()
+            .put(null)
+            .put(true)
+            .put(-1)
+            .put(300L)
+            .put(1.5f)
+            .put(2.25)
+            .put("hé")
+            .put(byteArrayOf(1, 2))
+            .put(JSONObject().put("k", JSONArray()))
+    }
+
+    @Test
+    fun encodesGoldenVector() {
+        assertContentEquals(goldenArray, BinaryValueCodec.encode(goldenValue()))
+    }
+
+    @Test
+    fun decodesGoldenVector() {
+        val array = BinaryValueCodec.decode(goldenArray) as JSONArray
+        assertEquals(9, array.length())
+        assertNull(array.opt(0))
+        assertEquals(true, array.opt(1))
+        assertEquals(-1, array.opt(2))
+        assertEquals(300L, array.opt(3))
+        assertEquals(1.5f, array.opt(4))
+        assertEquals(2.25, array.opt(5))
+        assertEquals("hé", array.opt(6))
+        assertContentEquals(byteArrayOf(1, 2), array.opt(7) as ByteArray)
+        assertEquals(0, (array.opt(8) as JSONObject).optJSONArray("k")?.length())
+    }
+
+    @Test
+    fun roundTripsNestedMap() {
+        val origin = JSONObject()
+            .put("min", Long.MIN_VALUE)
+            .put("max", Int.MAX_VALUE)
+            .put("list", JSONArray().put("a").put(JSONObject().put("b", -0.5)))
+            .put("", "x".repeat(1000))
+        val decoded = BinaryValueCodec.decode(BinaryValueCodec.encode(origin)) as JSONObject
+        assertEquals(Long.MIN_VALUE, decoded.opt("min"))
+        assertEquals(Int.MAX_VALUE, decoded.opt("max"))
+        val list = decoded.optJSONArray("list")!!
+        assertEquals("a", list.opt(0))
+        assertEquals(-0.5, list.optJSONObject(1)?.opt("b"))
+        assertEquals(1000, decoded.optString("").length)
+    }
+
+    @Test
+    fun encodesKotlinCollections() {
+        val fromMap = BinaryValueCodec.encode(mapOf("k" to listOf<Any>()))
+        val fromJson = BinaryValueCodec.encode(JSONObject().put("k", JSONArray()))
+        assertContentEquals(fromJson, fromMap)
+    }
+
+    @Test
+    fun rejectsMalformedData() {
+        assertNull(BinaryValueCodec.decode(goldenArray.copyOf(goldenArray.size - 1)))
+        assertNull(BinaryValueCodec.decode(goldenArray + byteArrayOf(0)))
+        assertNull(BinaryValueCodec.decode(byteArrayOf(0x4B, 0x52, 0x42, 0x02, 0x00)))
+        assertNull(BinaryValueCodec.decode(byteArrayOf(0x4B, 0x52, 0x42, 0x01, 0x7F)))
+        val deep = ByteArray(4 + 200 + 1)
+        byteArrayOf(0x4B, 0x52, 0x42, 0x01).copyInto(deep)
+        for (i in 0 until 100) {
+            deep[4 + i * 2] = 0x09
+            deep[5 + i * 2] = 0x01
+        }
+        assertTrue(deep.last() == 0.toByte())
+        assertNull(BinaryValueCodec.decode(deep))
+    }
+}
@@ -24,8 +24,12 @@ import kotlinx.cinterop.memScoped
 import kotlinx.cinterop.ptr
 import kotlinx.cinterop.value
 import kotlinx.cinterop.*
+import com.tencent.kuikly.core.nvi.serialization.binary.BinaryValueCodec
+import com.tencent.kuikly.core.nvi.serialization.json.JSONArray
+import com.tencent.kuikly.core.nvi.serialization.json.JSONObject
 import ohos.KRRenderCValue
 import ohos.Type
+import ohos.com_tencent_kuikly_IsBinaryRenderValueEnabled
 import platform.ohos.OH_LOG_Print
 import platform.posix.int32_t
 
@@ -33,6 +37,13 @@ import platform.posix.int32_t
  * Created by kamlin on 2024/4/20.
  */
 
+/**
+ * render 侧开启 KREnableBinaryRenderValue 时 JSONObject/JSONArray 才按二进制编码传递，否则传 json 字符串
+ * 在首次传递时读取，render 侧需在创建页面实例前开启
+ */
+@OptIn(ExperimentalForeignApi::class)
+private val binaryRenderValueEnabled: Boolean by lazy { com_tencent_kuikly_IsBinaryRenderValueEnabled() != 0 }
+
 @OptIn(ExperimentalForeignApi::class)
 fun Any?.toKRRenderCValue(memScope: MemScope, renderCValue: KRRenderCValue): KRRenderCValue {
     when (this) {
@@ -70,6 +81,19 @@ fun Any?.toKRRenderCValue(memScope: MemScope, renderCValue: KRRenderCValue): KRR
                 renderCValue.value.bytesValue = this.usePinned { it.addressOf(0) }
             }
         }
+        is JSONObject, is JSONArray -> if (binaryRenderValueEnabled) {
+            // 按 render 侧 KRRenderValueCodec 的格式编码，避免 json 序列化
+            val bytes = BinaryValueCodec.encode(this)
+            val cBytes = memScope.allocArray<ByteVar>(bytes.size)
+            for (i in bytes.indices) {
+                cBytes[i] = bytes[i]
+            }
+            renderCValue.type = Type.ENCODED
+            renderCValue.size = bytes.size
+            renderCValue.value.bytesValue = cBytes
+        } else {
+            this.toString().toKRRenderCValue(memScope, renderCValue)
+        }
         is Array<*> -> {
             renderCValue.type = Type.ARRAY
             renderCValue.size = this.size
@@ -104,6 +128,7 @@ fun KRRenderCValue.toAny(): Any? {
         Type.DOUBLE -> value.doubleValue
         Type.STRING -> value.stringValue?.toKString()
         Type.BYTES -> toByteArray()
+        Type.ENCODED -> BinaryValueCodec.decode(toByteArray())
         Type.ARRAY -> value.arrayValue?.arrayToAny(size)
         else -> null
     }
@@ -120,7 +145,7 @@ private fun CPointer<KRRenderCValue>.arrayToAny(size: Int): Any {
 }
 
 @OptIn(ExperimentalForeignApi::class)
-private fun KRRenderCValue.toByteArray(): Any {
+private fun KRRenderCValue.toByteArray(): ByteArray {
     val size = size
     val byteArray = ByteArray(size)
     for (index in 0 until size) {
@@ -20,7 +20,8 @@
 
 typedef struct KRRenderCValue {
     // 定义一个枚举类型来表示值的类型
-    enum Type { NULL, INT, LONG, FLOAT, DOUBLE, BOOL, STRING, BYTES, ARRAY } type;
+    // ENCODED 为 BinaryValueCodec 编码的 map or array, 数据与长度的存放方式同 BYTES
+    enum Type { NULL, INT, LONG, FLOAT, DOUBLE, BOOL, STRING, BYTES, ARRAY, ENCODED } type;
 
     // 定义一个联合体来存储不同类型的值
     union Value {